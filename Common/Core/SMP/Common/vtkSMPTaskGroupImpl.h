@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef vtkSMPTaskGroupImpl_h
+#define vtkSMPTaskGroupImpl_h
+
+#include "SMP/Common/vtkSMPToolsImpl.h"
+
+#include <deque>      // For std::deque
+#include <functional> // For std::function
+#include <mutex>      // For std::mutex
+#include <utility>    // For std::move
+
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+/**
+ * Backend part of vtkSMPTaskGroup. Dependencies between tasks are handled by
+ * vtkSMPTaskGroup, backends only run tasks that are ready.
+ */
+class vtkSMPTaskGroupImplAbstract
+{
+public:
+  virtual ~vtkSMPTaskGroupImplAbstract() = default;
+
+  /**
+   * Schedule a task. Can be called from any thread, including from a running task.
+   */
+  virtual void Run(std::function<void()> task) = 0;
+
+  /**
+   * Block until every scheduled task, including the ones scheduled while waiting,
+   * is done.
+   */
+  virtual void Wait() = 0;
+};
+
+/**
+ * Default implementation: tasks are deferred and run in submission order by
+ * the thread calling Wait(). Used by the Sequential and OpenMP backends.
+ */
+template <BackendType Backend>
+class vtkSMPTaskGroupImpl : public vtkSMPTaskGroupImplAbstract
+{
+public:
+  void Run(std::function<void()> task) override
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Tasks.emplace_back(std::move(task));
+  }
+
+  void Wait() override
+  {
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    while (!this->Tasks.empty())
+    {
+      std::function<void()> task = std::move(this->Tasks.front());
+      this->Tasks.pop_front();
+      lock.unlock();
+      task();
+      lock.lock();
+    }
+  }
+
+private:
+  std::mutex Mutex;
+  std::deque<std::function<void()>> Tasks;
+};
+
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
+
+#endif
+/* VTK-HeaderTest-Exclude: vtkSMPTaskGroupImpl.h */
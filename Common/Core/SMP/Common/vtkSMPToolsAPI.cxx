@@ -233,6 +233,48 @@ bool vtkSMPToolsAPI::GetNestedParallelism()
   return false;
 }
 
+//------------------------------------------------------------------------------
+// Work stealing and thread pinning are scheduling options of the STDThread thread pool.
+// They are kept when switching backends, so that they apply when STDThread is used again.
+void vtkSMPToolsAPI::SetWorkStealing(bool workStealing)
+{
+#if VTK_SMP_ENABLE_STDTHREAD
+  SetWorkStealingSTDThread(workStealing);
+#else
+  (void)workStealing;
+#endif
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPToolsAPI::GetWorkStealing()
+{
+#if VTK_SMP_ENABLE_STDTHREAD
+  return GetWorkStealingSTDThread();
+#else
+  return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::SetThreadPinning(bool threadPinning)
+{
+#if VTK_SMP_ENABLE_STDTHREAD
+  SetThreadPinningSTDThread(threadPinning);
+#else
+  (void)threadPinning;
+#endif
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPToolsAPI::GetThreadPinning()
+{
+#if VTK_SMP_ENABLE_STDTHREAD
+  return GetThreadPinningSTDThread();
+#else
+  return false;
+#endif
+}
+
 //------------------------------------------------------------------------------
 bool vtkSMPToolsAPI::IsParallelScope()
 {
@@ -65,6 +65,18 @@ public:
   //--------------------------------------------------------------------------------
   bool GetNestedParallelism();
 
+  //--------------------------------------------------------------------------------
+  void SetWorkStealing(bool workStealing);
+
+  //--------------------------------------------------------------------------------
+  bool GetWorkStealing();
+
+  //--------------------------------------------------------------------------------
+  void SetThreadPinning(bool threadPinning);
+
+  //--------------------------------------------------------------------------------
+  bool GetThreadPinning();
+
   //--------------------------------------------------------------------------------
   bool IsParallelScope();
 
@@ -219,6 +231,78 @@ public:
     }
   }
 
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename T, typename BinaryOp, typename UnaryOp>
+  T TransformReduce(InputIt begin, InputIt end, T init, BinaryOp reduce, UnaryOp transform)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        return this->SequentialBackend->TransformReduce(begin, end, init, reduce, transform);
+      case BackendType::STDThread:
+        return this->STDThreadBackend->TransformReduce(begin, end, init, reduce, transform);
+      case BackendType::TBB:
+        return this->TBBBackend->TransformReduce(begin, end, init, reduce, transform);
+      case BackendType::OpenMP:
+        return this->OpenMPBackend->TransformReduce(begin, end, init, reduce, transform);
+    }
+    return init;
+  }
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  OutputIt InclusiveScan(InputIt begin, InputIt end, OutputIt out, BinaryOp op)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        return this->SequentialBackend->InclusiveScan(begin, end, out, op);
+      case BackendType::STDThread:
+        return this->STDThreadBackend->InclusiveScan(begin, end, out, op);
+      case BackendType::TBB:
+        return this->TBBBackend->InclusiveScan(begin, end, out, op);
+      case BackendType::OpenMP:
+        return this->OpenMPBackend->InclusiveScan(begin, end, out, op);
+    }
+    return out;
+  }
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  OutputIt ExclusiveScan(InputIt begin, InputIt end, OutputIt out, T init, BinaryOp op)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        return this->SequentialBackend->ExclusiveScan(begin, end, out, init, op);
+      case BackendType::STDThread:
+        return this->STDThreadBackend->ExclusiveScan(begin, end, out, init, op);
+      case BackendType::TBB:
+        return this->TBBBackend->ExclusiveScan(begin, end, out, init, op);
+      case BackendType::OpenMP:
+        return this->OpenMPBackend->ExclusiveScan(begin, end, out, init, op);
+    }
+    return out;
+  }
+
+  //--------------------------------------------------------------------------------
+  template <typename Iterator, typename Predicate>
+  Iterator StablePartition(Iterator begin, Iterator end, Predicate pred)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        return this->SequentialBackend->StablePartition(begin, end, pred);
+      case BackendType::STDThread:
+        return this->STDThreadBackend->StablePartition(begin, end, pred);
+      case BackendType::TBB:
+        return this->TBBBackend->StablePartition(begin, end, pred);
+      case BackendType::OpenMP:
+        return this->OpenMPBackend->StablePartition(begin, end, pred);
+    }
+    return begin;
+  }
+
   // disable copying
   vtkSMPToolsAPI(vtkSMPToolsAPI const&) = delete;
   void operator=(vtkSMPToolsAPI const&) = delete;
@@ -247,6 +331,8 @@ private:
     this->Initialize(config.MaxNumberOfThreads);
     this->SetBackend(config.Backend.c_str());
     this->SetNestedParallelism(config.NestedParallelism);
+    this->SetWorkStealing(config.WorkStealing);
+    this->SetThreadPinning(config.ThreadPinning);
     return *this;
   }
 
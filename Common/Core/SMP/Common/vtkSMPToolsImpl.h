@@ -92,6 +92,22 @@ public:
   template <typename RandomAccessIterator, typename Compare>
   void Sort(RandomAccessIterator begin, RandomAccessIterator end, Compare comp);
 
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename T, typename BinaryOp, typename UnaryOp>
+  T TransformReduce(InputIt begin, InputIt end, T init, BinaryOp reduce, UnaryOp transform);
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  OutputIt InclusiveScan(InputIt begin, InputIt end, OutputIt out, BinaryOp op);
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  OutputIt ExclusiveScan(InputIt begin, InputIt end, OutputIt out, T init, BinaryOp op);
+
+  //--------------------------------------------------------------------------------
+  template <typename Iterator, typename Predicate>
+  Iterator StablePartition(Iterator begin, Iterator end, Predicate pred);
+
   //--------------------------------------------------------------------------------
   vtkSMPToolsImpl();
 
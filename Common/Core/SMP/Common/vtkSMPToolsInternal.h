@@ -4,7 +4,13 @@
 #ifndef vtkSMPToolsInternal_h
 #define vtkSMPToolsInternal_h
 
-#include <iterator> // For std::advance
+#include <algorithm>   // For std::stable_partition
+#include <iterator>    // For std::advance
+#include <memory>      // For std::unique_ptr
+#include <new>         // For placement new
+#include <type_traits> // For std::is_reference
+#include <utility>     // For std::move
+#include <vector>      // For std::vector
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 namespace vtk
@@ -90,6 +96,301 @@ public:
   T operator()(T vtkNotUsed(inValue)) { return Value; }
 };
 
+//--------------------------------------------------------------------------------
+// The chunked algorithms below (TransformReduce, InclusiveScan, ExclusiveScan and
+// StablePartition) are shared by the backends which only expose a parallel For.
+// They split the input into a few contiguous chunks per thread, process the
+// chunks in parallel, and combine the per-chunk partial results serially. Since
+// the chunks are combined in order, the binary operations are only required to
+// be associative (not commutative). Reduced and scanned value types must be
+// default constructible, StablePartition only requires movable values.
+//
+// Ranges smaller than MinimumChunkSize per thread are processed serially: the
+// overhead of the extra pass is not worth it for small inputs.
+constexpr vtkIdType MinimumChunkSize = 1024;
+
+//--------------------------------------------------------------------------------
+template <typename Functor>
+class ChunkCall
+{
+  Functor& F;
+
+public:
+  ChunkCall(Functor& f)
+    : F(f)
+  {
+  }
+
+  void Execute(vtkIdType begin, vtkIdType end)
+  {
+    for (vtkIdType chunk = begin; chunk < end; ++chunk)
+    {
+      this->F(chunk);
+    }
+  }
+};
+
+//--------------------------------------------------------------------------------
+// Split [0, size) into contiguous chunks. Returns the number of chunks, and 0 if
+// the range should be processed serially.
+inline vtkIdType ComputeChunks(vtkIdType size, int numberOfThreads, vtkIdType& chunkSize)
+{
+  if (numberOfThreads <= 1 || size < 2 * MinimumChunkSize)
+  {
+    chunkSize = size;
+    return 0;
+  }
+  const vtkIdType maxChunks = static_cast<vtkIdType>(numberOfThreads) * 4;
+  chunkSize = (size + maxChunks - 1) / maxChunks;
+  if (chunkSize < MinimumChunkSize)
+  {
+    chunkSize = MinimumChunkSize;
+  }
+  return (size + chunkSize - 1) / chunkSize;
+}
+
+//--------------------------------------------------------------------------------
+template <typename InputIt, typename T, typename BinaryOp, typename UnaryOp>
+T SequentialTransformReduce(InputIt begin, InputIt end, T init, BinaryOp& reduce, UnaryOp& transform)
+{
+  for (; begin != end; ++begin)
+  {
+    init = reduce(init, transform(*begin));
+  }
+  return init;
+}
+
+//--------------------------------------------------------------------------------
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+OutputIt SequentialInclusiveScan(InputIt begin, InputIt end, OutputIt out, BinaryOp& op)
+{
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+  if (begin == end)
+  {
+    return out;
+  }
+  ValueType sum = *begin;
+  *out = sum;
+  for (++begin, ++out; begin != end; ++begin, ++out)
+  {
+    sum = op(sum, *begin);
+    *out = sum;
+  }
+  return out;
+}
+
+//--------------------------------------------------------------------------------
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+OutputIt SequentialExclusiveScan(InputIt begin, InputIt end, OutputIt out, T init, BinaryOp& op)
+{
+  for (; begin != end; ++begin, ++out)
+  {
+    // Read before writing so that in-place scans are supported.
+    T value = *begin;
+    *out = init;
+    init = op(init, value);
+  }
+  return out;
+}
+
+//--------------------------------------------------------------------------------
+template <typename BackendImpl, typename InputIt, typename T, typename BinaryOp,
+  typename UnaryOp>
+T ChunkedTransformReduce(
+  BackendImpl& backend, InputIt begin, InputIt end, T init, BinaryOp& reduce, UnaryOp& transform)
+{
+  const vtkIdType size = std::distance(begin, end);
+  vtkIdType chunkSize;
+  const vtkIdType numberOfChunks =
+    ComputeChunks(size, backend.GetEstimatedNumberOfThreads(), chunkSize);
+  if (numberOfChunks == 0)
+  {
+    return SequentialTransformReduce(begin, end, init, reduce, transform);
+  }
+
+  // Not a std::vector, since the chunks write concurrently into std::vector<bool>.
+  std::unique_ptr<T[]> partials(new T[numberOfChunks]);
+  auto reduceChunk = [&](vtkIdType chunk)
+  {
+    const vtkIdType first = chunk * chunkSize;
+    const vtkIdType last = (std::min)(first + chunkSize, size);
+    InputIt it(begin);
+    std::advance(it, first);
+    T sum = transform(*it);
+    ++it;
+    for (vtkIdType i = first + 1; i < last; ++i, ++it)
+    {
+      sum = reduce(sum, transform(*it));
+    }
+    partials[chunk] = sum;
+  };
+  ChunkCall<decltype(reduceChunk)> exec(reduceChunk);
+  backend.For(0, numberOfChunks, 1, exec);
+
+  for (vtkIdType chunk = 0; chunk < numberOfChunks; ++chunk)
+  {
+    init = reduce(init, partials[chunk]);
+  }
+  return init;
+}
+
+//--------------------------------------------------------------------------------
+// When HasInit is false this is an inclusive scan and init is ignored.
+template <bool HasInit, typename BackendImpl, typename InputIt, typename OutputIt, typename T,
+  typename BinaryOp>
+OutputIt ChunkedScan(
+  BackendImpl& backend, InputIt begin, InputIt end, OutputIt out, T init, BinaryOp& op)
+{
+  const vtkIdType size = std::distance(begin, end);
+  vtkIdType chunkSize;
+  const vtkIdType numberOfChunks =
+    ComputeChunks(size, backend.GetEstimatedNumberOfThreads(), chunkSize);
+  if (numberOfChunks == 0)
+  {
+    if (HasInit)
+    {
+      return SequentialExclusiveScan(begin, end, out, init, op);
+    }
+    return SequentialInclusiveScan(begin, end, out, op);
+  }
+
+  // First pass: reduce each chunk independently.
+  std::unique_ptr<T[]> carries(new T[numberOfChunks]);
+  auto reduceChunk = [&](vtkIdType chunk)
+  {
+    const vtkIdType first = chunk * chunkSize;
+    const vtkIdType last = (std::min)(first + chunkSize, size);
+    InputIt it(begin);
+    std::advance(it, first);
+    T sum = *it;
+    ++it;
+    for (vtkIdType i = first + 1; i < last; ++i, ++it)
+    {
+      sum = op(sum, *it);
+    }
+    carries[chunk] = sum;
+  };
+  ChunkCall<decltype(reduceChunk)> reduceExec(reduceChunk);
+  backend.For(0, numberOfChunks, 1, reduceExec);
+
+  // Serial scan of the partial sums: carries[c] becomes the value entering chunk c.
+  T carry = init;
+  for (vtkIdType chunk = 0; chunk < numberOfChunks; ++chunk)
+  {
+    T partial = carries[chunk];
+    carries[chunk] = carry;
+    carry = (HasInit || chunk > 0) ? op(carry, partial) : partial;
+  }
+
+  // Second pass: scan each chunk starting from its carry.
+  auto scanChunk = [&](vtkIdType chunk)
+  {
+    const vtkIdType first = chunk * chunkSize;
+    const vtkIdType last = (std::min)(first + chunkSize, size);
+    InputIt it(begin);
+    std::advance(it, first);
+    OutputIt itOut(out);
+    std::advance(itOut, first);
+    if (HasInit)
+    {
+      SequentialExclusiveScan(it, std::next(it, last - first), itOut, carries[chunk], op);
+    }
+    else if (chunk == 0)
+    {
+      SequentialInclusiveScan(it, std::next(it, last - first), itOut, op);
+    }
+    else
+    {
+      T sum = carries[chunk];
+      for (vtkIdType i = first; i < last; ++i, ++it, ++itOut)
+      {
+        sum = op(sum, *it);
+        *itOut = sum;
+      }
+    }
+  };
+  ChunkCall<decltype(scanChunk)> scanExec(scanChunk);
+  backend.For(0, numberOfChunks, 1, scanExec);
+
+  std::advance(out, size);
+  return out;
+}
+
+//--------------------------------------------------------------------------------
+template <typename BackendImpl, typename Iterator, typename Predicate>
+Iterator ChunkedStablePartition(
+  BackendImpl& backend, Iterator begin, Iterator end, Predicate& pred)
+{
+  using ValueType = typename std::iterator_traits<Iterator>::value_type;
+  using Reference = typename std::iterator_traits<Iterator>::reference;
+  const vtkIdType size = std::distance(begin, end);
+  vtkIdType chunkSize;
+  const vtkIdType numberOfChunks =
+    ComputeChunks(size, backend.GetEstimatedNumberOfThreads(), chunkSize);
+  // Proxy references, as for std::vector<bool>, may share words between the
+  // values scattered concurrently.
+  if (numberOfChunks == 0 || !std::is_reference<Reference>::value)
+  {
+    return std::stable_partition(begin, end, pred);
+  }
+
+  // First pass: evaluate the predicate once per value, move the values aside
+  // and count the selected values of each chunk. The values are moved into raw
+  // storage, neither a std::vector<bool> written concurrently nor requiring
+  // them to be default constructible.
+  std::vector<unsigned char> selected(size);
+  std::allocator<ValueType> allocator;
+  auto deallocate = [&allocator, size](ValueType* ptr) { allocator.deallocate(ptr, size); };
+  std::unique_ptr<ValueType, decltype(deallocate)> values(allocator.allocate(size), deallocate);
+  std::vector<vtkIdType> offsets(numberOfChunks);
+  auto countChunk = [&](vtkIdType chunk)
+  {
+    const vtkIdType first = chunk * chunkSize;
+    const vtkIdType last = (std::min)(first + chunkSize, size);
+    Iterator it(begin);
+    std::advance(it, first);
+    vtkIdType count = 0;
+    for (vtkIdType i = first; i < last; ++i, ++it)
+    {
+      selected[i] = pred(*it) ? 1 : 0;
+      count += selected[i];
+      new (values.get() + i) ValueType(std::move(*it));
+    }
+    offsets[chunk] = count;
+  };
+  ChunkCall<decltype(countChunk)> countExec(countChunk);
+  backend.For(0, numberOfChunks, 1, countExec);
+
+  vtkIdType numberOfSelected = 0;
+  for (vtkIdType chunk = 0; chunk < numberOfChunks; ++chunk)
+  {
+    const vtkIdType count = offsets[chunk];
+    offsets[chunk] = numberOfSelected;
+    numberOfSelected += count;
+  }
+
+  // Second pass: scatter the values back to their partitioned location.
+  auto scatterChunk = [&](vtkIdType chunk)
+  {
+    const vtkIdType first = chunk * chunkSize;
+    const vtkIdType last = (std::min)(first + chunkSize, size);
+    vtkIdType selectedPos = offsets[chunk];
+    vtkIdType rejectedPos = numberOfSelected + first - offsets[chunk];
+    for (vtkIdType i = first; i < last; ++i)
+    {
+      Iterator it(begin);
+      std::advance(it, selected[i] ? selectedPos++ : rejectedPos++);
+      *it = std::move(values.get()[i]);
+      values.get()[i].~ValueType();
+    }
+  };
+  ChunkCall<decltype(scatterChunk)> scatterExec(scatterChunk);
+  backend.For(0, numberOfChunks, 1, scatterExec);
+
+  std::advance(begin, numberOfSelected);
+  return begin;
+}
+
 VTK_ABI_NAMESPACE_END
 
 } // namespace smp
@@ -143,6 +143,43 @@ void vtkSMPToolsImpl<BackendType::OpenMP>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename BinaryOp, typename UnaryOp>
+T vtkSMPToolsImpl<BackendType::OpenMP>::TransformReduce(
+  InputIt begin, InputIt end, T init, BinaryOp reduce, UnaryOp transform)
+{
+  return ChunkedTransformReduce(*this, begin, end, init, reduce, transform);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::OpenMP>::InclusiveScan(
+  InputIt begin, InputIt end, OutputIt out, BinaryOp op)
+{
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+  return ChunkedScan<false>(*this, begin, end, out, ValueType{}, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::OpenMP>::ExclusiveScan(
+  InputIt begin, InputIt end, OutputIt out, T init, BinaryOp op)
+{
+  return ChunkedScan<true>(*this, begin, end, out, init, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename Iterator, typename Predicate>
+Iterator vtkSMPToolsImpl<BackendType::OpenMP>::StablePartition(
+  Iterator begin, Iterator end, Predicate pred)
+{
+  return ChunkedStablePartition(*this, begin, end, pred);
+}
+
 //--------------------------------------------------------------------------------
 template <>
 VTKCOMMONCORE_EXPORT void vtkSMPToolsImpl<BackendType::OpenMP>::Initialize(int);
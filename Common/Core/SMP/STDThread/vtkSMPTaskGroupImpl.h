@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// .NAME vtkSMPTaskGroupImpl - Task group implementation using vtkSMPThreadPool.
+// .SECTION Description
+// Tasks are submitted to the shared queue of the vtkSMPThreadPool singleton and run by
+// idle threads of the pool. A thread calling Wait() runs pending tasks itself while
+// tasks of the group are not done.
+
+#ifndef STDThreadvtkSMPTaskGroupImpl_h
+#define STDThreadvtkSMPTaskGroupImpl_h
+
+#include "SMP/Common/vtkSMPTaskGroupImpl.h"
+#include "vtkCommonCoreModule.h" // For export macro
+
+#include <condition_variable> // For std::condition_variable
+#include <cstddef>            // For std::size_t
+
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+template <>
+class VTKCOMMONCORE_EXPORT vtkSMPTaskGroupImpl<BackendType::STDThread>
+  : public vtkSMPTaskGroupImplAbstract
+{
+public:
+  ~vtkSMPTaskGroupImpl() override;
+
+  void Run(std::function<void()> task) override;
+
+  void Wait() override;
+
+private:
+  std::mutex Mutex;
+  std::condition_variable ConditionVariable;
+  std::size_t Outstanding = 0; // Tasks scheduled and not done yet
+  std::size_t Completed = 0;   // Incremented every time a task is done
+};
+
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
+
+#endif
+/* VTK-HeaderTest-Exclude: vtkSMPTaskGroupImpl.h */
@@ -11,6 +11,11 @@
 #include <future>
 #include <iostream>
 
+#if defined(__linux__)
+#include <pthread.h> // For pthread_setaffinity_np
+#include <sched.h>   // For sched_getaffinity
+#endif
+
 namespace vtk
 {
 namespace detail
@@ -48,6 +53,7 @@ struct vtkSMPThreadPool::ThreadData
   std::thread SystemThread;                  // the system thread, not really used
   std::mutex Mutex;                          // thread mutex, used for Jobs manipulation
   std::condition_variable ConditionVariable; // thread cv, used to wake up the thread
+  std::unique_ptr<ProxyData> TaskProxy;      // single thread proxy used to run detached tasks
 };
 
 struct vtkSMPThreadPool::ProxyThreadData
@@ -211,6 +217,11 @@ bool vtkSMPThreadPool::Proxy::IsTopLevel() const noexcept
   return this->Data->Parent == nullptr;
 }
 
+std::size_t vtkSMPThreadPool::Proxy::ThreadCount() const noexcept
+{
+  return this->Data->Threads.size();
+}
+
 vtkSMPThreadPool::vtkSMPThreadPool()
 {
   const auto threadCount = static_cast<std::size_t>(std::thread::hardware_concurrency());
@@ -223,6 +234,34 @@ vtkSMPThreadPool::vtkSMPThreadPool()
     this->Threads.emplace_back(std::move(data));
   }
 
+  this->TasksProxy.reset(new ProxyData{});
+  this->TasksProxy->Pool = this;
+  this->TasksProxy->Threads.reserve(threadCount);
+  for (auto& threadData : this->Threads)
+  {
+    this->TasksProxy->Threads.emplace_back(threadData.get(), this->GetNextThreadId());
+
+    threadData->TaskProxy.reset(new ProxyData{});
+    threadData->TaskProxy->Pool = this;
+    threadData->TaskProxy->Parent = this->TasksProxy.get();
+    threadData->TaskProxy->Threads.emplace_back(threadData.get(), this->GetNextThreadId());
+  }
+
+#if defined(__linux__)
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) == 0)
+  {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+      if (CPU_ISSET(cpu, &cpuSet))
+      {
+        this->AllowedCPUs.push_back(cpu);
+      }
+    }
+  }
+#endif
+
   this->Initialized.store(true, std::memory_order_release);
 }
 
@@ -324,6 +363,141 @@ std::size_t vtkSMPThreadPool::ThreadCount() const noexcept
   return this->Threads.size();
 }
 
+void vtkSMPThreadPool::Enqueue(std::function<void()> task)
+{
+  {
+    std::lock_guard<std::mutex> tasksLock{ this->TasksMutex };
+    this->Tasks.emplace_back(std::move(task));
+    this->PendingTasks.fetch_add(1, std::memory_order_release);
+  }
+
+  // Any idle thread can run the task. Locking the thread mutex ensures that a thread that is
+  // about to wait sees the new task or gets the notification.
+  for (auto& threadData : this->Threads)
+  {
+    std::unique_lock<std::mutex> lock{ threadData->Mutex };
+    const bool idle = threadData->Jobs.empty();
+    lock.unlock();
+
+    if (idle)
+    {
+      threadData->ConditionVariable.notify_one();
+    }
+  }
+}
+
+bool vtkSMPThreadPool::RunPendingTask()
+{
+  std::function<void()> task;
+  if (!this->PopTask(task))
+  {
+    return false;
+  }
+
+  this->RunTask(this->GetCallerThreadData(), std::move(task));
+  return true;
+}
+
+bool vtkSMPThreadPool::PopTask(std::function<void()>& task)
+{
+  if (this->PendingTasks.load(std::memory_order_acquire) == 0)
+  {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> tasksLock{ this->TasksMutex };
+  if (this->Tasks.empty())
+  {
+    return false;
+  }
+
+  task = std::move(this->Tasks.front());
+  this->Tasks.pop_front();
+  this->PendingTasks.fetch_sub(1, std::memory_order_release);
+  return true;
+}
+
+void vtkSMPThreadPool::RunTask(ThreadData* threadData, std::function<void()>&& task)
+{
+  if (threadData)
+  {
+    // Run the task as a job of the thread's task proxy, so that thread IDs and nested
+    // parallelism work as they do in regular jobs.
+    std::unique_lock<std::mutex> lock{ threadData->Mutex };
+    threadData->Jobs.emplace_back(threadData->TaskProxy.get(), std::move(task));
+    RunJob(*threadData, threadData->Jobs.size() - 1, lock);
+    return;
+  }
+
+  try
+  {
+    task();
+  }
+  catch (const std::exception& e)
+  {
+    vtkErrorWithObjectMacro(nullptr,
+      "Task has thrown an exception. The exception is ignored. what():\n" << e.what());
+  }
+  catch (...)
+  {
+    vtkErrorWithObjectMacro(nullptr, "Task has thrown an unknown exception. The exception is ignored.");
+  }
+}
+
+void vtkSMPThreadPool::SetThreadPinning(bool pin)
+{
+  if (this->ThreadPinning.load(std::memory_order_acquire) == pin)
+  {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock{ this->PinningMutex };
+  if (this->ThreadPinning.load(std::memory_order_relaxed) == pin)
+  {
+    return;
+  }
+
+#if defined(__linux__)
+  if (this->AllowedCPUs.empty())
+  {
+    return;
+  }
+
+  // Unpinned threads can run on any allowed CPU
+  cpu_set_t allowedSet;
+  CPU_ZERO(&allowedSet);
+  for (int cpu : this->AllowedCPUs)
+  {
+    CPU_SET(cpu, &allowedSet);
+  }
+
+  for (std::size_t i = 0; i < this->Threads.size(); ++i)
+  {
+    cpu_set_t cpuSet = allowedSet;
+    if (pin)
+    {
+      CPU_ZERO(&cpuSet);
+      CPU_SET(this->AllowedCPUs[i % this->AllowedCPUs.size()], &cpuSet);
+    }
+
+    if (pthread_setaffinity_np(
+          this->Threads[i]->SystemThread.native_handle(), sizeof(cpuSet), &cpuSet) != 0)
+    {
+      vtkWarningWithObjectMacro(nullptr, "Failed to set the CPU affinity of a thread of the pool.");
+    }
+  }
+
+  this->ThreadPinning.store(pin, std::memory_order_release);
+#else
+  (void)pin;
+#endif
+}
+
+bool vtkSMPThreadPool::GetThreadPinning() const noexcept
+{
+  return this->ThreadPinning.load(std::memory_order_acquire);
+}
+
 vtkSMPThreadPool::ThreadData* vtkSMPThreadPool::GetCallerThreadData() const noexcept
 {
   for (const auto& threadData : this->Threads)
@@ -361,14 +535,29 @@ std::thread vtkSMPThreadPool::MakeThread()
         // This goes out of the scope of current implementation.
         threadData.ConditionVariable.wait(lock,
           [this, &threadData]
-          { return !threadData.Jobs.empty() || this->Joining.load(std::memory_order_acquire); });
+          {
+            return !threadData.Jobs.empty() ||
+              this->PendingTasks.load(std::memory_order_acquire) != 0 ||
+              this->Joining.load(std::memory_order_acquire);
+          });
 
-        if (threadData.Jobs.empty())
+        if (!threadData.Jobs.empty())
         {
-          break; // joining
+          RunJob(threadData, threadData.Jobs.size() - 1, lock);
+          continue;
         }
 
-        RunJob(threadData, threadData.Jobs.size() - 1, lock);
+        // Jobs have priority over detached tasks
+        lock.unlock();
+        std::function<void()> task;
+        if (this->PopTask(task))
+        {
+          this->RunTask(&threadData, std::move(task));
+        }
+        else if (this->Joining.load(std::memory_order_acquire))
+        {
+          break; // joining
+        }
       }
     } };
 }
@@ -8,6 +8,8 @@
 // The DoJob() method is used attributes the job to a free thread, if all
 // threads are working, the job is kept in a queue. Note that vtkSMPThreadPool
 // destructor joins threads and finish the jobs in the queue.
+// The Enqueue() method submits detached tasks, run by any idle thread of the pool.
+// Threads of the pool can be pinned to CPU cores with SetThreadPinning().
 
 #ifndef vtkSMPThreadPool_h
 #define vtkSMPThreadPool_h
@@ -16,7 +18,9 @@
 #include "vtkSystemIncludes.h"
 
 #include <atomic>     // For std::atomic
+#include <deque>      // For std::deque
 #include <functional> // For std::function
+#include <memory>     // For std::unique_ptr
 #include <mutex>      // For std::unique_lock
 #include <thread>     // For std::thread
 #include <vector>     // For std::vector
@@ -93,6 +97,11 @@ public:
      */
     bool IsTopLevel() const noexcept;
 
+    /**
+     * @brief Get the number of threads used by this proxy
+     */
+    std::size_t ThreadCount() const noexcept;
+
   private:
     friend class vtkSMPThreadPool; // Only the thread pool can construct this object
 
@@ -153,6 +162,40 @@ public:
    */
   std::size_t ThreadCount() const noexcept;
 
+  /**
+   * @brief Submit a detached task to the pool.
+   *
+   * Unlike proxy jobs, tasks are not bound to a thread: they are stored in a queue shared by
+   * the whole pool and run, in submission order, by the first thread that becomes idle.
+   * This function can be called from any thread, including threads of the pool.
+   * Parallel functions called from a task run in the thread executing the task.
+   */
+  void Enqueue(std::function<void()> task);
+
+  /**
+   * @brief Run one pending task in the calling thread.
+   *
+   * This is used by threads waiting for tasks to complete, so that waiting never
+   * deadlocks even when all threads of the pool are waiting.
+   * @return false if there was no pending task.
+   */
+  bool RunPendingTask();
+
+  /**
+   * @brief Pin each thread of the pool to a CPU core, or let the system schedule them.
+   *
+   * When enabled, the i-th thread of the pool is bound to the i-th CPU the process is allowed
+   * to run on. Threads then keep the memory they touched first on their NUMA node, and the
+   * same thread processes the same part of a range from one parallel for to the next.
+   * Only implemented on Linux, this does nothing on other platforms.
+   */
+  void SetThreadPinning(bool pin);
+
+  /**
+   * @brief Returns true if the threads of the pool are pinned to CPU cores.
+   */
+  bool GetThreadPinning() const noexcept;
+
 private:
   // static because also used by proxy
   static void RunJob(ThreadData& data, std::size_t jobIndex, std::unique_lock<std::mutex>& lock);
@@ -160,6 +203,8 @@ private:
   ThreadData* GetCallerThreadData() const noexcept;
 
   std::thread MakeThread();
+  bool PopTask(std::function<void()>& task);
+  void RunTask(ThreadData* threadData, std::function<void()>&& task);
   void FillThreadsForNestedProxy(ProxyData* proxy, std::size_t maxCount);
   std::size_t GetNextThreadId() noexcept;
 
@@ -168,6 +213,20 @@ private:
   std::vector<std::unique_ptr<ThreadData>> Threads; // Thread pool, fixed size
   std::atomic<std::size_t> NextProxyThreadId{ 1 };
 
+  // Detached tasks, see Enqueue()
+  std::mutex TasksMutex;
+  std::deque<std::function<void()>> Tasks;
+  std::atomic<std::size_t> PendingTasks{};
+  // Proxy owning every thread of the pool, parent of the proxies used to run tasks.
+  // Parallel functions called from a task can not find a free thread and run serially, this
+  // prevents threads waiting for each others.
+  std::unique_ptr<ProxyData> TasksProxy;
+
+  // Thread pinning, see SetThreadPinning()
+  std::mutex PinningMutex;
+  std::atomic<bool> ThreadPinning{};
+  std::vector<int> AllowedCPUs; // CPUs the process is allowed to run on, set at construction
+
 public:
   static vtkSMPThreadPool& GetInstance();
 };
@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: BSD-3-Clause
 
 #include "SMP/Common/vtkSMPToolsImpl.h"
+#include "SMP/STDThread/vtkSMPTaskGroupImpl.h"
 #include "SMP/STDThread/vtkSMPToolsImpl.txx"
 
+#include <atomic>  // For std::atomic
 #include <cstdlib> // For std::getenv()
 #include <thread>  // For std::thread::hardware_concurrency()
 
@@ -22,6 +24,60 @@ int GetNumberOfThreadsSTDThread()
   return specifiedNumThreadsSTD ? specifiedNumThreadsSTD : std::thread::hardware_concurrency();
 }
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Scheduling options, initialized from VTK_SMP_WORK_STEALING and VTK_SMP_THREAD_PINNING
+struct SchedulingSettingsSTD
+{
+  std::atomic<bool> WorkStealing{ false };
+  std::atomic<bool> ThreadPinning{ false };
+
+  SchedulingSettingsSTD()
+  {
+    if (const char* workStealing = std::getenv("VTK_SMP_WORK_STEALING"))
+    {
+      this->WorkStealing = std::atoi(workStealing) != 0;
+    }
+    if (const char* threadPinning = std::getenv("VTK_SMP_THREAD_PINNING"))
+    {
+      this->ThreadPinning = std::atoi(threadPinning) != 0;
+    }
+  }
+};
+
+SchedulingSettingsSTD& GetSchedulingSettingsSTD()
+{
+  static SchedulingSettingsSTD settings;
+  return settings;
+}
+}
+
+//------------------------------------------------------------------------------
+bool GetWorkStealingSTDThread()
+{
+  return GetSchedulingSettingsSTD().WorkStealing;
+}
+
+//------------------------------------------------------------------------------
+void SetWorkStealingSTDThread(bool workStealing)
+{
+  GetSchedulingSettingsSTD().WorkStealing = workStealing;
+}
+
+//------------------------------------------------------------------------------
+bool GetThreadPinningSTDThread()
+{
+  return GetSchedulingSettingsSTD().ThreadPinning;
+}
+
+//------------------------------------------------------------------------------
+void SetThreadPinningSTDThread(bool threadPinning)
+{
+  // Applied to the thread pool by the next parallel for
+  GetSchedulingSettingsSTD().ThreadPinning = threadPinning;
+}
+
 //------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::STDThread>::Initialize(int numThreads)
@@ -74,6 +130,58 @@ bool vtkSMPToolsImpl<BackendType::STDThread>::IsParallelScope()
   return vtkSMPThreadPool::GetInstance().IsParallelScope();
 }
 
+//------------------------------------------------------------------------------
+vtkSMPTaskGroupImpl<BackendType::STDThread>::~vtkSMPTaskGroupImpl()
+{
+  this->Wait();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTaskGroupImpl<BackendType::STDThread>::Run(std::function<void()> task)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    ++this->Outstanding;
+  }
+
+  vtkSMPThreadPool::GetInstance().Enqueue(
+    [this, task = std::move(task)]()
+    {
+      task();
+
+      // Notify while holding the lock: once Outstanding reaches zero the group may be
+      // destroyed as soon as the lock is released.
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      --this->Outstanding;
+      ++this->Completed;
+      this->ConditionVariable.notify_all();
+    });
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTaskGroupImpl<BackendType::STDThread>::Wait()
+{
+  auto& pool = vtkSMPThreadPool::GetInstance();
+
+  std::unique_lock<std::mutex> lock(this->Mutex);
+  while (this->Outstanding != 0)
+  {
+    // Help instead of blocking a thread that may be needed to run the tasks.
+    lock.unlock();
+    const bool ranTask = pool.RunPendingTask();
+    lock.lock();
+
+    if (!ranTask && this->Outstanding != 0)
+    {
+      // Remaining tasks are running. Wake up when one of them is done since it may have
+      // scheduled new tasks.
+      const std::size_t completed = this->Completed;
+      this->ConditionVariable.wait(
+        lock, [this, completed] { return this->Completed != completed; });
+    }
+  }
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
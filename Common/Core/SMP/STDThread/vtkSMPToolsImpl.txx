@@ -8,9 +8,10 @@
 #include <functional> // For std::bind
 
 #include "SMP/Common/vtkSMPToolsImpl.h"
-#include "SMP/Common/vtkSMPToolsInternal.h" // For common vtk smp class
-#include "SMP/STDThread/vtkSMPThreadPool.h" // For vtkSMPThreadPool
-#include "vtkCommonCoreModule.h"            // For export macro
+#include "SMP/Common/vtkSMPToolsInternal.h"         // For common vtk smp class
+#include "SMP/STDThread/vtkSMPThreadPool.h"         // For vtkSMPThreadPool
+#include "SMP/STDThread/vtkSMPWorkStealingRanges.h" // For vtkSMPWorkStealingRanges
+#include "vtkCommonCoreModule.h"                    // For export macro
 
 namespace vtk
 {
@@ -21,6 +22,10 @@ namespace smp
 VTK_ABI_NAMESPACE_BEGIN
 
 int VTKCOMMONCORE_EXPORT GetNumberOfThreadsSTDThread();
+bool VTKCOMMONCORE_EXPORT GetWorkStealingSTDThread();
+void VTKCOMMONCORE_EXPORT SetWorkStealingSTDThread(bool workStealing);
+bool VTKCOMMONCORE_EXPORT GetThreadPinningSTDThread();
+void VTKCOMMONCORE_EXPORT SetThreadPinningSTDThread(bool threadPinning);
 
 //--------------------------------------------------------------------------------
 template <>
@@ -41,19 +46,59 @@ void vtkSMPToolsImpl<BackendType::STDThread>::For(
   else
   {
     int threadNumber = GetNumberOfThreadsSTDThread();
+    auto& pool = vtkSMPThreadPool::GetInstance();
+    pool.SetThreadPinning(GetThreadPinningSTDThread());
 
+    if (!GetWorkStealingSTDThread())
+    {
+      if (grain <= 0)
+      {
+        vtkIdType estimateGrain = (last - first) / (threadNumber * 4);
+        grain = (estimateGrain > 0) ? estimateGrain : 1;
+      }
+
+      auto proxy = pool.AllocateThreads(threadNumber);
+
+      for (vtkIdType from = first; from < last; from += grain)
+      {
+        const auto to = (std::min)(from + grain, last);
+        proxy.DoJob([&fi, from, to] { fi.Execute(from, to); });
+      }
+
+      proxy.Join();
+      return;
+    }
+
+    // Work stealing: one job per thread, each one processing chunks from its own block
+    // first, then stealing chunks from the others. Finer chunks than above are used
+    // since idle threads balance the load dynamically.
     if (grain <= 0)
     {
-      vtkIdType estimateGrain = (last - first) / (threadNumber * 4);
+      vtkIdType estimateGrain = n / (threadNumber * 16);
       grain = (estimateGrain > 0) ? estimateGrain : 1;
     }
+    if ((n - 1) / grain >= vtkSMPWorkStealingRanges::MaximumNumberOfChunks)
+    {
+      grain = (n - 1) / vtkSMPWorkStealingRanges::MaximumNumberOfChunks + 1;
+    }
+    const vtkIdType numberOfChunks = (n - 1) / grain + 1;
 
-    auto proxy = vtkSMPThreadPool::GetInstance().AllocateThreads(threadNumber);
+    auto proxy = pool.AllocateThreads(threadNumber);
+    const std::size_t numberOfWorkers = proxy.ThreadCount();
+    vtkSMPWorkStealingRanges ranges(numberOfWorkers, numberOfChunks);
 
-    for (vtkIdType from = first; from < last; from += grain)
+    for (std::size_t worker = 0; worker < numberOfWorkers; ++worker)
     {
-      const auto to = (std::min)(from + grain, last);
-      proxy.DoJob([&fi, from, to] { fi.Execute(from, to); });
+      proxy.DoJob(
+        [&fi, &ranges, worker, first, last, grain]
+        {
+          vtkIdType chunk;
+          while (ranges.Next(worker, chunk))
+          {
+            const vtkIdType from = first + chunk * grain;
+            fi.Execute(from, (std::min)(from + grain, last));
+          }
+        });
     }
 
     proxy.Join();
@@ -115,6 +160,43 @@ void vtkSMPToolsImpl<BackendType::STDThread>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename BinaryOp, typename UnaryOp>
+T vtkSMPToolsImpl<BackendType::STDThread>::TransformReduce(
+  InputIt begin, InputIt end, T init, BinaryOp reduce, UnaryOp transform)
+{
+  return ChunkedTransformReduce(*this, begin, end, init, reduce, transform);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::STDThread>::InclusiveScan(
+  InputIt begin, InputIt end, OutputIt out, BinaryOp op)
+{
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+  return ChunkedScan<false>(*this, begin, end, out, ValueType{}, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::STDThread>::ExclusiveScan(
+  InputIt begin, InputIt end, OutputIt out, T init, BinaryOp op)
+{
+  return ChunkedScan<true>(*this, begin, end, out, init, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename Iterator, typename Predicate>
+Iterator vtkSMPToolsImpl<BackendType::STDThread>::StablePartition(
+  Iterator begin, Iterator end, Predicate pred)
+{
+  return ChunkedStablePartition(*this, begin, end, pred);
+}
+
 //--------------------------------------------------------------------------------
 template <>
 VTKCOMMONCORE_EXPORT void vtkSMPToolsImpl<BackendType::STDThread>::Initialize(int);
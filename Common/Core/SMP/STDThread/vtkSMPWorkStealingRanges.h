@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// .NAME vtkSMPWorkStealingRanges - Chunk scheduler with work stealing.
+//
+// .SECTION Description
+// vtkSMPWorkStealingRanges distributes the chunks of a parallel for among workers.
+// Each worker initially owns a contiguous block of chunks, so that a given worker
+// processes the same part of a range from one loop to the next (which keeps memory
+// on the NUMA node of the thread that first touched it when threads are pinned).
+// A worker takes chunks from the front of its block, in order. When its block is
+// empty, it steals the back half of the block of another worker.
+//
+// The [front, back) bounds of a block are packed in a single 64 bits atomic, so
+// that taking or stealing chunks is a single compare and swap.
+
+#ifndef vtkSMPWorkStealingRanges_h
+#define vtkSMPWorkStealingRanges_h
+
+#include "vtkSystemIncludes.h"
+
+#include <atomic>  // For std::atomic
+#include <cstdint> // For std::uint64_t
+#include <vector>  // For std::vector
+
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+class vtkSMPWorkStealingRanges
+{
+public:
+  /**
+   * Maximum number of chunks that can be scheduled.
+   */
+  static constexpr vtkIdType MaximumNumberOfChunks = 0xFFFFFFFF;
+
+  vtkSMPWorkStealingRanges(std::size_t numberOfWorkers, vtkIdType numberOfChunks)
+    : Blocks(numberOfWorkers)
+  {
+    const auto workers = static_cast<std::uint64_t>(numberOfWorkers);
+    const auto chunks = static_cast<std::uint64_t>(numberOfChunks);
+    for (std::uint64_t worker = 0; worker < workers; ++worker)
+    {
+      this->Blocks[worker].Bounds.store(
+        Pack(worker * chunks / workers, (worker + 1) * chunks / workers), std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * Get the next chunk to be processed by a worker.
+   * Returns false when there is no chunk left to process.
+   */
+  bool Next(std::size_t worker, vtkIdType& chunk)
+  {
+    std::atomic<std::uint64_t>& own = this->Blocks[worker].Bounds;
+    std::uint64_t bounds = own.load(std::memory_order_acquire);
+    while (Front(bounds) < Back(bounds))
+    {
+      if (own.compare_exchange_weak(bounds, Pack(Front(bounds) + 1, Back(bounds))))
+      {
+        chunk = static_cast<vtkIdType>(Front(bounds));
+        return true;
+      }
+    }
+
+    // Own block is empty, nobody else will write it: steal from the others.
+    const std::size_t workers = this->Blocks.size();
+    for (std::size_t i = 1; i < workers; ++i)
+    {
+      std::atomic<std::uint64_t>& victim = this->Blocks[(worker + i) % workers].Bounds;
+      bounds = victim.load(std::memory_order_acquire);
+      while (Front(bounds) < Back(bounds))
+      {
+        const std::uint64_t count = (Back(bounds) - Front(bounds) + 1) / 2;
+        const std::uint64_t newBack = Back(bounds) - count;
+        if (victim.compare_exchange_weak(bounds, Pack(Front(bounds), newBack)))
+        {
+          // Process the first stolen chunk now, keep the others in our block.
+          chunk = static_cast<vtkIdType>(newBack);
+          if (count > 1)
+          {
+            own.store(Pack(newBack + 1, newBack + count), std::memory_order_release);
+          }
+          return true;
+        }
+      }
+    }
+
+    return false;
+  }
+
+private:
+  static std::uint64_t Pack(std::uint64_t front, std::uint64_t back) { return (front << 32) | back; }
+  static std::uint64_t Front(std::uint64_t bounds) { return bounds >> 32; }
+  static std::uint64_t Back(std::uint64_t bounds) { return bounds & 0xFFFFFFFF; }
+
+  // One cache line per block to avoid false sharing between workers
+  struct alignas(64) Block
+  {
+    std::atomic<std::uint64_t> Bounds{ 0 };
+  };
+  std::vector<Block> Blocks;
+};
+
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
+
+#endif
+/* VTK-HeaderTest-Exclude: vtkSMPWorkStealingRanges.h */
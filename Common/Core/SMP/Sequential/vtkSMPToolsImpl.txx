@@ -4,7 +4,7 @@
 #ifndef SequentialvtkSMPToolsImpl_txx
 #define SequentialvtkSMPToolsImpl_txx
 
-#include <algorithm> // For std::sort, std::transform, std::fill
+#include <algorithm> // For std::sort, std::transform, std::fill, std::stable_partition
 
 #include "SMP/Common/vtkSMPToolsImpl.h"
 #include "SMP/Common/vtkSMPToolsInternal.h" // For common vtk smp class
@@ -93,6 +93,42 @@ void vtkSMPToolsImpl<BackendType::Sequential>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename BinaryOp, typename UnaryOp>
+T vtkSMPToolsImpl<BackendType::Sequential>::TransformReduce(
+  InputIt begin, InputIt end, T init, BinaryOp reduce, UnaryOp transform)
+{
+  return SequentialTransformReduce(begin, end, init, reduce, transform);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::Sequential>::InclusiveScan(
+  InputIt begin, InputIt end, OutputIt out, BinaryOp op)
+{
+  return SequentialInclusiveScan(begin, end, out, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::Sequential>::ExclusiveScan(
+  InputIt begin, InputIt end, OutputIt out, T init, BinaryOp op)
+{
+  return SequentialExclusiveScan(begin, end, out, init, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename Iterator, typename Predicate>
+Iterator vtkSMPToolsImpl<BackendType::Sequential>::StablePartition(
+  Iterator begin, Iterator end, Predicate pred)
+{
+  return std::stable_partition(begin, end, pred);
+}
+
 //--------------------------------------------------------------------------------
 template <>
 VTKCOMMONCORE_EXPORT void vtkSMPToolsImpl<BackendType::Sequential>::Initialize(int);
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// .NAME vtkSMPTaskGroupImpl - Task group implementation using tbb::task_group.
+// .SECTION Description
+// Tasks are run in the task arena configured by vtkSMPTools::Initialize().
+
+#ifndef TBBvtkSMPTaskGroupImpl_h
+#define TBBvtkSMPTaskGroupImpl_h
+
+#include "SMP/Common/vtkSMPTaskGroupImpl.h"
+#include "vtkCommonCoreModule.h" // For export macro
+
+#ifdef _MSC_VER
+#pragma push_macro("__TBB_NO_IMPLICIT_LINKAGE")
+#define __TBB_NO_IMPLICIT_LINKAGE 1
+#endif
+
+#include <tbb/task_group.h> // For tbb::task_group
+
+#ifdef _MSC_VER
+#pragma pop_macro("__TBB_NO_IMPLICIT_LINKAGE")
+#endif
+
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+template <>
+class VTKCOMMONCORE_EXPORT vtkSMPTaskGroupImpl<BackendType::TBB>
+  : public vtkSMPTaskGroupImplAbstract
+{
+public:
+  void Run(std::function<void()> task) override;
+
+  void Wait() override;
+
+private:
+  tbb::task_group Group;
+};
+
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
+
+#endif
+/* VTK-HeaderTest-Exclude: vtkSMPTaskGroupImpl.h */
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 
 #include "SMP/Common/vtkSMPToolsImpl.h"
+#include "SMP/TBB/vtkSMPTaskGroupImpl.h"
 #include "SMP/TBB/vtkSMPToolsImpl.txx"
 
 #include <cstdlib> // For std::getenv()
@@ -150,6 +151,32 @@ void vtkSMPToolsImplForTBB(vtkIdType first, vtkIdType last, vtkIdType grain,
   threadIdStackLock->unlock();
 }
 
+//------------------------------------------------------------------------------
+void vtkSMPTaskGroupImpl<BackendType::TBB>::Run(std::function<void()> task)
+{
+  if (taskArena->is_active())
+  {
+    taskArena->execute([&] { this->Group.run(std::move(task)); });
+  }
+  else
+  {
+    this->Group.run(std::move(task));
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTaskGroupImpl<BackendType::TBB>::Wait()
+{
+  if (taskArena->is_active())
+  {
+    taskArena->execute([&] { this->Group.wait(); });
+  }
+  else
+  {
+    this->Group.wait();
+  }
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
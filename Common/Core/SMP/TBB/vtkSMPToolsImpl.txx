@@ -15,6 +15,8 @@
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_scan.h>
 #include <tbb/parallel_sort.h>
 
 #ifdef _MSC_VER
@@ -108,6 +110,149 @@ void ExecuteFunctorTBB(void* functor, vtkIdType first, vtkIdType last, vtkIdType
   }
 }
 
+//--------------------------------------------------------------------------------
+// Body of tbb::parallel_reduce. Sub-bodies split from another one start empty
+// instead of from an identity value, so that the reduction operator does not
+// need one.
+template <typename InputIt, typename T, typename BinaryOp, typename UnaryOp>
+class TransformReduceBodyTBB
+{
+  InputIt Begin;
+  BinaryOp& Reduce;
+  UnaryOp& Transform;
+
+public:
+  T Sum{};
+  bool HasValue = false;
+
+  TransformReduceBodyTBB(InputIt begin, BinaryOp& reduce, UnaryOp& transform)
+    : Begin(begin)
+    , Reduce(reduce)
+    , Transform(transform)
+  {
+  }
+
+  TransformReduceBodyTBB(TransformReduceBodyTBB& other, tbb::split)
+    : Begin(other.Begin)
+    , Reduce(other.Reduce)
+    , Transform(other.Transform)
+  {
+  }
+
+  void operator()(const tbb::blocked_range<vtkIdType>& r)
+  {
+    InputIt it(this->Begin);
+    std::advance(it, r.begin());
+    for (vtkIdType i = r.begin(); i < r.end(); ++i, ++it)
+    {
+      if (this->HasValue)
+      {
+        this->Sum = this->Reduce(this->Sum, this->Transform(*it));
+      }
+      else
+      {
+        this->Sum = this->Transform(*it);
+        this->HasValue = true;
+      }
+    }
+  }
+
+  void join(TransformReduceBodyTBB& rhs)
+  {
+    if (!rhs.HasValue)
+    {
+      return;
+    }
+    this->Sum = this->HasValue ? this->Reduce(this->Sum, rhs.Sum) : rhs.Sum;
+    this->HasValue = true;
+  }
+
+  // Entry point matching ExecuteFunctorPtrType so that the reduction runs in the
+  // task arena configured by vtkSMPToolsImpl<BackendType::TBB>::Initialize().
+  static void Execute(void* body, vtkIdType first, vtkIdType last, vtkIdType vtkNotUsed(grain))
+  {
+    tbb::parallel_reduce(tbb::blocked_range<vtkIdType>(first, last),
+      *reinterpret_cast<TransformReduceBodyTBB*>(body));
+  }
+};
+
+//--------------------------------------------------------------------------------
+// Body of tbb::parallel_scan. Sum holds the reduction of all the values on the
+// left of the current range (if any). When HasInit is true the scan is
+// exclusive and Init is prepended to the sequence.
+template <bool HasInit, typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+class ScanBodyTBB
+{
+  InputIt In;
+  OutputIt Out;
+  T Init;
+  BinaryOp& Op;
+  T Sum{};
+  bool HasValue = false;
+
+public:
+  ScanBodyTBB(InputIt in, OutputIt out, T init, BinaryOp& op)
+    : In(in)
+    , Out(out)
+    , Init(init)
+    , Op(op)
+  {
+  }
+
+  ScanBodyTBB(ScanBodyTBB& other, tbb::split)
+    : In(other.In)
+    , Out(other.Out)
+    , Init(other.Init)
+    , Op(other.Op)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<vtkIdType>& r, Tag)
+  {
+    InputIt it(this->In);
+    std::advance(it, r.begin());
+    OutputIt itOut(this->Out);
+    std::advance(itOut, r.begin());
+    for (vtkIdType i = r.begin(); i < r.end(); ++i, ++it, ++itOut)
+    {
+      // Read before writing so that in-place scans are supported.
+      T value = *it;
+      if (HasInit && Tag::is_final_scan())
+      {
+        *itOut = this->HasValue ? this->Op(this->Init, this->Sum) : this->Init;
+      }
+      this->Sum = this->HasValue ? this->Op(this->Sum, value) : value;
+      this->HasValue = true;
+      if (!HasInit && Tag::is_final_scan())
+      {
+        *itOut = this->Sum;
+      }
+    }
+  }
+
+  void reverse_join(ScanBodyTBB& left)
+  {
+    if (left.HasValue)
+    {
+      this->Sum = this->HasValue ? this->Op(left.Sum, this->Sum) : left.Sum;
+      this->HasValue = true;
+    }
+  }
+
+  void assign(ScanBodyTBB& other)
+  {
+    this->Sum = other.Sum;
+    this->HasValue = other.HasValue;
+  }
+
+  static void Execute(void* body, vtkIdType first, vtkIdType last, vtkIdType vtkNotUsed(grain))
+  {
+    tbb::parallel_scan(
+      tbb::blocked_range<vtkIdType>(first, last), *reinterpret_cast<ScanBodyTBB*>(body));
+  }
+};
+
 //--------------------------------------------------------------------------------
 template <>
 template <typename FunctorInternal>
@@ -194,6 +339,82 @@ void vtkSMPToolsImpl<BackendType::TBB>::Sort(
   tbb::parallel_sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename BinaryOp, typename UnaryOp>
+T vtkSMPToolsImpl<BackendType::TBB>::TransformReduce(
+  InputIt begin, InputIt end, T init, BinaryOp reduce, UnaryOp transform)
+{
+  const vtkIdType size = std::distance(begin, end);
+  if (size < MinimumChunkSize || (!this->NestedActivated && this->IsParallel))
+  {
+    return SequentialTransformReduce(begin, end, init, reduce, transform);
+  }
+
+  TransformReduceBodyTBB<InputIt, T, BinaryOp, UnaryOp> body(begin, reduce, transform);
+  bool fromParallelCode = this->IsParallel.exchange(true);
+  vtkSMPToolsImplForTBB(0, size, 0, decltype(body)::Execute, &body);
+  bool trueFlag = true;
+  this->IsParallel.compare_exchange_weak(trueFlag, fromParallelCode);
+
+  return body.HasValue ? reduce(init, body.Sum) : init;
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::TBB>::InclusiveScan(
+  InputIt begin, InputIt end, OutputIt out, BinaryOp op)
+{
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+  const vtkIdType size = std::distance(begin, end);
+  if (size < MinimumChunkSize || (!this->NestedActivated && this->IsParallel))
+  {
+    return SequentialInclusiveScan(begin, end, out, op);
+  }
+
+  ScanBodyTBB<false, InputIt, OutputIt, ValueType, BinaryOp> body(begin, out, ValueType{}, op);
+  bool fromParallelCode = this->IsParallel.exchange(true);
+  vtkSMPToolsImplForTBB(0, size, 0, decltype(body)::Execute, &body);
+  bool trueFlag = true;
+  this->IsParallel.compare_exchange_weak(trueFlag, fromParallelCode);
+
+  std::advance(out, size);
+  return out;
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::TBB>::ExclusiveScan(
+  InputIt begin, InputIt end, OutputIt out, T init, BinaryOp op)
+{
+  const vtkIdType size = std::distance(begin, end);
+  if (size < MinimumChunkSize || (!this->NestedActivated && this->IsParallel))
+  {
+    return SequentialExclusiveScan(begin, end, out, init, op);
+  }
+
+  ScanBodyTBB<true, InputIt, OutputIt, T, BinaryOp> body(begin, out, init, op);
+  bool fromParallelCode = this->IsParallel.exchange(true);
+  vtkSMPToolsImplForTBB(0, size, 0, decltype(body)::Execute, &body);
+  bool trueFlag = true;
+  this->IsParallel.compare_exchange_weak(trueFlag, fromParallelCode);
+
+  std::advance(out, size);
+  return out;
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename Iterator, typename Predicate>
+Iterator vtkSMPToolsImpl<BackendType::TBB>::StablePartition(
+  Iterator begin, Iterator end, Predicate pred)
+{
+  // TBB has no partition algorithm, use the two-pass chunked one on top of For().
+  return ChunkedStablePartition(*this, begin, end, pred);
+}
+
 //--------------------------------------------------------------------------------
 template <>
 VTKCOMMONCORE_EXPORT void vtkSMPToolsImpl<BackendType::TBB>::Initialize(int);
@@ -0,0 +1,221 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompressedArray.h"
+
+#include "vtkCompressedDoubleArray.h"
+#include "vtkDataArrayRange.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+template <typename ValueType>
+bool CheckValues(vtkCompressedArray<ValueType>* compressed, vtkDataArray* base)
+{
+  const int nComps = base->GetNumberOfComponents();
+  std::vector<ValueType> tuple(nComps);
+  for (vtkIdType tupleIdx = 0; tupleIdx < base->GetNumberOfTuples(); ++tupleIdx)
+  {
+    compressed->GetTypedTuple(tupleIdx, tuple.data());
+    for (int comp = 0; comp < nComps; ++comp)
+    {
+      const ValueType expected = static_cast<ValueType>(base->GetComponent(tupleIdx, comp));
+      if (compressed->GetTypedComponent(tupleIdx, comp) != expected || tuple[comp] != expected)
+      {
+        std::cerr << "Wrong value at tuple " << tupleIdx << " component " << comp << ": "
+                  << compressed->GetTypedComponent(tupleIdx, comp) << " != " << expected
+                  << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+vtkSmartPointer<vtkCompressedArray<ValueType>> Compress(
+  vtkDataArray* base, vtkIdType blockSize, int cacheSize)
+{
+  auto compressed = vtkSmartPointer<vtkCompressedArray<ValueType>>::New();
+  compressed->ConstructBackend(base, blockSize, cacheSize);
+  compressed->SetNumberOfComponents(base->GetNumberOfComponents());
+  compressed->SetNumberOfTuples(base->GetNumberOfTuples());
+  return compressed;
+}
+
+//------------------------------------------------------------------------------
+bool TestSmoothField()
+{
+  // A smooth 3 components field, which should compress well.
+  vtkNew<vtkDoubleArray> base;
+  base->SetNumberOfComponents(3);
+  base->SetNumberOfTuples(200000);
+  for (vtkIdType i = 0; i < base->GetNumberOfTuples(); ++i)
+  {
+    base->SetTuple3(i, std::sin(i * 1e-4), 1.0, std::floor(i / 1000.0));
+  }
+
+  auto compressed = Compress<double>(base, 65536, 2);
+  auto backend = compressed->GetBackend();
+  if (backend->GetBlockSize() != 65535 || backend->GetNumberOfBlocks() != 10)
+  {
+    std::cerr << "Wrong blocks: " << backend->GetBlockSize() << " values, "
+              << backend->GetNumberOfBlocks() << " blocks" << std::endl;
+    return false;
+  }
+  std::cout << "Smooth field compressed from " << backend->GetUncompressedSize() << " to "
+            << backend->GetCompressedSize() << " bytes" << std::endl;
+  if (backend->GetCompressedSize() * 2 > backend->GetUncompressedSize())
+  {
+    std::cerr << "Smooth field did not compress" << std::endl;
+    return false;
+  }
+  if (!CheckValues(compressed.Get(), base))
+  {
+    return false;
+  }
+  // Sequential accesses decompress each block once.
+  if (backend->GetNumberOfDecompressions() != backend->GetNumberOfBlocks())
+  {
+    std::cerr << "Unexpected number of decompressions: " << backend->GetNumberOfDecompressions()
+              << std::endl;
+    return false;
+  }
+  // Only the most recently used blocks are kept.
+  compressed->GetValue(0);
+  compressed->GetValue(65535 * 9);
+  compressed->GetValue(65535);
+  if (backend->GetNumberOfDecompressions() != backend->GetNumberOfBlocks() + 2)
+  {
+    std::cerr << "The cache did not keep the most recently used blocks" << std::endl;
+    return false;
+  }
+  backend->SetCacheSize(1);
+  if (compressed->GetActualMemorySize() >=
+    static_cast<unsigned long>(backend->GetUncompressedSize() / 1024))
+  {
+    std::cerr << "Memory size is not reduced" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool TestIds()
+{
+  vtkNew<vtkIdTypeArray> base;
+  base->SetNumberOfValues(100003);
+  auto range = vtk::DataArrayValueRange<1>(base);
+  std::iota(range.begin(), range.end(), 1000000);
+
+  auto compressed = Compress<vtkIdType>(base, 4096, 4);
+  auto backend = compressed->GetBackend();
+  if (backend->GetCompressedSize() * 2 > backend->GetUncompressedSize())
+  {
+    std::cerr << "Ids did not compress" << std::endl;
+    return false;
+  }
+  // Access values concurrently in random order.
+  std::atomic<bool> valid{ true };
+  vtkSMPTools::For(0, base->GetNumberOfValues(),
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      std::mt19937 generator(static_cast<unsigned int>(begin));
+      std::uniform_int_distribution<vtkIdType> dist(0, base->GetNumberOfValues() - 1);
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const vtkIdType idx = dist(generator);
+        if (compressed->GetValue(idx) != base->GetValue(idx))
+        {
+          valid = false;
+        }
+      }
+    });
+  if (!valid)
+  {
+    std::cerr << "Wrong id values with concurrent accesses" << std::endl;
+    return false;
+  }
+  return CheckValues(compressed.Get(), base);
+}
+
+//------------------------------------------------------------------------------
+bool TestNoise()
+{
+  // Random values do not compress and are stored as is.
+  vtkNew<vtkFloatArray> base;
+  base->SetNumberOfComponents(2);
+  base->SetNumberOfTuples(10000);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  for (auto& value : vtk::DataArrayValueRange<2>(base))
+  {
+    value = dist(generator);
+  }
+  // Special values are preserved too.
+  base->SetComponent(5, 0, std::nanf(""));
+  base->SetComponent(5, 1, -0.f);
+
+  auto compressed = Compress<float>(base, 1000, 1);
+  auto backend = compressed->GetBackend();
+  if (backend->GetCompressedSize() != backend->GetUncompressedSize() + 20)
+  {
+    std::cerr << "Noise should be stored as is, got " << backend->GetCompressedSize()
+              << " bytes" << std::endl;
+    return false;
+  }
+  if (!std::isnan(compressed->GetTypedComponent(5, 0)) ||
+    !std::signbit(compressed->GetTypedComponent(5, 1)))
+  {
+    std::cerr << "Special values were not preserved" << std::endl;
+    return false;
+  }
+  base->SetComponent(5, 0, 0.f);
+  compressed = Compress<float>(base, 1000, 1);
+  return CheckValues(compressed.Get(), base);
+}
+
+//------------------------------------------------------------------------------
+bool TestTypedArray()
+{
+  vtkNew<vtkDoubleArray> base;
+  base->SetNumberOfValues(1000);
+  auto range = vtk::DataArrayValueRange<1>(base);
+  std::iota(range.begin(), range.end(), 0.5);
+
+  vtkNew<vtkCompressedDoubleArray> compressed;
+  compressed->ConstructBackend(base);
+  compressed->SetNumberOfTuples(1000);
+  double valueRange[2];
+  compressed->GetRange(valueRange);
+  if (valueRange[0] != 0.5 || valueRange[1] != 999.5)
+  {
+    std::cerr << "Wrong range for vtkCompressedDoubleArray" << std::endl;
+    return false;
+  }
+  return CheckValues<double>(compressed, base);
+}
+}
+
+//------------------------------------------------------------------------------
+int TestCompressedArray(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  if (!TestSmoothField() || !TestIds() || !TestNoise() || !TestTypedArray())
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Test vtkAOSDataArrayTemplate::MapFile and vtkSOADataArrayTemplate::MapFile:
+// arrays backed by a region of a file, in read-only and copy-on-write modes.
+
+#include "vtkFloatArray.h"
+#include "vtkNew.h"
+#include "vtkSOADataArrayTemplate.h"
+
+#include "vtksys/FStream.hxx"
+#include "vtksys/SystemTools.hxx"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+constexpr vtkIdType NumberOfTuples = 100000;
+constexpr vtkTypeInt64 HeaderSize = 64; // Bytes before the values, as in raw appended files
+
+#define CHECK(cond)                                                                                \
+  do                                                                                               \
+  {                                                                                                \
+    if (!(cond))                                                                                   \
+    {                                                                                              \
+      std::cerr << "Check failed line " << __LINE__ << ": " #cond << std::endl;                    \
+      return false;                                                                                \
+    }                                                                                              \
+  } while (false)
+
+//------------------------------------------------------------------------------
+float Value(vtkIdType valueIdx)
+{
+  return static_cast<float>(valueIdx) * 0.5f;
+}
+
+//------------------------------------------------------------------------------
+bool WriteFile(const std::string& fileName)
+{
+  std::vector<float> values(3 * NumberOfTuples);
+  for (vtkIdType i = 0; i < 3 * NumberOfTuples; ++i)
+  {
+    values[i] = Value(i);
+  }
+
+  vtksys::ofstream file(fileName.c_str(), std::ios::out | std::ios::binary);
+  const std::vector<char> header(HeaderSize, 'h');
+  file.write(header.data(), header.size());
+  file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float));
+  return file.good();
+}
+
+//------------------------------------------------------------------------------
+bool TestReadOnly(const std::string& fileName)
+{
+  vtkNew<vtkFloatArray> array;
+  array->SetNumberOfComponents(3);
+  CHECK(array->MapFile(fileName.c_str(), HeaderSize, 3 * NumberOfTuples));
+  CHECK(array->IsFileMapped());
+  CHECK(array->GetNumberOfTuples() == NumberOfTuples);
+  for (vtkIdType i = 0; i < 3 * NumberOfTuples; i += 997)
+  {
+    CHECK(array->GetValue(i) == Value(i));
+  }
+  double range[2];
+  array->GetRange(range, 1);
+  CHECK(range[0] == Value(1) && range[1] == Value(3 * NumberOfTuples - 2));
+
+  // Resizing copies the values in memory, then the array can be modified.
+  array->InsertNextTuple3(1, 2, 3);
+  CHECK(!array->IsFileMapped());
+  CHECK(array->GetNumberOfTuples() == NumberOfTuples + 1);
+  CHECK(array->GetValue(3 * NumberOfTuples - 1) == Value(3 * NumberOfTuples - 1));
+  array->SetValue(0, -1.0f);
+  CHECK(array->GetValue(0) == -1.0f);
+
+  // Shallow copies share the mapping, which outlives the original array.
+  vtkNew<vtkFloatArray> copy;
+  {
+    vtkNew<vtkFloatArray> source;
+    source->SetNumberOfComponents(3);
+    CHECK(source->MapFile(fileName.c_str(), HeaderSize, 3 * NumberOfTuples));
+    copy->ShallowCopy(source);
+  }
+  CHECK(copy->IsFileMapped());
+  CHECK(copy->GetValue(42) == Value(42));
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool TestCopyOnWrite(const std::string& fileName)
+{
+  vtkNew<vtkFloatArray> array;
+  CHECK(array->MapFile(fileName.c_str(), HeaderSize, 3 * NumberOfTuples, true));
+  array->SetValue(10, -1.0f);
+  CHECK(array->GetValue(10) == -1.0f);
+
+  // The file is not modified
+  vtkNew<vtkFloatArray> other;
+  CHECK(other->MapFile(fileName.c_str(), HeaderSize, 3 * NumberOfTuples));
+  CHECK(other->GetValue(10) == Value(10));
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool TestSOA(const std::string& fileName)
+{
+  // Each component is a contiguous block of the file
+  vtkNew<vtkSOADataArrayTemplate<float>> array;
+  array->SetNumberOfComponents(3);
+  for (int comp = 0; comp < 3; ++comp)
+  {
+    CHECK(array->MapFile(comp, fileName.c_str(),
+      HeaderSize + comp * NumberOfTuples * sizeof(float), NumberOfTuples, comp == 2));
+  }
+  CHECK(array->GetNumberOfTuples() == NumberOfTuples);
+  for (vtkIdType i = 0; i < NumberOfTuples; i += 101)
+  {
+    for (int comp = 0; comp < 3; ++comp)
+    {
+      CHECK(array->GetTypedComponent(i, comp) == Value(comp * NumberOfTuples + i));
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool TestErrors(const std::string& fileName)
+{
+  vtkNew<vtkFloatArray> array;
+  array->InsertNextValue(1.0f);
+
+  // Past the end of file, unaligned offset and missing file: the array is unchanged.
+  CHECK(!array->MapFile(fileName.c_str(), HeaderSize, 3 * NumberOfTuples + 1));
+  CHECK(!array->MapFile(fileName.c_str(), HeaderSize + 1, 1));
+  CHECK(!array->MapFile((fileName + ".missing").c_str(), 0, 1));
+  CHECK(!array->IsFileMapped());
+  CHECK(array->GetNumberOfValues() == 1 && array->GetValue(0) == 1.0f);
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestDataArrayFileMapping(int argc, char* argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing file name argument." << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string fileName = argv[1];
+  if (!WriteFile(fileName))
+  {
+    std::cerr << "Could not write " << fileName << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  bool success = TestReadOnly(fileName) && TestCopyOnWrite(fileName) && TestSOA(fileName);
+
+  const bool warnings = vtkObject::GetGlobalWarningDisplay();
+  vtkObject::GlobalWarningDisplayOff();
+  success = success && TestErrors(fileName);
+  vtkObject::SetGlobalWarningDisplay(warnings);
+
+  vtksys::SystemTools::RemoveFile(fileName);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
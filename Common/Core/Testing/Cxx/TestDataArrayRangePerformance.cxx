@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check the range computed by the contiguous (vectorized) kernels used for AOS arrays without
+// ghosts against the generic kernels, which are used when a ghost array is given, and report
+// their respective timings.
+
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkNew.h"
+#include "vtkSMPTools.h"
+#include "vtkShortArray.h"
+#include "vtkTimerLog.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+constexpr vtkIdType NumberOfValues = 12000000;
+constexpr int NumberOfRuns = 3;
+
+//------------------------------------------------------------------------------
+template <typename Functor>
+double TimeIt(vtkDataArray* array, Functor&& f)
+{
+  vtkNew<vtkTimerLog> timer;
+  double best = VTK_DOUBLE_MAX;
+  for (int run = 0; run < NumberOfRuns; ++run)
+  {
+    // Discard the cached ranges.
+    array->Modified();
+    timer->StartTimer();
+    f();
+    timer->StopTimer();
+    best = std::min(best, timer->GetElapsedTime());
+  }
+  return best;
+}
+
+//------------------------------------------------------------------------------
+// Compare the ranges of each component and of the magnitude, computed with and without the
+// contiguous kernels.
+bool CompareRanges(vtkDataArray* array, const std::vector<unsigned char>& noGhosts)
+{
+  const int nComps = array->GetNumberOfComponents();
+  bool success = true;
+  for (int comp = (nComps > 1 ? -1 : 0); comp < nComps; ++comp)
+  {
+    double range[2], expected[2];
+    double finiteRange[2], expectedFinite[2];
+    const double time = TimeIt(array, [&]() { array->GetRange(range, comp); });
+    const double expectedTime =
+      TimeIt(array, [&]() { array->GetRange(expected, comp, noGhosts.data(), 0xff); });
+    const double finiteTime = TimeIt(array, [&]() { array->GetFiniteRange(finiteRange, comp); });
+    const double expectedFiniteTime = TimeIt(
+      array, [&]() { array->GetFiniteRange(expectedFinite, comp, noGhosts.data(), 0xff); });
+
+    std::cout << array->GetClassName() << " " << nComps << " components, component " << comp
+              << ": range " << time << " s (generic " << expectedTime << " s), finite range "
+              << finiteTime << " s (generic " << expectedFiniteTime << " s)" << std::endl;
+
+    if (range[0] != expected[0] || range[1] != expected[1] ||
+      finiteRange[0] != expectedFinite[0] || finiteRange[1] != expectedFinite[1])
+    {
+      std::cerr << "Error: ranges differ for component " << comp << ": [" << range[0] << ", "
+                << range[1] << "] != [" << expected[0] << ", " << expected[1] << "], finite ["
+                << finiteRange[0] << ", " << finiteRange[1] << "] != [" << expectedFinite[0]
+                << ", " << expectedFinite[1] << "]" << std::endl;
+      success = false;
+    }
+  }
+  return success;
+}
+
+//------------------------------------------------------------------------------
+template <typename ArrayT>
+bool TestArray(int nComps, bool special)
+{
+  using ValueType = typename ArrayT::ValueType;
+  vtkNew<ArrayT> array;
+  array->SetNumberOfComponents(nComps);
+  array->SetNumberOfTuples(NumberOfValues / nComps);
+  std::mt19937 generator(nComps);
+  const double lowest = std::is_signed<ValueType>::value ? -100. : 0.;
+  std::uniform_real_distribution<double> dist(lowest, 100.);
+  ValueType* values = array->GetPointer(0);
+  for (vtkIdType i = 0; i < array->GetNumberOfValues(); ++i)
+  {
+    values[i] = static_cast<ValueType>(dist(generator));
+  }
+  if (special)
+  {
+    // NaN are ignored and infinite values are ignored by the finite ranges.
+    values[1] = std::numeric_limits<ValueType>::quiet_NaN();
+    values[nComps + 1] = std::numeric_limits<ValueType>::infinity();
+    values[array->GetNumberOfValues() - 1] = -std::numeric_limits<ValueType>::infinity();
+  }
+  std::vector<unsigned char> noGhosts(array->GetNumberOfTuples(), 0);
+  return CompareRanges(array, noGhosts);
+}
+
+//------------------------------------------------------------------------------
+// The squares of small integer types do not fit in the value type: the magnitude of the
+// largest tuple must not wrap around.
+template <typename ArrayT>
+bool TestMagnitudeOverflow(int nComps, typename ArrayT::ValueType largest)
+{
+  using ValueType = typename ArrayT::ValueType;
+  vtkNew<ArrayT> array;
+  array->SetNumberOfComponents(nComps);
+  array->SetNumberOfTuples(1000);
+  array->FillValue(static_cast<ValueType>(1));
+  for (int c = 0; c < nComps; ++c)
+  {
+    array->SetTypedComponent(500, c, largest);
+  }
+  const double square = static_cast<double>(largest) * static_cast<double>(largest);
+  const double expected[2] = { std::sqrt(static_cast<double>(nComps)),
+    std::sqrt(nComps * square) };
+  double range[2];
+  array->GetRange(range, -1);
+  if (range[0] != expected[0] || range[1] != expected[1])
+  {
+    std::cerr << "Error: magnitude range of " << array->GetClassName() << " with " << nComps
+              << " components is [" << range[0] << ", " << range[1] << "] instead of ["
+              << expected[0] << ", " << expected[1] << "]" << std::endl;
+    return false;
+  }
+  std::vector<unsigned char> noGhosts(array->GetNumberOfTuples(), 0);
+  return CompareRanges(array, noGhosts);
+}
+}
+
+//------------------------------------------------------------------------------
+int TestDataArrayRangePerformance(int, char*[])
+{
+  std::cout << "Backend: " << vtkSMPTools::GetBackend() << ", "
+            << vtkSMPTools::GetEstimatedNumberOfThreads() << " threads" << std::endl;
+  bool success = true;
+  for (int nComps : { 1, 3, 4 })
+  {
+    success &= TestArray<vtkFloatArray>(nComps, true);
+    success &= TestArray<vtkDoubleArray>(nComps, true);
+    success &= TestArray<vtkShortArray>(nComps, false);
+  }
+  success &= TestArray<vtkUnsignedCharArray>(2, false);
+  success &= TestMagnitudeOverflow<vtkUnsignedCharArray>(3, 255);
+  success &= TestMagnitudeOverflow<vtkUnsignedCharArray>(4, 255);
+  success &= TestMagnitudeOverflow<vtkShortArray>(3, 200);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
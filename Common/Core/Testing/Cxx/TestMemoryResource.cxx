@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkArenaMemoryResource.h"
+#include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkMemoryResource.h"
+#include "vtkNew.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+#define CHECK(cond)                                                                                \
+  do                                                                                               \
+  {                                                                                                \
+    if (!(cond))                                                                                   \
+    {                                                                                              \
+      std::cerr << "Failed check at line " << __LINE__ << ": " #cond << std::endl;                 \
+      return false;                                                                                \
+    }                                                                                              \
+  } while (false)
+
+using IdVector = std::vector<vtkIdType, vtkMemoryResourceAllocator<vtkIdType>>;
+
+//------------------------------------------------------------------------------
+bool TestArena()
+{
+  vtkNew<vtkArenaMemoryResource> arena;
+  arena->SetBlockSize(4096);
+  arena->SetLargeAllocationThreshold(1024);
+
+  void* a = arena->Allocate(100);
+  void* b = arena->Allocate(24, 64);
+  CHECK(a && b && a != b);
+  CHECK(reinterpret_cast<std::uintptr_t>(b) % 64 == 0);
+  CHECK(arena->GetBytesInUse() == 124);
+  CHECK(arena->GetNumberOfAllocations() == 2);
+  CHECK(arena->GetArenaSize() == 4096);
+
+  // Large allocations bypass the blocks.
+  void* large = arena->Allocate(100000);
+  CHECK(large != nullptr);
+  CHECK(arena->GetArenaSize() == 4096);
+  CHECK(arena->GetPeakBytesInUse() == 100124);
+  arena->Deallocate(large, 100000);
+
+  // Blocks can not be released while memory is in use.
+  CHECK(!arena->Release());
+  arena->Deallocate(a, 100);
+  arena->Deallocate(b, 24, 64);
+  CHECK(arena->GetBytesInUse() == 0);
+  CHECK(arena->GetTotalBytesAllocated() == 100124);
+  CHECK(arena->Release());
+  CHECK(arena->GetArenaSize() == 0);
+
+  arena->ResetCounters();
+  CHECK(arena->GetPeakBytesInUse() == 0 && arena->GetNumberOfAllocations() == 0);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool TestObjects()
+{
+  vtkNew<vtkArenaMemoryResource> arena;
+  vtkSmartPointer<vtkFloatArray> array;
+  vtkSmartPointer<vtkIdList> ids;
+  vtkIdType* released = nullptr;
+  {
+    vtkMemoryResource::vtkCurrentRAII scope(arena);
+    CHECK(vtkMemoryResource::GetCurrent() == arena);
+    array = vtkSmartPointer<vtkFloatArray>::New();
+    ids = vtkSmartPointer<vtkIdList>::New();
+
+    vtkNew<vtkIdList> temporary;
+    temporary->SetNumberOfIds(10);
+    temporary->Resize(100);
+    temporary->SetId(99, 99);
+    released = temporary->Release();
+  }
+  CHECK(vtkMemoryResource::GetCurrent() == nullptr);
+  // Ids released from the resource are copied to memory freed with delete[].
+  delete[] released;
+  CHECK(arena->GetBytesInUse() == 0);
+
+  // Objects keep using the resource captured at construction.
+  array->SetNumberOfComponents(3);
+  array->SetNumberOfTuples(1000);
+  array->FillValue(1.f);
+  CHECK(arena->GetBytesInUse() >= static_cast<vtkTypeInt64>(3000 * sizeof(float)));
+  ids->SetNumberOfIds(50);
+  for (vtkIdType i = 0; i < 50; ++i)
+  {
+    ids->SetId(i, i);
+  }
+  ids->InsertNextId(50);
+  CHECK(ids->GetId(50) == 50 && ids->GetId(49) == 49);
+  CHECK(ids->GetMemoryResource() == arena);
+
+  // Shallow copies share the buffer, which is freed once both arrays are gone.
+  vtkNew<vtkFloatArray> copy;
+  copy->ShallowCopy(array);
+  array = nullptr;
+  CHECK(copy->GetValue(2999) == 1.f);
+  ids = nullptr;
+  copy->Initialize();
+  CHECK(arena->GetBytesInUse() == 0);
+
+  // Without resource, objects allocate as usual.
+  vtkNew<vtkIdList> plain;
+  plain->SetNumberOfIds(10);
+  CHECK(plain->GetMemoryResource() == nullptr);
+  CHECK(arena->GetBytesInUse() == 0);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+struct FillLocalVectors
+{
+  vtkSMPThreadLocal<IdVector> Local;
+  vtkSMPThreadLocal<vtkMemoryResource*> Resources;
+
+  void Initialize()
+  {
+    this->Resources.Local() = vtkMemoryResource::GetCurrent();
+    this->Local.Local().reserve(16);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    IdVector& local = this->Local.Local();
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      local.push_back(i);
+    }
+  }
+
+  void Reduce() {}
+};
+
+//------------------------------------------------------------------------------
+bool TestSMP()
+{
+  vtkNew<vtkArenaMemoryResource> arena;
+  constexpr vtkIdType n = 100000;
+  vtkIdType total = 0;
+  {
+    vtkMemoryResource::vtkCurrentRAII scope(arena);
+    FillLocalVectors functor;
+    vtkSMPTools::For(0, n, functor);
+    for (vtkMemoryResource* resource : functor.Resources)
+    {
+      CHECK(resource == arena);
+    }
+    for (const IdVector& local : functor.Local)
+    {
+      CHECK(local.get_allocator().GetResource() == arena);
+      total += static_cast<vtkIdType>(local.size());
+    }
+    CHECK(arena->GetBytesInUse() >= static_cast<vtkTypeInt64>(n * sizeof(vtkIdType)));
+  }
+  CHECK(total == n);
+  CHECK(arena->GetBytesInUse() == 0);
+  CHECK(arena->Release());
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestMemoryResource(int, char*[])
+{
+  if (!TestArena() || !TestObjects() || !TestSMP())
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
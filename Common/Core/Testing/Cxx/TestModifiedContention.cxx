@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check the ordering of time stamps and reference counts when many threads create, modify and
+// reference small objects, as vtkSMPTools functors do, and report the throughput of these
+// operations so that contention regressions are noticed.
+
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkTimeStamp.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+
+namespace
+{
+constexpr vtkIdType NumberOfOperations = 2000000;
+
+//------------------------------------------------------------------------------
+// Time stamps given to a thread must increase.
+struct ThreadStamps
+{
+  vtkSMPThreadLocal<vtkMTimeType> LastStamp;
+  std::atomic<bool> Success{ true };
+
+  void Initialize() { this->LastStamp.Local() = 0; }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkMTimeType& last = this->LastStamp.Local();
+    vtkTimeStamp stamp;
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      stamp.Modified();
+      if (stamp.GetMTime() <= last)
+      {
+        this->Success = false;
+      }
+      last = stamp.GetMTime();
+    }
+  }
+
+  void Reduce() {}
+};
+
+//------------------------------------------------------------------------------
+// Time stamps must increase along calls ordered by a mutex, even when they come
+// from different threads.
+struct OrderedStamps
+{
+  std::mutex Mutex;
+  vtkMTimeType LastStamp = 0;
+  std::atomic<bool> Success{ true };
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkTimeStamp stamp;
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      // Other time stamps, which may invalidate the block of another thread.
+      stamp.Modified();
+      stamp.Modified();
+
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      stamp.Modified();
+      if (stamp.GetMTime() <= this->LastStamp)
+      {
+        this->Success = false;
+      }
+      this->LastStamp = stamp.GetMTime();
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+// Create, modify and delete temporary objects, and reference a shared one.
+struct CreateObjects
+{
+  vtkIdList* Shared;
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      vtkNew<vtkIdList> ids;
+      ids->InsertNextId(i);
+      ids->Modified();
+      this->Shared->Register(nullptr);
+      this->Shared->UnRegister(nullptr);
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+template <typename Functor>
+double TimeIt(vtkIdType numberOfOperations, Functor& functor)
+{
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  vtkSMPTools::For(0, numberOfOperations, 1024, functor);
+  timer->StopTimer();
+  return timer->GetElapsedTime();
+}
+}
+
+//------------------------------------------------------------------------------
+int TestModifiedContention(int, char*[])
+{
+  std::cout << "Backend: " << vtkSMPTools::GetBackend() << ", "
+            << vtkSMPTools::GetEstimatedNumberOfThreads() << " threads" << std::endl;
+  bool success = true;
+
+  ThreadStamps threadStamps;
+  double time = TimeIt(NumberOfOperations, threadStamps);
+  std::cout << "Modified: " << NumberOfOperations / time << " calls/s" << std::endl;
+  if (!threadStamps.Success)
+  {
+    std::cerr << "Error: time stamps of a thread do not increase." << std::endl;
+    success = false;
+  }
+
+  // After the loop, time stamps must be greater than all the ones given in the loop.
+  vtkMTimeType maxStamp = 0;
+  for (vtkMTimeType stamp : threadStamps.LastStamp)
+  {
+    maxStamp = std::max(maxStamp, stamp);
+  }
+  vtkTimeStamp after;
+  after.Modified();
+  if (after.GetMTime() <= maxStamp)
+  {
+    std::cerr << "Error: time stamp " << after.GetMTime()
+              << " given after the loop is not greater than " << maxStamp << std::endl;
+    success = false;
+  }
+
+  OrderedStamps orderedStamps;
+  time = TimeIt(NumberOfOperations / 10, orderedStamps);
+  std::cout << "Modified under a mutex: " << NumberOfOperations / 10 / time << " calls/s"
+            << std::endl;
+  if (!orderedStamps.Success)
+  {
+    std::cerr << "Error: time stamps do not increase along synchronized calls." << std::endl;
+    success = false;
+  }
+
+  vtkNew<vtkIdList> shared;
+  CreateObjects createObjects{ shared };
+  time = TimeIt(NumberOfOperations, createObjects);
+  std::cout << "Object creation and referencing: " << NumberOfOperations / time << " objects/s"
+            << std::endl;
+  if (shared->GetReferenceCount() != 1)
+  {
+    std::cerr << "Error: reference count of the shared object is " << shared->GetReferenceCount()
+              << " instead of 1." << std::endl;
+    success = false;
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -7,6 +7,7 @@
 #include "vtkSMPThreadLocal.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
+#include <algorithm>
 #include <cstdlib>
 #include <deque>
 #include <functional>
@@ -487,6 +488,119 @@ int doTestSMP()
       return EXIT_FAILURE;
     }
   }
+
+  // Test reduce and transform reduce. The size is large enough to use the
+  // parallel code path of every backend.
+  const vtkIdType scanSize = 1000003;
+  std::vector<vtkIdType> scanData(scanSize);
+  for (vtkIdType i = 0; i < scanSize; ++i)
+  {
+    scanData[i] = (i * 7919) % 13;
+  }
+  const vtkIdType sumTarget64 = std::accumulate(scanData.begin(), scanData.end(), vtkIdType(5));
+  if (vtkSMPTools::Reduce(scanData.cbegin(), scanData.cend(), vtkIdType(5)) != sumTarget64)
+  {
+    cerr << "Error: Invalid output for vtkSMPTools::Reduce!" << endl;
+    return EXIT_FAILURE;
+  }
+  const vtkIdType maxValue = vtkSMPTools::Reduce(scanData.cbegin(), scanData.cend(), vtkIdType(-1),
+    [](vtkIdType a, vtkIdType b) { return std::max(a, b); });
+  if (maxValue != 12)
+  {
+    cerr << "Error: Invalid output for vtkSMPTools::Reduce with max operator!" << endl;
+    return EXIT_FAILURE;
+  }
+  const double squares = vtkSMPTools::TransformReduce(scanData.cbegin(), scanData.cend(), 0.0,
+    std::plus<double>(), [](vtkIdType x) { return static_cast<double>(x * x); });
+  double squaresTarget = 0.0;
+  for (const auto& x : scanData)
+  {
+    squaresTarget += static_cast<double>(x * x);
+  }
+  if (squares != squaresTarget)
+  {
+    cerr << "Error: Invalid output for vtkSMPTools::TransformReduce!" << endl;
+    return EXIT_FAILURE;
+  }
+  std::vector<int> emptyData;
+  if (vtkSMPTools::Reduce(emptyData.begin(), emptyData.end(), 3) != 3)
+  {
+    cerr << "Error: Invalid output for vtkSMPTools::Reduce on an empty range!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Test scans, including in-place ones.
+  std::vector<vtkIdType> scanOutput(scanSize);
+  auto scanEnd = vtkSMPTools::InclusiveScan(scanData.cbegin(), scanData.cend(), scanOutput.begin());
+  vtkIdType prefix = 0;
+  for (vtkIdType i = 0; i < scanSize; ++i)
+  {
+    prefix += scanData[i];
+    if (scanOutput[i] != prefix)
+    {
+      cerr << "Error: Invalid output for vtkSMPTools::InclusiveScan at index " << i << endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (scanEnd != scanOutput.end())
+  {
+    cerr << "Error: Invalid iterator returned by vtkSMPTools::InclusiveScan!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<vtkIdType> offsets(scanData);
+  scanEnd = vtkSMPTools::ExclusiveScan(offsets.begin(), offsets.end(), offsets.begin(), vtkIdType(10));
+  prefix = 10;
+  for (vtkIdType i = 0; i < scanSize; ++i)
+  {
+    if (offsets[i] != prefix)
+    {
+      cerr << "Error: Invalid output for in-place vtkSMPTools::ExclusiveScan at index " << i
+           << endl;
+      return EXIT_FAILURE;
+    }
+    prefix += scanData[i];
+  }
+  if (scanEnd != offsets.end())
+  {
+    cerr << "Error: Invalid iterator returned by vtkSMPTools::ExclusiveScan!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Non commutative operator: keep the last non-zero value.
+  std::vector<vtkIdType> lastNonZero(scanSize);
+  vtkSMPTools::InclusiveScan(scanData.cbegin(), scanData.cend(), lastNonZero.begin(),
+    [](vtkIdType a, vtkIdType b) { return b != 0 ? b : a; });
+  vtkIdType last = 0;
+  for (vtkIdType i = 0; i < scanSize; ++i)
+  {
+    last = scanData[i] != 0 ? scanData[i] : last;
+    if (lastNonZero[i] != last)
+    {
+      cerr << "Error: Invalid output for vtkSMPTools::InclusiveScan with a non commutative "
+              "operator at index "
+           << i << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Test stable partition
+  std::vector<vtkIdType> partitionData(scanSize);
+  std::iota(partitionData.begin(), partitionData.end(), 0);
+  auto isSelected = [&scanData](vtkIdType i) { return scanData[i] < 4; };
+  auto middle = vtkSMPTools::StablePartition(partitionData.begin(), partitionData.end(), isSelected);
+  std::vector<vtkIdType> partitionTarget(scanSize);
+  std::iota(partitionTarget.begin(), partitionTarget.end(), 0);
+  auto middleTarget =
+    std::stable_partition(partitionTarget.begin(), partitionTarget.end(), isSelected);
+  if (partitionData != partitionTarget ||
+    std::distance(partitionData.begin(), middle) !=
+      std::distance(partitionTarget.begin(), middleTarget))
+  {
+    cerr << "Error: Invalid output for vtkSMPTools::StablePartition!" << endl;
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
 
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that vtkSMPTools::ExclusiveScan, InclusiveScan, Reduce and
+// StablePartition match the serial std::partial_sum, std::accumulate and
+// std::stable_partition for any number of threads, with enough values to be
+// split in several chunks, including for bool and move-only values.
+
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+constexpr vtkIdType NumberOfValues = 1000003;
+
+//------------------------------------------------------------------------------
+// Partition bool values, packed in a std::vector<bool> or not, and move-only
+// values, and compare them to std::stable_partition.
+bool TestStablePartition(const std::vector<bool>& flags)
+{
+  auto identity = [](bool flag) { return flag; };
+  std::vector<bool> expectedFlags(flags);
+  const auto expectedMiddle =
+    std::stable_partition(expectedFlags.begin(), expectedFlags.end(), identity) -
+    expectedFlags.begin();
+
+  std::vector<bool> packedFlags(flags);
+  auto packedMiddle =
+    vtkSMPTools::StablePartition(packedFlags.begin(), packedFlags.end(), identity);
+  std::unique_ptr<bool[]> rawFlags(new bool[NumberOfValues]);
+  std::copy(flags.begin(), flags.end(), rawFlags.get());
+  bool* rawMiddle =
+    vtkSMPTools::StablePartition(rawFlags.get(), rawFlags.get() + NumberOfValues, identity);
+  if (packedFlags != expectedFlags || packedMiddle - packedFlags.begin() != expectedMiddle ||
+    !std::equal(expectedFlags.begin(), expectedFlags.end(), rawFlags.get()) ||
+    rawMiddle - rawFlags.get() != expectedMiddle)
+  {
+    return false;
+  }
+
+  auto isSelected = [&flags](vtkIdType id) { return flags[id]; };
+  std::vector<vtkIdType> expectedIds(NumberOfValues);
+  std::iota(expectedIds.begin(), expectedIds.end(), 0);
+  std::stable_partition(expectedIds.begin(), expectedIds.end(), isSelected);
+  std::vector<std::unique_ptr<vtkIdType>> ids;
+  for (vtkIdType i = 0; i < NumberOfValues; ++i)
+  {
+    ids.emplace_back(new vtkIdType(i));
+  }
+  auto idMiddle = vtkSMPTools::StablePartition(ids.begin(), ids.end(),
+    [&isSelected](const std::unique_ptr<vtkIdType>& id) { return isSelected(*id); });
+  if (idMiddle - ids.begin() != expectedMiddle)
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < NumberOfValues; ++i)
+  {
+    if (!ids[i] || *ids[i] != expectedIds[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestSMPScan(int, char*[])
+{
+  std::vector<vtkIdType> counts(NumberOfValues);
+  std::vector<bool> flags(NumberOfValues);
+  for (vtkIdType i = 0; i < NumberOfValues; ++i)
+  {
+    counts[i] = 3 + (i % 6);
+    flags[i] = (i % 7) == 0;
+  }
+  std::vector<vtkIdType> expected(NumberOfValues);
+  expected[0] = 0;
+  std::partial_sum(counts.begin(), counts.end() - 1, expected.begin() + 1);
+  std::vector<vtkIdType> expectedInclusive(NumberOfValues);
+  std::partial_sum(counts.begin(), counts.end(), expectedInclusive.begin());
+  const vtkIdType expectedSum = expectedInclusive.back();
+
+  const int maxThreads = vtkSMPTools::GetEstimatedDefaultNumberOfThreads();
+  for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+  {
+    std::vector<vtkIdType> offsets(NumberOfValues);
+    std::vector<vtkIdType> inclusive(NumberOfValues);
+    vtkIdType sum = 0;
+    bool anyFlag = false;
+    bool allFlags = true;
+    bool partitioned = false;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config{ numThreads },
+      [&]()
+      {
+        vtkSMPTools::ExclusiveScan(counts.begin(), counts.end(), offsets.begin(), vtkIdType(0));
+        vtkSMPTools::InclusiveScan(counts.begin(), counts.end(), inclusive.begin());
+        sum = vtkSMPTools::Reduce(counts.begin(), counts.end(), vtkIdType(0));
+        anyFlag = vtkSMPTools::Reduce(flags.cbegin(), flags.cend(), false, std::logical_or<bool>());
+        allFlags =
+          vtkSMPTools::Reduce(flags.cbegin(), flags.cend(), true, std::logical_and<bool>());
+        partitioned = TestStablePartition(flags);
+      });
+
+    if (offsets != expected || inclusive != expectedInclusive || sum != expectedSum ||
+      !anyFlag || allFlags || !partitioned)
+    {
+      std::cerr << "Error: wrong result with " << numThreads << " threads." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
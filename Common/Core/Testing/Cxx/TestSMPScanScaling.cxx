@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Measure how vtkSMPTools::ExclusiveScan and vtkSMPTools::Reduce scale with the
+// number of threads, compared to the serial std::partial_sum. This is the typical
+// offset-building step of filters compacting their output.
+
+#include "vtkNew.h"
+#include "vtkSMPTools.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+constexpr vtkIdType NumberOfValues = 5000000;
+constexpr int NumberOfRuns = 3;
+
+//------------------------------------------------------------------------------
+template <typename Functor>
+double TimeIt(Functor&& f)
+{
+  vtkNew<vtkTimerLog> timer;
+  double best = VTK_DOUBLE_MAX;
+  for (int run = 0; run < NumberOfRuns; ++run)
+  {
+    timer->StartTimer();
+    f();
+    timer->StopTimer();
+    best = std::min(best, timer->GetElapsedTime());
+  }
+  return best;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestSMPScanScaling(int, char*[])
+{
+  std::vector<vtkIdType> counts(NumberOfValues);
+  for (vtkIdType i = 0; i < NumberOfValues; ++i)
+  {
+    counts[i] = 3 + (i % 6);
+  }
+  std::vector<vtkIdType> offsets(NumberOfValues);
+  std::vector<vtkIdType> expected(NumberOfValues);
+
+  const double serialTime = TimeIt(
+    [&]()
+    {
+      expected[0] = 0;
+      std::partial_sum(counts.begin(), counts.end() - 1, expected.begin() + 1);
+    });
+  const vtkIdType expectedSum = expected.back() + counts.back();
+  std::cout << "Backend: " << vtkSMPTools::GetBackend() << std::endl;
+  std::cout << "Serial partial_sum: " << serialTime << " s" << std::endl;
+
+  const int maxThreads = vtkSMPTools::GetEstimatedDefaultNumberOfThreads();
+  for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+  {
+    double scanTime = 0.0;
+    double reduceTime = 0.0;
+    vtkIdType sum = 0;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config{ numThreads },
+      [&]()
+      {
+        scanTime = TimeIt(
+          [&]()
+          {
+            vtkSMPTools::ExclusiveScan(counts.begin(), counts.end(), offsets.begin(), vtkIdType(0));
+          });
+        reduceTime =
+          TimeIt([&]() { sum = vtkSMPTools::Reduce(counts.begin(), counts.end(), vtkIdType(0)); });
+      });
+
+    if (offsets != expected || sum != expectedSum)
+    {
+      std::cerr << "Error: wrong result with " << numThreads << " threads." << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::cout << numThreads << " threads: ExclusiveScan " << scanTime << " s (speedup "
+              << serialTime / scanTime << "), Reduce " << reduceTime << " s" << std::endl;
+  }
+
+  return EXIT_SUCCESS;
+}
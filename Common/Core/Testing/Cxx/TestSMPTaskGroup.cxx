@@ -0,0 +1,194 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkObject.h"
+#include "vtkSMPTaskGroup.h"
+#include "vtkSMPTools.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+int doTestSMPTaskGroup()
+{
+  std::cout << "Testing vtkSMPTaskGroup with " << vtkSMPTools::GetBackend() << " backend."
+            << std::endl;
+
+  // Independent tasks
+  {
+    std::atomic<int> counter(0);
+    vtkSMPTaskGroup group;
+    for (int i = 0; i < 100; ++i)
+    {
+      group.Spawn([&counter]() { ++counter; });
+    }
+    group.Wait();
+    if (counter != 100)
+    {
+      std::cerr << "Error: " << counter << " tasks ran instead of 100." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Dependencies: a diamond and a chain of continuations
+  {
+    std::mutex mutex;
+    std::vector<char> order;
+    auto record = [&](char c)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(c);
+    };
+
+    vtkSMPTaskGroup group;
+    auto a = group.Spawn([&]() { record('a'); });
+    auto b = group.Then(a, [&]() { record('b'); });
+    auto c = group.Then(a, [&]() { record('c'); });
+    auto d = group.Spawn([&]() { record('d'); }, { b, c });
+    auto e = group.Then(d, [&]() { record('e'); });
+    group.Wait();
+
+    if (order.size() != 5 || order[0] != 'a' || order[3] != 'd' || order[4] != 'e' ||
+      !group.IsDone(e))
+    {
+      std::cerr << "Error: dependencies were not respected: "
+                << std::string(order.begin(), order.end()) << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // Depending on a finished task runs immediately
+    bool ran = false;
+    group.Then(a, [&]() { ran = true; });
+    group.Wait();
+    if (!ran)
+    {
+      std::cerr << "Error: continuation of a finished task did not run." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Reused group: the tasks are released by each Wait(), their ids are not reused.
+  {
+    std::atomic<int> counter(0);
+    vtkSMPTaskGroup group;
+    vtkSMPTaskGroup::TaskId previous = -1;
+    for (int cycle = 0; cycle < 100; ++cycle)
+    {
+      vtkSMPTaskGroup::TaskId last = previous;
+      for (int i = 0; i < 10; ++i)
+      {
+        last = previous >= 0 ? group.Then(previous, [&counter]() { ++counter; })
+                             : group.Spawn([&counter]() { ++counter; });
+      }
+      if (group.GetNumberOfTasks() != 10)
+      {
+        std::cerr << "Error: " << group.GetNumberOfTasks() << " tasks held instead of 10."
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+      group.Wait();
+      if (group.GetNumberOfTasks() != 0 || last <= previous || !group.IsDone(last) ||
+        (previous >= 0 && !group.IsDone(previous)))
+      {
+        std::cerr << "Error: tasks of cycle " << cycle << " not released." << std::endl;
+        return EXIT_FAILURE;
+      }
+      previous = last;
+    }
+    if (counter != 1000)
+    {
+      std::cerr << "Error: " << counter << " tasks ran instead of 1000." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Tasks spawning tasks, nested groups and parallel loops inside tasks
+  {
+    std::atomic<vtkIdType> sum(0);
+    vtkSMPTaskGroup group;
+    for (int i = 0; i < 8; ++i)
+    {
+      group.Spawn(
+        [&]()
+        {
+          group.Spawn(
+            [&]()
+            {
+              vtkSMPTaskGroup nested;
+              for (int j = 0; j < 4; ++j)
+              {
+                nested.Spawn(
+                  [&]()
+                  {
+                    vtkSMPTools::For(0, 1000,
+                      [&](vtkIdType begin, vtkIdType end)
+                      {
+                        vtkIdType local = 0;
+                        for (vtkIdType k = begin; k < end; ++k)
+                        {
+                          local += k;
+                        }
+                        sum += local;
+                      });
+                  });
+              }
+            });
+        });
+    }
+    group.Wait();
+    if (sum != 8 * 4 * 499500)
+    {
+      std::cerr << "Error: wrong result for nested tasks: " << sum << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Exceptions do not prevent dependent tasks from running. The error they
+  // report is expected.
+  {
+    const int warningDisplay = vtkObject::GetGlobalWarningDisplay();
+    vtkObject::GlobalWarningDisplayOff();
+    bool ran = false;
+    vtkSMPTaskGroup group;
+    auto thrower = group.Spawn([]() { throw std::runtime_error("expected error"); });
+    group.Then(thrower, [&]() { ran = true; });
+    group.Wait();
+    vtkObject::SetGlobalWarningDisplay(warningDisplay);
+    if (!ran)
+    {
+      std::cerr << "Error: continuation of a throwing task did not run." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestSMPTaskGroup(int argc, char* argv[])
+{
+  int returnValue = EXIT_SUCCESS;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string argument(argv[i] + 2);
+    std::size_t separator = argument.find('=');
+    std::string backend = argument.substr(0, separator);
+    int value = std::atoi(argument.substr(separator + 1, argument.size()).c_str());
+    if (value)
+    {
+      vtkSMPTools::SetBackend(backend.c_str());
+      if (doTestSMPTaskGroup() != EXIT_SUCCESS)
+      {
+        returnValue = EXIT_FAILURE;
+      }
+    }
+  }
+  return returnValue;
+}
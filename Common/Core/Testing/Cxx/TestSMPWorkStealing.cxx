@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Compare the scheduling of vtkSMPTools::For with and without work stealing on
+// skewed workloads, where the cost of an item grows along the range (e.g. adaptive
+// refinement or cells sorted by complexity). With static chunks, the threads that
+// get the expensive end of the range finish last; work stealing rebalances them.
+
+#include "vtkNew.h"
+#include "vtkSMPTools.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+constexpr vtkIdType NumberOfItems = 20000;
+constexpr int NumberOfRuns = 3;
+
+//------------------------------------------------------------------------------
+// The cost of item i is proportional to i for Linear and to i^2 for Quadratic.
+enum class Workload
+{
+  Linear,
+  Quadratic
+};
+
+struct SkewedFunctor
+{
+  std::vector<double>& Output;
+  Workload Skew;
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const vtkIdType iterations = this->Skew == Workload::Linear
+        ? i / 20
+        : (i / 200) * (i / 200) / 10;
+      double value = 0.0;
+      for (vtkIdType j = 0; j < iterations; ++j)
+      {
+        value += std::sqrt(static_cast<double>(i + j));
+      }
+      this->Output[i] = value;
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+double Run(bool workStealing, bool threadPinning, Workload skew, std::vector<double>& output)
+{
+  vtkSMPTools::Config config;
+  config.WorkStealing = workStealing;
+  config.ThreadPinning = threadPinning;
+
+  vtkNew<vtkTimerLog> timer;
+  double best = VTK_DOUBLE_MAX;
+  vtkSMPTools::LocalScope(config,
+    [&]()
+    {
+      SkewedFunctor functor{ output, skew };
+      for (int run = 0; run < NumberOfRuns; ++run)
+      {
+        timer->StartTimer();
+        vtkSMPTools::For(0, NumberOfItems, functor);
+        timer->StopTimer();
+        best = std::min(best, timer->GetElapsedTime());
+      }
+    });
+  return best;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestSMPWorkStealing(int, char*[])
+{
+  const bool workStealing = vtkSMPTools::GetWorkStealing();
+  const bool threadPinning = vtkSMPTools::GetThreadPinning();
+  // Work stealing is opt-in: existing loops keep their scheduling.
+  if (workStealing && !std::getenv("VTK_SMP_WORK_STEALING"))
+  {
+    std::cerr << "Error: work stealing is enabled by default." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Backend: " << vtkSMPTools::GetBackend() << ", "
+            << vtkSMPTools::GetEstimatedNumberOfThreads() << " threads" << std::endl;
+
+  for (Workload skew : { Workload::Linear, Workload::Quadratic })
+  {
+    std::vector<double> expected(NumberOfItems);
+    SkewedFunctor serial{ expected, skew };
+    serial(0, NumberOfItems);
+
+    std::vector<double> staticOutput(NumberOfItems);
+    std::vector<double> stealingOutput(NumberOfItems);
+    std::vector<double> pinnedOutput(NumberOfItems);
+    const double staticTime = Run(false, false, skew, staticOutput);
+    const double stealingTime = Run(true, false, skew, stealingOutput);
+    const double pinnedTime = Run(true, true, skew, pinnedOutput);
+
+    if (staticOutput != expected || stealingOutput != expected || pinnedOutput != expected)
+    {
+      std::cerr << "Error: wrong result for the "
+                << (skew == Workload::Linear ? "linear" : "quadratic") << " workload."
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    std::cout << (skew == Workload::Linear ? "Linear" : "Quadratic")
+              << " workload: static chunks " << staticTime << " s, work stealing " << stealingTime
+              << " s (speedup " << staticTime / stealingTime << "), work stealing and pinning "
+              << pinnedTime << " s" << std::endl;
+  }
+
+  // LocalScope must restore the previous settings
+  if (vtkSMPTools::GetWorkStealing() != workStealing ||
+    vtkSMPTools::GetThreadPinning() != threadPinning)
+  {
+    std::cerr << "Error: LocalScope did not restore the scheduling settings." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -244,6 +244,32 @@ public:
    **/
   void SetArrayFreeFunction(void (*callback)(void*)) override;
 
+  /**
+   * Use @a size values stored in the file @a fileName, starting at byte @a offset,
+   * as data of the array, without copying them. The file is mapped in memory and
+   * pages are only loaded when they are accessed, so that large files can be opened
+   * instantly. Values must be stored in native byte order, and @a offset must be a
+   * multiple of the value size. The number of components must be set beforehand.
+   * If @a copyOnWrite is false, the array is read-only: modifying its values
+   * crashes the process. Otherwise, modified pages are copied in memory and the
+   * file is never changed. Resizing the array copies its data in memory.
+   * Return false if the file can not be mapped, in which case the array is unchanged.
+   * @sa vtkFileMapping
+   */
+  bool MapFile(const char* fileName, vtkTypeInt64 offset, vtkIdType size, bool copyOnWrite = false);
+
+  /**
+   * Return true if the data of the array is a file region mapped by MapFile().
+   */
+  bool IsFileMapped() const { return this->Buffer->IsFileMapped(); }
+
+  /**
+   * Move the values allocated from a vtkMemoryResource to memory allocated as
+   * usual, so that the array no longer keeps the resource alive.
+   * @sa vtkBuffer::ReleaseMemoryResource
+   */
+  bool ReleaseMemoryResource() { return this->Buffer->ReleaseMemoryResource(); }
+
   // Overridden for optimized implementations:
   void SetTuple(vtkIdType tupleIdx, const float* tuple) override;
   void SetTuple(vtkIdType tupleIdx, const double* tuple) override;
@@ -369,7 +395,8 @@ VTK_ABI_NAMESPACE_END
   T* WritePointer(vtkIdType id, vtkIdType number);                                                 \
   T* GetPointer(vtkIdType id);                                                                     \
   void SetArray(VTK_ZEROCOPY T* array, vtkIdType size, int save);                                  \
-  void SetArray(VTK_ZEROCOPY T* array, vtkIdType size, int save, int deleteMethod)
+  void SetArray(VTK_ZEROCOPY T* array, vtkIdType size, int save, int deleteMethod);                \
+  bool MapFile(const char* fileName, vtkTypeInt64 offset, vtkIdType size, bool copyOnWrite = false)
 
 #define vtkCreateReadOnlyWrappedArrayInterface(T)                                                  \
   int GetDataType() const override;                                                                \
@@ -114,6 +114,22 @@ void vtkAOSDataArrayTemplate<ValueType>::SetArrayFreeFunction(void (*callback)(v
   this->Buffer->SetFreeFunction(false, callback);
 }
 
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+bool vtkAOSDataArrayTemplate<ValueTypeT>::MapFile(
+  const char* fileName, vtkTypeInt64 offset, vtkIdType size, bool copyOnWrite)
+{
+  if (!this->Buffer->MapFile(fileName, offset, size, copyOnWrite))
+  {
+    return false;
+  }
+
+  this->Size = size;
+  this->MaxId = this->Size - 1;
+  this->DataChanged();
+  return true;
+}
+
 //-----------------------------------------------------------------------------
 template <class ValueTypeT>
 void vtkAOSDataArrayTemplate<ValueTypeT>::SetTuple(vtkIdType tupleIdx, const float* tuple)
@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkArenaMemoryResource.h"
+#include "vtkObjectFactory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkArenaMemoryResource);
+
+struct vtkArenaMemoryResource::vtkInternals
+{
+  struct Block
+  {
+    std::unique_ptr<char[]> Data;
+    std::size_t Size = 0;
+    std::atomic<std::size_t> Offset{ 0 };
+  };
+
+  // Try to allocate from a block, lock-free. Return nullptr if the block is full.
+  static void* AllocateFromBlock(Block& block, std::size_t bytes, std::size_t alignment)
+  {
+    const auto base = reinterpret_cast<std::uintptr_t>(block.Data.get());
+    std::size_t offset = block.Offset.load(std::memory_order_relaxed);
+    std::size_t begin;
+    do
+    {
+      begin = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+      if (begin + bytes > block.Size)
+      {
+        return nullptr;
+      }
+    } while (!block.Offset.compare_exchange_weak(offset, begin + bytes, std::memory_order_relaxed));
+    return block.Data.get() + begin;
+  }
+
+  std::mutex Mutex; // Protects Blocks
+  std::vector<std::unique_ptr<Block>> Blocks;
+  std::atomic<Block*> Current{ nullptr };
+};
+
+//------------------------------------------------------------------------------
+vtkArenaMemoryResource::vtkArenaMemoryResource()
+  : Internals(new vtkInternals)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkArenaMemoryResource::~vtkArenaMemoryResource() = default;
+
+//------------------------------------------------------------------------------
+void* vtkArenaMemoryResource::DoAllocate(std::size_t bytes, std::size_t alignment)
+{
+  if (static_cast<vtkTypeInt64>(bytes) > this->LargeAllocationThreshold &&
+    alignment <= alignof(std::max_align_t))
+  {
+    return std::malloc(bytes);
+  }
+
+  auto& internals = *this->Internals;
+  while (true)
+  {
+    vtkInternals::Block* block = internals.Current.load(std::memory_order_acquire);
+    if (block)
+    {
+      if (void* pointer = vtkInternals::AllocateFromBlock(*block, bytes, alignment))
+      {
+        return pointer;
+      }
+    }
+
+    // Current block is full, add a new one unless another thread did it meanwhile
+    std::lock_guard<std::mutex> lock(internals.Mutex);
+    if (internals.Current.load(std::memory_order_relaxed) != block)
+    {
+      continue;
+    }
+    std::unique_ptr<vtkInternals::Block> newBlock(new vtkInternals::Block);
+    newBlock->Size = (std::max)(static_cast<std::size_t>(this->BlockSize), bytes + alignment);
+    newBlock->Data.reset(new (std::nothrow) char[newBlock->Size]);
+    if (!newBlock->Data)
+    {
+      return nullptr;
+    }
+    internals.Current.store(newBlock.get(), std::memory_order_release);
+    internals.Blocks.emplace_back(std::move(newBlock));
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkArenaMemoryResource::DoDeallocate(
+  void* pointer, std::size_t bytes, std::size_t alignment)
+{
+  if (static_cast<vtkTypeInt64>(bytes) > this->LargeAllocationThreshold &&
+    alignment <= alignof(std::max_align_t))
+  {
+    std::free(pointer);
+  }
+  // Memory of the blocks is released all at once
+}
+
+//------------------------------------------------------------------------------
+bool vtkArenaMemoryResource::Release()
+{
+  if (this->GetBytesInUse() != 0)
+  {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  this->Internals->Current = nullptr;
+  this->Internals->Blocks.clear();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkArenaMemoryResource::GetArenaSize()
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  vtkTypeInt64 size = 0;
+  for (const auto& block : this->Internals->Blocks)
+  {
+    size += static_cast<vtkTypeInt64>(block->Size);
+  }
+  return size;
+}
+
+//------------------------------------------------------------------------------
+void vtkArenaMemoryResource::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "BlockSize: " << this->BlockSize << "\n";
+  os << indent << "LargeAllocationThreshold: " << this->LargeAllocationThreshold << "\n";
+  os << indent << "ArenaSize: " << this->GetArenaSize() << "\n";
+}
+VTK_ABI_NAMESPACE_END
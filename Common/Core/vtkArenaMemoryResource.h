@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkArenaMemoryResource
+ * @brief   memory resource allocating from large blocks released all at once
+ *
+ * vtkArenaMemoryResource serves small allocations by bumping a pointer in
+ * large blocks of memory, like std::pmr::monotonic_buffer_resource. Deallocate()
+ * does not give memory back to the blocks: they are all released together
+ * when the arena is destroyed, or by Release() once no allocation is in use.
+ * This makes the many short-lived buffers of an algorithm execution cheap to
+ * allocate, avoids contention on the system allocator between threads, and
+ * avoids fragmenting the heap.
+ *
+ * Allocations larger than LargeAllocationThreshold bytes are forwarded to the
+ * system allocator and freed when deallocated, so that growing buffers do not
+ * waste arena memory.
+ *
+ * Allocations are lock-free, except when a new block is needed.
+ *
+ * @sa vtkMemoryResource
+ */
+
+#ifndef vtkArenaMemoryResource_h
+#define vtkArenaMemoryResource_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkMemoryResource.h"
+
+#include <memory> // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkArenaMemoryResource : public vtkMemoryResource
+{
+public:
+  static vtkArenaMemoryResource* New();
+  vtkTypeMacro(vtkArenaMemoryResource, vtkMemoryResource);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Size in bytes of the blocks allocated from the system. Larger blocks are
+   * allocated if needed. Default is 1 MiB.
+   */
+  vtkSetClampMacro(BlockSize, vtkTypeInt64, 1024, VTK_TYPE_INT64_MAX);
+  vtkGetMacro(BlockSize, vtkTypeInt64);
+  ///@}
+
+  ///@{
+  /**
+   * Allocations strictly larger than this number of bytes are forwarded to the
+   * system allocator. Default is 64 KiB.
+   * It must not be changed while allocations are in use.
+   */
+  vtkSetClampMacro(LargeAllocationThreshold, vtkTypeInt64, 0, VTK_TYPE_INT64_MAX);
+  vtkGetMacro(LargeAllocationThreshold, vtkTypeInt64);
+  ///@}
+
+  /**
+   * Release all blocks. This is only possible when no allocation is in use:
+   * return false and do nothing otherwise.
+   * This method is not thread safe.
+   */
+  bool Release();
+
+  /**
+   * Number of bytes reserved from the system in blocks.
+   */
+  vtkTypeInt64 GetArenaSize();
+
+protected:
+  vtkArenaMemoryResource();
+  ~vtkArenaMemoryResource() override;
+
+  void* DoAllocate(std::size_t bytes, std::size_t alignment) override;
+  void DoDeallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+
+  vtkTypeInt64 BlockSize = 1 << 20;
+  vtkTypeInt64 LargeAllocationThreshold = 1 << 16;
+
+private:
+  vtkArenaMemoryResource(const vtkArenaMemoryResource&) = delete;
+  void operator=(const vtkArenaMemoryResource&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -13,6 +13,8 @@
 #ifndef vtkBuffer_h
 #define vtkBuffer_h
 
+#include "vtkFileMapping.h"    // For file-backed buffers
+#include "vtkMemoryResource.h" // For vtkMemoryResource
 #include "vtkObject.h"
 #include "vtkObjectFactory.h" // New() implementation
 
@@ -42,6 +44,42 @@ public:
    */
   void SetBuffer(ScalarType* array, vtkIdType size);
 
+  /**
+   * Use @a size elements stored in the file @a fileName, starting at byte @a offset,
+   * as buffer. The file is mapped in memory and nothing is copied: pages are loaded
+   * when they are first accessed. Values must be stored in native byte order, and
+   * @a offset must be a multiple of the size of ScalarType.
+   * If @a copyOnWrite is false, the buffer is read-only and must not be modified.
+   * Otherwise, modified pages are copied in memory and the file is never changed.
+   * The buffer is copied in regular memory when it is reallocated.
+   * Return false if the file can not be mapped, in which case the buffer is unchanged.
+   */
+  bool MapFile(const char* fileName, vtkTypeInt64 offset, vtkIdType size, bool copyOnWrite = false);
+
+  /**
+   * Return true if the buffer is a region of a file mapped by MapFile().
+   */
+  bool IsFileMapped() const { return this->FileMapping != nullptr; }
+
+  ///@{
+  /**
+   * Set/Get the memory resource used by Allocate() and Reallocate(). By default,
+   * this is the current resource of the thread constructing the buffer (see
+   * vtkMemoryResource::GetCurrent()). When it is nullptr, the malloc, realloc and
+   * free functions are used.
+   */
+  void SetMemoryResource(vtkMemoryResource* resource);
+  vtkMemoryResource* GetMemoryResource() const { return this->MemoryResource; }
+  ///@}
+
+  /**
+   * Stop using the memory resource, and move the buffer to memory allocated with
+   * the malloc function if it was allocated from the resource, so that the buffer
+   * no longer keeps the resource alive. Return false if the memory can not be
+   * allocated, in which case the buffer is unchanged.
+   */
+  bool ReleaseMemoryResource();
+
   /**
    * Set the malloc function to be used when allocating space inside this object.
    **/
@@ -84,17 +122,28 @@ protected:
     this->SetMallocFunction(vtkObjectBase::GetCurrentMallocFunction());
     this->SetReallocFunction(vtkObjectBase::GetCurrentReallocFunction());
     this->SetFreeFunction(false, vtkObjectBase::GetCurrentFreeFunction());
+    this->SetMemoryResource(vtkMemoryResource::GetCurrent());
   }
 
-  ~vtkBuffer() override { this->SetBuffer(nullptr, 0); }
+  ~vtkBuffer() override
+  {
+    this->SetBuffer(nullptr, 0);
+    this->SetMemoryResource(nullptr);
+  }
 
   ScalarType* Pointer;
   vtkIdType Size;
   vtkMallocingFunction MallocFunction;
   vtkReallocingFunction ReallocFunction;
   vtkFreeingFunction DeleteFunction;
+  vtkFileMapping* FileMapping = nullptr;
+  vtkMemoryResource* MemoryResource = nullptr;
+  vtkMemoryResource* PointerResource = nullptr; // Resource that allocated Pointer, if any
 
 private:
+  // Replace the buffer by a new one allocated from MemoryResource, preserving old data.
+  bool AllocateFromResource(vtkIdType size);
+
   vtkBuffer(const vtkBuffer&) = delete;
   void operator=(const vtkBuffer&) = delete;
 };
@@ -118,7 +167,20 @@ void vtkBuffer<ScalarT>::SetBuffer(typename vtkBuffer<ScalarT>::ScalarType* arra
 {
   if (this->Pointer != array)
   {
-    if (this->DeleteFunction)
+    if (this->FileMapping)
+    {
+      this->FileMapping->Delete();
+      this->FileMapping = nullptr;
+      this->SetFreeFunction(false, vtkObjectBase::GetCurrentFreeFunction());
+    }
+    else if (this->PointerResource)
+    {
+      this->PointerResource->Deallocate(
+        this->Pointer, this->Size * sizeof(ScalarType), alignof(ScalarType));
+      this->PointerResource->UnRegister(nullptr);
+      this->PointerResource = nullptr;
+    }
+    else if (this->DeleteFunction)
     {
       this->DeleteFunction(this->Pointer);
     }
@@ -126,6 +188,94 @@ void vtkBuffer<ScalarT>::SetBuffer(typename vtkBuffer<ScalarT>::ScalarType* arra
   }
   this->Size = sz;
 }
+
+//------------------------------------------------------------------------------
+template <typename ScalarT>
+bool vtkBuffer<ScalarT>::MapFile(
+  const char* fileName, vtkTypeInt64 offset, vtkIdType size, bool copyOnWrite)
+{
+  if (offset % static_cast<vtkTypeInt64>(sizeof(ScalarType)) != 0)
+  {
+    vtkErrorMacro("Offset " << offset << " is not a multiple of the value size "
+                            << sizeof(ScalarType) << ".");
+    return false;
+  }
+
+  vtkFileMapping* mapping = vtkFileMapping::New();
+  if (!mapping->Map(fileName, offset, static_cast<vtkTypeInt64>(size) * sizeof(ScalarType),
+        copyOnWrite ? vtkFileMapping::COPY_ON_WRITE : vtkFileMapping::READ_ONLY))
+  {
+    mapping->Delete();
+    return false;
+  }
+
+  this->SetBuffer(nullptr, 0);
+  if (size == 0)
+  {
+    // Nothing to keep mapped
+    mapping->Delete();
+    return true;
+  }
+  this->Pointer = static_cast<ScalarType*>(mapping->GetPointer());
+  this->Size = size;
+  this->FileMapping = mapping;
+  // The mapping owns the memory
+  this->DeleteFunction = nullptr;
+  return true;
+}
+//------------------------------------------------------------------------------
+template <typename ScalarT>
+void vtkBuffer<ScalarT>::SetMemoryResource(vtkMemoryResource* resource)
+{
+  // Memory already allocated stays attached to the resource that allocated it
+  if (this->MemoryResource != resource)
+  {
+    if (this->MemoryResource)
+    {
+      this->MemoryResource->UnRegister(nullptr);
+    }
+    this->MemoryResource = resource;
+    if (this->MemoryResource)
+    {
+      this->MemoryResource->Register(nullptr);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename ScalarT>
+bool vtkBuffer<ScalarT>::ReleaseMemoryResource()
+{
+  vtkMemoryResource* resource = this->MemoryResource;
+  this->SetMemoryResource(nullptr);
+  if (this->PointerResource && !this->Reallocate(this->Size))
+  {
+    this->SetMemoryResource(resource);
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+template <typename ScalarT>
+bool vtkBuffer<ScalarT>::AllocateFromResource(vtkIdType size)
+{
+  ScalarType* newArray = static_cast<ScalarType*>(
+    this->MemoryResource->Allocate(size * sizeof(ScalarType), alignof(ScalarType)));
+  if (!newArray)
+  {
+    return false;
+  }
+  if (this->Pointer)
+  {
+    std::copy(this->Pointer, this->Pointer + (std::min)(this->Size, size), newArray);
+  }
+  this->SetBuffer(newArray, size);
+  this->PointerResource = this->MemoryResource;
+  this->PointerResource->Register(nullptr);
+  return true;
+}
+
 //------------------------------------------------------------------------------
 template <typename ScalarT>
 void vtkBuffer<ScalarT>::SetMallocFunction(vtkMallocingFunction mallocFunction)
@@ -161,6 +311,11 @@ bool vtkBuffer<ScalarT>::Allocate(vtkIdType size)
   this->SetBuffer(nullptr, 0);
   if (size > 0)
   {
+    if (this->MemoryResource)
+    {
+      return this->AllocateFromResource(size);
+    }
+
     ScalarType* newArray;
     if (this->MallocFunction)
     {
@@ -193,7 +348,13 @@ bool vtkBuffer<ScalarT>::Reallocate(vtkIdType newsize)
     return this->Allocate(0);
   }
 
-  if (this->Pointer && this->DeleteFunction != free)
+  if (this->MemoryResource)
+  {
+    return this->AllocateFromResource(newsize);
+  }
+
+  // Memory of a resource can not be given to realloc
+  if (this->Pointer && (this->PointerResource || this->DeleteFunction != free))
   {
     ScalarType* newArray;
     bool forceFreeFunction = false;
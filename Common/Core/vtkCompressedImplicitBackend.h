@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtkCompressedImplicitBackend_h
+#define vtkCompressedImplicitBackend_h
+
+/**
+ * \class vtkCompressedImplicitBackend
+ *
+ * A backend for the `vtkImplicitArray` framework keeping the values of an array compressed in
+ * memory, and decompressing them on access.
+ *
+ * At construction, the values of the given array are split into blocks of (by default) 65536
+ * values, and each block is compressed independently with a lossless codec: every value is
+ * XOR'ed with the same component of the previous tuple, and only the significant bytes of the
+ * result are stored. This is effective on smooth floating point fields, constant or slowly
+ * varying integer fields and ids. Blocks that do not compress are stored as is.
+ *
+ * When a value is requested, its whole block is decompressed and kept in a small cache of the
+ * most recently used blocks, so that coherent accesses only pay for the decompression once.
+ * Accesses are thread safe, and the cache is shared by the shallow copies of the array.
+ *
+ * This backend is meant for large arrays that are rarely accessed, to reduce the resident memory.
+ * Algorithms accessing every value several times should work on a decompressed copy instead.
+ *
+ * An example of potential usage in a `vtkImplicitArray`:
+ * ```
+ * vtkNew<vtkImplicitArray<vtkCompressedImplicitBackend<double>>> compressed; // More compact
+ *                                                  // with `vtkCompressedArray<double>`
+ * compressed->ConstructBackend(baseArray);
+ * compressed->SetNumberOfComponents(baseArray->GetNumberOfComponents());
+ * compressed->SetNumberOfTuples(baseArray->GetNumberOfTuples());
+ * CHECK(compressed->GetValue(42) == baseArray->GetComponent(14, 0)); // with 3 components
+ * ```
+ *
+ * @sa
+ * vtkImplicitArray, vtkCompressedArray
+ */
+
+#include "vtkCommonCoreModule.h"
+
+#include "vtkType.h"
+
+#include <memory>
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+template <typename ValueType>
+class VTKCOMMONCORE_EXPORT vtkCompressedImplicitBackend final
+{
+public:
+  /**
+   * Constructor
+   * @param array array to compress, it is not referenced after construction
+   * @param blockSize number of values per compressed block, rounded down to a multiple of the
+   * number of components of @a array
+   * @param cacheSize maximum number of decompressed blocks kept in memory
+   */
+  vtkCompressedImplicitBackend(
+    vtkDataArray* array, vtkIdType blockSize = 65536, int cacheSize = 4);
+  ~vtkCompressedImplicitBackend();
+
+  /**
+   * Indexing operation for the compressed array respecting the backend expectations of
+   * `vtkImplicitArray`
+   */
+  ValueType operator()(vtkIdType idx) const;
+
+  /**
+   * Fill @a tuple with the components of tuple @a idx, decompressing its block at most once.
+   */
+  void mapTuple(vtkIdType idx, ValueType* tuple) const;
+
+  /**
+   * Returns the smallest integer memory size in KiB needed to store the compressed values and
+   * the cached blocks.
+   * Used to implement GetActualMemorySize on `vtkCompressedImplicitBackend`.
+   */
+  unsigned long getMemorySize() const;
+
+  ///@{
+  /**
+   * Maximum number of decompressed blocks kept in memory. Must be at least 1.
+   */
+  void SetCacheSize(int size);
+  int GetCacheSize() const;
+  ///@}
+
+  /**
+   * Number of values per block.
+   */
+  vtkIdType GetBlockSize() const;
+
+  /**
+   * Number of compressed blocks.
+   */
+  vtkIdType GetNumberOfBlocks() const;
+
+  /**
+   * Number of bytes used by the compressed blocks.
+   */
+  vtkTypeInt64 GetCompressedSize() const;
+
+  /**
+   * Number of bytes the values would use uncompressed.
+   */
+  vtkTypeInt64 GetUncompressedSize() const;
+
+  /**
+   * Number of blocks decompressed so far, i.e. the number of cache misses.
+   */
+  vtkTypeInt64 GetNumberOfDecompressions() const;
+
+private:
+  struct Internals;
+  std::unique_ptr<Internals> Internal;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkCompressedImplicitBackend_h
+
+#if defined(VTK_COMPRESSED_BACKEND_INSTANTIATING)
+
+#define VTK_INSTANTIATE_COMPRESSED_BACKEND(ValueType)                                              \
+  VTK_ABI_NAMESPACE_BEGIN                                                                          \
+  template class VTKCOMMONCORE_EXPORT vtkCompressedImplicitBackend<ValueType>;                     \
+  VTK_ABI_NAMESPACE_END
+
+#elif defined(VTK_USE_EXTERN_TEMPLATE)
+
+#ifndef VTK_COMPRESSED_BACKEND_TEMPLATE_EXTERN
+#define VTK_COMPRESSED_BACKEND_TEMPLATE_EXTERN
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4910) // extern and dllexport incompatible
+#endif
+VTK_ABI_NAMESPACE_BEGIN
+vtkExternTemplateMacro(extern template class VTKCOMMONCORE_EXPORT vtkCompressedImplicitBackend);
+VTK_ABI_NAMESPACE_END
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#endif // VTK_COMPRESSED_BACKEND_TEMPLATE_EXTERN
+
+#endif
@@ -0,0 +1,361 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompressedImplicitBackend.h"
+
+#include "vtkArrayDispatch.h"
+#include "vtkAtomicMutex.h"
+#include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vtkCompressedImplicitBackendDetail
+{
+VTK_ABI_NAMESPACE_BEGIN
+//-----------------------------------------------------------------------
+// Unsigned integer with the size of the values, holding their bits.
+template <std::size_t Size>
+struct BitsType;
+template <>
+struct BitsType<1>
+{
+  using Type = std::uint8_t;
+};
+template <>
+struct BitsType<2>
+{
+  using Type = std::uint16_t;
+};
+template <>
+struct BitsType<4>
+{
+  using Type = std::uint32_t;
+};
+template <>
+struct BitsType<8>
+{
+  using Type = std::uint64_t;
+};
+
+// Blocks are stored as is when they do not compress.
+enum BlockEncoding : unsigned char
+{
+  RAW = 0,
+  XOR = 1
+};
+
+//-----------------------------------------------------------------------
+// Compress the blocks of the array, reading its values through the fastest range available.
+struct CompressWorker
+{
+  template <typename ArrayT, typename InternalsT>
+  void operator()(ArrayT* array, InternalsT* internals)
+  {
+    using ValueType = typename InternalsT::ValueType;
+    const auto range = vtk::DataArrayValueRange(array);
+    const vtkIdType numberOfValues = range.size();
+    std::vector<ValueType> block(
+      static_cast<std::size_t>(std::min(internals->BlockSize, numberOfValues)));
+    for (vtkIdType begin = 0; begin < numberOfValues; begin += internals->BlockSize)
+    {
+      const vtkIdType size = std::min(internals->BlockSize, numberOfValues - begin);
+      std::transform(range.begin() + begin, range.begin() + begin + size, block.begin(),
+        [](auto value) { return static_cast<ValueType>(value); });
+      internals->CompressBlock(block.data(), size);
+    }
+  }
+};
+VTK_ABI_NAMESPACE_END
+} // namespace vtkCompressedImplicitBackendDetail
+
+VTK_ABI_NAMESPACE_BEGIN
+//-----------------------------------------------------------------------
+template <typename ValueT>
+struct vtkCompressedImplicitBackend<ValueT>::Internals
+{
+  using ValueType = ValueT;
+  using Bits = typename vtkCompressedImplicitBackendDetail::BitsType<sizeof(ValueType)>::Type;
+  using Block = std::vector<ValueType>;
+
+  struct CachedBlock
+  {
+    vtkIdType Index;
+    std::shared_ptr<const Block> Values;
+  };
+
+  Internals(vtkDataArray* array, vtkIdType blockSize, int cacheSize)
+    : CacheSize(std::max(cacheSize, 1))
+  {
+    this->Offsets.push_back(0);
+    if (!array)
+    {
+      vtkErrorWithObjectMacro(nullptr, "Cannot compress a nullptr array");
+      return;
+    }
+    // Blocks hold whole tuples so that mapTuple decompresses at most one block.
+    this->NumberOfComponents = std::max(array->GetNumberOfComponents(), 1);
+    this->BlockSize =
+      std::max<vtkIdType>(blockSize / this->NumberOfComponents, 1) * this->NumberOfComponents;
+    this->NumberOfValues = array->GetNumberOfValues();
+
+    vtkCompressedImplicitBackendDetail::CompressWorker worker;
+    if (!vtkArrayDispatch::Dispatch::Execute(array, worker, this))
+    {
+      worker(array, this);
+    }
+    this->Data.shrink_to_fit();
+  }
+
+  static Bits ToBits(ValueType value)
+  {
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(ValueType));
+    return bits;
+  }
+
+  static ValueType FromBits(Bits bits)
+  {
+    ValueType value;
+    std::memcpy(&value, &bits, sizeof(ValueType));
+    return value;
+  }
+
+  // Encode each value as its XOR with the same component of the previous tuple. Close values
+  // share their high order bytes, so only the low order bytes that differ are stored, and their
+  // count is stored in a 4 bits header per value.
+  void CompressBlock(const ValueType* values, vtkIdType size)
+  {
+    const std::size_t rawSize = static_cast<std::size_t>(size) * sizeof(ValueType);
+    const std::size_t headerSize = static_cast<std::size_t>(size + 1) / 2;
+    std::vector<unsigned char> encoded(1 + headerSize);
+    encoded.reserve(1 + headerSize + rawSize);
+    encoded[0] = vtkCompressedImplicitBackendDetail::XOR;
+    for (vtkIdType i = 0; i < size && encoded.size() < 1 + rawSize; ++i)
+    {
+      Bits bits = ToBits(values[i]);
+      if (i >= this->NumberOfComponents)
+      {
+        bits ^= ToBits(values[i - this->NumberOfComponents]);
+      }
+      unsigned char numberOfBytes = 0;
+      for (Bits remaining = bits; remaining; remaining = static_cast<Bits>(remaining >> 8))
+      {
+        encoded.push_back(static_cast<unsigned char>(remaining & 0xFF));
+        ++numberOfBytes;
+      }
+      encoded[1 + i / 2] |= static_cast<unsigned char>(numberOfBytes << (4 * (i % 2)));
+    }
+
+    if (encoded.size() < 1 + rawSize)
+    {
+      this->Data.insert(this->Data.end(), encoded.begin(), encoded.end());
+    }
+    else
+    {
+      this->Data.push_back(vtkCompressedImplicitBackendDetail::RAW);
+      const unsigned char* raw = reinterpret_cast<const unsigned char*>(values);
+      this->Data.insert(this->Data.end(), raw, raw + rawSize);
+    }
+    this->Offsets.push_back(this->Data.size());
+  }
+
+  void DecompressBlock(vtkIdType blockIdx, Block& block) const
+  {
+    const vtkIdType begin = blockIdx * this->BlockSize;
+    const vtkIdType size = std::min(this->BlockSize, this->NumberOfValues - begin);
+    block.resize(static_cast<std::size_t>(size));
+    const unsigned char* data = this->Data.data() + this->Offsets[blockIdx];
+    if (data[0] == vtkCompressedImplicitBackendDetail::RAW)
+    {
+      std::memcpy(block.data(), data + 1, static_cast<std::size_t>(size) * sizeof(ValueType));
+      return;
+    }
+
+    const unsigned char* header = data + 1;
+    const unsigned char* payload = header + (size + 1) / 2;
+    for (vtkIdType i = 0; i < size; ++i)
+    {
+      const unsigned char numberOfBytes = (header[i / 2] >> (4 * (i % 2))) & 0x0F;
+      Bits bits = 0;
+      for (unsigned char b = 0; b < numberOfBytes; ++b)
+      {
+        bits |= static_cast<Bits>(static_cast<Bits>(*payload++) << (8 * b));
+      }
+      if (i >= this->NumberOfComponents)
+      {
+        bits ^= ToBits(block[i - this->NumberOfComponents]);
+      }
+      block[i] = FromBits(bits);
+    }
+  }
+
+  // Call accessor with the decompressed block, looking it up in the cache first. Blocks are
+  // decompressed without holding the lock, so that threads missing different blocks do not
+  // wait for each other.
+  template <typename Accessor>
+  void Access(vtkIdType blockIdx, Accessor&& accessor) const
+  {
+    {
+      std::lock_guard<vtkAtomicMutex> guard(this->Lock);
+      for (auto it = this->Cache.begin(); it != this->Cache.end(); ++it)
+      {
+        if (it->Index == blockIdx)
+        {
+          if (it != this->Cache.begin())
+          {
+            this->Cache.splice(this->Cache.begin(), this->Cache, it);
+          }
+          accessor(*this->Cache.front().Values);
+          return;
+        }
+      }
+    }
+
+    auto block = std::make_shared<Block>();
+    this->DecompressBlock(blockIdx, *block);
+    ++this->NumberOfDecompressions;
+    accessor(*block);
+
+    std::lock_guard<vtkAtomicMutex> guard(this->Lock);
+    if (std::none_of(this->Cache.begin(), this->Cache.end(),
+          [blockIdx](const CachedBlock& cached) { return cached.Index == blockIdx; }))
+    {
+      this->Cache.push_front(CachedBlock{ blockIdx, std::move(block) });
+      this->TrimCache();
+    }
+  }
+
+  void TrimCache() const
+  {
+    while (static_cast<int>(this->Cache.size()) > this->CacheSize)
+    {
+      this->Cache.pop_back();
+    }
+  }
+
+  vtkIdType NumberOfValues = 0;
+  int NumberOfComponents = 1;
+  vtkIdType BlockSize = 1;
+  std::vector<unsigned char> Data;
+  std::vector<std::size_t> Offsets;
+
+  int CacheSize;
+  mutable vtkAtomicMutex Lock;
+  mutable std::list<CachedBlock> Cache;
+  mutable std::atomic<vtkTypeInt64> NumberOfDecompressions{ 0 };
+};
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+vtkCompressedImplicitBackend<ValueType>::vtkCompressedImplicitBackend(
+  vtkDataArray* array, vtkIdType blockSize, int cacheSize)
+  : Internal(std::unique_ptr<Internals>(new Internals(array, blockSize, cacheSize)))
+{
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+vtkCompressedImplicitBackend<ValueType>::~vtkCompressedImplicitBackend() = default;
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+ValueType vtkCompressedImplicitBackend<ValueType>::operator()(vtkIdType idx) const
+{
+  const vtkIdType blockSize = this->Internal->BlockSize;
+  ValueType value;
+  this->Internal->Access(idx / blockSize,
+    [&value, idx, blockSize](const std::vector<ValueType>& block)
+    { value = block[idx % blockSize]; });
+  return value;
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+void vtkCompressedImplicitBackend<ValueType>::mapTuple(vtkIdType idx, ValueType* tuple) const
+{
+  const vtkIdType blockSize = this->Internal->BlockSize;
+  const int numberOfComponents = this->Internal->NumberOfComponents;
+  const vtkIdType valueIdx = idx * numberOfComponents;
+  this->Internal->Access(valueIdx / blockSize,
+    [tuple, valueIdx, blockSize, numberOfComponents](const std::vector<ValueType>& block)
+    {
+      auto first = block.begin() + valueIdx % blockSize;
+      std::copy(first, first + numberOfComponents, tuple);
+    });
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+unsigned long vtkCompressedImplicitBackend<ValueType>::getMemorySize() const
+{
+  std::size_t bytes =
+    this->Internal->Data.capacity() + this->Internal->Offsets.capacity() * sizeof(std::size_t);
+  {
+    std::lock_guard<vtkAtomicMutex> guard(this->Internal->Lock);
+    for (const auto& cached : this->Internal->Cache)
+    {
+      bytes += cached.Values->capacity() * sizeof(ValueType);
+    }
+  }
+  return static_cast<unsigned long>(std::ceil(bytes / 1024.0));
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+void vtkCompressedImplicitBackend<ValueType>::SetCacheSize(int size)
+{
+  std::lock_guard<vtkAtomicMutex> guard(this->Internal->Lock);
+  this->Internal->CacheSize = std::max(size, 1);
+  this->Internal->TrimCache();
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+int vtkCompressedImplicitBackend<ValueType>::GetCacheSize() const
+{
+  return this->Internal->CacheSize;
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+vtkIdType vtkCompressedImplicitBackend<ValueType>::GetBlockSize() const
+{
+  return this->Internal->BlockSize;
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+vtkIdType vtkCompressedImplicitBackend<ValueType>::GetNumberOfBlocks() const
+{
+  return static_cast<vtkIdType>(this->Internal->Offsets.size()) - 1;
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+vtkTypeInt64 vtkCompressedImplicitBackend<ValueType>::GetCompressedSize() const
+{
+  return static_cast<vtkTypeInt64>(this->Internal->Data.size());
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+vtkTypeInt64 vtkCompressedImplicitBackend<ValueType>::GetUncompressedSize() const
+{
+  return static_cast<vtkTypeInt64>(this->Internal->NumberOfValues) * sizeof(ValueType);
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+vtkTypeInt64 vtkCompressedImplicitBackend<ValueType>::GetNumberOfDecompressions() const
+{
+  return this->Internal->NumberOfDecompressions;
+}
+VTK_ABI_NAMESPACE_END
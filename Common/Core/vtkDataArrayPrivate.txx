@@ -5,6 +5,7 @@
 
 #ifndef VTK_GDA_TEMPLATE_EXTERN
 
+#include "vtkAOSDataArrayTemplate.h"
 #include "vtkAssume.h"
 #include "vtkDataArray.h"
 #include "vtkDataArrayRange.h"
@@ -16,7 +17,9 @@
 #include <algorithm>
 #include <array>
 #include <cassert> // for assert()
+#include <cmath>
 #include <limits>
+#include <type_traits>
 #include <vector>
 
 namespace vtkDataArrayPrivate
@@ -332,6 +335,207 @@ public:
   }
 };
 
+//----------------------------------------------------------------------------
+// Kernels for arrays storing their values contiguously (vtkAOSDataArrayTemplate) when no ghost
+// is skipped. They are written without branches, so that comparisons and selects map to vector
+// min/max instructions, and with several independent accumulators per component, so that the
+// compiler can vectorize across tuples even with interleaved components. NaN are skipped by the
+// comparisons themselves, and infinite values by an extra mask for FiniteValues.
+namespace detail
+{
+template <typename T>
+bool IsFinite(T value, typename std::enable_if<std::is_floating_point<T>::value>::type* = nullptr)
+{
+  // false for NaN too
+  return std::abs(value) <= std::numeric_limits<T>::max();
+}
+
+template <typename T>
+bool IsFinite(T, typename std::enable_if<!std::is_floating_point<T>::value>::type* = nullptr)
+{
+  return true;
+}
+
+template <typename T>
+void SelectRange(T& min0, T& max0, T value, AllValues)
+{
+  min0 = value < min0 ? value : min0;
+  max0 = value > max0 ? value : max0;
+}
+
+template <typename T>
+void SelectRange(T& min0, T& max0, T value, FiniteValues)
+{
+  const bool finite = IsFinite(value);
+  min0 = (finite & (value < min0)) ? value : min0;
+  max0 = (finite & (value > max0)) ? value : max0;
+}
+}
+
+template <int NumComps, typename ValueType, typename Tag>
+class ContiguousMinAndMax : public MinAndMax<ValueType, NumComps>
+{
+private:
+  using MinAndMaxT = MinAndMax<ValueType, NumComps>;
+  // Fill a 256 bits register per component with each accumulator.
+  static constexpr int Lanes = sizeof(ValueType) >= 32 ? 1 : 32 / sizeof(ValueType);
+  static constexpr int Width = NumComps * Lanes;
+  const ValueType* Values;
+
+public:
+  ContiguousMinAndMax(const ValueType* values)
+    : MinAndMaxT()
+    , Values(values)
+  {
+  }
+  // Help vtkSMPTools find Initialize() and Reduce()
+  void Initialize() { MinAndMaxT::Initialize(); }
+  void Reduce() { MinAndMaxT::Reduce(); }
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    ValueType mins[Width];
+    ValueType maxs[Width];
+    for (int k = 0; k < Width; ++k)
+    {
+      mins[k] = vtkTypeTraits<ValueType>::Max();
+      maxs[k] = vtkTypeTraits<ValueType>::Min();
+    }
+    const ValueType* it = this->Values + begin * NumComps;
+    const ValueType* last = this->Values + end * NumComps;
+    for (; last - it >= Width; it += Width)
+    {
+      for (int k = 0; k < Width; ++k)
+      {
+        detail::SelectRange(mins[k], maxs[k], it[k], Tag{});
+      }
+    }
+    // Width is a multiple of NumComps, so the remainder starts at a tuple boundary.
+    for (int k = 0; it < last; ++it, ++k)
+    {
+      detail::SelectRange(mins[k], maxs[k], *it, Tag{});
+    }
+
+    auto& range = MinAndMaxT::TLRange.Local();
+    for (int k = 0; k < Width; ++k)
+    {
+      const int j = 2 * (k % NumComps);
+      range[j] = detail::min(range[j], mins[k]);
+      range[j + 1] = detail::max(range[j + 1], maxs[k]);
+    }
+  }
+};
+
+template <int NumComps, typename ValueType, typename Tag>
+class ContiguousMagnitudeMinAndMax : public MinAndMax<double, 1>
+{
+private:
+  using MinAndMaxT = MinAndMax<double, 1>;
+  static constexpr int Lanes = 4;
+  const ValueType* Values;
+
+public:
+  ContiguousMagnitudeMinAndMax(const ValueType* values)
+    : MinAndMaxT()
+    , Values(values)
+  {
+  }
+  // Help vtkSMPTools find Initialize() and Reduce()
+  void Initialize() { MinAndMaxT::Initialize(); }
+  void Reduce() { MinAndMaxT::Reduce(); }
+  template <typename T>
+  void CopyRanges(T* ranges)
+  {
+    MinAndMaxT::CopyRanges(ranges);
+    ranges[0] = std::sqrt(ranges[0]);
+    ranges[1] = std::sqrt(ranges[1]);
+  }
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    // Squares are summed in double, like the generic magnitude kernels are
+    // instantiated by DoComputeVectorRange, so small integer types cannot wrap.
+    double mins[Lanes];
+    double maxs[Lanes];
+    for (int k = 0; k < Lanes; ++k)
+    {
+      mins[k] = vtkTypeTraits<double>::Max();
+      maxs[k] = vtkTypeTraits<double>::Min();
+    }
+    const ValueType* values = this->Values;
+    vtkIdType tupleIdx = begin;
+    for (; end - tupleIdx >= Lanes; tupleIdx += Lanes)
+    {
+      for (int k = 0; k < Lanes; ++k)
+      {
+        const ValueType* tuple = values + (tupleIdx + k) * NumComps;
+        double squaredSum = 0.0;
+        for (int c = 0; c < NumComps; ++c)
+        {
+          squaredSum += static_cast<double>(tuple[c]) * static_cast<double>(tuple[c]);
+        }
+        detail::SelectRange(mins[k], maxs[k], squaredSum, Tag{});
+      }
+    }
+    for (int k = 0; tupleIdx < end; ++tupleIdx, ++k)
+    {
+      const ValueType* tuple = values + tupleIdx * NumComps;
+      double squaredSum = 0.0;
+      for (int c = 0; c < NumComps; ++c)
+      {
+        squaredSum += static_cast<double>(tuple[c]) * static_cast<double>(tuple[c]);
+      }
+      detail::SelectRange(mins[k], maxs[k], squaredSum, Tag{});
+    }
+
+    auto& range = MinAndMaxT::TLRange.Local();
+    for (int k = 0; k < Lanes; ++k)
+    {
+      range[0] = detail::min(range[0], mins[k]);
+      range[1] = detail::max(range[1], maxs[k]);
+    }
+  }
+};
+
+// Use the contiguous kernels when possible, return false otherwise.
+template <int NumComps, typename ArrayT, typename RangeValueType, typename Tag>
+bool ComputeContiguousScalarRange(ArrayT*, RangeValueType*, Tag, const unsigned char*)
+{
+  return false;
+}
+
+template <int NumComps, typename ValueType, typename RangeValueType, typename Tag>
+bool ComputeContiguousScalarRange(vtkAOSDataArrayTemplate<ValueType>* array,
+  RangeValueType* ranges, Tag, const unsigned char* ghosts)
+{
+  if (ghosts)
+  {
+    return false;
+  }
+  ContiguousMinAndMax<NumComps, ValueType, Tag> minmax(array->GetPointer(0));
+  vtkSMPTools::For(0, array->GetNumberOfTuples(), minmax);
+  minmax.CopyRanges(ranges);
+  return true;
+}
+
+template <int NumComps, typename ArrayT, typename RangeValueType, typename Tag>
+bool ComputeContiguousVectorRange(ArrayT*, RangeValueType*, Tag, const unsigned char*)
+{
+  return false;
+}
+
+template <int NumComps, typename ValueType, typename RangeValueType, typename Tag>
+bool ComputeContiguousVectorRange(vtkAOSDataArrayTemplate<ValueType>* array,
+  RangeValueType* range, Tag, const unsigned char* ghosts)
+{
+  if (ghosts || array->GetNumberOfComponents() != NumComps)
+  {
+    return false;
+  }
+  ContiguousMagnitudeMinAndMax<NumComps, ValueType, Tag> minmax(array->GetPointer(0));
+  vtkSMPTools::For(0, array->GetNumberOfTuples(), minmax);
+  minmax.CopyRanges(range);
+  return true;
+}
+
 //----------------------------------------------------------------------------
 template <int NumComps>
 struct ComputeScalarRange
@@ -340,6 +544,10 @@ struct ComputeScalarRange
   bool operator()(ArrayT* array, RangeValueType* ranges, AllValues, const unsigned char* ghosts,
     unsigned char ghostsToSkip)
   {
+    if (ComputeContiguousScalarRange<NumComps>(array, ranges, AllValues{}, ghosts))
+    {
+      return true;
+    }
     AllValuesMinAndMax<NumComps, ArrayT> minmax(array, ghosts, ghostsToSkip);
     vtkSMPTools::For(0, array->GetNumberOfTuples(), minmax);
     minmax.CopyRanges(ranges);
@@ -349,6 +557,10 @@ struct ComputeScalarRange
   bool operator()(ArrayT* array, RangeValueType* ranges, FiniteValues, const unsigned char* ghosts,
     unsigned char ghostsToSkip)
   {
+    if (ComputeContiguousScalarRange<NumComps>(array, ranges, FiniteValues{}, ghosts))
+    {
+      return true;
+    }
     FiniteMinAndMax<NumComps, ArrayT> minmax(array, ghosts, ghostsToSkip);
     vtkSMPTools::For(0, array->GetNumberOfTuples(), minmax);
     minmax.CopyRanges(ranges);
@@ -573,6 +785,25 @@ bool DoComputeScalarRange(ArrayT* array, RangeValueType* ranges, ValueType tag,
   }
 }
 
+//----------------------------------------------------------------------------
+// Contiguous kernels for the most common vector sizes.
+template <typename ArrayT, typename RangeValueType, typename Tag>
+bool DispatchContiguousVectorRange(
+  ArrayT* array, RangeValueType* range, Tag tag, const unsigned char* ghosts)
+{
+  switch (array->GetNumberOfComponents())
+  {
+    case 2:
+      return ComputeContiguousVectorRange<2>(array, range, tag, ghosts);
+    case 3:
+      return ComputeContiguousVectorRange<3>(array, range, tag, ghosts);
+    case 4:
+      return ComputeContiguousVectorRange<4>(array, range, tag, ghosts);
+    default:
+      return false;
+  }
+}
+
 //----------------------------------------------------------------------------
 // generic implementation that operates on ValueType.
 template <typename ArrayT, typename RangeValueType>
@@ -589,6 +820,11 @@ bool DoComputeVectorRange(ArrayT* array, RangeValueType range[2], AllValues,
     return false;
   }
 
+  if (DispatchContiguousVectorRange(array, range, AllValues{}, ghosts))
+  {
+    return true;
+  }
+
   // Always compute at double precision for vector magnitudes. This will
   // give precision errors on large 64-bit ints, but magnitudes aren't usually
   // computed for those.
@@ -614,6 +850,11 @@ bool DoComputeVectorRange(ArrayT* array, RangeValueType range[2], FiniteValues,
     return false;
   }
 
+  if (DispatchContiguousVectorRange(array, range, FiniteValues{}, ghosts))
+  {
+    return true;
+  }
+
   // Always compute at double precision for vector magnitudes. This will
   // give precision errors on large 64-bit ints, but magnitudes aren't usually
   // computed for those.
@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkFileMapping.h"
+#include "vtkObjectFactory.h"
+
+#ifdef _WIN32
+#include "vtkWindows.h"
+#include "vtksys/Encoding.hxx"
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkFileMapping);
+
+//------------------------------------------------------------------------------
+vtkFileMapping::~vtkFileMapping()
+{
+  this->Unmap();
+}
+
+//------------------------------------------------------------------------------
+bool vtkFileMapping::Map(const char* fileName, vtkTypeInt64 offset, vtkTypeInt64 length, int mode)
+{
+  this->Unmap();
+
+  if (!fileName)
+  {
+    vtkErrorMacro("No file name specified.");
+    return false;
+  }
+  if (offset < 0)
+  {
+    vtkErrorMacro("Invalid offset " << offset << " in file " << fileName);
+    return false;
+  }
+  if (mode != READ_ONLY && mode != COPY_ON_WRITE)
+  {
+    vtkErrorMacro("Invalid mapping mode " << mode);
+    return false;
+  }
+
+#ifdef _WIN32
+  HANDLE file = CreateFileW(vtksys::Encoding::ToWindowsExtendedPath(fileName).c_str(), GENERIC_READ,
+    FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    vtkErrorMacro("Could not open file " << fileName);
+    return false;
+  }
+
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize))
+  {
+    vtkErrorMacro("Could not get the size of file " << fileName);
+    CloseHandle(file);
+    return false;
+  }
+  const vtkTypeInt64 size = fileSize.QuadPart;
+#else
+  const int file = open(fileName, O_RDONLY);
+  if (file < 0)
+  {
+    vtkErrorMacro("Could not open file " << fileName << ": " << strerror(errno));
+    return false;
+  }
+
+  struct stat fileStat;
+  if (fstat(file, &fileStat) != 0)
+  {
+    vtkErrorMacro("Could not get the size of file " << fileName << ": " << strerror(errno));
+    close(file);
+    return false;
+  }
+  const vtkTypeInt64 size = static_cast<vtkTypeInt64>(fileStat.st_size);
+#endif
+
+  if (length < 0)
+  {
+    length = size - offset;
+  }
+  if (offset > size || length > size - offset)
+  {
+    vtkErrorMacro("Region [" << offset << ", " << offset + length << ") is out of file "
+                             << fileName << " of " << size << " bytes.");
+#ifdef _WIN32
+    CloseHandle(file);
+#else
+    close(file);
+#endif
+    return false;
+  }
+
+  if (length == 0)
+  {
+    // Nothing to map, the system would refuse an empty mapping.
+#ifdef _WIN32
+    CloseHandle(file);
+#else
+    close(file);
+#endif
+    this->Mode = mode;
+    this->Mapped = true;
+    return true;
+  }
+
+#ifdef _WIN32
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  const vtkTypeInt64 granularity = systemInfo.dwAllocationGranularity;
+#else
+  const vtkTypeInt64 granularity = sysconf(_SC_PAGESIZE);
+#endif
+  const vtkTypeInt64 alignedOffset = offset - offset % granularity;
+  const vtkTypeInt64 mappedLength = length + (offset - alignedOffset);
+
+#ifdef _WIN32
+  // The mapping object and the file can be closed once the view is created,
+  // the view keeps them alive.
+  HANDLE mapping = CreateFileMappingW(file, nullptr,
+    mode == READ_ONLY ? PAGE_READONLY : PAGE_WRITECOPY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (!mapping)
+  {
+    vtkErrorMacro("Could not create a file mapping for " << fileName);
+    return false;
+  }
+  void* address = MapViewOfFile(mapping, mode == READ_ONLY ? FILE_MAP_READ : FILE_MAP_COPY,
+    static_cast<DWORD>(alignedOffset >> 32), static_cast<DWORD>(alignedOffset & 0xFFFFFFFF),
+    static_cast<SIZE_T>(mappedLength));
+  CloseHandle(mapping);
+  if (!address)
+  {
+    vtkErrorMacro("Could not map " << length << " bytes of file " << fileName);
+    return false;
+  }
+#else
+  // The file can be closed once mapped, the mapping keeps a reference on it.
+  void* address = mmap(nullptr, static_cast<size_t>(mappedLength),
+    mode == READ_ONLY ? PROT_READ : PROT_READ | PROT_WRITE,
+    mode == READ_ONLY ? MAP_SHARED : MAP_PRIVATE, file, static_cast<off_t>(alignedOffset));
+  close(file);
+  if (address == MAP_FAILED)
+  {
+    vtkErrorMacro("Could not map " << length << " bytes of file " << fileName << ": "
+                                   << strerror(errno));
+    return false;
+  }
+#endif
+
+  this->MappedAddress = address;
+  this->MappedLength = mappedLength;
+  this->Pointer = static_cast<char*>(address) + (offset - alignedOffset);
+  this->Length = length;
+  this->Mode = mode;
+  this->Mapped = true;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkFileMapping::Unmap()
+{
+  if (this->MappedAddress)
+  {
+#ifdef _WIN32
+    UnmapViewOfFile(this->MappedAddress);
+#else
+    munmap(this->MappedAddress, static_cast<size_t>(this->MappedLength));
+#endif
+  }
+
+  this->MappedAddress = nullptr;
+  this->MappedLength = 0;
+  this->Pointer = nullptr;
+  this->Length = 0;
+  this->Mapped = false;
+}
+
+//------------------------------------------------------------------------------
+void vtkFileMapping::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Mapped: " << this->Mapped << "\n";
+  os << indent << "Length: " << this->Length << "\n";
+  os << indent << "Mode: " << (this->Mode == READ_ONLY ? "READ_ONLY" : "COPY_ON_WRITE") << "\n";
+}
+VTK_ABI_NAMESPACE_END
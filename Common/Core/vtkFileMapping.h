@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkFileMapping
+ * @brief   map a region of a file in memory
+ *
+ * vtkFileMapping maps a byte range of a file in the address space of the
+ * process, using mmap on POSIX systems and file mapping objects on Windows.
+ * Nothing is read when the region is mapped: pages are loaded by the system
+ * the first time they are accessed, and can be evicted again under memory
+ * pressure since they are backed by the file.
+ *
+ * Two modes are available:
+ * - READ_ONLY: the region is shared with the file and can only be read.
+ *   Writing to it crashes the process.
+ * - COPY_ON_WRITE: the region can be modified, modified pages are copied in
+ *   private memory and the file itself is never changed.
+ *
+ * vtkFileMapping is used by vtkBuffer to back vtkAOSDataArrayTemplate and
+ * vtkSOADataArrayTemplate with files, see vtkAOSDataArrayTemplate::MapFile()
+ * and vtkSOADataArrayTemplate::MapFile().
+ *
+ * @sa vtkBuffer
+ */
+
+#ifndef vtkFileMapping_h
+#define vtkFileMapping_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkObject.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkFileMapping : public vtkObject
+{
+public:
+  static vtkFileMapping* New();
+  vtkTypeMacro(vtkFileMapping, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  enum MappingModes
+  {
+    READ_ONLY = 0,
+    COPY_ON_WRITE
+  };
+
+  /**
+   * Map @a length bytes of the file @a fileName, starting at byte @a offset.
+   * If @a length is negative, the file is mapped up to its end.
+   * Any region previously mapped by this object is unmapped first.
+   * Return false and report an error if the file can not be mapped.
+   */
+  bool Map(const char* fileName, vtkTypeInt64 offset, vtkTypeInt64 length, int mode = READ_ONLY);
+
+  /**
+   * Unmap the current region, if any. Pointers previously returned by
+   * GetPointer() become invalid.
+   */
+  void Unmap();
+
+  /**
+   * Return true if a region is mapped.
+   */
+  bool IsMapped() const { return this->Mapped; }
+
+  /**
+   * Pointer to the first byte of the mapped region, nullptr if nothing is mapped
+   * or if the region is empty.
+   */
+  void* GetPointer() const { return this->Pointer; }
+
+  /**
+   * Size of the mapped region in bytes.
+   */
+  vtkTypeInt64 GetLength() const { return this->Length; }
+
+  /**
+   * Mode of the mapped region, see MappingModes.
+   */
+  int GetMode() const { return this->Mode; }
+
+protected:
+  vtkFileMapping() = default;
+  ~vtkFileMapping() override;
+
+private:
+  vtkFileMapping(const vtkFileMapping&) = delete;
+  void operator=(const vtkFileMapping&) = delete;
+
+  // Mapping granularity: the system maps whole pages, from an aligned offset
+  void* MappedAddress = nullptr;
+  vtkTypeInt64 MappedLength = 0;
+  void* Pointer = nullptr;
+  vtkTypeInt64 Length = 0;
+  bool Mapped = false;
+  int Mode = READ_ONLY;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkIdList.h"
+#include "vtkMemoryResource.h"
 #include "vtkObjectFactory.h"
 #include "vtkSMPTools.h" //for parallel sort
 
@@ -14,14 +15,61 @@ vtkIdList::vtkIdList()
   this->Size = 0;
   this->Ids = nullptr;
   this->ManageMemory = true;
+  this->SetMemoryResource(vtkMemoryResource::GetCurrent());
 }
 
 //------------------------------------------------------------------------------
 vtkIdList::~vtkIdList()
 {
-  if (this->ManageMemory)
+  this->InitializeMemory();
+  this->SetMemoryResource(nullptr);
+}
+
+//------------------------------------------------------------------------------
+void vtkIdList::SetMemoryResource(vtkMemoryResource* resource)
+{
+  if (this->MemoryResource != resource)
   {
-    delete[] this->Ids;
+    if (this->MemoryResource)
+    {
+      this->MemoryResource->UnRegister(nullptr);
+    }
+    this->MemoryResource = resource;
+    if (this->MemoryResource)
+    {
+      this->MemoryResource->Register(nullptr);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkIdType* vtkIdList::NewIds(vtkIdType size, vtkMemoryResource*& resource)
+{
+  resource = this->MemoryResource;
+  if (!resource)
+  {
+    return new vtkIdType[size];
+  }
+  auto ids = static_cast<vtkIdType*>(
+    resource->Allocate(size * sizeof(vtkIdType), alignof(vtkIdType)));
+  if (ids)
+  {
+    resource->Register(nullptr);
+  }
+  return ids;
+}
+
+//------------------------------------------------------------------------------
+void vtkIdList::DeleteIds(vtkIdType* ids, vtkIdType size, vtkMemoryResource* resource)
+{
+  if (resource)
+  {
+    resource->Deallocate(ids, size * sizeof(vtkIdType), alignof(vtkIdType));
+    resource->UnRegister(nullptr);
+  }
+  else
+  {
+    delete[] ids;
   }
 }
 
@@ -29,6 +77,14 @@ vtkIdList::~vtkIdList()
 vtkIdType* vtkIdList::Release()
 {
   auto retval = this->Ids;
+  if (this->IdsResource && retval)
+  {
+    // The caller releases the ids with delete[]
+    retval = new vtkIdType[this->Size];
+    std::copy(this->Ids, this->Ids + this->NumberOfIds, retval);
+    this->DeleteIds(this->Ids, this->Size, this->IdsResource);
+  }
+  this->IdsResource = nullptr;
   this->Ids = nullptr;
   this->Initialize();
   return retval;
@@ -39,9 +95,10 @@ void vtkIdList::InitializeMemory()
 {
   if (this->ManageMemory)
   {
-    delete[] this->Ids;
+    this->DeleteIds(this->Ids, this->Size, this->IdsResource);
   }
   this->ManageMemory = true;
+  this->IdsResource = nullptr;
   this->Ids = nullptr;
 }
 
@@ -60,7 +117,7 @@ bool vtkIdList::AllocateInternal(vtkIdType sz, vtkIdType numberOfIds)
   {
     this->InitializeMemory();
     this->Size = (sz > 0 ? sz : 1);
-    this->Ids = new vtkIdType[this->Size];
+    this->Ids = this->NewIds(this->Size, this->IdsResource);
     if (this->Ids == nullptr)
     {
       vtkErrorMacro("Could not allocate memory for " << this->Size << " ids.");
@@ -116,10 +173,7 @@ vtkIdType* vtkIdList::WritePointer(const vtkIdType i, const vtkIdType number)
 //------------------------------------------------------------------------------
 void vtkIdList::SetArray(vtkIdType* array, vtkIdType size, bool save)
 {
-  if (this->ManageMemory)
-  {
-    delete[] this->Ids;
-  }
+  this->InitializeMemory();
   if (!array)
   {
     if (size)
@@ -200,7 +254,8 @@ vtkIdType* vtkIdList::Resize(const vtkIdType sz)
     return nullptr;
   }
 
-  if ((newIds = new vtkIdType[newSize]) == nullptr)
+  vtkMemoryResource* newIdsResource;
+  if ((newIds = this->NewIds(newSize, newIdsResource)) == nullptr)
   {
     vtkErrorMacro(<< "Cannot allocate memory\n");
     return nullptr;
@@ -217,10 +272,11 @@ vtkIdType* vtkIdList::Resize(const vtkIdType sz)
       static_cast<size_t>(sz < this->Size ? sz : this->Size) * sizeof(vtkIdType));
     if (this->ManageMemory)
     {
-      delete[] this->Ids;
+      this->DeleteIds(this->Ids, this->Size, this->IdsResource);
     }
   }
   this->ManageMemory = true;
+  this->IdsResource = newIdsResource;
 
   this->Size = newSize;
   this->Ids = newIds;
@@ -17,6 +17,8 @@
 #include "vtkWrappingHints.h" // For VTK_MARSHALAUTO
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkMemoryResource;
+
 class VTKCOMMONCORE_EXPORT VTK_MARSHALAUTO vtkIdList : public vtkObject
 {
 public:
@@ -172,6 +174,19 @@ public:
    * call.
    */
   vtkIdType* Release();
+
+  ///@{
+  /**
+   * Set/Get the memory resource used to allocate ids. By default, this is the
+   * current resource of the thread constructing the list (see
+   * vtkMemoryResource::GetCurrent()). When it is nullptr, ids are allocated
+   * with new[]. Ids already allocated are not moved to the new resource.
+   */
+  VTK_MARSHALEXCLUDE(VTK_MARSHAL_EXCLUDE_REASON_IS_INTERNAL)
+  void SetMemoryResource(vtkMemoryResource* resource);
+  VTK_MARSHALEXCLUDE(VTK_MARSHAL_EXCLUDE_REASON_IS_INTERNAL)
+  vtkMemoryResource* GetMemoryResource() const { return this->MemoryResource; }
+  ///@}
 #endif
 
   ///@{
@@ -202,6 +217,14 @@ protected:
   bool ManageMemory;
 
 private:
+  // Allocate and release ids with MemoryResource, or new[] when there is no resource.
+  // resource is the resource that allocated the ids, nullptr for new[].
+  vtkIdType* NewIds(vtkIdType size, vtkMemoryResource*& resource);
+  void DeleteIds(vtkIdType* ids, vtkIdType size, vtkMemoryResource* resource);
+
+  vtkMemoryResource* MemoryResource = nullptr;
+  vtkMemoryResource* IdsResource = nullptr;
+
   vtkIdList(const vtkIdList&) = delete;
   void operator=(const vtkIdList&) = delete;
 };
@@ -35,7 +35,7 @@ endmacro()
 
 include(vtkTypeLists)
 
-foreach(backend IN ITEMS Constant Affine Indexed Composite)
+foreach(backend IN ITEMS Constant Affine Indexed Composite Compressed)
   foreach (type IN LISTS vtk_numeric_types)
     vtk_type_to_camel_case("${type}" cased_type)
     _generate_implicit_array_specialization("${backend}" "${cased_type}" "${type}")
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkMemoryResource.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// Defined at namespace scope: MSVC refuses thread_local variables in exported functions.
+VTK_THREAD_LOCAL vtkMemoryResource* CurrentMemoryResource = nullptr;
+}
+
+//------------------------------------------------------------------------------
+void* vtkMemoryResource::Allocate(std::size_t bytes, std::size_t alignment)
+{
+  void* pointer = this->DoAllocate(bytes, alignment);
+  if (!pointer)
+  {
+    return nullptr;
+  }
+
+  const auto size = static_cast<vtkTypeInt64>(bytes);
+  const vtkTypeInt64 inUse = this->BytesInUse.fetch_add(size, std::memory_order_relaxed) + size;
+  this->TotalBytesAllocated.fetch_add(size, std::memory_order_relaxed);
+  this->NumberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+  vtkTypeInt64 peak = this->PeakBytesInUse.load(std::memory_order_relaxed);
+  while (peak < inUse &&
+    !this->PeakBytesInUse.compare_exchange_weak(peak, inUse, std::memory_order_relaxed))
+  {
+  }
+  return pointer;
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryResource::Deallocate(void* pointer, std::size_t bytes, std::size_t alignment)
+{
+  if (!pointer)
+  {
+    return;
+  }
+  this->DoDeallocate(pointer, bytes, alignment);
+  this->BytesInUse.fetch_sub(static_cast<vtkTypeInt64>(bytes), std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryResource::ResetCounters()
+{
+  this->PeakBytesInUse = this->BytesInUse.load();
+  this->TotalBytesAllocated = 0;
+  this->NumberOfAllocations = 0;
+}
+
+//------------------------------------------------------------------------------
+vtkMemoryResource* vtkMemoryResource::GetCurrent()
+{
+  return CurrentMemoryResource;
+}
+
+//------------------------------------------------------------------------------
+vtkMemoryResource::vtkCurrentRAII::vtkCurrentRAII(vtkMemoryResource* resource)
+  : Previous(CurrentMemoryResource)
+{
+  CurrentMemoryResource = resource;
+}
+
+//------------------------------------------------------------------------------
+vtkMemoryResource::vtkCurrentRAII::~vtkCurrentRAII()
+{
+  CurrentMemoryResource = this->Previous;
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryResource::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "BytesInUse: " << this->BytesInUse << "\n";
+  os << indent << "PeakBytesInUse: " << this->PeakBytesInUse << "\n";
+  os << indent << "TotalBytesAllocated: " << this->TotalBytesAllocated << "\n";
+  os << indent << "NumberOfAllocations: " << this->NumberOfAllocations << "\n";
+}
+VTK_ABI_NAMESPACE_END
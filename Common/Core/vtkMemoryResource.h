@@ -0,0 +1,203 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkMemoryResource
+ * @brief   abstract source of memory for buffers, id lists and containers
+ *
+ * vtkMemoryResource is the VTK counterpart of std::pmr::memory_resource: a
+ * polymorphic object providing raw memory through Allocate() and
+ * Deallocate(). Subclasses implement DoAllocate() and DoDeallocate(), while
+ * this class keeps track of the number of bytes allocated, so that the memory
+ * used by a piece of code can be measured.
+ *
+ * A resource can be made the current resource of the calling thread with
+ * vtkMemoryResource::vtkCurrentRAII. vtkBuffer (and thus vtkAOSDataArrayTemplate
+ * and vtkSOADataArrayTemplate) and vtkIdList objects capture the current
+ * resource when they are constructed, and allocate their memory from it for
+ * their whole lifetime. They hold a reference on the resource, so it is never
+ * destroyed while some of its memory is in use. When no resource is current,
+ * memory is allocated as usual.
+ *
+ * The current resource is propagated to the threads of vtkSMPTools::For while
+ * they call the Initialize() method of the functor, so that thread-local
+ * objects created there use it too. Standard containers, such as the ones
+ * stored in vtkSMPThreadLocal, can use a resource through
+ * vtkMemoryResourceAllocator.
+ *
+ * Allocate() and Deallocate() are thread safe if DoAllocate() and
+ * DoDeallocate() are.
+ *
+ * @sa vtkArenaMemoryResource vtkMemoryResourceAllocator
+ */
+
+#ifndef vtkMemoryResource_h
+#define vtkMemoryResource_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <atomic>  // For std::atomic
+#include <cstddef> // For std::size_t
+#include <new>     // For std::bad_alloc
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkMemoryResource : public vtkObject
+{
+public:
+  vtkTypeMacro(vtkMemoryResource, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Allocate @a bytes bytes aligned on @a alignment, which must be a power of two.
+   * Return nullptr if the memory can not be allocated.
+   */
+  void* Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+  /**
+   * Release memory returned by Allocate(). @a bytes and @a alignment must be the
+   * values given to Allocate().
+   */
+  void Deallocate(void* pointer, std::size_t bytes,
+    std::size_t alignment = alignof(std::max_align_t));
+
+  ///@{
+  /**
+   * Memory counters, in bytes. BytesInUse is the memory currently allocated,
+   * PeakBytesInUse its maximum, and TotalBytesAllocated the sum of all allocations.
+   */
+  vtkTypeInt64 GetBytesInUse() const { return this->BytesInUse; }
+  vtkTypeInt64 GetPeakBytesInUse() const { return this->PeakBytesInUse; }
+  vtkTypeInt64 GetTotalBytesAllocated() const { return this->TotalBytesAllocated; }
+  ///@}
+
+  /**
+   * Number of calls to Allocate() that succeeded.
+   */
+  vtkTypeInt64 GetNumberOfAllocations() const { return this->NumberOfAllocations; }
+
+  /**
+   * Reset PeakBytesInUse to BytesInUse, and TotalBytesAllocated and
+   * NumberOfAllocations to 0.
+   */
+  void ResetCounters();
+
+  /**
+   * Resource of the calling thread, nullptr if none. Objects allocate their memory
+   * as usual when there is no current resource.
+   */
+  static vtkMemoryResource* GetCurrent();
+
+  /**
+   * A class to make a resource the current resource of the calling thread.
+   * Declare it on the stack, the previous current resource is restored when
+   * it goes out of scope.
+   */
+  class VTKCOMMONCORE_EXPORT vtkCurrentRAII
+  {
+  public:
+    vtkCurrentRAII(vtkMemoryResource* resource);
+    ~vtkCurrentRAII();
+    vtkCurrentRAII(const vtkCurrentRAII&) = delete;
+    vtkCurrentRAII& operator=(const vtkCurrentRAII&) = delete;
+
+  private:
+    vtkMemoryResource* Previous;
+  };
+
+protected:
+  vtkMemoryResource() = default;
+  ~vtkMemoryResource() override = default;
+
+  virtual void* DoAllocate(std::size_t bytes, std::size_t alignment) = 0;
+  virtual void DoDeallocate(void* pointer, std::size_t bytes, std::size_t alignment) = 0;
+
+private:
+  vtkMemoryResource(const vtkMemoryResource&) = delete;
+  void operator=(const vtkMemoryResource&) = delete;
+
+  std::atomic<vtkTypeInt64> BytesInUse{ 0 };
+  std::atomic<vtkTypeInt64> PeakBytesInUse{ 0 };
+  std::atomic<vtkTypeInt64> TotalBytesAllocated{ 0 };
+  std::atomic<vtkTypeInt64> NumberOfAllocations{ 0 };
+};
+
+#ifndef __VTK_WRAP__
+/**
+ * @class   vtkMemoryResourceAllocator
+ * @brief   standard allocator drawing memory from a vtkMemoryResource
+ *
+ * vtkMemoryResourceAllocator lets standard containers allocate from a
+ * vtkMemoryResource. By default, it uses the current resource of the thread
+ * constructing it, so that containers created in a vtkSMPThreadLocal from an
+ * exemplar use the resource that was current when the exemplar was built:
+ * \code
+ * using IdVector = std::vector<vtkIdType, vtkMemoryResourceAllocator<vtkIdType>>;
+ * vtkSMPThreadLocal<IdVector> localIds; // Copies of the exemplar share its resource
+ * \endcode
+ * When there is no resource, memory is allocated with operator new.
+ * The allocator does not own the resource: it must outlive the containers using it.
+ */
+template <typename T>
+class vtkMemoryResourceAllocator
+{
+public:
+  using value_type = T;
+
+  vtkMemoryResourceAllocator() noexcept
+    : Resource(vtkMemoryResource::GetCurrent())
+  {
+  }
+  vtkMemoryResourceAllocator(vtkMemoryResource* resource) noexcept
+    : Resource(resource)
+  {
+  }
+  template <typename U>
+  vtkMemoryResourceAllocator(const vtkMemoryResourceAllocator<U>& other) noexcept
+    : Resource(other.GetResource())
+  {
+  }
+
+  T* allocate(std::size_t n)
+  {
+    if (!this->Resource)
+    {
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    void* pointer = this->Resource->Allocate(n * sizeof(T), alignof(T));
+    if (!pointer)
+    {
+      throw std::bad_alloc();
+    }
+    return static_cast<T*>(pointer);
+  }
+
+  void deallocate(T* pointer, std::size_t n) noexcept
+  {
+    if (!this->Resource)
+    {
+      ::operator delete(pointer);
+      return;
+    }
+    this->Resource->Deallocate(pointer, n * sizeof(T), alignof(T));
+  }
+
+  vtkMemoryResource* GetResource() const noexcept { return this->Resource; }
+
+  template <typename U>
+  bool operator==(const vtkMemoryResourceAllocator<U>& other) const noexcept
+  {
+    return this->Resource == other.GetResource();
+  }
+  template <typename U>
+  bool operator!=(const vtkMemoryResourceAllocator<U>& other) const noexcept
+  {
+    return this->Resource != other.GetResource();
+  }
+
+private:
+  vtkMemoryResource* Resource;
+};
+#endif
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -297,7 +297,9 @@ void vtkObjectBase::RegisterInternal(vtkObjectBase*, vtkTypeBool check)
   // count.
   if (!(check && vtkObjectBaseToGarbageCollectorFriendship::TakeReference(this)))
   {
-    this->ReferenceCount++;
+    // A new reference can only be created from an existing one, which keeps
+    // the object alive, so no ordering is needed here.
+    this->ReferenceCount.fetch_add(1, std::memory_order_relaxed);
   }
 }
 
@@ -306,15 +308,19 @@ void vtkObjectBase::UnRegisterInternal(vtkObjectBase*, vtkTypeBool check)
 {
   // If the garbage collector accepts a reference, do not decrement
   // the count.
-  if (check && this->ReferenceCount > 1 &&
+  if (check && this->ReferenceCount.load(std::memory_order_relaxed) > 1 &&
     vtkObjectBaseToGarbageCollectorFriendship::GiveReference(this))
   {
     return;
   }
 
-  // Decrement the reference count, delete object if count goes to zero.
-  if (--this->ReferenceCount <= 0)
+  // Decrement the reference count, delete object if count goes to zero. The
+  // release makes the uses of the object through this reference visible to
+  // the thread deleting it, which acquires them before the deletion.
+  if (this->ReferenceCount.fetch_sub(1, std::memory_order_release) <= 1)
   {
+    std::atomic_thread_fence(std::memory_order_acquire);
+
     // Let subclasses know the object is on its way out.
     this->ObjectFinalize();
 
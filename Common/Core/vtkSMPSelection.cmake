@@ -52,6 +52,7 @@ if (VTK_SMP_ENABLE_TBB)
   list(APPEND vtk_smp_sources
     "${vtk_smp_implementation_dir}/vtkSMPToolsImpl.cxx")
   list(APPEND vtk_smp_nowrap_headers
+    "${vtk_smp_implementation_dir}/vtkSMPTaskGroupImpl.h"
     "${vtk_smp_implementation_dir}/vtkSMPThreadLocalImpl.h")
   list(APPEND vtk_smp_templates
     "${vtk_smp_implementation_dir}/vtkSMPToolsImpl.txx")
@@ -93,9 +94,11 @@ if (VTK_SMP_ENABLE_STDTHREAD)
     "${vtk_smp_implementation_dir}/vtkSMPThreadLocalBackend.cxx"
     "${vtk_smp_implementation_dir}/vtkSMPThreadPool.cxx")
   list(APPEND vtk_smp_nowrap_headers
+    "${vtk_smp_implementation_dir}/vtkSMPTaskGroupImpl.h"
     "${vtk_smp_implementation_dir}/vtkSMPThreadLocalImpl.h"
     "${vtk_smp_implementation_dir}/vtkSMPThreadLocalBackend.h"
-    "${vtk_smp_implementation_dir}/vtkSMPThreadPool.h")
+    "${vtk_smp_implementation_dir}/vtkSMPThreadPool.h"
+    "${vtk_smp_implementation_dir}/vtkSMPWorkStealingRanges.h")
   list(APPEND vtk_smp_templates
     "${vtk_smp_implementation_dir}/vtkSMPToolsImpl.txx")
 endif()
@@ -129,6 +132,7 @@ set(vtk_smp_common_dir SMP/Common)
 list(APPEND vtk_smp_sources
   "${vtk_smp_common_dir}/vtkSMPToolsAPI.cxx")
 list(APPEND vtk_smp_nowrap_headers
+  "${vtk_smp_common_dir}/vtkSMPTaskGroupImpl.h"
   "${vtk_smp_common_dir}/vtkSMPThreadLocalAPI.h"
   "${vtk_smp_common_dir}/vtkSMPThreadLocalImplAbstract.h"
   "${vtk_smp_common_dir}/vtkSMPToolsAPI.h"
@@ -136,8 +140,12 @@ list(APPEND vtk_smp_nowrap_headers
   "${vtk_smp_common_dir}/vtkSMPToolsInternal.h")
 
 list(APPEND vtk_smp_sources
+  vtkSMPTaskGroup.cxx
   vtkSMPTools.cxx)
 list(APPEND vtk_smp_headers
   vtkSMPTools.h
   vtkSMPThreadLocal.h
   vtkSMPThreadLocalObject.h)
+# Not wrappable: non-copyable and only useful with C++ callables.
+list(APPEND vtk_smp_nowrap_headers
+  vtkSMPTaskGroup.h)
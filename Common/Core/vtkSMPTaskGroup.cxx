@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkSMPTaskGroup.h"
+
+#include "SMP/Common/vtkSMPTaskGroupImpl.h"
+#include "SMP/Common/vtkSMPToolsAPI.h"
+#include "vtkObject.h"
+#include "vtkSMP.h"
+
+#if VTK_SMP_ENABLE_STDTHREAD
+#include "SMP/STDThread/vtkSMPTaskGroupImpl.h"
+#endif
+#if VTK_SMP_ENABLE_TBB
+#include "SMP/TBB/vtkSMPTaskGroupImpl.h"
+#endif
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+using namespace vtk::detail::smp;
+
+//------------------------------------------------------------------------------
+struct vtkSMPTaskGroup::vtkInternals
+{
+  struct Node
+  {
+    std::function<void()> Function;
+    std::vector<TaskId> Successors;
+    vtkIdType PendingDependencies = 0;
+    bool Done = false;
+  };
+
+  std::unique_ptr<vtkSMPTaskGroupImplAbstract> Backend;
+  std::mutex Mutex; // Protects Nodes and FirstId
+  std::deque<Node> Nodes;
+  // Id of Nodes.front(): the nodes of the tasks done before the last Wait()
+  // are released, their ids are not reused.
+  TaskId FirstId = 0;
+
+  Node& GetNode(TaskId id) { return this->Nodes[id - this->FirstId]; }
+
+  void Schedule(TaskId id)
+  {
+    this->Backend->Run([this, id]() { this->Execute(id); });
+  }
+
+  void Execute(TaskId id)
+  {
+    std::function<void()> function;
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      function = std::move(this->GetNode(id).Function);
+    }
+
+    try
+    {
+      function();
+    }
+    catch (const std::exception& e)
+    {
+      vtkErrorWithObjectMacro(
+        nullptr, "Task " << id << " has thrown an exception. what():\n" << e.what());
+    }
+    catch (...)
+    {
+      vtkErrorWithObjectMacro(nullptr, "Task " << id << " has thrown an unknown exception.");
+    }
+
+    std::vector<TaskId> ready;
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      Node& node = this->GetNode(id);
+      node.Done = true;
+      for (TaskId successor : node.Successors)
+      {
+        if (--this->GetNode(successor).PendingDependencies == 0)
+        {
+          ready.push_back(successor);
+        }
+      }
+      node.Successors.clear();
+    }
+
+    for (TaskId successor : ready)
+    {
+      this->Schedule(successor);
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkSMPTaskGroup::vtkSMPTaskGroup()
+  : Internals(new vtkInternals)
+{
+  switch (vtkSMPToolsAPI::GetInstance().GetBackendType())
+  {
+#if VTK_SMP_ENABLE_STDTHREAD
+    case BackendType::STDThread:
+      this->Internals->Backend.reset(new vtkSMPTaskGroupImpl<BackendType::STDThread>);
+      break;
+#endif
+#if VTK_SMP_ENABLE_TBB
+    case BackendType::TBB:
+      this->Internals->Backend.reset(new vtkSMPTaskGroupImpl<BackendType::TBB>);
+      break;
+#endif
+    default:
+      this->Internals->Backend.reset(new vtkSMPTaskGroupImpl<BackendType::Sequential>);
+      break;
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkSMPTaskGroup::~vtkSMPTaskGroup()
+{
+  this->Wait();
+}
+
+//------------------------------------------------------------------------------
+vtkSMPTaskGroup::TaskId vtkSMPTaskGroup::Spawn(std::function<void()> task)
+{
+  return this->Spawn(std::move(task), nullptr, 0);
+}
+
+//------------------------------------------------------------------------------
+vtkSMPTaskGroup::TaskId vtkSMPTaskGroup::Spawn(
+  std::function<void()> task, std::initializer_list<TaskId> dependencies)
+{
+  return this->Spawn(
+    std::move(task), dependencies.begin(), static_cast<vtkIdType>(dependencies.size()));
+}
+
+//------------------------------------------------------------------------------
+vtkSMPTaskGroup::TaskId vtkSMPTaskGroup::Spawn(
+  std::function<void()> task, const TaskId* dependencies, vtkIdType count)
+{
+  TaskId id;
+  bool ready;
+  {
+    std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+    auto& nodes = this->Internals->Nodes;
+    id = this->Internals->FirstId + static_cast<TaskId>(nodes.size());
+    nodes.emplace_back();
+    nodes.back().Function = std::move(task);
+    for (vtkIdType i = 0; i < count; ++i)
+    {
+      const TaskId dependency = dependencies[i];
+      if (dependency < 0 || dependency >= id)
+      {
+        vtkErrorWithObjectMacro(nullptr, "Unknown task " << dependency << ", dependency ignored.");
+        continue;
+      }
+      // Tasks released by Wait() are done.
+      if (dependency >= this->Internals->FirstId && !this->Internals->GetNode(dependency).Done)
+      {
+        this->Internals->GetNode(dependency).Successors.push_back(id);
+        ++nodes.back().PendingDependencies;
+      }
+    }
+    ready = nodes.back().PendingDependencies == 0;
+  }
+
+  if (ready)
+  {
+    this->Internals->Schedule(id);
+  }
+  return id;
+}
+
+//------------------------------------------------------------------------------
+vtkSMPTaskGroup::TaskId vtkSMPTaskGroup::Then(
+  TaskId predecessor, std::function<void()> continuation)
+{
+  return this->Spawn(std::move(continuation), &predecessor, 1);
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTaskGroup::Wait()
+{
+  this->Internals->Backend->Wait();
+
+  // Release the nodes once every task is done, unless another thread spawned
+  // a task meanwhile.
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  auto& nodes = this->Internals->Nodes;
+  if (std::all_of(
+        nodes.begin(), nodes.end(), [](const vtkInternals::Node& node) { return node.Done; }))
+  {
+    this->Internals->FirstId += static_cast<TaskId>(nodes.size());
+    nodes.clear();
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPTaskGroup::IsDone(TaskId task)
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  const TaskId firstId = this->Internals->FirstId;
+  if (task < 0 || task >= firstId + static_cast<TaskId>(this->Internals->Nodes.size()))
+  {
+    return false;
+  }
+  return task < firstId || this->Internals->GetNode(task).Done;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkSMPTaskGroup::GetNumberOfTasks()
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  return static_cast<vtkIdType>(this->Internals->Nodes.size());
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSMPTaskGroup
+ * @brief   Run independent tasks asynchronously with the SMP backend.
+ *
+ * vtkSMPTaskGroup complements the fork-join vtkSMPTools::For with
+ * asynchronous tasks. Tasks are spawned in a group and may depend on other
+ * tasks of the same group: a task starts only once all its dependencies are
+ * done. Wait() blocks until every task of the group is done, the destructor
+ * waits as well.
+ *
+ * Usage example:
+ * \code
+ * vtkSMPTaskGroup group;
+ * auto read = group.Spawn([&]() { reader->Update(); });
+ * auto other = group.Spawn([&]() { ComputeSomethingElse(); });
+ * group.Then(read, [&]() { Process(reader->GetOutput()); });
+ * group.Spawn([&]() { Merge(); }, { read, other });
+ * group.Wait();
+ * \endcode
+ *
+ * The backend in use when the group is created runs the tasks:
+ *    - STDThread submits tasks to the thread pool used by vtkSMPTools::For.
+ *      Threads waiting for a group run pending tasks instead of blocking.
+ *    - TBB runs tasks with a tbb::task_group in the vtkSMPTools task arena.
+ *    - Sequential and OpenMP defer the tasks and run them, in order, in the
+ *      thread calling Wait().
+ *
+ * Tasks can spawn new tasks in the group they belong to. Exceptions thrown by a
+ * task are reported as errors and ignored, tasks depending on it still run.
+ *
+ * @sa
+ * vtkSMPTools
+ */
+
+#ifndef vtkSMPTaskGroup_h
+#define vtkSMPTaskGroup_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkType.h"             // For vtkIdType
+
+#include <functional>       // For std::function
+#include <initializer_list> // For std::initializer_list
+#include <memory>           // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkSMPTaskGroup
+{
+public:
+  /**
+   * Handle on a spawned task, used to declare dependencies.
+   */
+  using TaskId = vtkIdType;
+
+  vtkSMPTaskGroup();
+  ~vtkSMPTaskGroup();
+  vtkSMPTaskGroup(const vtkSMPTaskGroup&) = delete;
+  vtkSMPTaskGroup& operator=(const vtkSMPTaskGroup&) = delete;
+
+  ///@{
+  /**
+   * Spawn a task. The task starts as soon as all the given tasks of this group are
+   * done, immediately if there are none. Unknown task ids are ignored with an error.
+   * This method is thread safe.
+   */
+  TaskId Spawn(std::function<void()> task);
+  TaskId Spawn(std::function<void()> task, std::initializer_list<TaskId> dependencies);
+  TaskId Spawn(std::function<void()> task, const TaskId* dependencies, vtkIdType count);
+  ///@}
+
+  /**
+   * Spawn a continuation: a task that starts when `predecessor` is done.
+   * This method is thread safe.
+   */
+  TaskId Then(TaskId predecessor, std::function<void()> continuation);
+
+  /**
+   * Block until all the tasks of the group are done, including tasks spawned while
+   * waiting. The group can be reused afterwards: the tasks are then released, their
+   * ids stay valid and are not reused.
+   */
+  void Wait();
+
+  /**
+   * Return true if the given task is done.
+   */
+  bool IsDone(TaskId task);
+
+  /**
+   * Return the number of tasks held by the group, done or not, spawned since the
+   * last Wait().
+   */
+  vtkIdType GetNumberOfTasks();
+
+private:
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
+// VTK-HeaderTest-Exclude: vtkSMPTaskGroup.h
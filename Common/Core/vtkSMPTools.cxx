@@ -55,6 +55,34 @@ bool vtkSMPTools::GetNestedParallelism()
   return SMPToolsAPI.GetNestedParallelism();
 }
 
+//------------------------------------------------------------------------------
+void vtkSMPTools::SetWorkStealing(bool workStealing)
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  SMPToolsAPI.SetWorkStealing(workStealing);
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPTools::GetWorkStealing()
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  return SMPToolsAPI.GetWorkStealing();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTools::SetThreadPinning(bool threadPinning)
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  SMPToolsAPI.SetThreadPinning(threadPinning);
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPTools::GetThreadPinning()
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  return SMPToolsAPI.GetThreadPinning();
+}
+
 //------------------------------------------------------------------------------
 bool vtkSMPTools::IsParallelScope()
 {
@@ -19,12 +19,14 @@
 #define vtkSMPTools_h
 
 #include "vtkCommonCoreModule.h" // For export macro
+#include "vtkMemoryResource.h"   // For vtkMemoryResource::vtkCurrentRAII
 #include "vtkObject.h"
 
 #include "SMP/Common/vtkSMPToolsAPI.h"
 #include "vtkSMPThreadLocal.h" // For Initialized
 
 #include <functional>  // For std::function
+#include <iterator>    // For std::iterator_traits
 #include <type_traits> // For std:::enable_if
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -98,9 +100,12 @@ struct vtkSMPTools_FunctorInternal<Functor, true>
 {
   Functor& F;
   vtkSMPThreadLocal<unsigned char> Initialized;
+  // Thread-local objects created in Initialize() use the memory resource of the caller
+  vtkMemoryResource* MemoryResource;
   vtkSMPTools_FunctorInternal(Functor& f)
     : F(f)
     , Initialized(0)
+    , MemoryResource(vtkMemoryResource::GetCurrent())
   {
   }
   void Execute(vtkIdType first, vtkIdType last)
@@ -108,6 +113,7 @@ struct vtkSMPTools_FunctorInternal<Functor, true>
     unsigned char& inited = this->Initialized.Local();
     if (!inited)
     {
+      vtkMemoryResource::vtkCurrentRAII currentResource(this->MemoryResource);
       this->F.Initialize();
       inited = 1;
     }
@@ -437,6 +443,42 @@ public:
    */
   static bool GetNestedParallelism();
 
+  /**
+   * /!\ This method is not thread safe.
+   * If true, the STDThread backend balances parallel for loops with work stealing:
+   * each thread first processes a contiguous block of the range, then steals chunks
+   * from the other threads once it is done. This is faster when the cost of the work
+   * is not uniform over the range. If false, chunks are distributed round-robin to the
+   * threads before the loop starts.
+   * Other backends ignore this setting.
+   *
+   * Default to false, unless the VTK_SMP_WORK_STEALING env variable is set to 1, so
+   * that existing loops keep their round-robin scheduling unless asked otherwise.
+   */
+  static void SetWorkStealing(bool workStealing);
+
+  /**
+   * Get true if the STDThread backend uses work stealing.
+   */
+  static bool GetWorkStealing();
+
+  /**
+   * /!\ This method is not thread safe.
+   * If true, each thread of the STDThread backend is pinned to a CPU core.
+   * Combined with work stealing, a given thread processes the same part of a range
+   * from one parallel for to the next, so memory initialized in parallel (first touch)
+   * stays on the NUMA node of the thread using it.
+   * Only supported on Linux. Other backends ignore this setting.
+   *
+   * Default to false, unless the VTK_SMP_THREAD_PINNING env variable is set to 1.
+   */
+  static void SetThreadPinning(bool threadPinning);
+
+  /**
+   * Get true if thread pinning is requested for the STDThread backend.
+   */
+  static bool GetThreadPinning();
+
   /**
    * Return true if it is called from a parallel scope.
    */
@@ -454,12 +496,17 @@ public:
    *    - MaxNumberOfThreads set the maximum number of threads.
    *    - Backend set a specific SMPTools backend.
    *    - NestedParallelism, if true enable nested parallelism.
+   *    - WorkStealing, if true the STDThread backend uses work stealing.
+   *    - ThreadPinning, if true the STDThread backend pins its threads to CPU cores.
+   * WorkStealing and ThreadPinning default to their current values.
    */
   struct Config
   {
     int MaxNumberOfThreads = 0;
     std::string Backend = vtk::detail::smp::vtkSMPToolsAPI::GetInstance().GetBackend();
     bool NestedParallelism = false;
+    bool WorkStealing = vtk::detail::smp::vtkSMPToolsAPI::GetInstance().GetWorkStealing();
+    bool ThreadPinning = vtk::detail::smp::vtkSMPToolsAPI::GetInstance().GetThreadPinning();
 
     Config() = default;
     Config(int maxNumberOfThreads)
@@ -485,6 +532,8 @@ public:
       : MaxNumberOfThreads(API.GetInternalDesiredNumberOfThread())
       , Backend(API.GetBackend())
       , NestedParallelism(API.GetNestedParallelism())
+      , WorkStealing(API.GetWorkStealing())
+      , ThreadPinning(API.GetThreadPinning())
     {
     }
 #endif // DOXYGEN_SHOULD_SKIP_THIS
@@ -623,6 +672,124 @@ public:
     auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
     SMPToolsAPI.Sort(begin, end, comp);
   }
+
+  ///@{
+  /**
+   * A convenience method for reducing data. It is a drop in replacement for
+   * std::reduce(): the values of the range are combined with `init` using the
+   * binary operation `reduce` (std::plus by default). `reduce` must be
+   * associative, but does not need to be commutative: partial results are
+   * always combined in order. `T` must be default constructible.
+   *
+   * Usage example:
+   * \code
+   * auto range = vtk::DataArrayValueRange<1>(array);
+   * double sum = vtkSMPTools::Reduce(range.cbegin(), range.cend(), 0.0);
+   * \endcode
+   */
+  template <typename Iterator, typename T, typename BinaryOp>
+  static T Reduce(Iterator begin, Iterator end, T init, BinaryOp reduce)
+  {
+    return vtkSMPTools::TransformReduce(
+      begin, end, init, reduce, [](const T& value) { return value; });
+  }
+
+  template <typename Iterator, typename T>
+  static T Reduce(Iterator begin, Iterator end, T init)
+  {
+    return vtkSMPTools::Reduce(begin, end, init, std::plus<T>());
+  }
+  ///@}
+
+  /**
+   * A convenience method for transforming and reducing data. It is a drop in
+   * replacement for std::transform_reduce(): `transform` is applied to each value
+   * of the range and the results are combined with `init` using `reduce`.
+   * The same requirements as Reduce() apply. tbb::parallel_reduce is used by the
+   * TBB backend.
+   *
+   * Usage example, computing the squared norm of a vector:
+   * \code
+   * double norm2 = vtkSMPTools::TransformReduce(values.cbegin(), values.cend(), 0.0,
+   *   std::plus<double>(), [](double x) { return x * x; });
+   * \endcode
+   */
+  template <typename Iterator, typename T, typename BinaryOp, typename UnaryOp>
+  static T TransformReduce(Iterator begin, Iterator end, T init, BinaryOp reduce, UnaryOp transform)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    return SMPToolsAPI.TransformReduce(begin, end, init, reduce, transform);
+  }
+
+  ///@{
+  /**
+   * A convenience method computing an inclusive prefix scan. It is a drop in
+   * replacement for std::inclusive_scan(): the i-th output value is the
+   * combination of the input values 0 to i with `op` (std::plus by default).
+   * `op` must be associative. The output range may be the input range.
+   * Returns the iterator past the last written value.
+   * tbb::parallel_scan is used by the TBB backend, other backends perform two
+   * parallel passes over the data.
+   */
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  static OutputIt InclusiveScan(InputIt begin, InputIt end, OutputIt out, BinaryOp op)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    return SMPToolsAPI.InclusiveScan(begin, end, out, op);
+  }
+
+  template <typename InputIt, typename OutputIt>
+  static OutputIt InclusiveScan(InputIt begin, InputIt end, OutputIt out)
+  {
+    using ValueType = typename std::iterator_traits<InputIt>::value_type;
+    return vtkSMPTools::InclusiveScan(begin, end, out, std::plus<ValueType>());
+  }
+  ///@}
+
+  ///@{
+  /**
+   * A convenience method computing an exclusive prefix scan. It is a drop in
+   * replacement for std::exclusive_scan(): the i-th output value is the
+   * combination of `init` and the input values 0 to i-1 with `op`
+   * (std::plus by default). This is typically used to turn per-cell sizes into
+   * offsets. `op` must be associative. The output range may be the input range.
+   * Returns the iterator past the last written value.
+   *
+   * Usage example:
+   * \code
+   * std::vector<vtkIdType> counts = ...;
+   * std::vector<vtkIdType> offsets(counts.size());
+   * vtkSMPTools::ExclusiveScan(counts.begin(), counts.end(), offsets.begin(), vtkIdType(0));
+   * \endcode
+   */
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  static OutputIt ExclusiveScan(InputIt begin, InputIt end, OutputIt out, T init, BinaryOp op)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    return SMPToolsAPI.ExclusiveScan(begin, end, out, init, op);
+  }
+
+  template <typename InputIt, typename OutputIt, typename T>
+  static OutputIt ExclusiveScan(InputIt begin, InputIt end, OutputIt out, T init)
+  {
+    return vtkSMPTools::ExclusiveScan(begin, end, out, init, std::plus<T>());
+  }
+  ///@}
+
+  /**
+   * A convenience method for partitioning data. It is a drop in replacement for
+   * std::stable_partition(): the values for which `pred` returns true are moved
+   * before the others, preserving the relative order within both groups.
+   * Returns an iterator to the first value of the second group. `pred` is
+   * evaluated exactly once per value. Values must be default constructible and
+   * move assignable.
+   */
+  template <typename Iterator, typename Predicate>
+  static Iterator StablePartition(Iterator begin, Iterator end, Predicate pred)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    return SMPToolsAPI.StablePartition(begin, end, pred);
+  }
 };
 
 VTK_ABI_NAMESPACE_END
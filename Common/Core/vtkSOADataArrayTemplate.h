@@ -162,6 +162,21 @@ public:
   void SetArray(int comp, VTK_ZEROCOPY ValueType* array, vtkIdType size, bool updateMaxId = false,
     bool save = false, int deleteMethod = VTK_DATA_ARRAY_FREE);
 
+  /**
+   * Use @a size values stored in the file @a fileName, starting at byte @a offset,
+   * as data of component @a comp, without copying them. The file is mapped in
+   * memory and pages are only loaded when they are accessed. Values must be stored
+   * in native byte order, and @a offset must be a multiple of the value size.
+   * If @a updateMaxId is true, the array's MaxId is updated as in SetArray().
+   * If @a copyOnWrite is false, the component is read-only: modifying its values
+   * crashes the process. Otherwise, modified pages are copied in memory and the
+   * file is never changed.
+   * Return false if the file can not be mapped, in which case the component is unchanged.
+   * @sa vtkFileMapping
+   */
+  bool MapFile(int comp, const char* fileName, vtkTypeInt64 offset, vtkIdType size,
+    bool updateMaxId = false, bool copyOnWrite = false);
+
   /**
    * This method allows the user to specify a custom free function to be
    * called when the array is deallocated. Calling this method will implicitly
@@ -214,6 +229,13 @@ public:
   void SetNumberOfComponents(int numComps) override;
   void ShallowCopy(vtkDataArray* other) override;
 
+  /**
+   * Move the values allocated from a vtkMemoryResource to memory allocated as
+   * usual, so that the array no longer keeps the resource alive.
+   * @sa vtkBuffer::ReleaseMemoryResource
+   */
+  bool ReleaseMemoryResource();
+
   // Reimplemented for efficiency:
   void InsertTuples(
     vtkIdType dstStart, vtkIdType n, vtkIdType srcStart, vtkAbstractArray* source) override;
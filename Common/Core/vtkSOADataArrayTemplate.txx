@@ -146,6 +146,18 @@ void vtkSOADataArrayTemplate<ValueType>::ShallowCopy(vtkDataArray* other)
   }
 }
 
+//-----------------------------------------------------------------------------
+template <class ValueType>
+bool vtkSOADataArrayTemplate<ValueType>::ReleaseMemoryResource()
+{
+  bool released = !this->AoSData || this->AoSData->ReleaseMemoryResource();
+  for (vtkBuffer<ValueType>* buffer : this->Data)
+  {
+    released = buffer->ReleaseMemoryResource() && released;
+  }
+  return released;
+}
+
 //-----------------------------------------------------------------------------
 template <class ValueType>
 void vtkSOADataArrayTemplate<ValueType>::InsertTuples(
@@ -295,6 +307,53 @@ void vtkSOADataArrayTemplate<ValueType>::SetArray(
   this->DataChanged();
 }
 
+//-----------------------------------------------------------------------------
+template <class ValueType>
+bool vtkSOADataArrayTemplate<ValueType>::MapFile(int comp, const char* fileName,
+  vtkTypeInt64 offset, vtkIdType size, bool updateMaxId, bool copyOnWrite)
+{
+  const int numComps = this->GetNumberOfComponents();
+  if (comp >= numComps || comp < 0)
+  {
+    vtkErrorMacro("Invalid component number '"
+      << comp
+      << "' specified. "
+         "Use `SetNumberOfComponents` first to set the number of components.");
+    return false;
+  }
+
+  vtkBuffer<ValueType>* buffer = vtkBuffer<ValueType>::New();
+  if (!buffer->MapFile(fileName, offset, size, copyOnWrite))
+  {
+    buffer->Delete();
+    return false;
+  }
+
+  if (this->StorageType == StorageTypeEnum::AOS && this->AoSData)
+  {
+    this->AoSData->Delete();
+    this->AoSData = nullptr;
+  }
+
+  while (this->Data.size() < static_cast<size_t>(numComps))
+  {
+    this->Data.push_back(vtkBuffer<ValueType>::New());
+  }
+
+  this->Data[comp]->Delete();
+  this->Data[comp] = buffer;
+
+  if (updateMaxId)
+  {
+    this->Size = numComps * size;
+    this->MaxId = this->Size - 1;
+  }
+  this->StorageType = StorageTypeEnum::SOA;
+
+  this->DataChanged();
+  return true;
+}
+
 //-----------------------------------------------------------------------------
 template <class ValueType>
 void vtkSOADataArrayTemplate<ValueType>::SetArrayFreeFunction(void (*callback)(void*))
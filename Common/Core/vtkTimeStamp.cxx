@@ -7,8 +7,31 @@
 
 #include <atomic>
 
-//------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+#if defined(VTK_USE_64BIT_TIMESTAMPS) || (VTK_SIZEOF_VOID_P == 8)
+using vtkTimeStampCounter = uint64_t;
+// Number of time stamps reserved at once by a thread. Reserving blocks makes
+// the counter grow faster, so blocks are only used with 64-bit time stamps.
+constexpr vtkTimeStampCounter vtkTimeStampBlockSize = 64;
+#else
+using vtkTimeStampCounter = uint32_t;
+constexpr vtkTimeStampCounter vtkTimeStampBlockSize = 1;
+#endif
+
+// Time stamps reserved by the current thread: Next + 1, ..., End.
+struct vtkTimeStampBlock
+{
+  vtkTimeStampCounter Next = 0;
+  vtkTimeStampCounter End = 0;
+};
+
+// Defined at namespace scope: MSVC refuses thread_local variables in exported functions.
+VTK_THREAD_LOCAL vtkTimeStampBlock CurrentTimeStampBlock;
+}
+
+//------------------------------------------------------------------------------
 vtkTimeStamp* vtkTimeStamp::New()
 {
   // If the factory was unable to create the object, then create it here.
@@ -37,11 +60,29 @@ void vtkTimeStamp::Modified()
   // The last solution has been decided to have the smallest downside of these.
   //
   // Good luck!
-#if defined(VTK_USE_64BIT_TIMESTAMPS) || (VTK_SIZEOF_VOID_P == 8)
-  static std::atomic<uint64_t> GlobalTimeStamp(0U);
-#else
-  static std::atomic<uint32_t> GlobalTimeStamp(0U);
-#endif
-  this->ModifiedTime = (vtkMTimeType)++GlobalTimeStamp;
+  static std::atomic<vtkTimeStampCounter> GlobalTimeStamp(0U);
+
+  if (vtkTimeStampBlockSize == 1)
+  {
+    this->ModifiedTime = (vtkMTimeType)++GlobalTimeStamp;
+    return;
+  }
+
+  // Each thread takes its time stamps from a block reserved in the global
+  // counter, which is then only read instead of written. A block stays usable
+  // as long as no other block has been reserved after it: any time stamp
+  // given by another thread is then smaller than the ones left in the block.
+  // Once a block has been reserved after ours, we can not know whether its
+  // time stamps were given before this call, so a new block is reserved.
+  // Reading the global counter is enough to see such a reservation when it
+  // happened before this call, so time stamps keep increasing along any
+  // chain of synchronized operations, as with a single global counter.
+  vtkTimeStampBlock& block = CurrentTimeStampBlock;
+  if (block.Next == block.End || GlobalTimeStamp.load(std::memory_order_relaxed) != block.End)
+  {
+    block.Next = GlobalTimeStamp.fetch_add(vtkTimeStampBlockSize);
+    block.End = block.Next + vtkTimeStampBlockSize;
+  }
+  this->ModifiedTime = (vtkMTimeType)++block.Next;
 }
 VTK_ABI_NAMESPACE_END
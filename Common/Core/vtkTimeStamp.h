@@ -34,6 +34,13 @@ public:
    * within the program. When this does occur, the typical consequence
    * should be that some filters will update themselves when really
    * they don't need to.
+   *
+   * This method is thread safe. Threads take their time stamps from blocks
+   * reserved in a global counter, so that threads calling it concurrently do
+   * not all write to the same memory location. Time stamps still increase
+   * along any sequence of calls ordered by synchronization, e.g. a call made
+   * after joining the threads of a vtkSMPTools::For() returns a time stamp
+   * greater than all the ones given within the loop.
    */
   void Modified();
 
@@ -5,7 +5,11 @@
 #include "vtkPointData.h"
 
 #include "vtkCellTreeLocator.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkMinimalStandardRandomSequence.h"
 #include "vtkNew.h"
+#include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkSphereSource.h"
 
@@ -48,6 +52,9 @@ int TestWithCachedCellBoundsParameter(int cachedCellBounds)
   double param_t, intersect[3], paraCoord[3];
   double sourcePnt[3], destinPnt[3], normalVec[3];
   vtkNew<vtkGenericCell> cell;
+  vtkNew<vtkPoints> sourcePnts;
+  vtkNew<vtkPoints> destinPnts;
+  vtkNew<vtkIdList> cellIds;
 
   // this loop traverses each point on the outer sphere (sphere1)
   // and  looks for an intersection on the inner sphere (sphere2)
@@ -66,6 +73,28 @@ int TestWithCachedCellBoundsParameter(int cachedCellBounds)
     {
       numIntersected++;
     }
+    else
+    {
+      cell_id = -1;
+    }
+    sourcePnts->InsertNextPoint(sourcePnt);
+    destinPnts->InsertNextPoint(destinPnt);
+    cellIds->InsertNextId(cell_id);
+  }
+
+  // the batched intersection must give the same cells
+  vtkNew<vtkIdList> batchedCellIds;
+  vtkNew<vtkPoints> batchedIntersections;
+  locator->IntersectWithLines(
+    sourcePnts, destinPnts, 0.0010, batchedCellIds, batchedIntersections);
+  for (vtkIdType i = 0; i < cellIds->GetNumberOfIds(); i++)
+  {
+    if (batchedCellIds->GetId(i) != cellIds->GetId(i))
+    {
+      vtkGenericWarningMacro("ERROR: batched intersection of ray "
+        << i << " gives cell " << batchedCellIds->GetId(i) << " instead of " << cellIds->GetId(i));
+      return EXIT_FAILURE;
+    }
   }
 
   if (numIntersected != 9802)
@@ -86,9 +115,58 @@ int TestWithCachedCellBoundsParameter(int cachedCellBounds)
   return EXIT_SUCCESS;
 }
 
+int TestFindCells()
+{
+  // enough cells for the tree to be built in parallel
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(41, 41, 41);
+  image->SetSpacing(0.1, 0.1, 0.1);
+
+  vtkNew<vtkCellTreeLocator> locator;
+  locator->SetDataSet(image);
+  locator->BuildLocator();
+
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  vtkNew<vtkPoints> points;
+  double pos[3];
+  for (int i = 0; i < 10000; i++)
+  {
+    // some points are outside of the image
+    for (int j = 0; j < 3; j++)
+    {
+      pos[j] = random->GetNextRangeValue(-0.5, 4.5);
+    }
+    points->InsertNextPoint(pos);
+  }
+
+  vtkNew<vtkIdList> cellIds;
+  locator->FindCells(points, cellIds);
+  if (cellIds->GetNumberOfIds() != points->GetNumberOfPoints())
+  {
+    vtkGenericWarningMacro("ERROR: FindCells gives " << cellIds->GetNumberOfIds() << " ids for "
+                                                     << points->GetNumberOfPoints() << " points");
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType i = 0; i < points->GetNumberOfPoints(); i++)
+  {
+    points->GetPoint(i, pos);
+    vtkIdType cellId = locator->FindCell(pos);
+    if (cellIds->GetId(i) != cellId)
+    {
+      vtkGenericWarningMacro("ERROR: FindCells gives cell " << cellIds->GetId(i) << " for point "
+                                                            << i << " instead of " << cellId);
+      return EXIT_FAILURE;
+    }
+  }
+  std::cout << "Passed: FindCells matches FindCell." << std::endl;
+
+  return EXIT_SUCCESS;
+}
+
 int CellTreeLocator(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
 {
   int retVal = TestWithCachedCellBoundsParameter(0);
   retVal += TestWithCachedCellBoundsParameter(1);
+  retVal += TestFindCells();
   return retVal;
 }
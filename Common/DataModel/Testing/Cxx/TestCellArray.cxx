@@ -557,6 +557,135 @@ void TestConvertTo64BitStorage(vtkSmartPointer<vtkCellArray> cellArray)
   ValidateCellArray(cellArray);
 }
 
+struct TestCompactStorageImpl
+{
+  static constexpr bool SupportsCompactStorage = true;
+
+  template <typename CellStateT>
+  void operator()(CellStateT& state, bool expectFixedSize, std::size_t expectValueSize) const
+  {
+    TEST_ASSERT(CellStateT::IsFixedSize == expectFixedSize);
+    TEST_ASSERT(sizeof(typename CellStateT::ValueType) == expectValueSize);
+    TEST_ASSERT(state.GetNumberOfCells() == 3);
+  }
+};
+
+struct GetConnectivityImpl
+{
+  template <typename CellStateT>
+  const vtkDataArray* operator()(const CellStateT& state) const
+  {
+    return state.GetConnectivity();
+  }
+};
+
+void TestCompactStorage(vtkSmartPointer<vtkCellArray> cellArray)
+{
+  vtkLogScopeFunction(INFO);
+
+  FillCellArray(cellArray);
+
+  // Compact storages are opt-in:
+  TEST_ASSERT(cellArray->ConvertToSmallestStorage());
+  TEST_ASSERT(!cellArray->IsStorageCompact());
+
+  // Mixed cell sizes, small point ids:
+  TEST_ASSERT(cellArray->ConvertToCompactStorage());
+  TEST_ASSERT(cellArray->GetStorageType() == vtkCellArray::Int8);
+  TEST_ASSERT(cellArray->IsStorageCompact());
+  TEST_ASSERT(!cellArray->IsStorageFixedSize());
+  cellArray->Visit(TestCompactStorageImpl{}, false, 1);
+  TEST_ASSERT(cellArray->IsValid());
+  TEST_ASSERT(cellArray->GetMaxCellSize() == 6);
+  ValidateCellArray(cellArray);
+
+  TEST_ASSERT(!cellArray->CanConvertToStorage(vtkCellArray::FixedSizeInt32));
+  TEST_ASSERT(!cellArray->ConvertToStorage(vtkCellArray::FixedSizeInt32));
+  TEST_ASSERT(cellArray->ConvertToStorage(vtkCellArray::Int16));
+  cellArray->Visit(TestCompactStorageImpl{}, false, 2);
+  ValidateCellArray(cellArray);
+
+  // Copies keep the compact storage:
+  vtkNew<vtkCellArray> copy;
+  copy->DeepCopy(cellArray);
+  TEST_ASSERT(copy->GetStorageType() == vtkCellArray::Int16);
+  ValidateCellArray(copy);
+  copy->ShallowCopy(cellArray);
+  TEST_ASSERT(copy->GetStorageType() == vtkCellArray::Int16);
+  ValidateCellArray(copy);
+
+  // Inserting goes back to explicit storage:
+  cellArray->InsertNextCell({ 0, 1, 2 });
+  TEST_ASSERT(!cellArray->IsStorageCompact());
+  TEST_ASSERT(cellArray->GetNumberOfCells() == 4);
+
+  // Fixed-size storage, with point ids requiring 16 bits:
+  vtkNew<vtkCellArray> quads;
+  quads->InsertNextCell({ 0, 1, 2, 3 });
+  quads->InsertNextCell({ 1000, 1001, 1002, 1003 });
+  quads->InsertNextCell({ 4, 5, 6, 7 });
+  TEST_ASSERT(quads->ConvertToCompactStorage());
+  TEST_ASSERT(quads->GetStorageType() == vtkCellArray::FixedSizeInt16);
+  TEST_ASSERT(quads->IsStorageFixedSize());
+  quads->Visit(TestCompactStorageImpl{}, true, 2);
+  TEST_ASSERT(quads->IsHomogeneous() == 4);
+  TEST_ASSERT(quads->GetNumberOfOffsets() == 4);
+  TEST_ASSERT(quads->GetOffset(2) == 8);
+  TEST_ASSERT(quads->GetCellSize(1) == 4);
+
+  vtkNew<vtkIdList> ids;
+  quads->GetCellAtId(1, ids);
+  TEST_ASSERT(ids->GetNumberOfIds() == 4);
+  TEST_ASSERT(ids->GetId(0) == 1000 && ids->GetId(3) == 1003);
+
+  vtkNew<vtkCellArray> appended;
+  appended->Append(quads, 10);
+  TEST_ASSERT(appended->GetNumberOfCells() == 3);
+  appended->GetCellAtId(1, ids);
+  TEST_ASSERT(ids->GetId(0) == 1010);
+
+  // The const Visit uses an explicit copy, kept until the array is modified:
+  const vtkCellArray* constQuads = quads;
+  const vtkDataArray* expanded = constQuads->Visit(GetConnectivityImpl{});
+  TEST_ASSERT(quads->IsStorageCompact());
+  TEST_ASSERT(expanded->GetDataTypeSize() >= 4);
+  TEST_ASSERT(constQuads->Visit(GetConnectivityImpl{}) == expanded);
+  quads->GetConnectivityArray()->Modified();
+  TEST_ASSERT(constQuads->Visit(GetConnectivityImpl{}) != expanded);
+
+  // Accessing the arrays does not convert the storage:
+  TEST_ASSERT(quads->GetOffsetsArray()->GetNumberOfValues() == 4);
+  TEST_ASSERT(quads->GetOffsetsArray()->GetComponent(3, 0) == 12);
+  TEST_ASSERT(quads->GetConnectivityArray()->GetComponent(4, 0) == 1000);
+  TEST_ASSERT(quads->GetStorageType() == vtkCellArray::FixedSizeInt16);
+
+  // Unlike the 32/64-bit accessors, which convert to the explicit storage
+  // given by IsStorage64Bit():
+  TEST_ASSERT(!quads->IsStorage64Bit());
+  TEST_ASSERT(quads->GetConnectivityArray32()->GetValue(4) == 1000);
+  TEST_ASSERT(quads->GetStorageType() == vtkCellArray::Int32);
+  TEST_ASSERT(quads->GetOffsetsArray32()->GetValue(3) == 12);
+
+  // SetData with a fixed cell size generates explicit offsets:
+  vtkNew<vtkCellArray::ArrayType32> conn;
+  for (vtkIdType i = 0; i < 12; ++i)
+  {
+    conn->InsertNextValue(static_cast<vtkTypeInt32>(i));
+  }
+  vtkNew<vtkCellArray> explicitTriangles;
+  TEST_ASSERT(explicitTriangles->SetData(3, conn));
+  TEST_ASSERT(explicitTriangles->GetStorageType() == vtkCellArray::Int32);
+  TEST_ASSERT(explicitTriangles->GetOffsetsArray32()->GetValue(4) == 12);
+
+  // SetFixedSizeData shares the connectivity array:
+  vtkNew<vtkCellArray> triangles;
+  TEST_ASSERT(triangles->SetFixedSizeData(3, conn));
+  TEST_ASSERT(triangles->GetStorageType() == vtkCellArray::FixedSizeInt32);
+  TEST_ASSERT(triangles->GetNumberOfCells() == 4);
+  TEST_ASSERT(triangles->GetCellSize(3) == 3);
+  TEST_ASSERT(triangles->GetConnectivityArray() == conn.Get());
+}
+
 void TestGetOffsetsArray(vtkSmartPointer<vtkCellArray> cellArray)
 {
   vtkLogScopeFunction(INFO);
@@ -1386,6 +1515,7 @@ void RunTests(bool use64BitStorage)
   TestCanConvertTo64BitStorage(NewCellArray(use64BitStorage));
   TestConvertTo32BitStorage(NewCellArray(use64BitStorage));
   TestConvertTo64BitStorage(NewCellArray(use64BitStorage));
+  TestCompactStorage(NewCellArray(use64BitStorage));
   TestGetOffsetsArray(NewCellArray(use64BitStorage));
   TestGetConnectivityArray(NewCellArray(use64BitStorage));
   TestIsHomogeneous(NewCellArray(use64BitStorage));
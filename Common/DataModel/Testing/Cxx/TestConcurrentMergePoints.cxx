@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Insert many coincident points from several threads in vtkConcurrentMergePoints, and check that
+// the merged points, once sorted, are the ones vtkMergePoints gives with a serial insertion.
+
+#include "vtkConcurrentMergePoints.h"
+#include "vtkIdList.h"
+#include "vtkMergePoints.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Points on a coarse lattice so that each of them is repeated many times.
+void GeneratePoints(vtkIdType numPts, std::vector<double>& coords)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1234);
+  coords.resize(3 * numPts);
+  for (auto& x : coords)
+  {
+    x = 0.1 * static_cast<int>(random->GetNextRangeValue(0.0, 20.0));
+  }
+}
+
+//------------------------------------------------------------------------------
+bool TestMerge(int dataType)
+{
+  const vtkIdType numPts = 200000;
+  std::vector<double> coords;
+  GeneratePoints(numPts, coords);
+  const double bounds[6] = { 0.0, 2.0, 0.0, 2.0, 0.0, 2.0 };
+
+  // Reference serial merge.
+  vtkNew<vtkPoints> refPts;
+  refPts->SetDataType(dataType);
+  vtkNew<vtkMergePoints> merge;
+  merge->InitPointInsertion(refPts, bounds, numPts);
+  std::vector<vtkIdType> refIds(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    merge->InsertUniquePoint(coords.data() + 3 * i, refIds[i]);
+  }
+
+  vtkNew<vtkPoints> pts;
+  pts->SetDataType(dataType);
+  vtkNew<vtkConcurrentMergePoints> merger;
+  merger->InitPointInsertion(pts, bounds, numPts);
+  std::vector<vtkIdType> ids(numPts);
+  std::atomic<vtkIdType> numInserted(0);
+  vtkSMPTools::For(0, numPts, 1000,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        numInserted += merger->InsertUniquePoint(coords.data() + 3 * i, i, ids[i]);
+      }
+    });
+
+  bool success = true;
+  const vtkIdType numUnique = refPts->GetNumberOfPoints();
+  if (merger->GetNumberOfPoints() != numUnique || numInserted != numUnique)
+  {
+    std::cerr << "Error: " << merger->GetNumberOfPoints() << " points merged and " << numInserted
+              << " reported as inserted instead of " << numUnique << std::endl;
+    return false;
+  }
+
+  // Coincident points must have the same id.
+  for (vtkIdType i = 0; i < numPts && success; ++i)
+  {
+    if (merger->IsInsertedPoint(coords.data() + 3 * i) != ids[i])
+    {
+      std::cerr << "Error: inconsistent id for point " << i << std::endl;
+      success = false;
+    }
+  }
+
+  vtkNew<vtkIdList> newIds;
+  merger->SortPoints(newIds);
+  merger->FinalizePointInsertion();
+  if (newIds->GetNumberOfIds() != numUnique || pts->GetNumberOfPoints() != numUnique)
+  {
+    std::cerr << "Error: wrong number of sorted points" << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < numPts && success; ++i)
+  {
+    if (newIds->GetId(ids[i]) != refIds[i])
+    {
+      std::cerr << "Error: sorted id " << newIds->GetId(ids[i]) << " of point " << i
+                << " instead of " << refIds[i] << std::endl;
+      success = false;
+    }
+  }
+  for (vtkIdType i = 0; i < numUnique && success; ++i)
+  {
+    double x[3], y[3];
+    pts->GetPoint(i, x);
+    refPts->GetPoint(i, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      std::cerr << "Error: wrong coordinates for merged point " << i << std::endl;
+      success = false;
+    }
+  }
+  if (merger->IsInsertedPoint(coords.data()) != refIds[0])
+  {
+    std::cerr << "Error: sorted ids are not used for later queries" << std::endl;
+    success = false;
+  }
+
+  return success;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestConcurrentMergePoints(int, char*[])
+{
+  bool success = TestMerge(VTK_FLOAT);
+  success &= TestMerge(VTK_DOUBLE);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
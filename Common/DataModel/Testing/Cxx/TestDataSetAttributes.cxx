@@ -2,9 +2,18 @@
 // SPDX-License-Identifier: BSD-3-Clause
 
 #include "vtkDataSetAttributes.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkIntArray.h"
 #include "vtkLogger.h"
 #include "vtkNew.h"
+#include "vtkStringArray.h"
 #include "vtkUnsignedCharArray.h"
+#include "vtkVariant.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
 
 int TestDataSetAttributes(int, char*[])
 {
@@ -77,5 +86,85 @@ int TestDataSetAttributes(int, char*[])
     }
   }
 
+  {
+    // Batched interpolation must match InterpolatePoint() / InterpolateEdge(),
+    // including for arrays that are not dispatched and nearest neighbor attributes.
+    constexpr vtkIdType N = 20;
+    vtkNew<vtkDataSetAttributes> source;
+    vtkNew<vtkDoubleArray> doubles;
+    doubles->SetName("doubles");
+    doubles->SetNumberOfComponents(3);
+    doubles->SetNumberOfTuples(N);
+    vtkNew<vtkIntArray> ints;
+    ints->SetName("ints");
+    ints->SetNumberOfTuples(N);
+    vtkNew<vtkStringArray> strings;
+    strings->SetName("strings");
+    strings->SetNumberOfTuples(N);
+    for (vtkIdType i = 0; i < N; ++i)
+    {
+      doubles->SetTuple3(i, i, 2.0 * i, -0.5 * i);
+      ints->SetValue(i, static_cast<int>(7 * i));
+      strings->SetValue(i, std::to_string(i));
+    }
+    source->AddArray(doubles);
+    source->AddArray(strings);
+    source->SetScalars(ints);
+
+    const std::vector<vtkIdType> offsets = { 0, 3, 5, 9 };
+    const std::vector<vtkIdType> ids = { 0, 1, 2, 5, 7, 10, 11, 12, 13 };
+    const std::vector<double> weights = { 0.2, 0.5, 0.3, 0.75, 0.25, 0.1, 0.2, 0.3, 0.4 };
+    const std::vector<vtkIdType> edges = { 3, 4, 8, 19, 0, 1 };
+    const std::vector<double> ts = { 0.25, 0.5, 0.9 };
+
+    vtkNew<vtkDataSetAttributes> batched, reference;
+    vtkNew<vtkIdList> ptIds;
+    for (int interpolation : { 1, 2 })
+    {
+      batched->SetCopyScalars(interpolation, vtkDataSetAttributes::INTERPOLATE);
+      reference->SetCopyScalars(interpolation, vtkDataSetAttributes::INTERPOLATE);
+      batched->InterpolateAllocate(source, 6);
+      reference->InterpolateAllocate(source, 6);
+      batched->SetNumberOfTuples(6);
+
+      batched->InterpolatePoints(source, 0, 3, offsets.data(), ids.data(), weights.data());
+      batched->InterpolateEdges(source, 3, 3, edges.data(), ts.data());
+      for (vtkIdType i = 0; i < 3; ++i)
+      {
+        ptIds->SetNumberOfIds(offsets[i + 1] - offsets[i]);
+        std::copy(ids.begin() + offsets[i], ids.begin() + offsets[i + 1], ptIds->begin());
+        reference->InterpolatePoint(
+          source, i, ptIds, const_cast<double*>(weights.data()) + offsets[i]);
+      }
+      for (vtkIdType i = 0; i < 3; ++i)
+      {
+        reference->InterpolateEdge(source, 3 + i, edges[2 * i], edges[2 * i + 1], ts[i]);
+      }
+
+      for (int a = 0; a < reference->GetNumberOfArrays(); ++a)
+      {
+        vtkAbstractArray* expected = reference->GetAbstractArray(a);
+        vtkAbstractArray* actual = batched->GetAbstractArray(expected->GetName());
+        if (!actual || actual->GetNumberOfTuples() != 6)
+        {
+          vtkLog(ERROR, "Missing interpolated array " << expected->GetName());
+          retVal = EXIT_FAILURE;
+          continue;
+        }
+        const vtkIdType numValues = 6 * expected->GetNumberOfComponents();
+        for (vtkIdType v = 0; v < numValues; ++v)
+        {
+          if (actual->GetVariantValue(v) != expected->GetVariantValue(v))
+          {
+            vtkLog(ERROR,
+              "Batched interpolation of " << expected->GetName() << " differs at value " << v);
+            retVal = EXIT_FAILURE;
+            break;
+          }
+        }
+      }
+    }
+  }
+
   return retVal;
 }
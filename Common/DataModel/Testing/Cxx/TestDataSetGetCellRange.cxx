@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that vtkDataSet::GetCellRange() returns the same cell types and points
+// as GetCellType() and GetCellPoints(), for the generic implementation and the
+// overrides of the structured and unstructured datasets, including hidden and
+// deleted cells, compact cell storages and grids without cells.
+
+#include "vtkCellArray.h"
+#include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkExplicitStructuredGrid.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkStructuredGrid.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+constexpr int Resolution = 6;
+
+//------------------------------------------------------------------------------
+// Compare a range of cells with the cells returned one by one.
+bool CompareRange(const std::string& name, vtkDataSet* ds, vtkIdType beginCellId,
+  vtkIdType endCellId, vtkUnsignedCharArray* types, vtkIdTypeArray* offsets,
+  vtkIdTypeArray* connectivity)
+{
+  ds->GetCellRange(beginCellId, endCellId, types, offsets, connectivity);
+  const vtkIdType numCells = endCellId - beginCellId;
+  if (types->GetNumberOfValues() != numCells || offsets->GetNumberOfValues() != numCells + 1 ||
+    offsets->GetValue(0) != 0 ||
+    connectivity->GetNumberOfValues() != offsets->GetValue(numCells))
+  {
+    std::cerr << "Error: " << name << ": wrong sizes for the range [" << beginCellId << ", "
+              << endCellId << ")" << std::endl;
+    return false;
+  }
+
+  vtkNew<vtkIdList> ptIds;
+  for (vtkIdType i = 0; i < numCells; ++i)
+  {
+    const vtkIdType cellId = beginCellId + i;
+    const int cellType = ds->GetCellType(cellId);
+    if (types->GetValue(i) != cellType)
+    {
+      std::cerr << "Error: " << name << ": cell " << cellId << " has type "
+                << static_cast<int>(types->GetValue(i)) << " instead of " << cellType
+                << std::endl;
+      return false;
+    }
+    if (cellType == VTK_EMPTY_CELL)
+    {
+      ptIds->Reset();
+    }
+    else
+    {
+      ds->GetCellPoints(cellId, ptIds);
+    }
+    const vtkIdType npts = offsets->GetValue(i + 1) - offsets->GetValue(i);
+    if (npts != ptIds->GetNumberOfIds() ||
+      !std::equal(ptIds->begin(), ptIds->end(), connectivity->GetPointer(offsets->GetValue(i))))
+    {
+      std::cerr << "Error: " << name << ": wrong points for cell " << cellId << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Visit all the cells by ranges of different sizes, with the same arrays.
+bool TestDataSet(const std::string& name, vtkDataSet* ds)
+{
+  vtkNew<vtkUnsignedCharArray> types;
+  vtkNew<vtkIdTypeArray> offsets;
+  vtkNew<vtkIdTypeArray> connectivity;
+  const vtkIdType numCells = ds->GetNumberOfCells();
+  for (vtkIdType rangeSize : { numCells, vtkIdType(7), vtkIdType(1) })
+  {
+    for (vtkIdType beginCellId = 0; beginCellId < numCells; beginCellId += rangeSize)
+    {
+      const vtkIdType endCellId = std::min(beginCellId + rangeSize, numCells);
+      if (!CompareRange(name, ds, beginCellId, endCellId, types, offsets, connectivity))
+      {
+        return false;
+      }
+    }
+  }
+  return CompareRange(name, ds, numCells, numCells, types, offsets, connectivity);
+}
+}
+
+//------------------------------------------------------------------------------
+int TestDataSetGetCellRange(int, char*[])
+{
+  bool success = true;
+
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(Resolution, Resolution, Resolution);
+  success &= TestDataSet("image", image);
+  image->BlankCell(5);
+  image->BlankPoint(2 * Resolution + 3);
+  success &= TestDataSet("blanked image", image);
+
+  vtkNew<vtkImageData> plane;
+  plane->SetDimensions(Resolution, 1, Resolution);
+  success &= TestDataSet("plane", plane);
+
+  vtkNew<vtkRectilinearGrid> rectilinear;
+  rectilinear->SetDimensions(Resolution, Resolution, 1);
+  vtkNew<vtkDoubleArray> coords;
+  for (int i = 0; i < Resolution; ++i)
+  {
+    coords->InsertNextValue(i * i);
+  }
+  vtkNew<vtkDoubleArray> zCoords;
+  zCoords->InsertNextValue(0.0);
+  rectilinear->SetXCoordinates(coords);
+  rectilinear->SetYCoordinates(coords);
+  rectilinear->SetZCoordinates(zCoords);
+  success &= TestDataSet("rectilinear grid", rectilinear);
+
+  vtkNew<vtkStructuredGrid> structured;
+  structured->SetDimensions(Resolution, Resolution, Resolution);
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(image->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < image->GetNumberOfPoints(); ++ptId)
+  {
+    points->SetPoint(ptId, image->GetPoint(ptId));
+  }
+  structured->SetPoints(points);
+  success &= TestDataSet("structured grid", structured);
+
+  // Mixed cell types, with an empty cell.
+  vtkNew<vtkUnstructuredGrid> grid;
+  grid->SetPoints(points);
+  grid->AllocateEstimate(image->GetNumberOfCells(), 8);
+  vtkNew<vtkIdList> ptIds;
+  for (vtkIdType cellId = 0; cellId < image->GetNumberOfCells(); ++cellId)
+  {
+    image->GetCellPoints(cellId, ptIds);
+    if (cellId % 3 == 0)
+    {
+      grid->InsertNextCell(VTK_VOXEL, ptIds);
+    }
+    else if (cellId % 3 == 1)
+    {
+      grid->InsertNextCell(VTK_TETRA, 4, ptIds->GetPointer(0));
+    }
+    else
+    {
+      grid->InsertNextCell(VTK_EMPTY_CELL, 0, ptIds->GetPointer(0));
+    }
+  }
+  success &= TestDataSet("unstructured grid", grid);
+
+  // Voxels with a fixed-size 16-bit storage.
+  vtkNew<vtkUnstructuredGrid> compactGrid;
+  compactGrid->SetPoints(points);
+  compactGrid->AllocateExact(image->GetNumberOfCells(), 8);
+  for (vtkIdType cellId = 0; cellId < image->GetNumberOfCells(); ++cellId)
+  {
+    image->GetCellPoints(cellId, ptIds);
+    compactGrid->InsertNextCell(VTK_VOXEL, ptIds);
+  }
+  if (!compactGrid->GetCells()->ConvertToCompactStorage() ||
+    !compactGrid->GetCells()->IsStorageCompact())
+  {
+    std::cerr << "Error: no compact storage for the voxels" << std::endl;
+    success = false;
+  }
+  success &= TestDataSet("unstructured grid with a compact storage", compactGrid);
+
+  vtkNew<vtkUnstructuredGrid> emptyGrid;
+  success &= TestDataSet("unstructured grid without cells", emptyGrid);
+
+  // Handled by the generic implementation.
+  vtkNew<vtkExplicitStructuredGrid> explicitGrid;
+  explicitGrid->SetDimensions(Resolution, Resolution, Resolution);
+  explicitGrid->SetPoints(points);
+  vtkNew<vtkCellArray> hexahedra;
+  for (vtkIdType cellId = 0; cellId < image->GetNumberOfCells(); ++cellId)
+  {
+    image->GetCellPoints(cellId, ptIds);
+    hexahedra->InsertNextCell(ptIds);
+  }
+  explicitGrid->SetCells(hexahedra);
+  explicitGrid->BlankCell(3);
+  success &= TestDataSet("explicit structured grid", explicitGrid);
+
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->AllocateEstimate(Resolution * Resolution, 4);
+  for (vtkIdType ptId = 0; ptId + Resolution + 1 < Resolution * Resolution; ++ptId)
+  {
+    const vtkIdType quad[4] = { ptId, ptId + 1, ptId + Resolution + 1, ptId + Resolution };
+    polyData->InsertNextCell(VTK_QUAD, 4, quad);
+    polyData->InsertNextCell(VTK_VERTEX, 1, quad);
+    polyData->InsertNextCell(VTK_LINE, 2, quad);
+  }
+  success &= TestDataSet("polydata", polyData);
+  polyData->BuildCells();
+  polyData->DeleteCell(4);
+  success &= TestDataSet("polydata with a deleted cell", polyData);
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that the batched evaluation of implicit functions, and the evaluation of
+// whole point arrays built on it, give the values of the point by point evaluation.
+
+#include "vtkBox.h"
+#include "vtkCylinder.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkImplicitBoolean.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPlane.h"
+#include "vtkQuadric.h"
+#include "vtkSphere.h"
+#include "vtkTransform.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr vtkIdType NumberOfPoints = 1001;
+
+//------------------------------------------------------------------------------
+bool FuzzyEqual(double a, double b, double tolerance)
+{
+  return std::fabs(a - b) <= tolerance * std::max(1.0, std::max(std::fabs(a), std::fabs(b)));
+}
+
+//------------------------------------------------------------------------------
+bool TestFunction(const std::string& name, vtkImplicitFunction* function, vtkDoubleArray* points)
+{
+  std::vector<double> x(NumberOfPoints), y(NumberOfPoints), z(NumberOfPoints);
+  for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+  {
+    x[i] = points->GetComponent(i, 0);
+    y[i] = points->GetComponent(i, 1);
+    z[i] = points->GetComponent(i, 2);
+  }
+  std::vector<double> values(NumberOfPoints);
+  function->FunctionValueBatch(NumberOfPoints, x.data(), y.data(), z.data(), values.data());
+
+  vtkNew<vtkDoubleArray> doubleValues;
+  function->FunctionValue(points, doubleValues);
+  vtkNew<vtkFloatArray> floatPoints;
+  floatPoints->DeepCopy(points);
+  vtkNew<vtkFloatArray> floatValues;
+  function->FunctionValue(floatPoints, floatValues);
+
+  if (doubleValues->GetNumberOfTuples() != NumberOfPoints ||
+    floatValues->GetNumberOfTuples() != NumberOfPoints)
+  {
+    std::cerr << "Error: " << name << ": wrong number of values" << std::endl;
+    return false;
+  }
+
+  for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+  {
+    double pt[3];
+    points->GetTuple(i, pt);
+    const double expected = function->FunctionValue(pt);
+    floatPoints->GetTuple(i, pt);
+    const double expectedFloat = function->FunctionValue(pt);
+    if (!FuzzyEqual(values[i], expected, 1.0e-12) ||
+      !FuzzyEqual(doubleValues->GetValue(i), expected, 1.0e-12) ||
+      !FuzzyEqual(floatValues->GetValue(i), expectedFloat, 1.0e-6))
+    {
+      std::cerr << "Error: " << name << ": point " << i << " evaluates to " << values[i] << ", "
+                << doubleValues->GetValue(i) << " and " << floatValues->GetValue(i) << " instead of "
+                << expected << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestImplicitFunctionBatch(int, char*[])
+{
+  // Random points, some of them snapped to a lattice so that they lie exactly on
+  // the faces of the boxes.
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(8775070);
+  vtkNew<vtkDoubleArray> points;
+  points->SetNumberOfComponents(3);
+  points->SetNumberOfTuples(NumberOfPoints);
+  for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      double value = random->GetNextRangeValue(-2.0, 2.0);
+      if (i % 3 == 0)
+      {
+        value = 0.5 * std::round(2.0 * value);
+      }
+      points->SetComponent(i, j, value);
+    }
+  }
+
+  bool success = true;
+
+  vtkNew<vtkSphere> sphere;
+  sphere->SetCenter(0.1, -0.2, 0.3);
+  sphere->SetRadius(1.2);
+  success &= TestFunction("sphere", sphere, points);
+
+  vtkNew<vtkPlane> plane;
+  plane->SetOrigin(0.2, 0.1, -0.3);
+  plane->SetNormal(1.0, 2.0, -0.5);
+  plane->SetOffset(0.4);
+  success &= TestFunction("plane", plane, points);
+
+  vtkNew<vtkCylinder> cylinder;
+  cylinder->SetCenter(-0.1, 0.2, 0.0);
+  cylinder->SetAxis(1.0, 1.0, 0.5);
+  cylinder->SetRadius(0.7);
+  success &= TestFunction("cylinder", cylinder, points);
+
+  vtkNew<vtkBox> box;
+  box->SetBounds(-1.0, 0.5, -0.5, 1.0, -1.5, 1.0);
+  success &= TestFunction("box", box, points);
+
+  vtkNew<vtkBox> flatBox;
+  flatBox->SetBounds(-1.0, 1.0, 0.5, 0.5, -1.0, 1.0);
+  success &= TestFunction("flat box", flatBox, points);
+
+  // No batched implementation: uses the default one.
+  vtkNew<vtkQuadric> quadric;
+  quadric->SetCoefficients(1.0, 2.0, 0.5, 0.1, 0.0, 0.3, 0.2, -0.1, 0.0, -1.0);
+  success &= TestFunction("quadric", quadric, points);
+
+  vtkNew<vtkTransform> transform;
+  transform->RotateWXYZ(30.0, 1.0, 1.0, 0.0);
+  transform->Translate(0.2, 0.0, -0.1);
+  transform->Scale(1.0, 1.5, 0.8);
+  box->SetTransform(transform);
+  success &= TestFunction("transformed box", box, points);
+
+  const char* names[] = { "union", "intersection", "difference", "union of magnitudes" };
+  for (int operation = vtkImplicitBoolean::VTK_UNION;
+       operation <= vtkImplicitBoolean::VTK_UNION_OF_MAGNITUDES; ++operation)
+  {
+    vtkNew<vtkImplicitBoolean> empty;
+    empty->SetOperationType(operation);
+    success &= TestFunction(std::string("empty ") + names[operation], empty, points);
+
+    vtkNew<vtkImplicitBoolean> inner;
+    inner->SetOperationType(operation);
+    inner->AddFunction(sphere);
+    inner->AddFunction(cylinder);
+
+    vtkNew<vtkImplicitBoolean> outer;
+    outer->SetOperationType(operation);
+    outer->AddFunction(box);
+    outer->AddFunction(inner);
+    outer->AddFunction(plane);
+    outer->AddFunction(quadric);
+    success &= TestFunction(names[operation], outer, points);
+
+    vtkNew<vtkTransform> outerTransform;
+    outerTransform->Translate(0.3, -0.2, 0.1);
+    outer->SetTransform(outerTransform);
+    success &= TestFunction(std::string("transformed ") + names[operation], outer, points);
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
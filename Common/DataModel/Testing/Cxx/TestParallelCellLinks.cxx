@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that the cell links built in parallel list the cells of each point in
+// increasing order, for the static and editable links of unstructured grids and
+// for the static links of other datasets, and that they are only rebuilt when
+// the dataset changes.
+
+#include "vtkCellArray.h"
+#include "vtkCellLinks.h"
+#include "vtkDataSet.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkStaticCellLinks.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Large enough for the prefix sum of the point uses to be split in several
+// blocks.
+constexpr int Resolution = 50;
+
+//------------------------------------------------------------------------------
+// The cells of each point, computed serially.
+std::vector<std::vector<vtkIdType>> ReferenceLinks(vtkDataSet* ds)
+{
+  std::vector<std::vector<vtkIdType>> links(ds->GetNumberOfPoints());
+  vtkNew<vtkIdList> ptIds;
+  for (vtkIdType cellId = 0; cellId < ds->GetNumberOfCells(); ++cellId)
+  {
+    ds->GetCellPoints(cellId, ptIds);
+    for (vtkIdType i = 0; i < ptIds->GetNumberOfIds(); ++i)
+    {
+      links[ptIds->GetId(i)].push_back(cellId);
+    }
+  }
+  return links;
+}
+
+//------------------------------------------------------------------------------
+template <typename TLinks>
+bool CompareLinks(const std::string& name, TLinks* links, vtkDataSet* ds)
+{
+  const auto reference = ReferenceLinks(ds);
+  for (vtkIdType ptId = 0; ptId < ds->GetNumberOfPoints(); ++ptId)
+  {
+    const vtkIdType ncells = links->GetNcells(ptId);
+    const vtkIdType* cells = links->GetCells(ptId);
+    if (ncells != static_cast<vtkIdType>(reference[ptId].size()))
+    {
+      std::cerr << "Error: " << name << ": point " << ptId << " has " << ncells
+                << " cells instead of " << reference[ptId].size() << std::endl;
+      return false;
+    }
+    for (vtkIdType i = 0; i < ncells; ++i)
+    {
+      if (cells[i] != reference[ptId][i])
+      {
+        std::cerr << "Error: " << name << ": cell " << i << " of point " << ptId << " is "
+                  << cells[i] << " instead of " << reference[ptId][i] << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Check that the links are built once, and rebuilt when the points change.
+bool TestRebuild(const std::string& name, vtkAbstractCellLinks* links, vtkPointSet* ds)
+{
+  links->BuildLinks();
+  const vtkMTimeType buildTime = links->GetBuildTime();
+  links->BuildLinks();
+  if (links->GetBuildTime() != buildTime)
+  {
+    std::cerr << "Error: " << name << ": links rebuilt without changes" << std::endl;
+    return false;
+  }
+  ds->GetPoints()->Modified();
+  links->BuildLinks();
+  if (links->GetBuildTime() == buildTime)
+  {
+    std::cerr << "Error: " << name << ": links not rebuilt after a change" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestParallelCellLinks(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(Resolution, Resolution, Resolution);
+
+  // The same grid as an unstructured grid, with the cells in reverse order so
+  // that the links are not built sorted.
+  vtkNew<vtkUnstructuredGrid> grid;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(image->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < image->GetNumberOfPoints(); ++ptId)
+  {
+    points->SetPoint(ptId, image->GetPoint(ptId));
+  }
+  grid->SetPoints(points);
+  grid->AllocateExact(image->GetNumberOfCells(), 8);
+  vtkNew<vtkIdList> ptIds;
+  for (vtkIdType cellId = image->GetNumberOfCells() - 1; cellId >= 0; --cellId)
+  {
+    image->GetCellPoints(cellId, ptIds);
+    grid->InsertNextCell(VTK_VOXEL, ptIds);
+  }
+
+  bool success = true;
+
+  vtkNew<vtkStaticCellLinks> imageLinks;
+  imageLinks->SetDataSet(image);
+  imageLinks->BuildLinks();
+  success &= CompareLinks("image static links", imageLinks.Get(), image);
+
+  vtkNew<vtkStaticCellLinks> staticLinks;
+  staticLinks->SetDataSet(grid);
+  staticLinks->BuildLinks();
+  success &= CompareLinks("static links", staticLinks.Get(), grid);
+  success &= TestRebuild("static links", staticLinks, grid);
+
+  vtkNew<vtkCellLinks> editableLinks;
+  editableLinks->SetDataSet(grid);
+  editableLinks->BuildLinks();
+  success &= CompareLinks("editable links", editableLinks.Get(), grid);
+  success &= TestRebuild("editable links", editableLinks, grid);
+  success &= CompareLinks("rebuilt editable links", editableLinks.Get(), grid);
+
+  // Links shallow copied before a rebuild are left untouched.
+  vtkNew<vtkCellLinks> copy;
+  copy->SetDataSet(grid);
+  copy->ShallowCopy(editableLinks);
+  grid->GetPoints()->Modified();
+  editableLinks->BuildLinks();
+  success &= CompareLinks("shallow copied editable links", copy.Get(), grid);
+
+  // The links of an editable grid are vtkCellLinks.
+  grid->EditableOn();
+  grid->BuildLinks();
+  if (!vtkCellLinks::SafeDownCast(grid->GetLinks()))
+  {
+    std::cerr << "Error: editable grid does not use vtkCellLinks" << std::endl;
+    success = false;
+  }
+  vtkNew<vtkIdList> cellIds;
+  grid->GetPointCells(0, cellIds);
+  if (cellIds->GetNumberOfIds() != 1 || cellIds->GetId(0) != grid->GetNumberOfCells() - 1)
+  {
+    std::cerr << "Error: wrong cells for point 0 of the editable grid" << std::endl;
+    success = false;
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that polyhedra loaded from a grid with a vtkPolyhedronTopology have the same faces,
+// edges and geometric queries as polyhedra generating them, and that the topology is dropped
+// when the cells change.
+
+#include "vtkCell.h"
+#include "vtkCellArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyhedron.h"
+#include "vtkPolyhedronTopology.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+constexpr int Resolution = 4;
+
+//------------------------------------------------------------------------------
+// A grid of cubes described as polyhedra, with an hexahedron in the middle of
+// the cell list.
+void BuildGrid(vtkUnstructuredGrid* grid)
+{
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k <= Resolution; ++k)
+  {
+    for (int j = 0; j <= Resolution; ++j)
+    {
+      for (int i = 0; i <= Resolution; ++i)
+      {
+        points->InsertNextPoint(i, j + 0.1 * i, k + 0.05 * j * i);
+      }
+    }
+  }
+  grid->SetPoints(points);
+  grid->AllocateExact(Resolution * Resolution * Resolution, 8);
+
+  auto id = [](int i, int j, int k) -> vtkIdType
+  { return i + (Resolution + 1) * (j + (Resolution + 1) * k); };
+  for (int k = 0; k < Resolution; ++k)
+  {
+    for (int j = 0; j < Resolution; ++j)
+    {
+      for (int i = 0; i < Resolution; ++i)
+      {
+        const vtkIdType pts[8] = { id(i, j, k), id(i + 1, j, k), id(i + 1, j + 1, k),
+          id(i, j + 1, k), id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j + 1, k + 1),
+          id(i, j + 1, k + 1) };
+        if (i == 1 && j == 1 && k == 1)
+        {
+          grid->InsertNextCell(VTK_HEXAHEDRON, 8, pts);
+          continue;
+        }
+        // Faces oriented outwards, in the legacy face stream format.
+        const vtkIdType faces[30] = { 4, pts[0], pts[3], pts[2], pts[1], 4, pts[4], pts[5],
+          pts[6], pts[7], 4, pts[0], pts[1], pts[5], pts[4], 4, pts[1], pts[2], pts[6], pts[5], 4,
+          pts[2], pts[3], pts[7], pts[6], 4, pts[3], pts[0], pts[4], pts[7] };
+        grid->InsertNextCell(VTK_POLYHEDRON, 8, pts, 6, faces);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+bool SameIds(vtkIdList* a, vtkIdList* b)
+{
+  if (a->GetNumberOfIds() != b->GetNumberOfIds())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfIds(); ++i)
+  {
+    if (a->GetId(i) != b->GetId(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool CompareCells(vtkCell* generated, vtkCell* precomputed, vtkIdType cellId)
+{
+  if (generated->GetNumberOfFaces() != precomputed->GetNumberOfFaces() ||
+    generated->GetNumberOfEdges() != precomputed->GetNumberOfEdges())
+  {
+    std::cerr << "Error: cell " << cellId << " has " << precomputed->GetNumberOfFaces()
+              << " faces and " << precomputed->GetNumberOfEdges() << " edges instead of "
+              << generated->GetNumberOfFaces() << " and " << generated->GetNumberOfEdges()
+              << std::endl;
+    return false;
+  }
+  for (int i = 0; i < generated->GetNumberOfEdges(); ++i)
+  {
+    if (!SameIds(generated->GetEdge(i)->GetPointIds(), precomputed->GetEdge(i)->GetPointIds()))
+    {
+      std::cerr << "Error: edge " << i << " of cell " << cellId << " differs" << std::endl;
+      return false;
+    }
+  }
+  for (int i = 0; i < generated->GetNumberOfFaces(); ++i)
+  {
+    if (!SameIds(generated->GetFace(i)->GetPointIds(), precomputed->GetFace(i)->GetPointIds()))
+    {
+      std::cerr << "Error: face " << i << " of cell " << cellId << " differs" << std::endl;
+      return false;
+    }
+  }
+
+  vtkPolyhedron* generatedPolyhedron = vtkPolyhedron::SafeDownCast(generated);
+  vtkPolyhedron* precomputedPolyhedron = vtkPolyhedron::SafeDownCast(precomputed);
+  if (generatedPolyhedron->IsConvex() != precomputedPolyhedron->IsConvex())
+  {
+    std::cerr << "Error: convexity of cell " << cellId << " differs" << std::endl;
+    return false;
+  }
+
+  double center[3] = { 0.0, 0.0, 0.0 };
+  for (vtkIdType i = 0; i < generated->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    generated->GetPoints()->GetPoint(i, x);
+    for (int j = 0; j < 3; ++j)
+    {
+      center[j] += x[j] / generated->GetNumberOfPoints();
+    }
+  }
+  if (generatedPolyhedron->IsInside(center, 1.0e-6) !=
+    precomputedPolyhedron->IsInside(center, 1.0e-6))
+  {
+    std::cerr << "Error: inside test of cell " << cellId << " differs" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestPolyhedronTopology(int, char*[])
+{
+  vtkNew<vtkUnstructuredGrid> grid;
+  BuildGrid(grid);
+
+  vtkNew<vtkUnstructuredGrid> copy;
+  copy->ShallowCopy(grid);
+  copy->BuildPolyhedronTopology();
+  vtkPolyhedronTopology* topology = copy->GetPolyhedronTopology();
+  if (!topology || topology->GetNumberOfCells() != grid->GetNumberOfCells())
+  {
+    std::cerr << "Error: the topology was not built" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (grid->GetPolyhedronTopology())
+  {
+    std::cerr << "Error: the original grid should not have a topology" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkIdType numFaces;
+  const vtkIdType* faceOffsets;
+  const vtkIdType* faceConn;
+  topology->GetCellFaces(Resolution * Resolution + Resolution + 1, numFaces, faceOffsets, faceConn);
+  if (numFaces != 0)
+  {
+    std::cerr << "Error: the hexahedron should not have faces in the topology" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkGenericCell> generated;
+  vtkNew<vtkGenericCell> precomputed;
+  for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells(); ++cellId)
+  {
+    if (grid->GetCellType(cellId) != VTK_POLYHEDRON)
+    {
+      continue;
+    }
+    grid->GetCell(cellId, generated);
+    copy->GetCell(cellId, precomputed);
+    if (!CompareCells(
+          generated->GetRepresentativeCell(), precomputed->GetRepresentativeCell(), cellId))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Replacing the cells discards the topology.
+  vtkNew<vtkCellArray> faces;
+  faces->DeepCopy(copy->GetPolyhedronFaces());
+  vtkNew<vtkCellArray> faceLocations;
+  faceLocations->DeepCopy(copy->GetPolyhedronFaceLocations());
+  copy->SetPolyhedralCells(copy->GetCellTypesArray(), copy->GetCells(), faceLocations, faces);
+  if (copy->GetPolyhedronTopology())
+  {
+    std::cerr << "Error: the topology should be discarded with the cells" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
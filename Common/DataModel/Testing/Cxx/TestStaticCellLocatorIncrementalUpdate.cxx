@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Deform a mesh over several time steps and check that a vtkStaticCellLocator refit
+// incrementally finds the same cells as a locator rebuilt from scratch.
+
+#include "vtkGenericCell.h"
+#include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkStaticCellLocator.h"
+#include "vtkStructuredGrid.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+constexpr int Resolution = 30;
+
+//------------------------------------------------------------------------------
+// Displace the points of a unit cube grid; the displacement vanishes on the
+// boundary so that the mesh stays within its initial bounds.
+void Deform(vtkPoints* points, double amplitude)
+{
+  vtkIdType ptId = 0;
+  for (int k = 0; k < Resolution; ++k)
+  {
+    for (int j = 0; j < Resolution; ++j)
+    {
+      for (int i = 0; i < Resolution; ++i, ++ptId)
+      {
+        double x[3] = { static_cast<double>(i) / (Resolution - 1),
+          static_cast<double>(j) / (Resolution - 1), static_cast<double>(k) / (Resolution - 1) };
+        double bump = amplitude * std::sin(vtkMath::Pi() * x[0]) *
+          std::sin(vtkMath::Pi() * x[1]) * std::sin(vtkMath::Pi() * x[2]);
+        x[0] += bump;
+        x[1] += 0.5 * bump;
+        points->SetPoint(ptId, x);
+      }
+    }
+  }
+  points->Modified();
+}
+
+//------------------------------------------------------------------------------
+int CompareLocators(vtkStaticCellLocator* incremental, vtkStaticCellLocator* reference,
+  vtkStructuredGrid* grid, vtkMinimalStandardRandomSequence* random)
+{
+  vtkNew<vtkGenericCell> cell;
+  std::vector<double> weights(8);
+  double pcoords[3], closest[3], dist2;
+  int subId;
+  int numFailed = 0;
+  for (int n = 0; n < 2000; ++n)
+  {
+    double x[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      x[i] = random->GetNextRangeValue(0.0, 1.0);
+    }
+    vtkIdType cellId = incremental->FindCell(x, 0.0, cell, subId, pcoords, weights.data());
+    vtkIdType refCellId = reference->FindCell(x, 0.0, cell, subId, pcoords, weights.data());
+    if ((cellId < 0) != (refCellId < 0))
+    {
+      std::cerr << "Error: FindCell returned " << cellId << " instead of " << refCellId << " for ("
+                << x[0] << ", " << x[1] << ", " << x[2] << ")" << std::endl;
+      ++numFailed;
+    }
+    else if (cellId >= 0)
+    {
+      // Points on shared faces may be found in either cell.
+      grid->GetCell(cellId, cell);
+      if (cell->EvaluatePosition(x, closest, subId, pcoords, dist2, weights.data()) != 1)
+      {
+        std::cerr << "Error: cell " << cellId << " does not contain (" << x[0] << ", " << x[1]
+                  << ", " << x[2] << ")" << std::endl;
+        ++numFailed;
+      }
+    }
+  }
+  return numFailed;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestStaticCellLocatorIncrementalUpdate(int, char*[])
+{
+  vtkNew<vtkStructuredGrid> grid;
+  grid->SetDimensions(Resolution, Resolution, Resolution);
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(Resolution * Resolution * Resolution);
+  Deform(points, 0.0);
+  grid->SetPoints(points);
+
+  vtkNew<vtkStaticCellLocator> locator;
+  locator->SetDataSet(grid);
+  locator->IncrementalUpdateOn();
+  locator->SetRebuildThreshold(1.0);
+  locator->SetNumberOfCellsPerNode(2);
+  locator->BuildLocator();
+  if (locator->GetNumberOfRebinnedCells() != -1)
+  {
+    std::cerr << "Error: first build should not be incremental" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(42);
+  int numFailed = 0;
+  for (int step = 1; step <= 5; ++step)
+  {
+    Deform(points, 0.02 * step);
+    grid->Modified();
+
+    vtkNew<vtkStaticCellLocator> reference;
+    reference->SetDataSet(grid);
+    reference->SetNumberOfCellsPerNode(2);
+    reference->BuildLocator();
+
+    // The locator is refit lazily by the queries.
+    numFailed += CompareLocators(locator, reference, grid, random);
+    vtkIdType numRebinned = locator->GetNumberOfRebinnedCells();
+    std::cout << "Step " << step << ": " << numRebinned << " cells rebinned" << std::endl;
+    if (numRebinned < 0)
+    {
+      std::cerr << "Error: locator was rebuilt instead of refit" << std::endl;
+      ++numFailed;
+    }
+  }
+
+  // Moving too many cells rebuilds the locator.
+  locator->SetRebuildThreshold(0.0);
+  Deform(points, 0.0);
+  grid->Modified();
+  locator->BuildLocator();
+  if (locator->GetNumberOfRebinnedCells() != -1)
+  {
+    std::cerr << "Error: locator should have been rebuilt" << std::endl;
+    ++numFailed;
+  }
+
+  // RefitLocator() refits explicitly, even without IncrementalUpdate.
+  locator->IncrementalUpdateOff();
+  locator->SetRebuildThreshold(1.0);
+  Deform(points, 0.05);
+  grid->Modified();
+  if (!locator->RefitLocator() || locator->GetNumberOfRebinnedCells() < 0)
+  {
+    std::cerr << "Error: RefitLocator() rebuilt the locator" << std::endl;
+    ++numFailed;
+  }
+  vtkNew<vtkStaticCellLocator> reference;
+  reference->SetDataSet(grid);
+  reference->BuildLocator();
+  numFailed += CompareLocators(locator, reference, grid, random);
+
+  // Initialize() releases the bins, so there is nothing left to refit.
+  locator->Initialize();
+  if (locator->RefitLocator() || locator->GetNumberOfRebinnedCells() != -1)
+  {
+    std::cerr << "Error: locator was refit after Initialize()" << std::endl;
+    ++numFailed;
+  }
+  numFailed += CompareLocators(locator, reference, grid, random);
+
+  return numFailed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
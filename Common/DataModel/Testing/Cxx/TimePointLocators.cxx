@@ -209,32 +209,32 @@ int TimePointLocators(int, char*[])
   cout << "Build and delete tree\n";
   cout << "\tUniform: " << buildTime[0] << "\n";
   cout << "\tStatic: " << buildTime[1] << "\n";
-  cout << "\tOctree: " << buildTime[2] << "\n";
-  cout << "\tKD Tree: " << buildTime[3] << "\n";
+  cout << "\tKD Tree: " << buildTime[2] << "\n";
+  cout << "\tOctree: " << buildTime[3] << "\n";
 
   cout << "Closest point queries\n";
   cout << "\tUniform: " << cpTime[0] << "\n";
   cout << "\tStatic: " << cpTime[1] << "\n";
-  cout << "\tOctree: " << cpTime[2] << "\n";
-  cout << "\tKD Tree: " << cpTime[3] << "\n";
+  cout << "\tKD Tree: " << cpTime[2] << "\n";
+  cout << "\tOctree: " << cpTime[3] << "\n";
 
   cout << "Closest N points queries\n";
   cout << "\tUniform: " << cnpTime[0] << "\n";
   cout << "\tStatic: " << cnpTime[1] << "\n";
-  cout << "\tOctree: " << cnpTime[2] << "\n";
-  cout << "\tKD Tree: " << cnpTime[3] << "\n";
+  cout << "\tKD Tree: " << cnpTime[2] << "\n";
+  cout << "\tOctree: " << cnpTime[3] << "\n";
 
   cout << "Closest points within radius queries\n";
   cout << "\tUniform: " << crpTime[0] << "\n";
   cout << "\tStatic: " << crpTime[1] << "\n";
-  cout << "\tOctree: " << crpTime[2] << "\n";
-  cout << "\tKD Tree: " << crpTime[3] << "\n";
+  cout << "\tKD Tree: " << crpTime[2] << "\n";
+  cout << "\tOctree: " << crpTime[3] << "\n";
 
   cout << "Total time\n";
   cout << "\tUniform: " << (buildTime[0] + cpTime[0] + cnpTime[0] + crpTime[0]) << "\n";
   cout << "\tStatic: " << (buildTime[1] + cpTime[1] + cnpTime[1] + crpTime[1]) << "\n";
-  cout << "\tOctree: " << (buildTime[2] + cpTime[2] + cnpTime[2] + crpTime[2]) << "\n";
-  cout << "\tKD Tree: " << (buildTime[3] + cpTime[3] + cnpTime[3] + crpTime[3]) << "\n";
+  cout << "\tKD Tree: " << (buildTime[2] + cpTime[2] + cnpTime[2] + crpTime[2]) << "\n";
+  cout << "\tOctree: " << (buildTime[3] + cpTime[3] + cnpTime[3] + crpTime[3]) << "\n";
 
   timer->Delete();
   points->Delete();
@@ -288,6 +288,26 @@ void vtkAbstractCellLocator::GetCellBounds(vtkIdType cellId, double*& cellBounds
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::CopyParameters(vtkAbstractCellLocator* from)
+{
+  if (!from)
+  {
+    return;
+  }
+
+  // vtkLocator parameters
+  this->SetAutomatic(from->GetAutomatic());
+  this->SetTolerance(from->GetTolerance());
+  this->SetMaxLevel(from->GetMaxLevel());
+  this->SetUseExistingSearchStructure(from->GetUseExistingSearchStructure());
+
+  // vtkAbstractCellLocator parameters
+  this->SetNumberOfCellsPerNode(from->GetNumberOfCellsPerNode());
+  this->SetCacheCellBounds(from->GetCacheCellBounds());
+  this->SetRetainCellLists(from->GetRetainCellLists());
+}
+
 //------------------------------------------------------------------------------
 void vtkAbstractCellLocator::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -301,6 +301,13 @@ public:
    */
   virtual void ShallowCopy(vtkAbstractCellLocator*) {}
 
+  /**
+   * Copy the parameters, but not the search structure, of another locator.
+   * This is used to configure a locator instantiated from a prototype.
+   * Sub-classes can contribute to the parameter copying process via chaining.
+   */
+  virtual void CopyParameters(vtkAbstractCellLocator* from);
+
 protected:
   vtkAbstractCellLocator();
   ~vtkAbstractCellLocator() override;
@@ -1214,7 +1214,7 @@ struct BoundsPointUsesWorker
 struct BoundsPointIdsWorker
 {
   template <typename TPointsArray, typename TId>
-  void operator()(TPointsArray* pts, const TId* ptIds, TId numberOfPointsIds, double* bds)
+  void operator()(TPointsArray* pts, const TId* ptIds, vtkIdType numberOfPointsIds, double* bds)
   {
     // We use THRESHOLD to test if the data size is small enough
     // to execute the functor serially. This is faster.
@@ -1321,6 +1321,36 @@ void vtkBoundingBox::ComputeBounds(
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkBoundingBox::ComputeBounds(
+  vtkPoints* pts, const short* ptIds, vtkIdType numberOfPointsIds, double bounds[6])
+{
+  // Compute bounds: dispatch to real types, fallback for other types.
+  using Dispatcher = vtkArrayDispatch::DispatchByValueTypeUsingArrays<vtkArrayDispatch::AllArrays,
+    vtkArrayDispatch::Reals>;
+  BoundsPointIdsWorker worker;
+
+  if (!Dispatcher::Execute(pts->GetData(), worker, ptIds, numberOfPointsIds, bounds))
+  { // Fallback to slowpath for other point types
+    worker(pts->GetData(), ptIds, numberOfPointsIds, bounds);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkBoundingBox::ComputeBounds(
+  vtkPoints* pts, const signed char* ptIds, vtkIdType numberOfPointsIds, double bounds[6])
+{
+  // Compute bounds: dispatch to real types, fallback for other types.
+  using Dispatcher = vtkArrayDispatch::DispatchByValueTypeUsingArrays<vtkArrayDispatch::AllArrays,
+    vtkArrayDispatch::Reals>;
+  BoundsPointIdsWorker worker;
+
+  if (!Dispatcher::Execute(pts->GetData(), worker, ptIds, numberOfPointsIds, bounds))
+  { // Fallback to slowpath for other point types
+    worker(pts->GetData(), ptIds, numberOfPointsIds, bounds);
+  }
+}
+
 // ---------------------------------------------------------------------------
 void vtkBoundingBox::ComputeLocalBounds(
   vtkPoints* points, double u[3], double v[3], double w[3], double outputBounds[6])
@@ -77,7 +77,9 @@ public:
    * Compute the bounding box from an array of vtkPoints. It uses a fast
    * (i.e., threaded) path when possible. The second signature (with point
    * uses) only considers points with ptUses[i] != 0 in the bounds
-   * calculation. The third signature uses point ids.
+   * calculation. The signatures with point ids only consider the given
+   * points, the 8- and 16-bit ones supporting the compact connectivity arrays
+   * of vtkCellArray.
    * The non-static ComputeBounds() methods update the current bounds of an instance of this class.
    */
   static void ComputeBounds(vtkPoints* pts, double bounds[6]);
@@ -88,6 +90,10 @@ public:
     vtkPoints* pts, const long long* ptIds, long long numPointIds, double bounds[6]);
   static void ComputeBounds(vtkPoints* pts, const long* ptIds, long numPointIds, double bounds[6]);
   static void ComputeBounds(vtkPoints* pts, const int* ptIds, int numPointIds, double bounds[6]);
+  static void ComputeBounds(
+    vtkPoints* pts, const short* ptIds, vtkIdType numPointIds, double bounds[6]);
+  static void ComputeBounds(
+    vtkPoints* pts, const signed char* ptIds, vtkIdType numPointIds, double bounds[6]);
   void ComputeBounds(vtkPoints* pts)
   {
     double bds[6];
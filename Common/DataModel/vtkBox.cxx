@@ -176,6 +176,38 @@ double vtkBox::EvaluateFunction(double x[3])
   }
 }
 
+//------------------------------------------------------------------------------
+// Evaluate box equation for a batch of points. Same result as EvaluateFunction(),
+// but the signed distance along each axis is computed without branches: it is
+// positive outside the slab of the axis and negative inside. Flat axes (zero
+// length) do not contribute to the distance of the points inside the box.
+void vtkBox::EvaluateFunctionBatch(
+  vtkIdType n, const double* x, const double* y, const double* z, double* values)
+{
+  const double* minP = this->BBox->GetMinPoint();
+  const double* maxP = this->BBox->GetMaxPoint();
+  const double min0 = minP[0], min1 = minP[1], min2 = minP[2];
+  const double max0 = maxP[0], max1 = maxP[1], max2 = maxP[2];
+  const bool flat0 = this->BBox->GetLength(0) == 0.0;
+  const bool flat1 = this->BBox->GetLength(1) == 0.0;
+  const bool flat2 = this->BBox->GetLength(2) == 0.0;
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    const double d0 = std::max(min0 - x[i], x[i] - max0);
+    const double d1 = std::max(min1 - y[i], y[i] - max1);
+    const double d2 = std::max(min2 - z[i], z[i] - max2);
+    const double in0 = flat0 ? -VTK_DOUBLE_MAX : d0;
+    const double in1 = flat1 ? -VTK_DOUBLE_MAX : d1;
+    const double in2 = flat2 ? -VTK_DOUBLE_MAX : d2;
+    const double out0 = std::max(d0, 0.0);
+    const double out1 = std::max(d1, 0.0);
+    const double out2 = std::max(d2, 0.0);
+    const bool inside = d0 <= 0.0 && d1 <= 0.0 && d2 <= 0.0;
+    values[i] = inside ? std::max(std::max(in0, in1), in2)
+                       : std::sqrt(out0 * out0 + out1 * out1 + out2 * out2);
+  }
+}
+
 //------------------------------------------------------------------------------
 // Evaluate box gradient.
 void vtkBox::EvaluateGradient(double x[3], double n[3])
@@ -40,6 +40,8 @@ public:
    */
   using vtkImplicitFunction::EvaluateFunction;
   double EvaluateFunction(double x[3]) override;
+  void EvaluateFunctionBatch(
+    vtkIdType n, const double* x, const double* y, const double* z, double* values) override;
 
   /**
    * Evaluate the gradient of the box.
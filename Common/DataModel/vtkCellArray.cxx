@@ -17,6 +17,9 @@
 #include <algorithm>
 #include <array>
 #include <iterator>
+#include <limits>
+#include <mutex>
+#include <type_traits>
 
 namespace
 {
@@ -27,6 +30,8 @@ namespace deprec
 
 struct GetSizeImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   vtkIdType operator()(CellStateT& cells) const
   {
@@ -39,10 +44,12 @@ struct GetSizeImpl
 // returned CellId will be -1.
 struct LocationToCellIdFunctor
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   vtkIdType operator()(CellStateT& cells, vtkIdType location) const
   {
-    using ValueType = typename CellStateT::ValueType;
+    using ValueType = typename CellStateT::OffsetsValueType;
 
     const auto offsets = vtk::DataArrayValueRange<1>(cells.GetOffsets());
 
@@ -100,17 +107,21 @@ struct LocationToCellIdFunctor
 
 struct CellIdToLocationFunctor
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   vtkIdType operator()(CellStateT& cells, vtkIdType cellId) const
   {
     // Adding the cellId to the offset of that cell id gives us the cell
     // location in the old-style vtkCellArray connectivity array.
-    return static_cast<vtkIdType>(cells.GetOffsets()->GetValue(cellId)) + cellId;
+    return cells.GetBeginOffset(cellId) + cellId;
   }
 };
 
 struct GetInsertLocationImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   vtkIdType operator()(CellStateT& cells) const
   {
@@ -125,20 +136,20 @@ struct GetInsertLocationImpl
 
 struct PrintDebugImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   void operator()(CellStateT& state, std::ostream& os)
   {
-    using ValueType = typename CellStateT::ValueType;
-
     const vtkIdType numCells = state.GetNumberOfCells();
     for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
     {
       os << "cell " << cellId << ": ";
 
       const auto cellRange = state.GetCellRange(cellId);
-      for (ValueType ptId : cellRange)
+      for (const auto ptId : cellRange)
       {
-        os << ptId << " ";
+        os << static_cast<vtkIdType>(ptId) << " ";
       }
 
       os << "\n";
@@ -159,6 +170,8 @@ struct InitializeImpl
 
 struct SqueezeImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   void operator()(CellStateT& cells) const
   {
@@ -169,10 +182,12 @@ struct SqueezeImpl
 
 struct IsValidImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   bool operator()(CellStateT& state) const
   {
-    using ValueType = typename CellStateT::ValueType;
+    using ValueType = typename CellStateT::OffsetsValueType;
     auto* offsetArray = state.GetOffsets();
     auto* connArray = state.GetConnectivity();
 
@@ -208,9 +223,11 @@ struct IsValidImpl
   }
 };
 
-template <typename T>
+template <typename T, typename OffsetsT = T>
 struct CanConvert
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   bool operator()(CellStateT& state) const
   {
@@ -219,8 +236,8 @@ struct CanConvert
 
     // offsets are sorted, so just check the last value, but we have to compute
     // the full range of the connectivity array.
-    auto* off = state.GetOffsets();
-    if (off->GetNumberOfValues() > 0 && !this->CheckValue(off->GetValue(off->GetMaxId())))
+    const vtkIdType lastOffset = state.GetBeginOffset(state.GetNumberOfCells());
+    if (!this->CheckValue<OffsetsT>(lastOffset))
     {
       return false;
     }
@@ -230,7 +247,7 @@ struct CanConvert
     if (mutConn->GetNumberOfValues() > 0)
     {
       mutConn->GetValueRange(connRange.data(), 0);
-      if (!this->CheckValue(connRange[0]) || !this->CheckValue(connRange[1]))
+      if (!this->CheckValue<T>(connRange[0]) || !this->CheckValue<T>(connRange[1]))
       {
         return false;
       }
@@ -239,10 +256,10 @@ struct CanConvert
     return true;
   }
 
-  template <typename U>
+  template <typename TargetT, typename U>
   bool CheckValue(const U& val) const
   {
-    return val == static_cast<U>(static_cast<T>(val));
+    return val == static_cast<U>(static_cast<TargetT>(val));
   }
 };
 
@@ -276,32 +293,42 @@ struct ExtractAndInitialize
 
 struct IsHomogeneousImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellArraysT>
   vtkIdType operator()(CellArraysT& state) const
   {
-    using ValueType = typename CellArraysT::ValueType;
-    auto* offsets = state.GetOffsets();
-
     const vtkIdType numCells = state.GetNumberOfCells();
     if (numCells == 0)
     {
       return 0;
     }
 
-    // Initialize using the first cell:
-    const vtkIdType firstCellSize = state.GetCellSize(0);
+    if constexpr (CellArraysT::IsFixedSize)
+    {
+      return state.GetFixedCellSize();
+    }
+    else
+    {
+      using ValueType = typename CellArraysT::OffsetsValueType;
+      using OffsetsArrayType = typename CellArraysT::OffsetsArrayType;
+      auto* offsets = const_cast<OffsetsArrayType*>(state.GetOffsets());
+
+      // Initialize using the first cell:
+      const vtkIdType firstCellSize = state.GetCellSize(0);
 
-    // Verify the rest:
-    auto offsetRange = vtk::DataArrayValueRange<1>(offsets);
-    auto it = std::adjacent_find(offsetRange.begin() + 1, offsetRange.end(),
-      [&](const ValueType a, const ValueType b) -> bool { return (b - a != firstCellSize); });
+      // Verify the rest:
+      auto offsetRange = vtk::DataArrayValueRange<1>(offsets);
+      auto it = std::adjacent_find(offsetRange.begin() + 1, offsetRange.end(),
+        [&](const ValueType a, const ValueType b) -> bool { return (b - a != firstCellSize); });
 
-    if (it != offsetRange.end())
-    { // Found a cell that doesn't match the size of the first cell:
-      return -1;
-    }
+      if (it != offsetRange.end())
+      { // Found a cell that doesn't match the size of the first cell:
+        return -1;
+      }
 
-    return firstCellSize;
+      return firstCellSize;
+    }
   }
 };
 
@@ -346,6 +373,8 @@ struct FindMaxCell // SMP functor
 
   struct Impl
   {
+    static constexpr bool SupportsCompactStorage = true;
+
     template <typename CellStateT>
     vtkIdType operator()(CellStateT& cells, vtkIdType cellId, const vtkIdType endCellId) const
     {
@@ -375,6 +404,8 @@ struct FindMaxCell // SMP functor
 
 struct GetActualMemorySizeImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   unsigned long operator()(CellStateT& cells) const
   {
@@ -385,6 +416,8 @@ struct GetActualMemorySizeImpl
 
 struct PrintSelfImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   void operator()(CellStateT& cells, ostream& os, vtkIndent indent) const
   {
@@ -397,6 +430,8 @@ struct PrintSelfImpl
 
 struct GetLegacyDataSizeImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   vtkIdType operator()(CellStateT& cells) const
   {
@@ -407,6 +442,8 @@ struct GetLegacyDataSizeImpl
 
 struct ReverseCellAtIdImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   void operator()(CellStateT& cells, vtkIdType cellId) const
   {
@@ -471,14 +508,15 @@ struct AppendLegacyFormatImpl
 
 struct AppendImpl
 {
-  // Call this signature:
   template <typename DstCellStateT>
-  void operator()(DstCellStateT& dstcells, vtkCellArray* src, vtkIdType pointOffset) const
-  { // dispatch on src:
-    src->Visit(*this, dstcells, pointOffset);
-  }
+  void operator()(DstCellStateT& dstcells, vtkCellArray* src, vtkIdType pointOffset) const;
+};
+
+// Appends the source cells, which may use a compact storage.
+struct AppendSourceImpl
+{
+  static constexpr bool SupportsCompactStorage = true;
 
-  // Above signature calls this operator in Visit:
   template <typename SrcCellStateT, typename DstCellStateT>
   void operator()(SrcCellStateT& src, DstCellStateT& dst, vtkIdType pointOffsets) const
   {
@@ -519,6 +557,119 @@ struct AppendImpl
   }
 };
 
+template <typename DstCellStateT>
+void AppendImpl::operator()(
+  DstCellStateT& dstcells, vtkCellArray* src, vtkIdType pointOffset) const
+{ // dispatch on src:
+  src->Visit(AppendSourceImpl{}, dstcells, pointOffset);
+}
+
+struct GetConnectivityRangeImpl
+{
+  static constexpr bool SupportsCompactStorage = true;
+
+  template <typename CellStateT>
+  std::array<vtkTypeInt64, 2> operator()(CellStateT& state) const
+  {
+    using ArrayType = typename CellStateT::ArrayType;
+    using ValueType = typename CellStateT::ValueType;
+
+    auto* conn = const_cast<ArrayType*>(state.GetConnectivity());
+    if (conn->GetNumberOfValues() == 0)
+    {
+      return { 0, 0 };
+    }
+    std::array<ValueType, 2> range;
+    conn->GetValueRange(range.data(), 0);
+    return { static_cast<vtkTypeInt64>(range[0]), static_cast<vtkTypeInt64>(range[1]) };
+  }
+};
+
+// Copy the cells of any storage to the given arrays. Offsets are skipped when
+// the target storage is fixed-size, and arrays of the same type are shared.
+struct CopyArraysImpl
+{
+  static constexpr bool SupportsCompactStorage = true;
+
+  template <typename CellStateT, typename OffsetsArrayT, typename ArrayT>
+  bool operator()(CellStateT& state, OffsetsArrayT* offsets, ArrayT* conn) const
+  {
+    using SrcArrayType = typename CellStateT::ArrayType;
+    using SrcOffsetsArrayType = typename CellStateT::OffsetsArrayType;
+
+    auto* srcConn = const_cast<SrcArrayType*>(state.GetConnectivity());
+    if constexpr (std::is_same<SrcArrayType, ArrayT>::value)
+    {
+      conn->ShallowCopy(srcConn);
+    }
+    else
+    {
+      using ValueType = typename ArrayT::ValueType;
+      const vtkIdType numValues = srcConn->GetNumberOfValues();
+      if (!conn->SetNumberOfValues(numValues))
+      {
+        return false;
+      }
+      const auto* src = srcConn->GetPointer(0);
+      ValueType* dst = conn->GetPointer(0);
+      vtkSMPTools::For(0, numValues,
+        [src, dst](vtkIdType begin, vtkIdType end)
+        {
+          for (vtkIdType i = begin; i < end; ++i)
+          {
+            dst[i] = static_cast<ValueType>(src[i]);
+          }
+        });
+    }
+
+    if constexpr (std::is_same<OffsetsArrayT, vtkCellArray::AffineArrayType64>::value)
+    {
+      (void)offsets;
+    }
+    else if constexpr (std::is_same<SrcOffsetsArrayType, OffsetsArrayT>::value)
+    {
+      offsets->ShallowCopy(const_cast<SrcOffsetsArrayType*>(state.GetOffsets()));
+    }
+    else
+    {
+      using OffsetsValueType = typename OffsetsArrayT::ValueType;
+      const vtkIdType numOffsets = state.GetNumberOfCells() + 1;
+      if (!offsets->SetNumberOfValues(numOffsets))
+      {
+        return false;
+      }
+      OffsetsValueType* dst = offsets->GetPointer(0);
+      vtkSMPTools::For(0, numOffsets,
+        [&state, dst](vtkIdType begin, vtkIdType end)
+        {
+          for (vtkIdType i = begin; i < end; ++i)
+          {
+            dst[i] = static_cast<OffsetsValueType>(state.GetBeginOffset(i));
+          }
+        });
+    }
+    return true;
+  }
+};
+
+// Storage type holding the arrays of a VisitState.
+template <typename StateT>
+constexpr vtkCellArray::StorageTypes StorageTypeOf()
+{
+  constexpr std::size_t size = sizeof(typename StateT::ValueType);
+  if (StateT::IsFixedSize)
+  {
+    return size == 1 ? vtkCellArray::FixedSizeInt8
+      : size == 2    ? vtkCellArray::FixedSizeInt16
+      : size == 4    ? vtkCellArray::FixedSizeInt32
+                     : vtkCellArray::FixedSizeInt64;
+  }
+  return size == 1 ? vtkCellArray::Int8
+    : size == 2    ? vtkCellArray::Int16
+    : size == 4    ? vtkCellArray::Int32
+                   : vtkCellArray::Int64;
+}
+
 } // end anon namespace
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -683,24 +834,23 @@ void vtkCellArray::DeepCopy(vtkAbstractCellArray* ca)
     return;
   }
 
-  if (other->Storage.Is64Bit())
-  {
-    this->Storage.Use64BitStorage();
-    auto& srcStorage = other->Storage.GetArrays64();
-    auto& dstStorage = this->Storage.GetArrays64();
-    dstStorage.Offsets->DeepCopy(srcStorage.Offsets);
-    dstStorage.Connectivity->DeepCopy(srcStorage.Connectivity);
-    this->Modified();
-  }
-  else
-  {
-    this->Storage.Use32BitStorage();
-    auto& srcStorage = other->Storage.GetArrays32();
-    auto& dstStorage = this->Storage.GetArrays32();
-    dstStorage.Offsets->DeepCopy(srcStorage.Offsets);
-    dstStorage.Connectivity->DeepCopy(srcStorage.Connectivity);
-    this->Modified();
-  }
+  this->Storage.Use(other->Storage.GetType());
+  other->Storage.Apply<void>(
+    [this](auto& srcStorage)
+    {
+      using StateT = std::decay_t<decltype(srcStorage)>;
+      auto& dstStorage = *this->Storage.GetState<StateT>();
+      dstStorage.Connectivity->DeepCopy(srcStorage.Connectivity);
+      if constexpr (StateT::IsFixedSize)
+      {
+        dstStorage.InitializeOffsets(srcStorage.FixedCellSize, srcStorage.GetNumberOfCells());
+      }
+      else
+      {
+        dstStorage.Offsets->DeepCopy(srcStorage.Offsets);
+      }
+    });
+  this->Modified();
 }
 
 //------------------------------------------------------------------------------
@@ -716,16 +866,12 @@ void vtkCellArray::ShallowCopy(vtkAbstractCellArray* ca)
     return;
   }
 
-  if (other->Storage.Is64Bit())
-  {
-    auto& srcStorage = other->Storage.GetArrays64();
-    this->SetData(srcStorage.GetOffsets(), srcStorage.GetConnectivity());
-  }
-  else
-  {
-    auto& srcStorage = other->Storage.GetArrays32();
-    this->SetData(srcStorage.GetOffsets(), srcStorage.GetConnectivity());
-  }
+  other->Storage.Apply<void>(
+    [this](auto& srcStorage)
+    {
+      this->SetStorage(srcStorage.FixedCellSize, srcStorage.GetOffsets(),
+        srcStorage.GetConnectivity());
+    });
 }
 
 //------------------------------------------------------------------------------
@@ -740,7 +886,12 @@ void vtkCellArray::Append(vtkCellArray* src, vtkIdType pointOffset)
 //------------------------------------------------------------------------------
 void vtkCellArray::Initialize()
 {
+  if (this->Storage.IsCompact())
+  {
+    this->Storage.Use(this->Storage.GetExplicitType());
+  }
   this->Visit(InitializeImpl{});
+  this->ReleaseExplicitCopy();
 
   this->LegacyData->Initialize();
 }
@@ -915,6 +1066,24 @@ struct GenerateOffsetsImpl
   }
 };
 
+// Shares the memory of connectivity arrays from InputArrayList with an array
+// of the matching storage type.
+struct ToStorageArrayImpl
+{
+  vtkSmartPointer<vtkDataArray> Result;
+
+  template <typename ArrayT>
+  void operator()(ArrayT* connectivity)
+  {
+    using ValueType = vtk::GetAPIType<ArrayT>;
+    using StorageArrayT = typename std::conditional<sizeof(ValueType) == 4,
+      vtkCellArray::ArrayType32, vtkCellArray::ArrayType64>::type;
+    auto result = vtkSmartPointer<StorageArrayT>::New();
+    result->ShallowCopy(connectivity);
+    this->Result = result;
+  }
+};
+
 } // end anon namespace
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -973,10 +1142,64 @@ bool vtkCellArray::SetData(vtkIdType cellSize, vtkDataArray* connectivity)
   return this->SetData(offsets, connectivity);
 }
 
+//------------------------------------------------------------------------------
+bool vtkCellArray::SetFixedSizeData(vtkIdType cellSize, vtkDataArray* connectivity)
+{
+  if (connectivity == nullptr || cellSize <= 0)
+  {
+    vtkErrorMacro("Invalid cellSize or connectivity array.");
+    return false;
+  }
+
+  if ((connectivity->GetNumberOfTuples() % cellSize) != 0)
+  {
+    vtkErrorMacro("Connectivity array size is not suitable for chosen cellSize");
+    return false;
+  }
+
+  if (connectivity->GetNumberOfComponents() != 1)
+  {
+    vtkErrorMacro("Only single component arrays may be used for vtkCellArray storage.");
+    return false;
+  }
+
+  if (auto conn8 = vtkArrayDownCast<ArrayType8>(connectivity))
+  {
+    this->SetStorage(cellSize, static_cast<AffineArrayType64*>(nullptr), conn8);
+    return true;
+  }
+  if (auto conn16 = vtkArrayDownCast<ArrayType16>(connectivity))
+  {
+    this->SetStorage(cellSize, static_cast<AffineArrayType64*>(nullptr), conn16);
+    return true;
+  }
+
+  ToStorageArrayImpl worker;
+  using SupportedArrays = vtkCellArray::InputArrayList;
+  using Dispatch = vtkArrayDispatch::DispatchByArray<SupportedArrays>;
+  if (!Dispatch::Execute(connectivity, worker))
+  {
+    vtkErrorMacro("Invalid array types passed to SetData: "
+      << "connectivity=" << connectivity->GetClassName());
+    return false;
+  }
+
+  if (auto conn32 = vtkArrayDownCast<ArrayType32>(worker.Result))
+  {
+    this->SetStorage(cellSize, static_cast<AffineArrayType64*>(nullptr), conn32);
+  }
+  else
+  {
+    this->SetStorage(cellSize, static_cast<AffineArrayType64*>(nullptr),
+      vtkArrayDownCast<ArrayType64>(worker.Result));
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkCellArray::Use32BitStorage()
 {
-  if (!this->Storage.Is64Bit())
+  if (this->Storage.GetType() == Int32)
   {
     this->Initialize();
     return;
@@ -987,7 +1210,7 @@ void vtkCellArray::Use32BitStorage()
 //------------------------------------------------------------------------------
 void vtkCellArray::Use64BitStorage()
 {
-  if (this->Storage.Is64Bit())
+  if (this->Storage.GetType() == Int64)
   {
     this->Initialize();
     return;
@@ -1008,11 +1231,7 @@ void vtkCellArray::UseDefaultStorage()
 //------------------------------------------------------------------------------
 bool vtkCellArray::CanConvertTo32BitStorage() const
 {
-  if (!this->Storage.Is64Bit())
-  {
-    return true;
-  }
-  return this->Visit(CanConvert<ArrayType32::ValueType>{});
+  return this->CanConvertToStorage(Int32);
 }
 
 //------------------------------------------------------------------------------
@@ -1034,10 +1253,14 @@ bool vtkCellArray::CanConvertToDefaultStorage() const
 //------------------------------------------------------------------------------
 bool vtkCellArray::ConvertTo32BitStorage()
 {
-  if (!this->IsStorage64Bit())
+  if (this->Storage.GetType() == Int32)
   {
     return true;
   }
+  if (this->Storage.IsCompact())
+  {
+    return this->ConvertToStorageUnchecked(Int32, 0);
+  }
   vtkNew<ArrayType32> offsets;
   vtkNew<ArrayType32> conn;
   if (!this->Visit(ExtractAndInitialize{}, offsets.Get(), conn.Get()))
@@ -1052,10 +1275,14 @@ bool vtkCellArray::ConvertTo32BitStorage()
 //------------------------------------------------------------------------------
 bool vtkCellArray::ConvertTo64BitStorage()
 {
-  if (this->IsStorage64Bit())
+  if (this->Storage.GetType() == Int64)
   {
     return true;
   }
+  if (this->Storage.IsCompact())
+  {
+    return this->ConvertToStorageUnchecked(Int64, 0);
+  }
   vtkNew<ArrayType64> offsets;
   vtkNew<ArrayType64> conn;
   if (!this->Visit(ExtractAndInitialize{}, offsets.Get(), conn.Get()))
@@ -1080,6 +1307,10 @@ bool vtkCellArray::ConvertToDefaultStorage()
 //------------------------------------------------------------------------------
 bool vtkCellArray::ConvertToSmallestStorage()
 {
+  if (this->Storage.IsCompact() && !this->ConvertToExplicitStorage())
+  {
+    return false;
+  }
   if (this->IsStorage64Bit() && this->CanConvertTo32BitStorage())
   {
     return this->ConvertTo32BitStorage();
@@ -1088,9 +1319,233 @@ bool vtkCellArray::ConvertToSmallestStorage()
   return true;
 }
 
+//------------------------------------------------------------------------------
+bool vtkCellArray::ConvertToCompactStorage()
+{
+  const vtkIdType numCells = this->GetNumberOfCells();
+  if (numCells == 0)
+  {
+    // Nothing to save, keep an explicit storage ready for insertion.
+    return this->IsStorageCompact() ? this->ConvertToExplicitStorage()
+                                    : this->ConvertTo32BitStorage();
+  }
+
+  const vtkIdType cellSize = this->Visit(IsHomogeneousImpl{});
+  const std::array<vtkTypeInt64, 2> range = this->Visit(GetConnectivityRangeImpl{});
+  const vtkIdType connSize = this->GetNumberOfConnectivityIds();
+  auto fits = [&range](auto value)
+  {
+    using T = decltype(value);
+    return range[0] >= std::numeric_limits<T>::lowest() &&
+      range[1] <= std::numeric_limits<T>::max();
+  };
+
+  int type;
+  if (cellSize > 0)
+  {
+    // Implicit offsets, only the connectivity type matters.
+    type = fits(vtkTypeInt8{}) ? FixedSizeInt8
+      : fits(vtkTypeInt16{})   ? FixedSizeInt16
+      : fits(vtkTypeInt32{})   ? FixedSizeInt32
+                               : FixedSizeInt64;
+  }
+  else if (connSize > VTK_TYPE_INT32_MAX || !fits(vtkTypeInt32{}))
+  {
+    type = Int64;
+  }
+  else
+  {
+    type = fits(vtkTypeInt8{}) ? Int8 : fits(vtkTypeInt16{}) ? Int16 : Int32;
+  }
+
+  if (type == this->Storage.GetType())
+  {
+    return true;
+  }
+  return this->ConvertToStorageUnchecked(type, cellSize);
+}
+
+//------------------------------------------------------------------------------
+bool vtkCellArray::CanConvertToStorage(int type) const
+{
+  if (type == this->Storage.GetType())
+  {
+    return true;
+  }
+  if (type >= FixedSizeInt8 && type <= FixedSizeInt64 && this->Visit(IsHomogeneousImpl{}) < 0)
+  {
+    return false;
+  }
+  switch (type)
+  {
+    case Int32:
+      return this->Visit(CanConvert<ArrayType32::ValueType>{});
+    case Int64:
+      return this->Visit(CanConvert<ArrayType64::ValueType>{});
+    case Int8:
+      return this->Visit(CanConvert<ArrayType8::ValueType, ArrayType32::ValueType>{});
+    case Int16:
+      return this->Visit(CanConvert<ArrayType16::ValueType, ArrayType32::ValueType>{});
+    case FixedSizeInt8:
+      return this->Visit(CanConvert<ArrayType8::ValueType, vtkTypeInt64>{});
+    case FixedSizeInt16:
+      return this->Visit(CanConvert<ArrayType16::ValueType, vtkTypeInt64>{});
+    case FixedSizeInt32:
+      return this->Visit(CanConvert<ArrayType32::ValueType, vtkTypeInt64>{});
+    case FixedSizeInt64:
+      return this->Visit(CanConvert<ArrayType64::ValueType, vtkTypeInt64>{});
+    default:
+      return false;
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkCellArray::ConvertToStorage(int type)
+{
+  if (type < Int32 || type > FixedSizeInt64)
+  {
+    vtkErrorMacro("Invalid storage type: " << type);
+    return false;
+  }
+  if (type == this->Storage.GetType())
+  {
+    return true;
+  }
+  if (!this->CanConvertToStorage(type))
+  {
+    return false;
+  }
+  const vtkIdType cellSize = type >= FixedSizeInt8 ? this->Visit(IsHomogeneousImpl{}) : 0;
+  return this->ConvertToStorageUnchecked(type, cellSize);
+}
+
+//------------------------------------------------------------------------------
+bool vtkCellArray::ConvertToExplicitStorage()
+{
+  if (!this->Storage.IsCompact())
+  {
+    return true;
+  }
+  // The explicit type always holds the values of the compact storage.
+  return this->ConvertToStorageUnchecked(this->Storage.GetExplicitType(), 0);
+}
+
+//------------------------------------------------------------------------------
+bool vtkCellArray::ConvertToStorageUnchecked(int type, vtkIdType cellSize)
+{
+  auto convert = [this, cellSize](auto offsets, auto conn)
+  {
+    if (!this->Visit(CopyArraysImpl{}, offsets.Get(), conn.Get()))
+    {
+      return false;
+    }
+    this->SetStorage(cellSize, offsets.Get(), conn.Get());
+    return true;
+  };
+  const vtkSmartPointer<AffineArrayType64> implicitOffsets;
+
+  switch (type)
+  {
+    case Int32:
+      return convert(vtkSmartPointer<ArrayType32>::New(), vtkSmartPointer<ArrayType32>::New());
+    case Int64:
+      return convert(vtkSmartPointer<ArrayType64>::New(), vtkSmartPointer<ArrayType64>::New());
+    case Int8:
+      return convert(vtkSmartPointer<ArrayType32>::New(), vtkSmartPointer<ArrayType8>::New());
+    case Int16:
+      return convert(vtkSmartPointer<ArrayType32>::New(), vtkSmartPointer<ArrayType16>::New());
+    case FixedSizeInt8:
+      return convert(implicitOffsets, vtkSmartPointer<ArrayType8>::New());
+    case FixedSizeInt16:
+      return convert(implicitOffsets, vtkSmartPointer<ArrayType16>::New());
+    case FixedSizeInt32:
+      return convert(implicitOffsets, vtkSmartPointer<ArrayType32>::New());
+    case FixedSizeInt64:
+      return convert(implicitOffsets, vtkSmartPointer<ArrayType64>::New());
+    default:
+      vtkErrorMacro("Invalid storage type: " << type);
+      return false;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkCellArray::CopyToExplicitStorage(vtkCellArray* target) const
+{
+  if (this->Storage.GetExplicitType() == Int64)
+  {
+    vtkNew<ArrayType64> offsets;
+    vtkNew<ArrayType64> conn;
+    this->Visit(CopyArraysImpl{}, offsets.Get(), conn.Get());
+    target->SetStorage(0, offsets.Get(), conn.Get());
+  }
+  else
+  {
+    vtkNew<ArrayType32> offsets;
+    vtkNew<ArrayType32> conn;
+    this->Visit(CopyArraysImpl{}, offsets.Get(), conn.Get());
+    target->SetStorage(0, offsets.Get(), conn.Get());
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCellArray> vtkCellArray::GetExplicitCopy() const
+{
+  // GetMTime() and the array accessors are not const, but do not modify anything.
+  auto* self = const_cast<vtkCellArray*>(this);
+  const vtkMTimeType mtime = std::max({ self->GetMTime(), self->GetOffsetsArray()->GetMTime(),
+    self->GetConnectivityArray()->GetMTime() });
+
+  std::lock_guard<std::mutex> lock(this->ExplicitCopyMutex);
+  if (!this->ExplicitCopy || this->ExplicitCopyTime != mtime)
+  {
+    vtkDebugWithObjectMacro(self, "Copying the compact cell array to an explicit storage.");
+    auto copy = vtkSmartPointer<vtkCellArray>::New();
+    this->CopyToExplicitStorage(copy);
+    this->ExplicitCopy = copy;
+    this->ExplicitCopyTime = mtime;
+  }
+  return this->ExplicitCopy;
+}
+
+//------------------------------------------------------------------------------
+void vtkCellArray::ReleaseExplicitCopy()
+{
+  std::lock_guard<std::mutex> lock(this->ExplicitCopyMutex);
+  this->ExplicitCopy = nullptr;
+  this->ExplicitCopyTime = 0;
+}
+
+//------------------------------------------------------------------------------
+template <typename ArrayT, typename OffsetsArrayT>
+void vtkCellArray::SetStorage(vtkIdType cellSize, OffsetsArrayT* offsets, ArrayT* connectivity)
+{
+  using StateT = VisitState<ArrayT, OffsetsArrayT>;
+  this->Storage.Use(StorageTypeOf<StateT>());
+  StateT& state = *this->Storage.GetState<StateT>();
+  state.Connectivity = connectivity;
+  if constexpr (StateT::IsFixedSize)
+  {
+    (void)offsets;
+    state.InitializeOffsets(
+      cellSize, cellSize > 0 ? connectivity->GetNumberOfValues() / cellSize : 0);
+  }
+  else
+  {
+    (void)cellSize;
+    state.Offsets = offsets;
+  }
+  this->ReleaseExplicitCopy();
+  this->Modified();
+}
+
 //------------------------------------------------------------------------------
 bool vtkCellArray::AllocateExact(vtkIdType numCells, vtkIdType connectivitySize)
 {
+  if (this->Storage.IsCompact())
+  {
+    // Existing data is not preserved, cells are going to be inserted.
+    this->Storage.Use(this->Storage.GetExplicitType());
+  }
   return this->Visit(AllocateExactImpl{}, numCells, connectivitySize);
 }
 
@@ -1126,7 +1581,8 @@ void vtkCellArray::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
 
-  os << indent << "StorageIs64Bit: " << this->Storage.Is64Bit() << "\n";
+  os << indent << "StorageIs64Bit: " << this->IsStorage64Bit() << "\n";
+  os << indent << "StorageType: " << this->Storage.GetType() << "\n";
 
   PrintSelfImpl functor;
   this->Visit(functor, os, indent);
@@ -1226,6 +1682,7 @@ void vtkCellArray::AppendLegacyFormat(const vtkIdType* data, vtkIdType len, vtkI
 void vtkCellArray::Squeeze()
 {
   this->Visit(SqueezeImpl{});
+  this->ReleaseExplicitCopy();
 
   // Just delete the legacy buffer.
   this->LegacyData->Initialize();
@@ -84,6 +84,36 @@
  * - `bool ConvertToDefaultStorage() // Depends on vtkIdType`
  * - `bool ConvertToSmallestStorage() // Depends on current values in arrays`
  *
+ * Besides these explicit 32- and 64-bit storages, a cell array may use compact
+ * storages, listed in StorageTypes:
+ *
+ * - 8- and 16-bit connectivity arrays with 32-bit offsets, for small blocks
+ *   where all point ids fit in 8 or 16 bits.
+ * - Fixed-size storages, where all cells have the same number of points and
+ *   the offsets array is implicit (a vtkAffineArray that uses no memory). The
+ *   connectivity may use 8, 16, 32 or 64 bits. For a mesh of hexahedra, this
+ *   saves the whole offsets array, i.e. 8 bytes per cell with 64-bit storage.
+ *
+ * Compact storages are opt-in: ConvertToCompactStorage() selects the most
+ * compact storage for the current cells, ConvertToStorage() a given one, and
+ * SetFixedSizeData(cellSize, connectivity) directly uses a fixed-size storage.
+ * They are meant for cell arrays that are no longer modified: inserting cells
+ * first converts the storage back to explicit 32- or 64-bit arrays, and so
+ * does accessing the internal arrays through the 32/64-bit API
+ * (GetOffsetsArray32() etc.). GetOffsetsArray() and GetConnectivityArray()
+ * never change the storage and return the compact arrays. See Visit() for the
+ * way functors see compact storages.
+ *
+ * Methods for managing compact storages are:
+ *
+ * - `int GetStorageType()`
+ * - `bool IsStorageFixedSize()`
+ * - `bool IsStorageCompact()`
+ * - `bool CanConvertToStorage(int type)`
+ * - `bool ConvertToStorage(int type)`
+ * - `bool ConvertToCompactStorage() // Depends on current values in arrays`
+ * - `bool ConvertToExplicitStorage() // Back to 32- or 64-bit arrays`
+ *
  * Note that some legacy methods are still available that reflect the
  * previous storage format of this data, which embedded the cell sizes into
  * the Connectivity array:
@@ -128,16 +158,20 @@
 #include "vtkWrappingHints.h"         // For VTK_MARSHALMANUAL
 
 #include "vtkAOSDataArrayTemplate.h" // Needed for inline methods
+#include "vtkAffineArray.h"          // Needed for fixed-size storage
 #include "vtkCell.h"                 // Needed for inline methods
 #include "vtkDataArrayRange.h"       // Needed for inline methods
 #include "vtkFeatures.h"             // for VTK_USE_MEMKIND
 #include "vtkSmartPointer.h"         // For vtkSmartPointer
+#include "vtkTypeInt16Array.h"       // Needed for inline methods
 #include "vtkTypeInt32Array.h"       // Needed for inline methods
 #include "vtkTypeInt64Array.h"       // Needed for inline methods
+#include "vtkTypeInt8Array.h"        // Needed for inline methods
 #include "vtkTypeList.h"             // Needed for ArrayList definition
 
 #include <cassert>          // for assert
 #include <initializer_list> // for API
+#include <mutex>            // for std::mutex
 #include <type_traits>      // for std::is_same
 #include <utility>          // for std::forward
 
@@ -172,6 +206,31 @@ class VTKCOMMONDATAMODEL_EXPORT VTK_MARSHALMANUAL vtkCellArray : public vtkAbstr
 public:
   using ArrayType32 = vtkTypeInt32Array;
   using ArrayType64 = vtkTypeInt64Array;
+  using ArrayType8 = vtkTypeInt8Array;
+  using ArrayType16 = vtkTypeInt16Array;
+
+  /**
+   * Implicit offsets array used by fixed-size storages.
+   */
+  using AffineArrayType64 = vtkAffineArray<vtkTypeInt64>;
+
+  /**
+   * Internal storage types. The explicit Int32 and Int64 storages use offsets
+   * and connectivity arrays of the same type. Int8 and Int16 use 32-bit
+   * offsets, and the FixedSize storages use an implicit AffineArrayType64
+   * offsets array.
+   */
+  enum StorageTypes
+  {
+    Int32 = 0,
+    Int64,
+    Int8,
+    Int16,
+    FixedSizeInt8,
+    FixedSizeInt16,
+    FixedSizeInt32,
+    FixedSizeInt64
+  };
 
   ///@{
   /**
@@ -188,7 +247,7 @@ public:
    * List of possible array types used for storage. May be used with
    * vtkArrayDispatch::Dispatch[2]ByArray to process internal arrays.
    * Both the Connectivity and Offset arrays are guaranteed to have the same
-   * type.
+   * type. Compact storages are not part of this list, see GetStorageType().
    *
    * @sa vtkCellArray::Visit() for a simpler mechanism.
    */
@@ -301,47 +360,21 @@ public:
   /**
    * Get the number of cells in the array.
    */
-  vtkIdType GetNumberOfCells() const override
-  {
-    if (this->Storage.Is64Bit())
-    {
-      return this->Storage.GetArrays64().Offsets->GetNumberOfValues() - 1;
-    }
-    else
-    {
-      return this->Storage.GetArrays32().Offsets->GetNumberOfValues() - 1;
-    }
-  }
+  vtkIdType GetNumberOfCells() const override { return this->Storage.GetNumberOfOffsets() - 1; }
 
   /**
    * Get the number of elements in the offsets array. This will be the number of
    * cells + 1.
    */
-  vtkIdType GetNumberOfOffsets() const override
-  {
-    if (this->Storage.Is64Bit())
-    {
-      return this->Storage.GetArrays64().Offsets->GetNumberOfValues();
-    }
-    else
-    {
-      return this->Storage.GetArrays32().Offsets->GetNumberOfValues();
-    }
-  }
+  vtkIdType GetNumberOfOffsets() const override { return this->Storage.GetNumberOfOffsets(); }
 
   /**
    * Get the offset (into the connectivity) for a specified cell id.
    */
   vtkIdType GetOffset(vtkIdType cellId) override
   {
-    if (this->Storage.Is64Bit())
-    {
-      return this->Storage.GetArrays64().Offsets->GetValue(cellId);
-    }
-    else
-    {
-      return this->Storage.GetArrays32().Offsets->GetValue(cellId);
-    }
+    return this->Storage.Apply<vtkIdType>(
+      [cellId](const auto& state) { return state.GetBeginOffset(cellId); });
   }
 
   /**
@@ -352,14 +385,7 @@ public:
    */
   vtkIdType GetNumberOfConnectivityIds() const override
   {
-    if (this->Storage.Is64Bit())
-    {
-      return this->Storage.GetArrays64().Connectivity->GetNumberOfValues();
-    }
-    else
-    {
-      return this->Storage.GetArrays32().Connectivity->GetNumberOfValues();
-    }
+    return this->Storage.GetNumberOfConnectivityIds();
   }
 
   /**
@@ -414,14 +440,25 @@ public:
    *
    * If invalid arrays are passed in, an error is logged and the function
    * will return false.
+   *
+   * @sa SetFixedSizeData
    */
   bool SetData(vtkIdType cellSize, vtkDataArray* connectivity);
 
+  /**
+   * Like SetData(cellSize, connectivity), but uses a fixed-size storage: the
+   * offsets array is implicit, and the connectivity array is shared when
+   * possible. The `connectivity` array may also be an ArrayType8 or
+   * ArrayType16 array. See StorageTypes.
+   */
+  bool SetFixedSizeData(vtkIdType cellSize, vtkDataArray* connectivity);
+
   /**
    * @return True if the internal storage is using 64 bit arrays. If false,
-   * the storage is using 32 bit arrays.
+   * the storage is using 32 bit arrays. For compact storages, this tells
+   * which explicit storage ConvertToExplicitStorage() converts them to.
    */
-  bool IsStorage64Bit() const { return this->Storage.Is64Bit(); }
+  bool IsStorage64Bit() const { return this->Storage.GetExplicitType() == Int64; }
 
   /**
    * @return True if the internal storage can be shared as a
@@ -431,16 +468,38 @@ public:
    */
   bool IsStorageShareable() const override
   {
-    if (this->Storage.Is64Bit())
+    switch (this->Storage.GetType())
     {
-      return VisitState<ArrayType64>::ValueTypeIsSameAsIdType;
-    }
-    else
-    {
-      return VisitState<ArrayType32>::ValueTypeIsSameAsIdType;
+      case Int64:
+        return VisitState<ArrayType64>::ValueTypeIsSameAsIdType;
+      case Int32:
+        return VisitState<ArrayType32>::ValueTypeIsSameAsIdType;
+      case FixedSizeInt64:
+        return VisitState<ArrayType64, AffineArrayType64>::ValueTypeIsSameAsIdType;
+      case FixedSizeInt32:
+        return VisitState<ArrayType32, AffineArrayType64>::ValueTypeIsSameAsIdType;
+      default:
+        return false;
     }
   }
 
+  /**
+   * @return The current internal storage type, one of StorageTypes.
+   */
+  int GetStorageType() const { return this->Storage.GetType(); }
+
+  /**
+   * @return True if the internal storage is one of the fixed-size storages,
+   * where all cells have the same size and offsets are implicit.
+   */
+  bool IsStorageFixedSize() const { return this->Storage.GetType() >= FixedSizeInt8; }
+
+  /**
+   * @return True if the internal storage is not one of the explicit 32- or
+   * 64-bit storages.
+   */
+  bool IsStorageCompact() const { return this->Storage.IsCompact(); }
+
   /**
    * Initialize internal data structures to use 32- or 64-bit storage.
    * If selecting default storage, the storage depends on the VTK_USE_64BIT_IDS
@@ -489,45 +548,97 @@ public:
   bool ConvertToSmallestStorage();
   /**@}*/
 
+  /**
+   * Convert internal data structures to the most compact storage for the
+   * existing data, among the explicit and compact StorageTypes: a fixed-size
+   * storage when all cells have the same size, and the smallest connectivity
+   * type holding all the point ids. Existing data is preserved.
+   *
+   * @return True on success, false on failure.
+   */
+  bool ConvertToCompactStorage();
+
+  /**
+   * Check if the existing data can be converted to the given storage type,
+   * one of StorageTypes. All values must fit in the target arrays without
+   * truncation, and fixed-size storages require all cells to have the same
+   * size.
+   */
+  bool CanConvertToStorage(int type) const;
+
+  /**
+   * Convert internal data structures to the given storage type, one of
+   * StorageTypes. Existing data is preserved.
+   *
+   * @return False if the existing data can not be represented with this
+   * storage type (see CanConvertToStorage()), in which case the cell array is
+   * left untouched, or if an allocation fails.
+   */
+  bool ConvertToStorage(int type);
+
+  /**
+   * Convert a compact storage back to explicit 32-bit arrays, or 64-bit
+   * arrays when the FixedSizeInt64 storage or the size of the connectivity
+   * requires it. Does nothing for explicit storages.
+   */
+  bool ConvertToExplicitStorage();
+
   /**
    * Return the array used to store cell offsets. The 32/64 variants are only
    * valid when IsStorage64Bit() returns the appropriate value.
+   *
+   * With a compact storage, GetOffsetsArray() returns its offsets array, an
+   * implicit vtkAffineArray for fixed-size storages, without converting it.
+   * The 32/64 variants first convert it to the explicit storage given by
+   * IsStorage64Bit(), see ConvertToExplicitStorage(), so they must not be
+   * called concurrently on such arrays.
    * @{
    */
   vtkDataArray* GetOffsetsArray()
   {
-    if (this->Storage.Is64Bit())
-    {
-      return this->GetOffsetsArray64();
-    }
-    else
-    {
-      return this->GetOffsetsArray32();
-    }
+    return this->Storage.Apply<vtkDataArray*>(
+      [](auto& state) -> vtkDataArray* { return state.GetOffsets(); });
+  }
+  ArrayType32* GetOffsetsArray32()
+  {
+    this->EnsureExplicitStorage();
+    return this->Storage.GetType() == Int32 ? this->Storage.GetArrays32().Offsets.Get() : nullptr;
+  }
+  ArrayType64* GetOffsetsArray64()
+  {
+    this->EnsureExplicitStorage();
+    return this->Storage.GetType() == Int64 ? this->Storage.GetArrays64().Offsets.Get() : nullptr;
   }
-  ArrayType32* GetOffsetsArray32() { return this->Storage.GetArrays32().Offsets; }
-  ArrayType64* GetOffsetsArray64() { return this->Storage.GetArrays64().Offsets; }
   /**@}*/
 
   /**
    * Return the array used to store the point ids that define the cells'
    * connectivity. The 32/64 variants are only valid when IsStorage64Bit()
    * returns the appropriate value.
+   *
+   * With a compact storage, GetConnectivityArray() returns its connectivity
+   * array without converting it. The 32/64 variants first convert it to the
+   * explicit storage given by IsStorage64Bit(), see ConvertToExplicitStorage(),
+   * so they must not be called concurrently on such arrays.
    * @{
    */
   vtkDataArray* GetConnectivityArray()
   {
-    if (this->Storage.Is64Bit())
-    {
-      return this->GetConnectivityArray64();
-    }
-    else
-    {
-      return this->GetConnectivityArray32();
-    }
+    return this->Storage.Apply<vtkDataArray*>(
+      [](auto& state) -> vtkDataArray* { return state.GetConnectivity(); });
+  }
+  ArrayType32* GetConnectivityArray32()
+  {
+    this->EnsureExplicitStorage();
+    return this->Storage.GetType() == Int32 ? this->Storage.GetArrays32().Connectivity.Get()
+                                            : nullptr;
+  }
+  ArrayType64* GetConnectivityArray64()
+  {
+    this->EnsureExplicitStorage();
+    return this->Storage.GetType() == Int64 ? this->Storage.GetArrays64().Connectivity.Get()
+                                            : nullptr;
   }
-  ArrayType32* GetConnectivityArray32() { return this->Storage.GetArrays32().Connectivity; }
-  ArrayType64* GetConnectivityArray64() { return this->Storage.GetArrays64().Connectivity; }
   /**@}*/
 
   /**
@@ -794,12 +905,17 @@ public:
   // The wrappers get understandably confused by some of the template code below
 #ifndef __VTK_WRAP__
 
-  // Holds connectivity and offset arrays of the given ArrayType.
-  template <typename ArrayT>
+  // Holds connectivity and offset arrays of the given ArrayType. Compact
+  // storages use a different OffsetsArrayType: ArrayType32 for the 8- and
+  // 16-bit storages, and the implicit AffineArrayType64 for fixed-size
+  // storages.
+  template <typename ArrayT, typename OffsetsArrayT = ArrayT>
   struct VisitState
   {
     using ArrayType = ArrayT;
     using ValueType = typename ArrayType::ValueType;
+    using OffsetsArrayType = OffsetsArrayT;
+    using OffsetsValueType = typename OffsetsArrayType::ValueType;
     using CellRangeType = decltype(vtk::DataArrayValueRange<1>(std::declval<ArrayType>()));
 
     // We can't just use is_same here, since binary compatible representations
@@ -810,8 +926,11 @@ public:
     static constexpr bool ValueTypeIsSameAsIdType = std::is_integral<ValueType>::value &&
       std::is_signed<ValueType>::value && (sizeof(ValueType) == sizeof(vtkIdType));
 
-    ArrayType* GetOffsets() { return this->Offsets; }
-    const ArrayType* GetOffsets() const { return this->Offsets; }
+    // True if all cells have the same size, the offsets array being implicit.
+    static constexpr bool IsFixedSize = std::is_same<OffsetsArrayType, AffineArrayType64>::value;
+
+    OffsetsArrayType* GetOffsets() { return this->Offsets; }
+    const OffsetsArrayType* GetOffsets() const { return this->Offsets; }
 
     ArrayType* GetConnectivity() { return this->Connectivity; }
     const ArrayType* GetConnectivity() const { return this->Connectivity; }
@@ -826,14 +945,17 @@ public:
 
     CellRangeType GetCellRange(vtkIdType cellId);
 
+    // Size of all cells for fixed-size storages, 0 otherwise.
+    vtkIdType GetFixedCellSize() const { return this->FixedCellSize; }
+
     friend class vtkCellArray;
 
   protected:
     VisitState()
     {
       this->Connectivity = vtkSmartPointer<ArrayType>::New();
-      this->Offsets = vtkSmartPointer<ArrayType>::New();
-      this->Offsets->InsertNextValue(0);
+      this->Offsets = vtkSmartPointer<OffsetsArrayType>::New();
+      this->InitializeOffsets(0, 0);
       if (vtkObjectBase::GetUsingMemkind())
       {
         this->IsInMemkind = true;
@@ -867,8 +989,28 @@ public:
 #endif
     }
 
+    // Set the implicit offsets of numCells cells of the given size, for
+    // fixed-size storages. Explicit offsets only get their first 0 value.
+    void InitializeOffsets(vtkIdType cellSize, vtkIdType numCells)
+    {
+      if constexpr (IsFixedSize)
+      {
+        this->FixedCellSize = cellSize;
+        this->Offsets->ConstructBackend(cellSize, 0);
+        this->Offsets->SetNumberOfComponents(1);
+        this->Offsets->SetNumberOfTuples(numCells + 1);
+      }
+      else
+      {
+        (void)cellSize;
+        (void)numCells;
+        this->Offsets->InsertNextValue(0);
+      }
+    }
+
     vtkSmartPointer<ArrayType> Connectivity;
-    vtkSmartPointer<ArrayType> Offsets;
+    vtkSmartPointer<OffsetsArrayType> Offsets;
+    vtkIdType FixedCellSize = 0;
 
   private:
     VisitState(const VisitState&) = delete;
@@ -886,6 +1028,63 @@ private: // Helpers that allow Visit to return a value:
   {
   };
 
+  // Detects the functors declaring `SupportsCompactStorage = true`.
+  template <typename Functor, typename = void>
+  struct SupportsCompactStorage : std::false_type
+  {
+  };
+
+  template <typename Functor>
+  struct SupportsCompactStorage<Functor,
+    std::void_t<decltype(std::decay_t<Functor>::SupportsCompactStorage)>>
+    : std::integral_constant<bool, std::decay_t<Functor>::SupportsCompactStorage>
+  {
+  };
+
+  template <typename ReturnT, typename Functor, typename... Args>
+  ReturnT VisitImpl(Functor&& functor, Args&&... args)
+  {
+    constexpr bool supportsCompact = SupportsCompactStorage<Functor>::value;
+    if constexpr (!supportsCompact)
+    {
+      this->EnsureExplicitStorage();
+    }
+    return this->Storage.template Apply<ReturnT, supportsCompact>(
+      [&](auto& state) -> ReturnT
+      {
+        // If you get an error on the next line, a call to Visit(functor, Args...)
+        // is being called with arguments that do not match the functor's call
+        // signature. See the Visit documentation for details.
+        return static_cast<ReturnT>(functor(state, std::forward<Args>(args)...));
+      });
+  }
+
+  template <typename ReturnT, typename Functor, typename... Args>
+  ReturnT VisitImpl(Functor&& functor, Args&&... args) const
+  {
+    constexpr bool supportsCompact = SupportsCompactStorage<Functor>::value;
+    if constexpr (!supportsCompact)
+    {
+      if (this->Storage.IsCompact())
+      {
+        // This cell array can not be converted here, work on an explicit copy.
+        // The local reference keeps the copy alive if it is replaced meanwhile.
+        const vtkSmartPointer<vtkCellArray> expanded = this->GetExplicitCopy();
+        const vtkCellArray* constExpanded = expanded;
+        return constExpanded->template VisitImpl<ReturnT>(
+          std::forward<Functor>(functor), std::forward<Args>(args)...);
+      }
+    }
+    return this->Storage.template Apply<ReturnT, supportsCompact>(
+      [&](const auto& state) -> ReturnT
+      {
+        // If you get an error on the next line, a call to Visit(functor, Args...)
+        // is being called with arguments that do not match the functor's call
+        // signature. See the Visit documentation for details.
+        return static_cast<ReturnT>(functor(state, std::forward<Args>(args)...));
+      });
+  }
+
 public:
   /**
    * @warning Advanced use only.
@@ -954,85 +1153,68 @@ public:
    * vtkIdType largest = cellArray->Visit(FindLargestCellInRange{},
    *                                      128, 1024);
    * ```
+   *
+   * By default, functors only see the explicit storages, i.e.
+   * `VisitState<ArrayType32>` and `VisitState<ArrayType64>`. When the cell
+   * array uses a compact storage (see StorageTypes), which only happens when
+   * it was requested, the non-const Visit converts it back to explicit storage
+   * before calling the functor, so it must not be called concurrently on such
+   * arrays. The const Visit never converts the storage and calls the functor
+   * with an explicit copy of the arrays instead. The copy is made by the first
+   * such call and reused until the cell array is modified, so it costs a full
+   * copy of the cells once and doubles the memory used by the array. Nothing
+   * pointing into the copied arrays should be kept after the call.
+   *
+   * Functors that can handle compact storages should declare it, in which
+   * case they are called with the compact `VisitState` directly:
+   *
+   * ```
+   * struct CountPoints
+   * {
+   *   static constexpr bool SupportsCompactStorage = true;
+   *
+   *   template <typename CellStateT>
+   *   vtkIdType operator()(CellStateT& state)
+   *   {
+   *     return state.GetEndOffset(state.GetNumberOfCells() - 1);
+   *   }
+   * };
+   * ```
+   *
+   * Such functors must not assume that `CellStateT::OffsetsValueType` is
+   * `CellStateT::ValueType`, nor that the offsets array is writable or
+   * contiguous: fixed-size storages (`CellStateT::IsFixedSize`) use an
+   * implicit vtkAffineArray. Using GetBeginOffset() / GetEndOffset() /
+   * GetCellRange() works with all storages.
    * @{
    */
   template <typename Functor, typename... Args,
     typename = typename std::enable_if<ReturnsVoid<Functor, Args...>::value>::type>
   void Visit(Functor&& functor, Args&&... args)
   {
-    if (this->Storage.Is64Bit())
-    {
-      // If you get an error on the next line, a call to Visit(functor, Args...)
-      // is being called with arguments that do not match the functor's call
-      // signature. See the Visit documentation for details.
-      functor(this->Storage.GetArrays64(), std::forward<Args>(args)...);
-    }
-    else
-    {
-      // If you get an error on the next line, a call to Visit(functor, Args...)
-      // is being called with arguments that do not match the functor's call
-      // signature. See the Visit documentation for details.
-      functor(this->Storage.GetArrays32(), std::forward<Args>(args)...);
-    }
+    this->VisitImpl<void>(std::forward<Functor>(functor), std::forward<Args>(args)...);
   }
 
   template <typename Functor, typename... Args,
     typename = typename std::enable_if<ReturnsVoid<Functor, Args...>::value>::type>
   void Visit(Functor&& functor, Args&&... args) const
   {
-    if (this->Storage.Is64Bit())
-    {
-      // If you get an error on the next line, a call to Visit(functor, Args...)
-      // is being called with arguments that do not match the functor's call
-      // signature. See the Visit documentation for details.
-      functor(this->Storage.GetArrays64(), std::forward<Args>(args)...);
-    }
-    else
-    {
-      // If you get an error on the next line, a call to Visit(functor, Args...)
-      // is being called with arguments that do not match the functor's call
-      // signature. See the Visit documentation for details.
-      functor(this->Storage.GetArrays32(), std::forward<Args>(args)...);
-    }
+    this->VisitImpl<void>(std::forward<Functor>(functor), std::forward<Args>(args)...);
   }
 
   template <typename Functor, typename... Args,
     typename = typename std::enable_if<!ReturnsVoid<Functor, Args...>::value>::type>
   GetReturnType<Functor, Args...> Visit(Functor&& functor, Args&&... args)
   {
-    if (this->Storage.Is64Bit())
-    {
-      // If you get an error on the next line, a call to Visit(functor, Args...)
-      // is being called with arguments that do not match the functor's call
-      // signature. See the Visit documentation for details.
-      return functor(this->Storage.GetArrays64(), std::forward<Args>(args)...);
-    }
-    else
-    {
-      // If you get an error on the next line, a call to Visit(functor, Args...)
-      // is being called with arguments that do not match the functor's call
-      // signature. See the Visit documentation for details.
-      return functor(this->Storage.GetArrays32(), std::forward<Args>(args)...);
-    }
+    return this->VisitImpl<GetReturnType<Functor, Args...>>(
+      std::forward<Functor>(functor), std::forward<Args>(args)...);
   }
   template <typename Functor, typename... Args,
     typename = typename std::enable_if<!ReturnsVoid<Functor, Args...>::value>::type>
   GetReturnType<Functor, Args...> Visit(Functor&& functor, Args&&... args) const
   {
-    if (this->Storage.Is64Bit())
-    {
-      // If you get an error on the next line, a call to Visit(functor, Args...)
-      // is being called with arguments that do not match the functor's call
-      // signature. See the Visit documentation for details.
-      return functor(this->Storage.GetArrays64(), std::forward<Args>(args)...);
-    }
-    else
-    {
-      // If you get an error on the next line, a call to Visit(functor, Args...)
-      // is being called with arguments that do not match the functor's call
-      // signature. See the Visit documentation for details.
-      return functor(this->Storage.GetArrays32(), std::forward<Args>(args)...);
-    }
+    return this->VisitImpl<GetReturnType<Functor, Args...>>(
+      std::forward<Functor>(functor), std::forward<Args>(args)...);
   }
 
   /** @} */
@@ -1191,17 +1373,51 @@ protected:
   vtkCellArray();
   ~vtkCellArray() override;
 
+  // Converts compact storages to explicit storage, before accessing the
+  // explicit arrays.
+  void EnsureExplicitStorage()
+  {
+    if (this->Storage.IsCompact())
+    {
+      this->ConvertToExplicitStorage();
+    }
+  }
+
+  // Fill the empty explicit storage of target with the cells of this array.
+  void CopyToExplicitStorage(vtkCellArray* target) const;
+
+  // Explicit copy of a compact storage used by the const Visit, made on first
+  // use and remade when this array or its arrays are modified.
+  vtkSmartPointer<vtkCellArray> GetExplicitCopy() const;
+
+  // Drops the copy made by GetExplicitCopy().
+  void ReleaseExplicitCopy();
+
+  // Use the storage type matching the given arrays. Fixed-size storages
+  // ignore offsets and generate them from cellSize.
+  template <typename ArrayT, typename OffsetsArrayT>
+  void SetStorage(vtkIdType cellSize, OffsetsArrayT* offsets, ArrayT* connectivity);
+
+  // ConvertToStorage without checking that the values fit in the new storage.
+  bool ConvertToStorageUnchecked(int type, vtkIdType cellSize);
+
   // Encapsulates storage of the internal arrays as a discriminated union
-  // between 32-bit and 64-bit storage.
+  // between the StorageTypes.
   struct Storage
   {
-    // Union type that switches 32 and 64 bit array storage
+    // Union type that switches between the array storages
     union ArraySwitch
     {
       ArraySwitch() = default;  // handled by Storage
       ~ArraySwitch() = default; // handle by Storage
       VisitState<ArrayType32>* Int32;
       VisitState<ArrayType64>* Int64;
+      VisitState<ArrayType8, ArrayType32>* Int8;
+      VisitState<ArrayType16, ArrayType32>* Int16;
+      VisitState<ArrayType8, AffineArrayType64>* FixedSizeInt8;
+      VisitState<ArrayType16, AffineArrayType64>* FixedSizeInt16;
+      VisitState<ArrayType32, AffineArrayType64>* FixedSizeInt32;
+      VisitState<ArrayType64, AffineArrayType64>* FixedSizeInt64;
     };
 
     Storage()
@@ -1214,16 +1430,8 @@ protected:
 #endif
 
       // Default can be changed, to save memory
-      if (vtkCellArray::GetDefaultStorageIs64Bit())
-      {
-        this->Arrays->Int64 = new VisitState<ArrayType64>;
-        this->StorageIs64Bit = true;
-      }
-      else
-      {
-        this->Arrays->Int32 = new VisitState<ArrayType32>;
-        this->StorageIs64Bit = false;
-      }
+      this->Create(vtkCellArray::GetDefaultStorageIs64Bit() ? vtkCellArray::Int64
+                                                           : vtkCellArray::Int32);
 
 #ifdef VTK_USE_MEMKIND
       if (vtkObjectBase::GetUsingMemkind())
@@ -1237,16 +1445,7 @@ protected:
 
     ~Storage()
     {
-      if (this->StorageIs64Bit)
-      {
-        this->Arrays->Int64->~VisitState();
-        delete this->Arrays->Int64;
-      }
-      else
-      {
-        this->Arrays->Int32->~VisitState();
-        delete this->Arrays->Int32;
-      }
+      this->Destroy();
 #ifdef VTK_USE_MEMKIND
       if (this->IsInMemkind)
       {
@@ -1261,74 +1460,221 @@ protected:
 #endif
     }
 
-    // Switch the internal arrays to be 32-bit. Any old data is lost. Returns
-    // true if the storage changes.
-    bool Use32BitStorage()
+    // Switch the internal arrays to the given type. Any old data is lost.
+    // Returns true if the storage changes.
+    bool Use(StorageTypes type)
     {
-      if (!this->StorageIs64Bit)
+      if (this->Type == type)
       {
         return false;
       }
 
-      this->Arrays->Int64->~VisitState();
-      delete this->Arrays->Int64;
-      this->Arrays->Int32 = new VisitState<ArrayType32>;
-      this->StorageIs64Bit = false;
+      this->Destroy();
+      this->Create(type);
 
       return true;
     }
 
+    // Switch the internal arrays to be 32-bit. Any old data is lost. Returns
+    // true if the storage changes.
+    bool Use32BitStorage() { return this->Use(vtkCellArray::Int32); }
+
     // Switch the internal arrays to be 64-bit. Any old data is lost. Returns
     // true if the storage changes.
-    bool Use64BitStorage()
+    bool Use64BitStorage() { return this->Use(vtkCellArray::Int64); }
+
+    // Returns true if the storage is currently configured to be 64 bit.
+    bool Is64Bit() const { return this->Type == vtkCellArray::Int64; }
+
+    // Returns the current storage type.
+    StorageTypes GetType() const { return this->Type; }
+
+    // Returns true if the storage is not an explicit 32 or 64 bit storage.
+    bool IsCompact() const
+    {
+      return this->Type != vtkCellArray::Int32 && this->Type != vtkCellArray::Int64;
+    }
+
+    // Returns the explicit storage type compact storages are converted to.
+    StorageTypes GetExplicitType() const
     {
-      if (this->StorageIs64Bit)
+      if (this->Type == vtkCellArray::Int64 || this->Type == vtkCellArray::FixedSizeInt64 ||
+        this->GetNumberOfConnectivityIds() > VTK_TYPE_INT32_MAX)
       {
-        return false;
+        return vtkCellArray::Int64;
       }
+      return vtkCellArray::Int32;
+    }
 
-      this->Arrays->Int32->~VisitState();
-      delete this->Arrays->Int32;
-      this->Arrays->Int64 = new VisitState<ArrayType64>;
-      this->StorageIs64Bit = true;
+    vtkIdType GetNumberOfOffsets() const
+    {
+      return this->Apply<vtkIdType>(
+        [](const auto& state) { return state.GetOffsets()->GetNumberOfValues(); });
+    }
 
-      return true;
+    vtkIdType GetNumberOfConnectivityIds() const
+    {
+      return this->Apply<vtkIdType>(
+        [](const auto& state) { return state.GetConnectivity()->GetNumberOfValues(); });
     }
 
-    // Returns true if the storage is currently configured to be 64 bit.
-    bool Is64Bit() const { return this->StorageIs64Bit; }
+    // Call functor with the VisitState of the current storage type. Unless
+    // SupportsCompact is true, the storage must be explicit.
+    template <typename ReturnT, bool SupportsCompact = true, typename Functor>
+    ReturnT Apply(Functor&& functor)
+    {
+      if constexpr (SupportsCompact)
+      {
+        switch (this->Type)
+        {
+          case vtkCellArray::Int8:
+            return functor(*this->Arrays->Int8);
+          case vtkCellArray::Int16:
+            return functor(*this->Arrays->Int16);
+          case vtkCellArray::FixedSizeInt8:
+            return functor(*this->Arrays->FixedSizeInt8);
+          case vtkCellArray::FixedSizeInt16:
+            return functor(*this->Arrays->FixedSizeInt16);
+          case vtkCellArray::FixedSizeInt32:
+            return functor(*this->Arrays->FixedSizeInt32);
+          case vtkCellArray::FixedSizeInt64:
+            return functor(*this->Arrays->FixedSizeInt64);
+          default:
+            break;
+        }
+      }
+      if (this->Is64Bit())
+      {
+        return functor(this->GetArrays64());
+      }
+      else
+      {
+        return functor(this->GetArrays32());
+      }
+    }
+
+    template <typename ReturnT, bool SupportsCompact = true, typename Functor>
+    ReturnT Apply(Functor&& functor) const
+    {
+      if constexpr (SupportsCompact)
+      {
+        switch (this->Type)
+        {
+          case vtkCellArray::Int8:
+            return functor(std::as_const(*this->Arrays->Int8));
+          case vtkCellArray::Int16:
+            return functor(std::as_const(*this->Arrays->Int16));
+          case vtkCellArray::FixedSizeInt8:
+            return functor(std::as_const(*this->Arrays->FixedSizeInt8));
+          case vtkCellArray::FixedSizeInt16:
+            return functor(std::as_const(*this->Arrays->FixedSizeInt16));
+          case vtkCellArray::FixedSizeInt32:
+            return functor(std::as_const(*this->Arrays->FixedSizeInt32));
+          case vtkCellArray::FixedSizeInt64:
+            return functor(std::as_const(*this->Arrays->FixedSizeInt64));
+          default:
+            break;
+        }
+      }
+      if (this->Is64Bit())
+      {
+        return functor(this->GetArrays64());
+      }
+      else
+      {
+        return functor(this->GetArrays32());
+      }
+    }
+
+    // Get the VisitState of the given type, or nullptr if the current storage
+    // type differs.
+    template <typename StateT>
+    StateT* GetState()
+    {
+      return this->Apply<StateT*>(
+        [](auto& state) -> StateT*
+        {
+          if constexpr (std::is_same<std::decay_t<decltype(state)>, StateT>::value)
+          {
+            return &state;
+          }
+          else
+          {
+            return nullptr;
+          }
+        });
+    }
 
     // Get the VisitState for 32-bit arrays
     VisitState<ArrayType32>& GetArrays32()
     {
-      assert(!this->StorageIs64Bit);
+      assert(this->Type == vtkCellArray::Int32);
       return *this->Arrays->Int32;
     }
 
     const VisitState<ArrayType32>& GetArrays32() const
     {
-      assert(!this->StorageIs64Bit);
+      assert(this->Type == vtkCellArray::Int32);
       return *this->Arrays->Int32;
     }
 
     // Get the VisitState for 64-bit arrays
     VisitState<ArrayType64>& GetArrays64()
     {
-      assert(this->StorageIs64Bit);
+      assert(this->Type == vtkCellArray::Int64);
       return *this->Arrays->Int64;
     }
 
     const VisitState<ArrayType64>& GetArrays64() const
     {
-      assert(this->StorageIs64Bit);
+      assert(this->Type == vtkCellArray::Int64);
       return *this->Arrays->Int64;
     }
 
   private:
+    void Create(StorageTypes type)
+    {
+      switch (type)
+      {
+        case vtkCellArray::Int8:
+          this->Arrays->Int8 = new VisitState<ArrayType8, ArrayType32>;
+          break;
+        case vtkCellArray::Int16:
+          this->Arrays->Int16 = new VisitState<ArrayType16, ArrayType32>;
+          break;
+        case vtkCellArray::FixedSizeInt8:
+          this->Arrays->FixedSizeInt8 = new VisitState<ArrayType8, AffineArrayType64>;
+          break;
+        case vtkCellArray::FixedSizeInt16:
+          this->Arrays->FixedSizeInt16 = new VisitState<ArrayType16, AffineArrayType64>;
+          break;
+        case vtkCellArray::FixedSizeInt32:
+          this->Arrays->FixedSizeInt32 = new VisitState<ArrayType32, AffineArrayType64>;
+          break;
+        case vtkCellArray::FixedSizeInt64:
+          this->Arrays->FixedSizeInt64 = new VisitState<ArrayType64, AffineArrayType64>;
+          break;
+        case vtkCellArray::Int64:
+          this->Arrays->Int64 = new VisitState<ArrayType64>;
+          break;
+        case vtkCellArray::Int32:
+        default:
+          type = vtkCellArray::Int32;
+          this->Arrays->Int32 = new VisitState<ArrayType32>;
+          break;
+      }
+      this->Type = type;
+    }
+
+    void Destroy()
+    {
+      this->Apply<void>([](auto& state) { delete &state; });
+    }
+
     // Access restricted to ensure proper union construction/destruction thru
     // API.
     ArraySwitch* Arrays;
-    bool StorageIs64Bit;
+    StorageTypes Type = vtkCellArray::Int32;
     bool IsInMemkind = false;
   };
 
@@ -1337,6 +1683,11 @@ protected:
 
   vtkNew<vtkIdTypeArray> LegacyData; // For GetData().
 
+  // Cache of GetExplicitCopy(), with the modification time it was made for.
+  mutable vtkSmartPointer<vtkCellArray> ExplicitCopy;
+  mutable vtkMTimeType ExplicitCopyTime = 0;
+  mutable std::mutex ExplicitCopyMutex;
+
   static bool DefaultStorageIs64Bit;
 
 private:
@@ -1344,33 +1695,55 @@ private:
   void operator=(const vtkCellArray&) = delete;
 };
 
-template <typename ArrayT>
-vtkIdType vtkCellArray::VisitState<ArrayT>::GetNumberOfCells() const
+template <typename ArrayT, typename OffsetsArrayT>
+vtkIdType vtkCellArray::VisitState<ArrayT, OffsetsArrayT>::GetNumberOfCells() const
 {
   return this->Offsets->GetNumberOfValues() - 1;
 }
 
-template <typename ArrayT>
-vtkIdType vtkCellArray::VisitState<ArrayT>::GetBeginOffset(vtkIdType cellId) const
+template <typename ArrayT, typename OffsetsArrayT>
+vtkIdType vtkCellArray::VisitState<ArrayT, OffsetsArrayT>::GetBeginOffset(vtkIdType cellId) const
 {
-  return static_cast<vtkIdType>(this->Offsets->GetValue(cellId));
+  if constexpr (IsFixedSize)
+  {
+    return cellId * this->FixedCellSize;
+  }
+  else
+  {
+    return static_cast<vtkIdType>(this->Offsets->GetValue(cellId));
+  }
 }
 
-template <typename ArrayT>
-vtkIdType vtkCellArray::VisitState<ArrayT>::GetEndOffset(vtkIdType cellId) const
+template <typename ArrayT, typename OffsetsArrayT>
+vtkIdType vtkCellArray::VisitState<ArrayT, OffsetsArrayT>::GetEndOffset(vtkIdType cellId) const
 {
-  return static_cast<vtkIdType>(this->Offsets->GetValue(cellId + 1));
+  if constexpr (IsFixedSize)
+  {
+    return (cellId + 1) * this->FixedCellSize;
+  }
+  else
+  {
+    return static_cast<vtkIdType>(this->Offsets->GetValue(cellId + 1));
+  }
 }
 
-template <typename ArrayT>
-vtkIdType vtkCellArray::VisitState<ArrayT>::GetCellSize(vtkIdType cellId) const
+template <typename ArrayT, typename OffsetsArrayT>
+vtkIdType vtkCellArray::VisitState<ArrayT, OffsetsArrayT>::GetCellSize(vtkIdType cellId) const
 {
-  return this->GetEndOffset(cellId) - this->GetBeginOffset(cellId);
+  if constexpr (IsFixedSize)
+  {
+    (void)cellId;
+    return this->FixedCellSize;
+  }
+  else
+  {
+    return this->GetEndOffset(cellId) - this->GetBeginOffset(cellId);
+  }
 }
 
-template <typename ArrayT>
-typename vtkCellArray::VisitState<ArrayT>::CellRangeType
-vtkCellArray::VisitState<ArrayT>::GetCellRange(vtkIdType cellId)
+template <typename ArrayT, typename OffsetsArrayT>
+typename vtkCellArray::VisitState<ArrayT, OffsetsArrayT>::CellRangeType
+vtkCellArray::VisitState<ArrayT, OffsetsArrayT>::GetCellRange(vtkIdType cellId)
 {
   return vtk::DataArrayValueRange<1>(
     this->GetConnectivity(), this->GetBeginOffset(cellId), this->GetEndOffset(cellId));
@@ -1435,6 +1808,8 @@ struct UpdateCellCountImpl
 
 struct GetCellSizeImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   vtkIdType operator()(CellStateT& state, vtkIdType cellId)
   {
@@ -1444,11 +1819,11 @@ struct GetCellSizeImpl
 
 struct GetCellAtIdImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   void operator()(CellStateT& state, const vtkIdType cellId, vtkIdList* ids)
   {
-    using ValueType = typename CellStateT::ValueType;
-
     const vtkIdType beginOffset = state.GetBeginOffset(cellId);
     const vtkIdType endOffset = state.GetEndOffset(cellId);
     const vtkIdType cellSize = endOffset - beginOffset;
@@ -1457,7 +1832,7 @@ struct GetCellAtIdImpl
     // ValueType differs from vtkIdType, so we have to copy into a temporary buffer:
     ids->SetNumberOfIds(cellSize);
     vtkIdType* idPtr = ids->GetPointer(0);
-    for (ValueType i = 0; i < cellSize; ++i)
+    for (vtkIdType i = 0; i < cellSize; ++i)
     {
       idPtr[i] = static_cast<vtkIdType>(cellConnectivity[i]);
     }
@@ -1623,6 +1998,7 @@ inline vtkIdType vtkCellArray::InsertNextCell(int npts)
 //----------------------------------------------------------------------------
 inline void vtkCellArray::InsertCellPoint(vtkIdType id)
 {
+  this->EnsureExplicitStorage();
   if (this->Storage.Is64Bit())
   {
     using ValueType = typename ArrayType64::ValueType;
@@ -1659,6 +2035,12 @@ inline vtkIdType vtkCellArray::InsertNextCell(vtkCell* cell)
 //----------------------------------------------------------------------------
 inline void vtkCellArray::Reset()
 {
+  if (this->Storage.IsCompact())
+  {
+    // Nothing to preserve, directly go back to explicit storage.
+    this->Storage.Use(this->Storage.GetExplicitType());
+    return;
+  }
   this->Visit(vtkCellArray_detail::ResetImpl{});
 }
 
@@ -5,11 +5,15 @@
 #include "vtkCellArray.h"
 #include "vtkDataSet.h"
 #include "vtkGenericCell.h"
+#include "vtkIdList.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 
-#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <memory>
 
 VTK_ABI_NAMESPACE_BEGIN
 //------------------------------------------------------------------------------
@@ -132,7 +136,9 @@ vtkCellLinks::Link* vtkCellLinks::Resize(vtkIdType sz)
 }
 
 //------------------------------------------------------------------------------
-// Build the link list array.
+// Build the link list array. The cells are traversed in parallel: the uses of
+// each point are counted with atomics, then the cell ids are inserted and
+// sorted so that the lists do not depend on the scheduling.
 void vtkCellLinks::BuildLinks()
 {
   // don't rebuild if build time is newer than modified and dataset modified time
@@ -142,48 +148,80 @@ void vtkCellLinks::BuildLinks()
   }
   vtkIdType numPts = this->NumberOfPoints = this->DataSet->GetNumberOfPoints();
   vtkIdType numCells = this->NumberOfCells = this->DataSet->GetNumberOfCells();
-  int j;
-  vtkIdType cellId;
 
-  if (this->Array == nullptr)
+  // Reuse the array only if it was just allocated (e.g. with room for
+  // points to be inserted later), since it may be shared with a copy.
+  if (this->Array == nullptr || this->MaxId >= 0 || this->Size < numPts)
   {
-    this->Allocate(numPts);
-  }
-  // This is checked to capture changes in the size of the allocation
-  else if (this->DataSet->GetMTime() > this->BuildTime && this->DataSet->GetMTime() > this->MTime)
-  {
-    this->Allocate(numPts);
+    this->Allocate(numPts, this->Extend);
   }
 
-  // Use fast path if polydata
+  // GetCellPoints() is thread safe once it has been called from a single
+  // thread (e.g. this builds the cells of a vtkPolyData).
   vtkIdType npts;
   const vtkIdType* pts;
   vtkNew<vtkIdList> tempIds;
-
-  // traverse data to determine number of uses of each point
-  for (cellId = 0; cellId < numCells; cellId++)
+  if (numCells > 0)
   {
-    this->DataSet->GetCellPoints(cellId, npts, pts, tempIds);
-    for (j = 0; j < npts; j++)
-    {
-      this->IncrementLinkCount(pts[j]);
-    }
+    this->DataSet->GetCellPoints(0, npts, pts, tempIds);
   }
 
-  // fill out lists with number of references to cells
-  std::vector<vtkIdType> linkLoc(numPts, 0);
+  // traverse data to determine number of uses of each point
+  std::unique_ptr<std::atomic<vtkIdType>[]> counts(new std::atomic<vtkIdType>[numPts]());
+  vtkSMPThreadLocalObject<vtkIdList> tlIds;
+  vtkSMPTools::For(0, numCells,
+    [&](vtkIdType cellId, vtkIdType endCellId)
+    {
+      vtkIdList* ids = tlIds.Local();
+      vtkIdType numCellPts;
+      const vtkIdType* cellPts;
+      for (; cellId < endCellId; ++cellId)
+      {
+        this->DataSet->GetCellPoints(cellId, numCellPts, cellPts, ids);
+        for (vtkIdType j = 0; j < numCellPts; ++j)
+        {
+          counts[cellPts[j]].fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    });
 
   // now allocate storage for the links
+  vtkSMPTools::For(0, numPts,
+    [&](vtkIdType ptId, vtkIdType endPtId)
+    {
+      for (; ptId < endPtId; ++ptId)
+      {
+        this->Array[ptId].ncells = counts[ptId].load(std::memory_order_relaxed);
+      }
+    });
   this->AllocateLinks(numPts);
-  // fill out lists with cell ids
-  for (cellId = 0; cellId < numCells; cellId++)
-  {
-    this->DataSet->GetCellPoints(cellId, npts, pts, tempIds);
-    for (j = 0; j < npts; j++)
+
+  // fill out lists with cell ids, from the end of each list
+  vtkSMPTools::For(0, numCells,
+    [&](vtkIdType cellId, vtkIdType endCellId)
     {
-      this->InsertCellReference(pts[j], (linkLoc[pts[j]])++, cellId);
-    }
-  }
+      vtkIdList* ids = tlIds.Local();
+      vtkIdType numCellPts;
+      const vtkIdType* cellPts;
+      for (; cellId < endCellId; ++cellId)
+      {
+        this->DataSet->GetCellPoints(cellId, numCellPts, cellPts, ids);
+        for (vtkIdType j = 0; j < numCellPts; ++j)
+        {
+          const vtkIdType ptId = cellPts[j];
+          this->InsertCellReference(
+            ptId, counts[ptId].fetch_sub(1, std::memory_order_relaxed) - 1, cellId);
+        }
+      }
+    });
+  vtkSMPTools::For(0, numPts,
+    [&](vtkIdType ptId, vtkIdType endPtId)
+    {
+      for (; ptId < endPtId; ++ptId)
+      {
+        std::sort(this->Array[ptId].cells, this->Array[ptId].cells + this->Array[ptId].ncells);
+      }
+    });
   this->MaxId = numPts - 1;
   this->BuildTime.Modified();
 }
@@ -53,8 +53,10 @@ void vtkCellLocatorStrategy::SetCellLocator(vtkAbstractCellLocator* cL)
 //------------------------------------------------------------------------------
 int vtkCellLocatorStrategy::Initialize(vtkPointSet* ps)
 {
-  // See whether anything has changed. If not, just return.
-  if (this->PointSet != nullptr && ps == this->PointSet && this->MTime < this->InitializeTime)
+  // See whether anything has changed. If not, just return. A modified point
+  // set, e.g. a deforming mesh, needs its bounds and cell locator updated.
+  if (this->PointSet != nullptr && ps == this->PointSet && this->MTime < this->InitializeTime &&
+    ps->GetMTime() < this->InitializeTime)
   {
     return 1;
   }
@@ -10,9 +10,13 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 #include <array>
+#include <iterator>
 #include <stack>
 #include <vector>
 
@@ -63,6 +67,11 @@ struct vtkCellTree
     vtkPoints* points, vtkIdList* cellIds, vtkGenericCell* cell) = 0;
   virtual void GenerateRepresentation(int level, vtkPolyData* pd) = 0;
 
+  // Batched queries, cellIds and points are sized by the caller
+  virtual void FindCells(vtkPoints* points, vtkIdType* cellIds) = 0;
+  virtual void IntersectWithLines(
+    vtkPoints* p1, vtkPoints* p2, double tol, vtkIdType* cellIds, vtkPoints* points) = 0;
+
   // Utility methods
   static int getDominantAxis(const double dir[3])
   {
@@ -108,6 +117,44 @@ struct vtkCellTree
   }
 };
 
+//------------------------------------------------------------------------------
+// Keep track of the cells already tested by a line intersection. Only the flags
+// that were set are cleared by Reset(), so that a thread answering many queries
+// does not reallocate one flag per cell of the data set for each of them.
+template <typename T>
+struct VisitedCells
+{
+  std::vector<bool> Flags;
+  std::vector<T> Ids;
+
+  void Initialize(vtkIdType numberOfCells)
+  {
+    this->Flags.assign(static_cast<size_t>(numberOfCells), false);
+    this->Ids.clear();
+  }
+
+  // Return false if the cell has already been visited.
+  bool Visit(T cellId)
+  {
+    if (this->Flags[cellId])
+    {
+      return false;
+    }
+    this->Flags[cellId] = true;
+    this->Ids.push_back(cellId);
+    return true;
+  }
+
+  void Reset()
+  {
+    for (const T& cellId : this->Ids)
+    {
+      this->Flags[cellId] = false;
+    }
+    this->Ids.clear();
+  }
+};
+
 /**
  * This struct is the basic building block of the cell tree.
  * Nodes consist of two split planes, LeftMax and RightMin,
@@ -204,6 +251,15 @@ struct CellTree : public vtkCellTree
   int IntersectWithLine(const double p1[3], const double p2[3], double tol, vtkPoints* points,
     vtkIdList* cellIds, vtkGenericCell* cell) override;
   void GenerateRepresentation(int level, vtkPolyData* pd) override;
+  void FindCells(vtkPoints* points, vtkIdType* cellIds) override;
+  void IntersectWithLines(
+    vtkPoints* p1, vtkPoints* p2, double tol, vtkIdType* cellIds, vtkPoints* points) override;
+
+  // Closest intersection, using visitedCells to skip the cells already tested.
+  // visitedCells must be initialized, and is reset on return.
+  int IntersectWithLine(const double p1[3], const double p2[3], double tol, double& t, double x[3],
+    double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell,
+    VisitedCells<T>& visitedCells);
 };
 
 //------------------------------------------------------------------------------
@@ -372,9 +428,16 @@ private:
   int NumberOfBuckets;
   int NumberOfNodesPerLeaf;
 
+  using NodesType = std::vector<TCellTreeNode>;
+  using SplitStackType = std::stack<SplitInfo>;
+
+  // Nodes with more cells than this are split by all the threads together, while
+  // smaller subtrees are built concurrently, one per thread.
+  static constexpr T ParallelSplitSize = 16384;
+
   std::vector<CellInfo> CellsInfo;
-  std::vector<CellTreeNode<T>> Nodes;
-  std::stack<SplitInfo> SplitStack;
+  NodesType Nodes;
+  SplitStackType SplitStack;
 
   struct BucketsType : public std::array<std::vector<Bucket>, 3>
   {
@@ -394,6 +457,21 @@ private:
       std::fill((*this)[1].begin(), (*this)[1].end(), Bucket());
       std::fill((*this)[2].begin(), (*this)[2].end(), Bucket());
     }
+
+    void Merge(const BucketsType& other)
+    {
+      for (size_t d = 0; d < 3; ++d)
+      {
+        for (size_t i = 0; i < (*this)[d].size(); ++i)
+        {
+          Bucket& bucket = (*this)[d][i];
+          const Bucket& otherBucket = other[d][i];
+          bucket.Cnt += otherBucket.Cnt;
+          bucket.Min = std::min(bucket.Min, otherBucket.Min);
+          bucket.Max = std::max(bucket.Max, otherBucket.Max);
+        }
+      }
+    }
   };
   BucketsType Buckets;
 
@@ -428,10 +506,32 @@ private:
   }
 
   // -------------------------------------------------------------------------
-  void Split(T index, double min[3], double max[3], BucketsType& buckets)
+  // Accumulate the cells of [begin, end) in the buckets of the node with the given bounds.
+  void FillBuckets(const CellInfo* begin, const CellInfo* end, const double min[3],
+    const double iext[3], BucketsType& buckets)
+  {
+    for (const CellInfo* pc = begin; pc != end; ++pc)
+    {
+      for (uint8_t d = 0; d < 3; ++d)
+      {
+        double cen = (pc->Min[d] + pc->Max[d]) / 2.0;
+        double dblIdx = (cen - min[d]) * iext[d];
+        dblIdx = vtkMath::ClampValue(dblIdx, 0.0, static_cast<double>(this->NumberOfBuckets - 1));
+        size_t ind = static_cast<size_t>(dblIdx);
+
+        buckets[d][ind].Add(pc->Min[d], pc->Max[d]);
+      }
+    }
+  }
+
+  // -------------------------------------------------------------------------
+  // Split the leaf nodes[index] and push its children on splitStack. The buckets
+  // of nodes larger than ParallelSplitSize are filled in parallel when threaded is true.
+  void Split(NodesType& nodes, SplitStackType& splitStack, T index, double min[3],
+    double max[3], BucketsType& buckets, bool threaded)
   {
-    const T& start = this->Nodes[index].Start();
-    const T& size = this->Nodes[index].Size();
+    const T start = nodes[index].Start();
+    const T size = nodes[index].Size();
 
     if (size < this->NumberOfNodesPerLeaf)
     {
@@ -448,18 +548,23 @@ private:
 
     buckets.Reset();
 
-    for (const CellInfo* pc = begin; pc != end; ++pc)
+    if (threaded && size > ParallelSplitSize)
     {
-      for (uint8_t d = 0; d < 3; ++d)
+      // Bucket counts and bounds do not depend on the order in which cells are
+      // added, so the tree is the same as the one of a serial build.
+      vtkSMPThreadLocal<BucketsType> threadBuckets(BucketsType(this->NumberOfBuckets));
+      vtkSMPTools::For(0, size,
+        [&](vtkIdType first, vtkIdType last)
+        { this->FillBuckets(begin + first, begin + last, min, iext, threadBuckets.Local()); });
+      for (const BucketsType& localBuckets : threadBuckets)
       {
-        double cen = (pc->Min[d] + pc->Max[d]) / 2.0;
-        double dblIdx = (cen - min[d]) * iext[d];
-        dblIdx = vtkMath::ClampValue(dblIdx, 0.0, static_cast<double>(this->NumberOfBuckets - 1));
-        size_t ind = static_cast<size_t>(dblIdx);
-
-        buckets[d][ind].Add(pc->Min[d], pc->Max[d]);
+        buckets.Merge(localBuckets);
       }
     }
+    else
+    {
+      this->FillBuckets(begin, end, min, iext, buckets);
+    }
 
     double cost = VTK_DOUBLE_MAX;
     double plane = VTK_DOUBLE_MIN; // bad value in case it doesn't get setx
@@ -537,11 +642,28 @@ private:
     child[0].MakeLeaf(begin - this->CellsInfo.data(), mid - begin);
     child[1].MakeLeaf(mid - this->CellsInfo.data(), end - mid);
 
-    this->Nodes[index].MakeNode(static_cast<T>(this->Nodes.size()), dim, clip);
-    this->Nodes.insert(this->Nodes.end(), child, child + 2);
+    nodes[index].MakeNode(static_cast<T>(nodes.size()), dim, clip);
+    nodes.insert(nodes.end(), child, child + 2);
 
-    this->SplitStack.emplace(this->Nodes[index].GetRightChildIndex(), rMin, rMax);
-    this->SplitStack.emplace(this->Nodes[index].GetLeftChildIndex(), lMin, lMax);
+    splitStack.emplace(nodes[index].GetRightChildIndex(), rMin, rMax);
+    splitStack.emplace(nodes[index].GetLeftChildIndex(), lMin, lMax);
+  }
+
+  // -------------------------------------------------------------------------
+  // Build the subtree rooted at the leaf splitInfo.Index of this->Nodes in its own
+  // array of nodes, whose first node is the root.
+  void BuildSubtree(const SplitInfo& splitInfo, NodesType& nodes, BucketsType& buckets)
+  {
+    nodes.push_back(this->Nodes[splitInfo.Index]);
+    SplitStackType splitStack;
+    splitStack.emplace(0, splitInfo.Min, splitInfo.Max);
+    while (!splitStack.empty())
+    {
+      auto localSplitInfo = std::move(splitStack.top());
+      splitStack.pop();
+      this->Split(nodes, splitStack, localSplitInfo.Index, localSplitInfo.Min, localSplitInfo.Max,
+        buckets, false);
+    }
   }
 
 public:
@@ -556,35 +678,30 @@ public:
     const auto numberOfCells = static_cast<T>(this->DataSet->GetNumberOfCells());
     this->CellsInfo.resize(static_cast<size_t>(numberOfCells));
 
-    double min[3] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
-    double max[3] = {
-      -VTK_DOUBLE_MAX,
-      -VTK_DOUBLE_MAX,
-      -VTK_DOUBLE_MAX,
-    };
-
+    // The first call to GetCellBounds() may trigger a non thread safe initialization
+    // of the data set, so it is done before the threaded loop.
     double cellBounds[6], *cellBoundsPtr;
     cellBoundsPtr = cellBounds;
-    for (T i = 0; i < numberOfCells; ++i)
-    {
-      this->CellsInfo[i].Ind = i;
-      this->Locator->GetCellBounds(i, cellBoundsPtr);
-
-      for (uint8_t d = 0; d < 3; ++d)
+    this->Locator->GetCellBounds(0, cellBoundsPtr);
+    vtkSMPTools::For(0, numberOfCells,
+      [&](vtkIdType begin, vtkIdType end)
       {
-        this->CellsInfo[i].Min[d] = cellBoundsPtr[2 * d + 0];
-        this->CellsInfo[i].Max[d] = cellBoundsPtr[2 * d + 1];
-
-        if (this->CellsInfo[i].Min[d] < min[d])
-        {
-          min[d] = this->CellsInfo[i].Min[d];
-        }
-        if (this->CellsInfo[i].Max[d] > max[d])
+        double threadCellBounds[6], *threadCellBoundsPtr;
+        for (vtkIdType i = begin; i < end; ++i)
         {
-          max[d] = this->CellsInfo[i].Max[d];
+          threadCellBoundsPtr = threadCellBounds;
+          this->CellsInfo[i].Ind = static_cast<T>(i);
+          this->Locator->GetCellBounds(i, threadCellBoundsPtr);
+          for (uint8_t d = 0; d < 3; ++d)
+          {
+            this->CellsInfo[i].Min[d] = threadCellBoundsPtr[2 * d + 0];
+            this->CellsInfo[i].Max[d] = threadCellBoundsPtr[2 * d + 1];
+          }
         }
-      }
-    }
+      });
+
+    double min[3], max[3];
+    this->FindMinMax(this->CellsInfo.data(), this->CellsInfo.data() + numberOfCells, min, max);
 
     this->Tree.DataBBox[0] = min[0];
     this->Tree.DataBBox[1] = max[0];
@@ -608,12 +725,56 @@ public:
 
   void operator()()
   {
+    // Split the nodes that are large enough to benefit from threaded bucket filling,
+    // and keep the other ones as roots of subtrees that are built concurrently.
+    const T numberOfCells = static_cast<T>(this->CellsInfo.size());
+    const T numberOfThreads = static_cast<T>(vtkSMPTools::GetEstimatedNumberOfThreads());
+    const T subtreeSize = std::max(ParallelSplitSize, numberOfCells / (4 * numberOfThreads));
+    std::vector<SplitInfo> subtrees;
     auto& buckets = this->Buckets;
     while (!this->SplitStack.empty())
     {
       auto splitInfo = std::move(this->SplitStack.top());
       this->SplitStack.pop();
-      this->Split(splitInfo.Index, splitInfo.Min, splitInfo.Max, buckets);
+      if (this->Nodes[splitInfo.Index].Size() > subtreeSize)
+      {
+        this->Split(this->Nodes, this->SplitStack, splitInfo.Index, splitInfo.Min, splitInfo.Max,
+          buckets, true);
+      }
+      else
+      {
+        subtrees.push_back(std::move(splitInfo));
+      }
+    }
+
+    std::vector<NodesType> subtreesNodes(subtrees.size());
+    vtkSMPThreadLocal<BucketsType> threadBuckets(BucketsType(this->NumberOfBuckets));
+    vtkSMPTools::For(0, static_cast<vtkIdType>(subtrees.size()), 1,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          this->BuildSubtree(subtrees[i], subtreesNodes[i], threadBuckets.Local());
+        }
+      });
+
+    // Append the subtrees to the nodes. The child indices of a subtree are shifted
+    // so that its node i > 0 is stored at offset + i, its root replacing the leaf.
+    for (size_t i = 0; i < subtrees.size(); ++i)
+    {
+      const NodesType& subtreeNodes = subtreesNodes[i];
+      const T offset = static_cast<T>(this->Nodes.size()) - 1;
+      auto relocate = [offset](TCellTreeNode node)
+      {
+        if (node.IsNode())
+        {
+          node.SetChildren(node.GetLeftChildIndex() + offset);
+        }
+        return node;
+      };
+      this->Nodes[subtrees[i].Index] = relocate(subtreeNodes[0]);
+      std::transform(
+        subtreeNodes.begin() + 1, subtreeNodes.end(), std::back_inserter(this->Nodes), relocate);
     }
   }
 
@@ -684,6 +845,19 @@ vtkIdType CellTree<T>::FindCell(
 template <typename T>
 int CellTree<T>::IntersectWithLine(const double p1[3], const double p2[3], double tol, double& t,
   double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell)
+{
+  // Initialize intersection query array if necessary. This is done
+  // locally to ensure thread safety.
+  VisitedCells<T> visitedCells;
+  visitedCells.Initialize(this->DataSet->GetNumberOfCells());
+  return this->IntersectWithLine(p1, p2, tol, t, x, pcoords, subId, cellId, cell, visitedCells);
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+int CellTree<T>::IntersectWithLine(const double p1[3], const double p2[3], double tol, double& t,
+  double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell,
+  VisitedCells<T>& visitedCells)
 {
   TCellTreeNode *node, *nearNode, *farNode;
   double tmin, tmax, tDist, tHitCell, tBest = VTK_DOUBLE_MAX, xBest[3], pCoordsBest[3];
@@ -702,10 +876,6 @@ int CellTree<T>::IntersectWithLine(const double p1[3], const double p2[3], doubl
     return 0; // No intersections possible, line is outside the locator
   }
 
-  // Initialize intersection query array if necessary. This is done
-  // locally to ensure thread safety.
-  std::vector<bool> cellHasBeenVisited(this->DataSet->GetNumberOfCells(), false);
-
   // Ok, setup a stack and various params
   TreeNodeStack ns;
   // setup our axis optimized ray box edge stuff
@@ -783,10 +953,8 @@ int CellTree<T>::IntersectWithLine(const double p1[3], const double p2[3], doubl
     for (T i = 0; i < node->Size(); i++)
     {
       cId = this->Leaves[node->Start() + i];
-      if (!cellHasBeenVisited[cId])
+      if (visitedCells.Visit(cId))
       {
-        cellHasBeenVisited[cId] = true;
-
         this->Locator->GetCellBounds(cId, cellBoundsPtr);
         if (_getMinDist(p1, rayDir, cellBoundsPtr) > tBest)
         {
@@ -818,6 +986,7 @@ int CellTree<T>::IntersectWithLine(const double p1[3], const double p2[3], doubl
       }
     }
   }
+  visitedCells.Reset();
   // If a cell has been intersected, recover the information and return.
   if (cellIdBest >= 0)
   {
@@ -1251,6 +1420,66 @@ void CellTree<T>::FindCellsWithinBounds(double* bbox, vtkIdList* cells)
     }
   }
 }
+
+//------------------------------------------------------------------------------
+template <typename T>
+void CellTree<T>::FindCells(vtkPoints* points, vtkIdType* cellIds)
+{
+  const std::vector<double> weights(static_cast<size_t>(this->DataSet->GetMaxCellSize()));
+  vtkSMPThreadLocalObject<vtkGenericCell> threadCells;
+  vtkSMPThreadLocal<std::vector<double>> threadWeights(weights);
+  vtkSMPTools::For(0, points->GetNumberOfPoints(),
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      vtkGenericCell* cell = threadCells.Local();
+      double* cellWeights = threadWeights.Local().data();
+      double pos[3], pcoords[3];
+      int subId;
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        points->GetPoint(i, pos);
+        // Qualified call, the tree type is already resolved.
+        cellIds[i] = this->CellTree<T>::FindCell(pos, cell, subId, pcoords, cellWeights);
+      }
+    });
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void CellTree<T>::IntersectWithLines(
+  vtkPoints* p1, vtkPoints* p2, double tol, vtkIdType* cellIds, vtkPoints* points)
+{
+  const vtkIdType numberOfCells = this->DataSet->GetNumberOfCells();
+  vtkSMPThreadLocalObject<vtkGenericCell> threadCells;
+  vtkSMPThreadLocal<VisitedCells<T>> threadVisitedCells;
+  vtkSMPTools::For(0, p1->GetNumberOfPoints(),
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      vtkGenericCell* cell = threadCells.Local();
+      VisitedCells<T>& visitedCells = threadVisitedCells.Local();
+      if (visitedCells.Flags.empty())
+      {
+        visitedCells.Initialize(numberOfCells);
+      }
+      double a0[3], a1[3], t, x[3], pcoords[3];
+      int subId;
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        p1->GetPoint(i, a0);
+        p2->GetPoint(i, a1);
+        if (!this->IntersectWithLine(
+              a0, a1, tol, t, x, pcoords, subId, cellIds[i], cell, visitedCells))
+        {
+          cellIds[i] = -1;
+          std::copy_n(a1, 3, x);
+        }
+        if (points)
+        {
+          points->SetPoint(i, x);
+        }
+      }
+    });
+}
 VTK_ABI_NAMESPACE_END
 } // namespace
 
@@ -1309,7 +1538,7 @@ void vtkCellTreeLocator::BuildLocatorInternal()
 {
   using namespace detail;
   vtkIdType numCells;
-  if (!this->DataSet || (numCells = this->DataSet->GetNumberOfCells() < 1))
+  if (!this->DataSet || (numCells = this->DataSet->GetNumberOfCells()) < 1)
   {
     vtkErrorMacro(<< " No Cells in the data set\n");
     return;
@@ -1390,6 +1619,59 @@ int vtkCellTreeLocator::IntersectWithLine(const double p1[3], const double p2[3]
   return this->Tree->IntersectWithLine(p1, p2, tol, points, cellIds, cell);
 }
 
+//------------------------------------------------------------------------------
+void vtkCellTreeLocator::FindCells(vtkPoints* points, vtkIdList* cellIds)
+{
+  if (!points || !cellIds)
+  {
+    vtkErrorMacro("Points and cell ids must be provided.");
+    return;
+  }
+  const vtkIdType numberOfPoints = points->GetNumberOfPoints();
+  cellIds->SetNumberOfIds(numberOfPoints);
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    std::fill_n(cellIds->GetPointer(0), numberOfPoints, -1);
+    return;
+  }
+  this->Tree->FindCells(points, cellIds->GetPointer(0));
+}
+
+//------------------------------------------------------------------------------
+void vtkCellTreeLocator::IntersectWithLines(
+  vtkPoints* p1, vtkPoints* p2, double tol, vtkIdList* cellIds, vtkPoints* points)
+{
+  if (!p1 || !p2 || !cellIds)
+  {
+    vtkErrorMacro("Line end points and cell ids must be provided.");
+    return;
+  }
+  const vtkIdType numberOfLines = p1->GetNumberOfPoints();
+  if (p2->GetNumberOfPoints() != numberOfLines)
+  {
+    vtkErrorMacro("The line start and end points must have the same size, "
+      << numberOfLines << " != " << p2->GetNumberOfPoints() << ".");
+    return;
+  }
+  cellIds->SetNumberOfIds(numberOfLines);
+  if (points)
+  {
+    points->SetNumberOfPoints(numberOfLines);
+  }
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    std::fill_n(cellIds->GetPointer(0), numberOfLines, -1);
+    if (points)
+    {
+      points->DeepCopy(p2);
+    }
+    return;
+  }
+  this->Tree->IntersectWithLines(p1, p2, tol, cellIds->GetPointer(0), points);
+}
+
 //------------------------------------------------------------------------------
 void vtkCellTreeLocator::GenerateRepresentation(int level, vtkPolyData* pd)
 {
@@ -147,6 +147,28 @@ public:
   vtkIdType FindCell(double pos[3], double vtkNotUsed(tol2), vtkGenericCell* cell, int& subId,
     double pcoords[3], double* weights) override;
 
+  /**
+   * Find the cells containing each of the given points. cellIds is resized to
+   * the number of points, and its i-th id is the one of the cell containing the
+   * i-th point, or -1 if the point is outside the data set. The result is the same
+   * as calling FindCell() for each point, but the queries are threaded with
+   * vtkSMPTools, and the locator is checked once for the whole batch.
+   */
+  void FindCells(vtkPoints* points, vtkIdList* cellIds);
+
+  /**
+   * Intersect the line segments (p1[i], p2[i]) with the data set. cellIds is
+   * resized to the number of segments, and its i-th id is the one of the cell
+   * closest to p1[i] along the i-th segment, or -1 if there is no intersection.
+   * If points is provided, it is resized the same way and receives the
+   * intersection points, or p2[i] for segments that do not hit a cell. The
+   * result is the same as calling IntersectWithLine() for each segment, but the
+   * queries are threaded with vtkSMPTools, and each thread reuses its state
+   * between segments.
+   */
+  void IntersectWithLines(
+    vtkPoints* p1, vtkPoints* p2, double tol, vtkIdList* cellIds, vtkPoints* points = nullptr);
+
   ///@{
   /**
    * Satisfy vtkLocator abstract interface.
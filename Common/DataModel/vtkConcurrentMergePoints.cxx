@@ -0,0 +1,428 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkConcurrentMergePoints.h"
+
+#include "vtkBoundingBox.h"
+#include "vtkIdList.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkConcurrentMergePoints);
+
+//------------------------------------------------------------------------------
+struct vtkConcurrentMergePoints::vtkInternals
+{
+  // A merged point. X and Next are written before the node is published in its
+  // bucket and are then read only. Id is -1 until the point has been given its id.
+  struct Node
+  {
+    double X[3];
+    std::atomic<vtkIdType> Id{ -1 };
+    std::atomic<vtkIdType> Order{ VTK_ID_MAX };
+    Node* Next = nullptr;
+  };
+
+  // Nodes are allocated in chunks of growing sizes so that they never move and
+  // the chunk of a node can be found from its slot without locking. Chunk c holds
+  // FirstChunkSize << c nodes.
+  static constexpr vtkIdType FirstChunkSize = 1024;
+  static constexpr int MaximumNumberOfChunks = 48;
+
+  std::atomic<Node*> Chunks[MaximumNumberOfChunks];
+  std::atomic<vtkIdType> NumberOfNodes{ 0 };
+  std::atomic<vtkIdType> NumberOfPoints{ 0 };
+
+  std::unique_ptr<std::atomic<Node*>[]> Buckets;
+  vtkIdType NumberOfBuckets = 0;
+  int Divisions[3] = { 1, 1, 1 };
+  double Bounds[6] = { 0.0, 1.0, 0.0, 1.0, 0.0, 1.0 };
+  double InverseH[3] = { 1.0, 1.0, 1.0 };
+  bool FloatPoints = false;
+  vtkSmartPointer<vtkPoints> Points;
+
+  vtkInternals()
+  {
+    for (auto& chunk : this->Chunks)
+    {
+      chunk.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~vtkInternals() { this->Clear(); }
+
+  void Clear()
+  {
+    for (auto& chunk : this->Chunks)
+    {
+      delete[] chunk.exchange(nullptr);
+    }
+    this->NumberOfNodes = 0;
+    this->NumberOfPoints = 0;
+    this->Buckets.reset();
+    this->NumberOfBuckets = 0;
+  }
+
+  static int GetChunk(vtkIdType slot, vtkIdType& offset)
+  {
+    vtkIdType q = slot / FirstChunkSize + 1;
+    int chunk = 0;
+    while (q >>= 1)
+    {
+      ++chunk;
+    }
+    offset = slot - FirstChunkSize * ((static_cast<vtkIdType>(1) << chunk) - 1);
+    return chunk;
+  }
+
+  // Return the node of a slot, or nullptr if its chunk is not allocated.
+  Node* GetNode(vtkIdType slot) const
+  {
+    vtkIdType offset;
+    int chunk = GetChunk(slot, offset);
+    Node* nodes = this->Chunks[chunk].load(std::memory_order_acquire);
+    return nodes ? nodes + offset : nullptr;
+  }
+
+  Node* NewNode()
+  {
+    vtkIdType offset;
+    int chunk = GetChunk(this->NumberOfNodes.fetch_add(1, std::memory_order_relaxed), offset);
+    Node* nodes = this->Chunks[chunk].load(std::memory_order_acquire);
+    if (!nodes)
+    {
+      // Several threads may allocate the chunk, the first one to publish it wins.
+      Node* newNodes = new Node[FirstChunkSize << chunk];
+      if (this->Chunks[chunk].compare_exchange_strong(
+            nodes, newNodes, std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        nodes = newNodes;
+      }
+      else
+      {
+        delete[] newNodes;
+      }
+    }
+    return nodes + offset;
+  }
+
+  void Round(const double x[3], double y[3]) const
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      y[i] = this->FloatPoints ? static_cast<double>(static_cast<float>(x[i])) : x[i];
+    }
+  }
+
+  vtkIdType GetBucket(const double x[3]) const
+  {
+    int ijk[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      double t = (x[i] - this->Bounds[2 * i]) * this->InverseH[i];
+      // Also maps NaN to the first bucket.
+      ijk[i] = !(t > 0.0)
+        ? 0
+        : (t >= this->Divisions[i] ? this->Divisions[i] - 1 : static_cast<int>(t));
+    }
+    return ijk[0] +
+      static_cast<vtkIdType>(this->Divisions[0]) *
+      (ijk[1] + static_cast<vtkIdType>(this->Divisions[1]) * ijk[2]);
+  }
+
+  static bool Equal(const double a[3], const double b[3])
+  {
+    return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+  }
+
+  // Scan a bucket list from node down to (but excluding) last.
+  static Node* Find(Node* node, const Node* last, const double x[3])
+  {
+    for (; node != last; node = node->Next)
+    {
+      if (Equal(node->X, x))
+      {
+        return node;
+      }
+    }
+    return nullptr;
+  }
+
+  static vtkIdType WaitForId(const Node* node)
+  {
+    vtkIdType id;
+    while ((id = node->Id.load(std::memory_order_acquire)) < 0)
+    {
+      std::this_thread::yield();
+    }
+    return id;
+  }
+
+  static void KeepSmallestOrder(Node* node, vtkIdType order)
+  {
+    vtkIdType current = node->Order.load(std::memory_order_relaxed);
+    while (order < current &&
+      !node->Order.compare_exchange_weak(current, order, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  int Insert(const double p[3], vtkIdType order, bool hasOrder, vtkIdType& ptId)
+  {
+    double x[3];
+    this->Round(p, x);
+    std::atomic<Node*>& bucket = this->Buckets[this->GetBucket(x)];
+
+    Node* head = bucket.load(std::memory_order_acquire);
+    const Node* scanned = nullptr;
+    Node* node = nullptr;
+    for (;;)
+    {
+      // Only the nodes prepended since the previous attempt need to be checked.
+      if (Node* match = Find(head, scanned, x))
+      {
+        if (hasOrder)
+        {
+          KeepSmallestOrder(match, order);
+        }
+        // A node allocated by a previous attempt is left unused, with an id of -1.
+        ptId = WaitForId(match);
+        return 0;
+      }
+      scanned = head;
+
+      if (!node)
+      {
+        node = this->NewNode();
+        std::copy(x, x + 3, node->X);
+        node->Order.store(hasOrder ? order : VTK_ID_MAX, std::memory_order_relaxed);
+      }
+      node->Next = head;
+      if (bucket.compare_exchange_weak(
+            head, node, std::memory_order_release, std::memory_order_acquire))
+      {
+        break;
+      }
+    }
+
+    ptId = this->NumberOfPoints.fetch_add(1, std::memory_order_relaxed);
+    if (!hasOrder)
+    {
+      KeepSmallestOrder(node, ptId);
+    }
+    node->Id.store(ptId, std::memory_order_release);
+    return 1;
+  }
+
+  vtkIdType IsInserted(const double p[3]) const
+  {
+    if (!this->Buckets)
+    {
+      return -1;
+    }
+    double x[3];
+    this->Round(p, x);
+    Node* match =
+      Find(this->Buckets[this->GetBucket(x)].load(std::memory_order_acquire), nullptr, x);
+    return match ? WaitForId(match) : -1;
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkConcurrentMergePoints::vtkConcurrentMergePoints()
+  : Internals(new vtkInternals)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkConcurrentMergePoints::~vtkConcurrentMergePoints() = default;
+
+//------------------------------------------------------------------------------
+void vtkConcurrentMergePoints::Initialize()
+{
+  this->Internals->Clear();
+  this->Internals->Points = nullptr;
+}
+
+//------------------------------------------------------------------------------
+int vtkConcurrentMergePoints::InitPointInsertion(
+  vtkPoints* newPts, const double bounds[6], vtkIdType estNumPts)
+{
+  this->Initialize();
+  if (!newPts)
+  {
+    vtkErrorMacro(<< "Must define points for point insertion");
+    return 0;
+  }
+
+  vtkInternals& internals = *this->Internals;
+  internals.Points = newPts;
+  internals.FloatPoints = newPts->GetDataType() == VTK_FLOAT;
+
+  vtkBoundingBox bbox(bounds);
+  vtkIdType numBins = std::max<vtkIdType>(1, estNumPts / this->NumberOfPointsPerBucket);
+  bbox.ComputeDivisions(numBins, internals.Bounds, internals.Divisions);
+  for (int i = 0; i < 3; ++i)
+  {
+    double width = internals.Bounds[2 * i + 1] - internals.Bounds[2 * i];
+    internals.InverseH[i] = width > 0.0 ? internals.Divisions[i] / width : 0.0;
+  }
+
+  internals.NumberOfBuckets = static_cast<vtkIdType>(internals.Divisions[0]) *
+    internals.Divisions[1] * internals.Divisions[2];
+  internals.Buckets.reset(new std::atomic<vtkInternals::Node*>[internals.NumberOfBuckets]);
+  std::atomic<vtkInternals::Node*>* buckets = internals.Buckets.get();
+  vtkSMPTools::For(0, internals.NumberOfBuckets,
+    [buckets](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        buckets[i].store(nullptr, std::memory_order_relaxed);
+      }
+    });
+
+  this->Modified();
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkConcurrentMergePoints::InsertUniquePoint(const double x[3], vtkIdType& ptId)
+{
+  if (!this->Internals->Buckets)
+  {
+    vtkErrorMacro(<< "InitPointInsertion() must be called before inserting points");
+    ptId = -1;
+    return 0;
+  }
+  return this->Internals->Insert(x, VTK_ID_MAX, false, ptId);
+}
+
+//------------------------------------------------------------------------------
+int vtkConcurrentMergePoints::InsertUniquePoint(
+  const double x[3], vtkIdType order, vtkIdType& ptId)
+{
+  if (!this->Internals->Buckets)
+  {
+    vtkErrorMacro(<< "InitPointInsertion() must be called before inserting points");
+    ptId = -1;
+    return 0;
+  }
+  return this->Internals->Insert(x, order, true, ptId);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkConcurrentMergePoints::IsInsertedPoint(const double x[3])
+{
+  return this->Internals->IsInserted(x);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkConcurrentMergePoints::GetNumberOfPoints() const
+{
+  return this->Internals->NumberOfPoints.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentMergePoints::SortPoints(vtkIdList* newIds)
+{
+  vtkInternals& internals = *this->Internals;
+  using Node = vtkInternals::Node;
+  const vtkIdType numPts = internals.NumberOfPoints;
+  const vtkIdType numNodes = internals.NumberOfNodes;
+
+  // Gather the nodes by id.
+  std::vector<Node*> nodes(numPts);
+  vtkSMPTools::For(0, numNodes,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType slot = begin; slot < end; ++slot)
+      {
+        Node* node = internals.GetNode(slot);
+        vtkIdType id = node->Id.load(std::memory_order_relaxed);
+        if (id >= 0)
+        {
+          nodes[id] = node;
+        }
+      }
+    });
+
+  vtkSMPTools::Sort(nodes.begin(), nodes.end(),
+    [](const Node* a, const Node* b)
+    {
+      vtkIdType orderA = a->Order.load(std::memory_order_relaxed);
+      vtkIdType orderB = b->Order.load(std::memory_order_relaxed);
+      if (orderA != orderB)
+      {
+        return orderA < orderB;
+      }
+      return std::lexicographical_compare(a->X, a->X + 3, b->X, b->X + 3);
+    });
+
+  if (newIds)
+  {
+    newIds->SetNumberOfIds(numPts);
+  }
+  vtkIdType* map = newIds ? newIds->GetPointer(0) : nullptr;
+  vtkSMPTools::For(0, numPts,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType newId = begin; newId < end; ++newId)
+      {
+        Node* node = nodes[newId];
+        if (map)
+        {
+          map[node->Id.load(std::memory_order_relaxed)] = newId;
+        }
+        node->Id.store(newId, std::memory_order_relaxed);
+      }
+    });
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentMergePoints::FinalizePointInsertion()
+{
+  vtkInternals& internals = *this->Internals;
+  if (!internals.Points)
+  {
+    return;
+  }
+
+  vtkPoints* points = internals.Points;
+  points->SetNumberOfPoints(internals.NumberOfPoints);
+  vtkSMPTools::For(0, internals.NumberOfNodes,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType slot = begin; slot < end; ++slot)
+      {
+        vtkInternals::Node* node = internals.GetNode(slot);
+        vtkIdType id = node->Id.load(std::memory_order_relaxed);
+        if (id >= 0)
+        {
+          points->SetPoint(id, node->X);
+        }
+      }
+    });
+  points->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentMergePoints::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  const vtkInternals& internals = *this->Internals;
+  os << indent << "Number Of Points Per Bucket: " << this->NumberOfPointsPerBucket << "\n";
+  os << indent << "Number Of Points: " << internals.NumberOfPoints << "\n";
+  os << indent << "Number Of Buckets: " << internals.NumberOfBuckets << "\n";
+  os << indent << "Divisions: (" << internals.Divisions[0] << ", " << internals.Divisions[1]
+     << ", " << internals.Divisions[2] << ")\n";
+  os << indent << "Points: " << internals.Points.Get() << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkConcurrentMergePoints
+ * @brief   merge exactly coincident points inserted from several threads
+ *
+ * vtkConcurrentMergePoints merges precisely coincident points, like
+ * vtkMergePoints, but InsertUniquePoint() and IsInsertedPoint() can be called
+ * concurrently, for instance from vtkSMPTools functors. Points are hashed in a
+ * uniform grid of buckets; each bucket is a list that is only ever prepended to
+ * with an atomic compare-and-swap, so lookups do not lock and insertions only
+ * retry when another thread inserted in the same bucket at the same time.
+ *
+ * Usage:
+ * \code
+ * vtkNew<vtkConcurrentMergePoints> merger;
+ * merger->InitPointInsertion(newPts, bounds, estimatedNumberOfPoints);
+ * vtkSMPTools::For(0, n,
+ *   [&](vtkIdType begin, vtkIdType end)
+ *   {
+ *     for (vtkIdType i = begin; i < end; ++i)
+ *     {
+ *       merger->InsertUniquePoint(x[i], i, ids[i]);
+ *     }
+ *   });
+ * merger->SortPoints(newIds); // optional, makes the ids deterministic
+ * merger->FinalizePointInsertion();
+ * \endcode
+ *
+ * Point ids are dense and given in insertion order, which depends on the
+ * scheduling of the threads. Each insertion may give an order, for instance the
+ * index of the input point or cell producing the point. SortPoints() then
+ * renumbers the points by increasing smallest order, points with the same
+ * order being sorted by their coordinates, which does not depend on the
+ * scheduling. When distinct points have distinct orders, this matches the ids
+ * vtkMergePoints gives when inserting the points serially by increasing order;
+ * points sharing an order may be numbered differently.
+ *
+ * Points are compared with the precision of the output points: if they are
+ * floats, coordinates that round to the same floats are merged.
+ *
+ * @warning
+ * InitPointInsertion(), SortPoints() and FinalizePointInsertion() are not thread
+ * safe and must not run concurrently with insertions.
+ *
+ * @sa
+ * vtkMergePoints vtkPointLocator vtkSMPTools
+ */
+
+#ifndef vtkConcurrentMergePoints_h
+#define vtkConcurrentMergePoints_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <memory> // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkIdList;
+class vtkPoints;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkConcurrentMergePoints : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, type information, and printing.
+   */
+  static vtkConcurrentMergePoints* New();
+  vtkTypeMacro(vtkConcurrentMergePoints, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Specify the average number of points in each bucket, used to size the
+   * bucket grid from the estimated number of points given to InitPointInsertion().
+   * Default is 3.
+   */
+  vtkSetClampMacro(NumberOfPointsPerBucket, int, 1, VTK_INT_MAX);
+  vtkGetMacro(NumberOfPointsPerBucket, int);
+  ///@}
+
+  /**
+   * Initialize the point insertion. The merged points are written to newPts
+   * by FinalizePointInsertion(). Points are expected within the given bounds;
+   * points outside of them are still merged, but in the border buckets.
+   * Returns 0 on failure.
+   */
+  int InitPointInsertion(vtkPoints* newPts, const double bounds[6], vtkIdType estNumPts);
+
+  ///@{
+  /**
+   * Insert x if no coincident point has been inserted. Return 1 if the point
+   * has been inserted and 0 if it was already present; in both cases ptId is the
+   * id of the point. order is the key used by SortPoints(), the smallest order
+   * given for a point is kept. Without order, the insertion id is used. These
+   * methods are thread safe. InitPointInsertion() must have been called first,
+   * otherwise an error is reported, ptId is set to -1 and 0 is returned.
+   */
+  int InsertUniquePoint(const double x[3], vtkIdType& ptId);
+  int InsertUniquePoint(const double x[3], vtkIdType order, vtkIdType& ptId);
+  ///@}
+
+  /**
+   * Return the id of the point coincident with x, or -1 if there is none.
+   * This method is thread safe.
+   */
+  vtkIdType IsInsertedPoint(const double x[3]);
+
+  /**
+   * Return the number of points inserted so far. This method is thread safe.
+   */
+  vtkIdType GetNumberOfPoints() const;
+
+  /**
+   * Renumber the points by increasing order, points with the same order being
+   * sorted by their coordinates. If newIds is given, it is resized to the number
+   * of points and maps the previous ids to the new ones. Later calls to
+   * InsertUniquePoint() and IsInsertedPoint() return the new ids.
+   */
+  void SortPoints(vtkIdList* newIds = nullptr);
+
+  /**
+   * Write the merged points, in id order, to the points given to
+   * InitPointInsertion(). Insertion can continue afterwards, in which case this
+   * method must be called again.
+   */
+  void FinalizePointInsertion();
+
+  /**
+   * Release the buckets and the stored points.
+   */
+  void Initialize();
+
+protected:
+  vtkConcurrentMergePoints();
+  ~vtkConcurrentMergePoints() override;
+
+  int NumberOfPointsPerBucket = 3;
+
+private:
+  vtkConcurrentMergePoints(const vtkConcurrentMergePoints&) = delete;
+  void operator=(const vtkConcurrentMergePoints&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -16,6 +16,7 @@
 #include "vtkDoubleArray.h"
 #include "vtkGenericCell.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
@@ -24,7 +25,9 @@
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStructuredData.h"
+#include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <cmath>
 #include <set>
 
@@ -540,6 +543,35 @@ void vtkDataSet::GetCellPoints(
   pts = ptIds->GetPointer(0);
 }
 
+//------------------------------------------------------------------------------
+void vtkDataSet::GetCellRange(vtkIdType beginCellId, vtkIdType endCellId,
+  vtkUnsignedCharArray* types, vtkIdTypeArray* offsets, vtkIdTypeArray* connectivity)
+{
+  const vtkIdType numCells = endCellId - beginCellId;
+  types->SetNumberOfTuples(numCells);
+  offsets->SetNumberOfTuples(numCells + 1);
+  offsets->SetValue(0, 0);
+  connectivity->Reset();
+
+  vtkNew<vtkIdList> ptIds;
+  vtkIdType npts;
+  const vtkIdType* pts;
+  for (vtkIdType i = 0; i < numCells; ++i)
+  {
+    const int cellType = this->GetCellType(beginCellId + i);
+    types->SetValue(i, static_cast<unsigned char>(cellType));
+    if (cellType == VTK_EMPTY_CELL)
+    {
+      offsets->SetValue(i + 1, connectivity->GetNumberOfValues());
+      continue;
+    }
+    this->GetCellPoints(beginCellId + i, npts, pts, ptIds);
+    const vtkIdType offset = connectivity->GetNumberOfValues();
+    std::copy(pts, pts + npts, connectivity->WritePointer(offset, npts));
+    offsets->SetValue(i + 1, offset + npts);
+  }
+}
+
 //------------------------------------------------------------------------------
 int vtkDataSet::GetMaxSpatialDimension()
 {
@@ -41,6 +41,7 @@ class vtkCellIterator;
 class vtkCellTypes;
 class vtkGenericCell;
 class vtkIdList;
+class vtkIdTypeArray;
 class vtkPointData;
 class vtkPoints;
 class vtkUnsignedCharArray;
@@ -200,6 +201,27 @@ public:
   virtual void GetCellPoints(vtkIdType cellId, vtkIdType& npts, vtkIdType const*& pts,
     vtkIdList* ptIds) VTK_SIZEHINT(pts, npts);
 
+  /**
+   * Topological inquiry to get the types and the points of the cells
+   * beginCellId <= cellId < endCellId with a single call. types is set to
+   * the type of each cell, as returned by GetCellType(), and the points of
+   * cell beginCellId + i, as returned by GetCellPoints(), are stored in
+   * connectivity from offsets[i] to offsets[i + 1] - 1, so offsets holds
+   * endCellId - beginCellId + 1 values starting at 0. Hidden cells, of type
+   * VTK_EMPTY_CELL, have no points. The arrays keep their memory when
+   * resized, so that they can be reused for the next range.
+   *
+   * Filters visiting the cells by ranges of a few hundred cells save two
+   * virtual calls per cell: subclasses override this method to copy the
+   * range from their cell arrays, or to generate the implicit connectivity of
+   * structured datasets.
+   *
+   * THIS METHOD IS THREAD SAFE IF FIRST CALLED FROM A SINGLE THREAD AND
+   * THE DATASET IS NOT MODIFIED
+   */
+  virtual void GetCellRange(vtkIdType beginCellId, vtkIdType endCellId,
+    vtkUnsignedCharArray* types, vtkIdTypeArray* offsets, vtkIdTypeArray* connectivity);
+
   /**
    * Topological inquiry to get cells using point.
    * THIS METHOD IS THREAD SAFE IF FIRST CALLED FROM A SINGLE THREAD AND
@@ -5,6 +5,8 @@
 #include "vtkArrayDispatch.h"
 #include "vtkArrayIteratorIncludes.h"
 #include "vtkDataArrayRange.h"
+#include "vtkIdList.h"
+#include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
@@ -1126,7 +1128,7 @@ void vtkDataSetAttributes::InterpolatePoint(
     {
       vtkIdType numIds = ptIds->GetNumberOfIds();
       vtkIdType maxId = ptIds->GetId(0);
-      vtkIdType maxWeight = 0;
+      double maxWeight = 0.;
       for (int j = 0; j < numIds; ++j)
       {
         if (weights[j] > maxWeight)
@@ -1215,6 +1217,196 @@ void vtkDataSetAttributes::InterpolateTime(
   }
 }
 
+namespace
+{
+//==============================================================================
+// Input tuples and weights used for each output tuple of InterpolatePoints().
+struct PointStencils
+{
+  const vtkIdType* Offsets;
+  const vtkIdType* Ids;
+  const double* Weights;
+
+  vtkIdType GetBegin(vtkIdType i) const { return this->Offsets[i]; }
+  vtkIdType GetEnd(vtkIdType i) const { return this->Offsets[i + 1]; }
+  vtkIdType GetId(vtkIdType j) const { return this->Ids[j]; }
+  double GetWeight(vtkIdType j) const { return this->Weights[j]; }
+
+  // Input tuple with the largest weight, for nearest neighbor interpolation.
+  vtkIdType GetNearestId(vtkIdType i) const
+  {
+    vtkIdType nearest = this->Ids[this->Offsets[i]];
+    double maxWeight = 0.0;
+    for (vtkIdType j = this->Offsets[i]; j < this->Offsets[i + 1]; ++j)
+    {
+      if (this->Weights[j] > maxWeight)
+      {
+        maxWeight = this->Weights[j];
+        nearest = this->Ids[j];
+      }
+    }
+    return nearest;
+  }
+
+  // Per-tuple interpolation, for arrays that are not dispatched.
+  void InterpolateTuple(vtkAbstractArray* outArray, vtkIdType toId, vtkIdType i,
+    vtkAbstractArray* inArray, vtkIdList* ids) const
+  {
+    const vtkIdType begin = this->Offsets[i];
+    ids->SetNumberOfIds(this->Offsets[i + 1] - begin);
+    std::copy(this->Ids + begin, this->Ids + this->Offsets[i + 1], ids->begin());
+    outArray->InterpolateTuple(toId, ids, inArray, const_cast<double*>(this->Weights + begin));
+  }
+};
+
+//==============================================================================
+// Input tuples and weights used for each output tuple of InterpolateEdges().
+struct EdgeStencils
+{
+  const vtkIdType* Edges;
+  const double* T;
+
+  vtkIdType GetBegin(vtkIdType i) const { return 2 * i; }
+  vtkIdType GetEnd(vtkIdType i) const { return 2 * i + 2; }
+  vtkIdType GetId(vtkIdType j) const { return this->Edges[j]; }
+  double GetWeight(vtkIdType j) const { return (j % 2) ? this->T[j / 2] : 1.0 - this->T[j / 2]; }
+
+  // Same choice as InterpolateEdge().
+  vtkIdType GetNearestId(vtkIdType i) const
+  {
+    return this->T[i] < 0.5 ? this->Edges[2 * i] : this->Edges[2 * i + 1];
+  }
+
+  // Per-tuple interpolation, for arrays that are not dispatched.
+  void InterpolateTuple(vtkAbstractArray* outArray, vtkIdType toId, vtkIdType i,
+    vtkAbstractArray* inArray, vtkIdList* vtkNotUsed(ids)) const
+  {
+    outArray->InterpolateTuple(
+      toId, this->Edges[2 * i], inArray, this->Edges[2 * i + 1], inArray, this->T[i]);
+  }
+};
+
+//==============================================================================
+// Interpolates a range of output tuples of a single array, the input and
+// output arrays having the same value type.
+template <typename StencilsT>
+struct InterpolateTuplesWorker
+{
+  template <typename OutArrayT, typename InArrayT>
+  void operator()(OutArrayT* outArray, InArrayT* inArray, vtkIdType toStart, vtkIdType numTuples,
+    const StencilsT& stencils, bool nearest) const
+  {
+    using ValueType = vtk::GetAPIType<OutArrayT>;
+    const int numComps = outArray->GetNumberOfComponents();
+    const auto in = vtk::DataArrayValueRange(inArray);
+    auto out = vtk::DataArrayValueRange(
+      outArray, toStart * numComps, (toStart + numTuples) * numComps);
+
+    auto outIter = out.begin();
+    for (vtkIdType i = 0; i < numTuples; ++i)
+    {
+      if (nearest)
+      {
+        const vtkIdType inStart = stencils.GetNearestId(i) * numComps;
+        for (int c = 0; c < numComps; ++c)
+        {
+          *outIter++ = in[inStart + c];
+        }
+        continue;
+      }
+
+      const vtkIdType begin = stencils.GetBegin(i);
+      const vtkIdType end = stencils.GetEnd(i);
+      for (int c = 0; c < numComps; ++c)
+      {
+        double val = 0.0;
+        for (vtkIdType j = begin; j < end; ++j)
+        {
+          val += stencils.GetWeight(j) * static_cast<double>(in[stencils.GetId(j) * numComps + c]);
+        }
+        ValueType valT;
+        vtkMath::RoundDoubleToIntegralIfNecessary(val, &valT);
+        *outIter++ = valT;
+      }
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+// Fallback for arrays that are not dispatched, e.g. vtkStringArray. The id
+// list is local since concurrent calls may share the vtkDataSetAttributes.
+template <typename StencilsT>
+void InterpolateTuplesFallback(vtkAbstractArray* outArray, vtkAbstractArray* inArray,
+  vtkIdType toStart, vtkIdType numTuples, const StencilsT& stencils, bool nearest)
+{
+  vtkNew<vtkIdList> ids;
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    if (nearest)
+    {
+      outArray->SetTuple(toStart + i, stencils.GetNearestId(i), inArray);
+    }
+    else
+    {
+      stencils.InterpolateTuple(outArray, toStart + i, i, inArray, ids);
+    }
+  }
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+template <typename StencilsT>
+void vtkDataSetAttributes::InterpolateTuples(vtkDataSetAttributes* fromPd, vtkIdType toStart,
+  vtkIdType numTuples, const StencilsT& stencils)
+{
+  if (numTuples <= 0)
+  {
+    return;
+  }
+
+  using Dispatcher = vtkArrayDispatch::Dispatch2SameValueType;
+  InterpolateTuplesWorker<StencilsT> worker;
+  for (const auto& i : this->RequiredArrays)
+  {
+    vtkAbstractArray* fromArray = fromPd->Data[i];
+    vtkAbstractArray* toArray = this->Data[this->TargetIndices[i]];
+
+    if (toArray->GetNumberOfTuples() < toStart + numTuples)
+    {
+      vtkErrorMacro("Array " << (toArray->GetName() ? toArray->GetName() : "(unnamed)")
+                             << " does not hold the interpolated tuples, skipping it.");
+      continue;
+    }
+
+    // check if the destination array needs nearest neighbor interpolation
+    int attributeIndex = this->IsArrayAnAttribute(this->TargetIndices[i]);
+    const bool nearest =
+      attributeIndex != -1 && this->CopyAttributeFlags[INTERPOLATE][attributeIndex] == 2;
+
+    vtkDataArray* fromDA = vtkArrayDownCast<vtkDataArray>(fromArray);
+    vtkDataArray* toDA = vtkArrayDownCast<vtkDataArray>(toArray);
+    if (!fromDA || !toDA || fromDA->GetNumberOfComponents() != toDA->GetNumberOfComponents() ||
+      !Dispatcher::Execute(toDA, fromDA, worker, toStart, numTuples, stencils, nearest))
+    {
+      InterpolateTuplesFallback(toArray, fromArray, toStart, numTuples, stencils, nearest);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkDataSetAttributes::InterpolatePoints(vtkDataSetAttributes* fromPd, vtkIdType toStart,
+  vtkIdType numTuples, const vtkIdType* offsets, const vtkIdType* ids, const double* weights)
+{
+  this->InterpolateTuples(fromPd, toStart, numTuples, PointStencils{ offsets, ids, weights });
+}
+
+//------------------------------------------------------------------------------
+void vtkDataSetAttributes::InterpolateEdges(vtkDataSetAttributes* fromPd, vtkIdType toStart,
+  vtkIdType numTuples, const vtkIdType* edges, const double* t)
+{
+  this->InterpolateTuples(fromPd, toStart, numTuples, EdgeStencils{ edges, t });
+}
+
 //------------------------------------------------------------------------------
 // Copy a tuple of data from one data array to another. This method (and
 // following ones) assume that the fromData and toData objects are of the
@@ -613,6 +613,35 @@ public:
   void InterpolateTime(
     vtkDataSetAttributes* from1, vtkDataSetAttributes* from2, vtkIdType id, double t);
 
+  ///@{
+  /**
+   * Batched forms of InterpolatePoint() and InterpolateEdge(), interpolating
+   * the numTuples consecutive tuples starting at toStart.
+   *
+   * With InterpolatePoints(), output tuple toStart + i is interpolated from the
+   * input tuples ids[offsets[i]] ... ids[offsets[i + 1] - 1], with the weights
+   * stored at the same locations of the weights array. offsets thus holds
+   * numTuples + 1 values. With InterpolateEdges(), output tuple toStart + i is
+   * interpolated from the input tuples edges[2 * i] and edges[2 * i + 1], as
+   * InterpolateEdge() does with the parameter t[i].
+   *
+   * Each array is processed by a single loop specialized for its value type,
+   * instead of one virtual call per array and per tuple. The INTERPOLATION copy
+   * flags are honored as in InterpolatePoint().
+   *
+   * Make sure that InterpolateAllocate() has been invoked, and that the output
+   * arrays already hold the tuples to write, e.g. with SetNumberOfTuples(): these
+   * methods never resize the output arrays, so that vtkSMPTools workers may call
+   * them concurrently on disjoint ranges of output tuples. Arrays that are not
+   * dispatched, such as vtkStringArray, fall back to per-tuple interpolation,
+   * which allocates a temporary vtkIdList per call.
+   */
+  void InterpolatePoints(vtkDataSetAttributes* fromPd, vtkIdType toStart, vtkIdType numTuples,
+    const vtkIdType* offsets, const vtkIdType* ids, const double* weights);
+  void InterpolateEdges(vtkDataSetAttributes* fromPd, vtkIdType toStart, vtkIdType numTuples,
+    const vtkIdType* edges, const double* t);
+  ///@}
+
   using FieldList = vtkDataSetAttributesFieldList;
 
   // field list copy operations ------------------------------------------
@@ -681,6 +710,11 @@ private:
 
   vtkFieldData::BasicIterator ComputeRequiredArrays(vtkDataSetAttributes* pd, int ctype);
 
+  // Shared implementation of InterpolatePoints() and InterpolateEdges().
+  template <typename StencilsT>
+  void InterpolateTuples(vtkDataSetAttributes* fromPd, vtkIdType toStart, vtkIdType numTuples,
+    const StencilsT& stencils);
+
   vtkDataSetAttributes(const vtkDataSetAttributes&) = delete;
   void operator=(const vtkDataSetAttributes&) = delete;
 
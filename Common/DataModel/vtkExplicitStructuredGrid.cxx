@@ -132,6 +132,8 @@ namespace
 { // anonymous
 struct ComputeCellBoundsVisitor
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   // vtkCellArray::Visit entry point:
   template <typename CellStateT>
   void operator()(CellStateT& state, vtkPoints* points, vtkIdType cellId, double bounds[6]) const
@@ -563,6 +563,15 @@ void vtkImageData::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
   this->StructuredCells->GetCellAtId(cellId, ptIds);
 }
 
+//------------------------------------------------------------------------------
+void vtkImageData::GetCellRange(vtkIdType beginCellId, vtkIdType endCellId,
+  vtkUnsignedCharArray* types, vtkIdTypeArray* offsets, vtkIdTypeArray* connectivity)
+{
+  vtkStructuredData::GetCellRange(this->StructuredCells, this->StructuredCellTypes, beginCellId,
+    endCellId, this->Dimensions, this->DataDescription, this->GetCellGhostArray(),
+    this->GetPointGhostArray(), types, offsets, connectivity);
+}
+
 //------------------------------------------------------------------------------
 void vtkImageData::ComputeBounds()
 {
@@ -92,6 +92,8 @@ public:
   void GetCellPoints(vtkIdType cellId, vtkIdType& npts, vtkIdType const*& pts, vtkIdList* ptIds)
     VTK_SIZEHINT(pts, npts) override;
   void GetCellPoints(vtkIdType cellId, vtkIdList* ptIds) override;
+  void GetCellRange(vtkIdType beginCellId, vtkIdType endCellId, vtkUnsignedCharArray* types,
+    vtkIdTypeArray* offsets, vtkIdTypeArray* connectivity) override;
   void GetPointCells(vtkIdType ptId, vtkIdList* cellIds) override
   {
     int dimensions[3];
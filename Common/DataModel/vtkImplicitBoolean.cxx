@@ -5,6 +5,7 @@
 #include "vtkImplicitFunctionCollection.h"
 #include "vtkObjectFactory.h"
 
+#include <algorithm>
 #include <cmath>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -135,6 +136,76 @@ double vtkImplicitBoolean::EvaluateFunction(double x[3])
   return value;
 }
 
+// Evaluate boolean combinations for a batch of points. The values of each
+// function are computed by blocks and combined into the output.
+void vtkImplicitBoolean::EvaluateFunctionBatch(
+  vtkIdType n, const double* x, const double* y, const double* z, double* values)
+{
+  constexpr vtkIdType blockSize = 256;
+  double blockValues[blockSize];
+  vtkImplicitFunction* f;
+  vtkCollectionSimpleIterator sit;
+  this->FunctionList->InitTraversal(sit);
+  vtkImplicitFunction* firstF = this->FunctionList->GetNextImplicitFunction(sit);
+  if (!firstF)
+  {
+    std::fill(values, values + n, 0.0);
+    return;
+  }
+
+  if (this->OperationType == VTK_DIFFERENCE)
+  { // the first function initializes the values
+    firstF->FunctionValueBatch(n, x, y, z, values);
+  }
+  else
+  {
+    std::fill(values, values + n,
+      this->OperationType == VTK_INTERSECTION ? -VTK_DOUBLE_MAX : VTK_DOUBLE_MAX);
+  }
+
+  for (this->FunctionList->InitTraversal(sit);
+       (f = this->FunctionList->GetNextImplicitFunction(sit));)
+  {
+    if (this->OperationType == VTK_DIFFERENCE && f == firstF)
+    {
+      continue;
+    }
+    for (vtkIdType begin = 0; begin < n; begin += blockSize)
+    {
+      const vtkIdType size = std::min(blockSize, n - begin);
+      double* blockOutput = values + begin;
+      f->FunctionValueBatch(size, x + begin, y + begin, z + begin, blockValues);
+      switch (this->OperationType)
+      {
+        case VTK_UNION: // take minimum value
+          for (vtkIdType i = 0; i < size; ++i)
+          {
+            blockOutput[i] = std::min(blockOutput[i], blockValues[i]);
+          }
+          break;
+        case VTK_INTERSECTION: // take maximum value
+          for (vtkIdType i = 0; i < size; ++i)
+          {
+            blockOutput[i] = std::max(blockOutput[i], blockValues[i]);
+          }
+          break;
+        case VTK_UNION_OF_MAGNITUDES: // take minimum absolute value
+          for (vtkIdType i = 0; i < size; ++i)
+          {
+            blockOutput[i] = std::min(blockOutput[i], std::fabs(blockValues[i]));
+          }
+          break;
+        default: // difference
+          for (vtkIdType i = 0; i < size; ++i)
+          {
+            blockOutput[i] = std::max(blockOutput[i], -blockValues[i]);
+          }
+          break;
+      }
+    }
+  }
+}
+
 // Evaluate gradient of boolean combination.
 void vtkImplicitBoolean::EvaluateGradient(double x[3], double g[3])
 {
@@ -54,6 +54,8 @@ public:
    */
   using vtkImplicitFunction::EvaluateFunction;
   double EvaluateFunction(double x[3]) override;
+  void EvaluateFunctionBatch(
+    vtkIdType n, const double* x, const double* y, const double* z, double* values) override;
   ///@}
 
   /**
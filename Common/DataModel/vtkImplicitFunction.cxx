@@ -28,6 +28,9 @@ vtkImplicitFunction::~vtkImplicitFunction()
 
 namespace
 {
+// Number of points gathered, evaluated and scattered at once. The coordinates and
+// values of a block fit in the L1 cache of most processors.
+constexpr vtkIdType BatchSize = 256;
 
 template <class Func>
 struct FunctionWorker
@@ -51,13 +54,26 @@ struct FunctionWorker
       [&](vtkIdType begin, vtkIdType end)
       {
         double tuple[3];
-        for (vtkIdType pointId = begin; pointId < end; ++pointId)
+        double x[BatchSize], y[BatchSize], z[BatchSize], values[BatchSize];
+        for (vtkIdType blockBegin = begin; blockBegin < end; blockBegin += BatchSize)
         {
-          // GetTuple creates a copy of the tuple using GetTypedTuple if it's not a vktDataArray
-          // we do that since the input points can be implicit points, and GetTypedTuple is faster
-          // than accessing the component of the TupleReference using GetTypedComponent internally.
-          srcTuples.GetTuple(pointId, tuple);
-          dstValues[pointId] = static_cast<DstValueT>(this->F(tuple));
+          const vtkIdType blockSize = std::min(BatchSize, end - blockBegin);
+          for (vtkIdType i = 0; i < blockSize; ++i)
+          {
+            // GetTuple creates a copy of the tuple using GetTypedTuple if it's not a vktDataArray
+            // we do that since the input points can be implicit points, and GetTypedTuple is
+            // faster than accessing the component of the TupleReference using GetTypedComponent
+            // internally.
+            srcTuples.GetTuple(blockBegin + i, tuple);
+            x[i] = tuple[0];
+            y[i] = tuple[1];
+            z[i] = tuple[2];
+          }
+          this->F(blockSize, x, y, z, values);
+          for (vtkIdType i = 0; i < blockSize; ++i)
+          {
+            dstValues[blockBegin + i] = static_cast<DstValueT>(values[i]);
+          }
         }
       });
   }
@@ -70,7 +86,10 @@ public:
     : Function(function)
   {
   }
-  double operator()(double in[3]) { return this->Function->EvaluateFunction(in); }
+  void operator()(vtkIdType n, const double* x, const double* y, const double* z, double* values)
+  {
+    this->Function->EvaluateFunctionBatch(n, x, y, z, values);
+  }
 
 private:
   vtkImplicitFunction* Function;
@@ -79,20 +98,17 @@ private:
 class TransformFunction
 {
 public:
-  TransformFunction(vtkImplicitFunction* function, vtkAbstractTransform* transform)
+  TransformFunction(vtkImplicitFunction* function)
     : Function(function)
-    , Transform(transform)
   {
   }
-  double operator()(double in[3])
+  void operator()(vtkIdType n, const double* x, const double* y, const double* z, double* values)
   {
-    this->Transform->TransformPoint(in, in);
-    return this->Function->EvaluateFunction(in);
+    this->Function->FunctionValueBatch(n, x, y, z, values);
   }
 
 private:
   vtkImplicitFunction* Function;
-  vtkAbstractTransform* Transform;
 };
 
 } // end anon namespace
@@ -105,7 +121,7 @@ void vtkImplicitFunction::FunctionValue(vtkDataArray* input, vtkDataArray* outpu
   }
   else // pass point through transform
   {
-    FunctionWorker<TransformFunction> worker(TransformFunction(this, this->Transform));
+    FunctionWorker<TransformFunction> worker(TransformFunction(this));
     typedef vtkTypeList::Create<float, double> InputTypes;
     typedef vtkTypeList::Create<float, double> OutputTypes;
     typedef vtkArrayDispatch::Dispatch2ByValueTypeUsingArrays<vtkArrayDispatch::AllArrays,
@@ -136,6 +152,51 @@ void vtkImplicitFunction::EvaluateFunction(vtkDataArray* input, vtkDataArray* ou
   }
 }
 
+// Evaluate function at n points. The points are transformed through
+// transform (if provided) by blocks to keep the copies on the stack.
+void vtkImplicitFunction::FunctionValueBatch(
+  vtkIdType n, const double* x, const double* y, const double* z, double* values)
+{
+  if (!this->Transform)
+  {
+    this->EvaluateFunctionBatch(n, x, y, z, values);
+    return;
+  }
+
+  double pt[3];
+  double tx[BatchSize], ty[BatchSize], tz[BatchSize];
+  for (vtkIdType blockBegin = 0; blockBegin < n; blockBegin += BatchSize)
+  {
+    const vtkIdType blockSize = std::min(BatchSize, n - blockBegin);
+    for (vtkIdType i = 0; i < blockSize; ++i)
+    {
+      pt[0] = x[blockBegin + i];
+      pt[1] = y[blockBegin + i];
+      pt[2] = z[blockBegin + i];
+      this->Transform->TransformPoint(pt, pt);
+      tx[i] = pt[0];
+      ty[i] = pt[1];
+      tz[i] = pt[2];
+    }
+    this->EvaluateFunctionBatch(blockSize, tx, ty, tz, values + blockBegin);
+  }
+}
+
+// Evaluate function at n points without transforming them. This is the fallback
+// for functions without a batched implementation.
+void vtkImplicitFunction::EvaluateFunctionBatch(
+  vtkIdType n, const double* x, const double* y, const double* z, double* values)
+{
+  double pt[3];
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    pt[0] = x[i];
+    pt[1] = y[i];
+    pt[2] = z[i];
+    values[i] = this->EvaluateFunction(pt);
+  }
+}
+
 // Evaluate function at position x-y-z and return value. Point x[3] is
 // transformed through transform (if provided).
 double vtkImplicitFunction::FunctionValue(const double x[3])
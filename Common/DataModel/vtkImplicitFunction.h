@@ -72,6 +72,14 @@ public:
   }
   ///@}
 
+  /**
+   * Evaluate function at n points whose coordinates are given as three separate
+   * x, y and z arrays, and write the n values. Points are transformed through
+   * transform (if provided) before calling EvaluateFunctionBatch().
+   */
+  VTK_WRAPEXCLUDE void FunctionValueBatch(
+    vtkIdType n, const double* x, const double* y, const double* z, double* values);
+
   ///@{
   /**
    * Evaluate function gradient at position x-y-z and pass back vector. Point
@@ -116,6 +124,17 @@ public:
   }
   ///@}
 
+  /**
+   * Evaluate function at n points whose coordinates are given as three separate
+   * x, y and z arrays, and write the n values. You should generally not call this
+   * method directly, you should use FunctionValueBatch() instead. The default
+   * implementation calls EvaluateFunction() for each point; derived classes with a
+   * closed form expression override it with a loop the compiler can vectorize.
+   * EvaluateFunction(vtkDataArray*, vtkDataArray*) calls it on blocks of points.
+   */
+  VTK_WRAPEXCLUDE virtual void EvaluateFunctionBatch(
+    vtkIdType n, const double* x, const double* y, const double* z, double* values);
+
   /**
    * Evaluate function gradient at position x-y-z and pass back vector.
    * You should generally not call this method directly, you should use
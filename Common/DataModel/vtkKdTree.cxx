@@ -12,6 +12,7 @@
 #include "vtkDataSetCollection.h"
 #include "vtkFloatArray.h"
 #include "vtkGarbageCollector.h"
+#include "vtkGenericCell.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
@@ -23,6 +24,10 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTaskGroup.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTimerLog.h"
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
@@ -32,6 +37,7 @@
 #include <map>
 #include <queue>
 #include <set>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 namespace
@@ -637,25 +643,50 @@ float* vtkKdTree::ComputeCellCenters(vtkDataSet* set)
     }
   }
 
-  double* weights = new double[maxCellSize];
+  const std::vector<double> weights(static_cast<size_t>(maxCellSize));
+  vtkSMPThreadLocalObject<vtkGenericCell> threadCells;
+  vtkSMPThreadLocal<std::vector<double>> threadWeights(weights);
+  int firstCell = 0;
 
-  float* cptr = center;
-  double dcenter[3];
-
-  if (set)
+  // Compute the centers of the cells of a data set in parallel, from center + 3 * firstCell.
+  auto computeCenters = [&](vtkDataSet* iset)
   {
-    for (int j = 0; j < totalCells; j++)
+    int nCells = iset->GetNumberOfCells();
+    if (nCells == 0)
     {
-      this->ComputeCellCenter(set->GetCell(j), dcenter, weights);
-      cptr[0] = static_cast<float>(dcenter[0]);
-      cptr[1] = static_cast<float>(dcenter[1]);
-      cptr[2] = static_cast<float>(dcenter[2]);
-      cptr += 3;
-      if (j % 1000 == 0)
-      {
-        this->UpdateSubOperationProgress(static_cast<double>(j) / totalCells);
-      }
+      return;
     }
+    // The first call to GetCell() may initialize the data set, which is not thread safe.
+    iset->GetCell(0, threadCells.Local());
+
+    vtkSMPTools::For(0, nCells,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        bool isFirst = vtkSMPTools::GetSingleThread();
+        vtkGenericCell* cell = threadCells.Local();
+        double* cellWeights = threadWeights.Local().data();
+        double dcenter[3];
+        float* cptr = center + 3 * (firstCell + begin);
+        for (vtkIdType j = begin; j < end; j++)
+        {
+          iset->GetCell(j, cell);
+          this->ComputeCellCenter(cell, dcenter, cellWeights);
+          cptr[0] = static_cast<float>(dcenter[0]);
+          cptr[1] = static_cast<float>(dcenter[1]);
+          cptr[2] = static_cast<float>(dcenter[2]);
+          cptr += 3;
+          if (isFirst && j % 1000 == 0)
+          {
+            this->UpdateSubOperationProgress(static_cast<double>(firstCell + j) / totalCells);
+          }
+        }
+      });
+    firstCell += nCells;
+  };
+
+  if (set)
+  {
+    computeCenters(set);
   }
   else
   {
@@ -664,25 +695,10 @@ float* vtkKdTree::ComputeCellCenters(vtkDataSet* set)
     for (vtkDataSet* iset = this->DataSets->GetNextDataSet(cookie); iset != nullptr;
          iset = this->DataSets->GetNextDataSet(cookie))
     {
-      int nCells = iset->GetNumberOfCells();
-
-      for (int j = 0; j < nCells; j++)
-      {
-        this->ComputeCellCenter(iset->GetCell(j), dcenter, weights);
-        cptr[0] = static_cast<float>(dcenter[0]);
-        cptr[1] = static_cast<float>(dcenter[1]);
-        cptr[2] = static_cast<float>(dcenter[2]);
-        cptr += 3;
-        if (j % 1000 == 0)
-        {
-          this->UpdateSubOperationProgress(static_cast<double>(j) / totalCells);
-        }
-      }
+      computeCenters(iset);
     }
   }
 
-  delete[] weights;
-
   this->UpdateSubOperationProgress(1.0);
   return center;
 }
@@ -1256,6 +1272,18 @@ int vtkKdTree::DivideTest(int size, int level)
 
 //------------------------------------------------------------------------------
 int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
+{
+  // Divide concurrently enough levels to give a few regions to each thread.
+  int parallelLevels = 0;
+  for (int nRegions = 1; nRegions < 4 * vtkSMPTools::GetEstimatedNumberOfThreads(); nRegions <<= 1)
+  {
+    parallelLevels++;
+  }
+  return this->DivideRegion(kd, c1, ids, level, level + parallelLevels);
+}
+
+//------------------------------------------------------------------------------
+int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level, int parallelLevel)
 {
   int ok = this->DivideTest(kd->GetNumberOfPoints(), level);
 
@@ -1320,9 +1348,21 @@ int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
   int* leftIds = ids;
   int* rightIds = ids ? ids + nleft : nullptr;
 
-  this->DivideRegion(kd->GetLeft(), c1, leftIds, level + 1);
+  if (level < parallelLevel && kd->GetNumberOfPoints() > vtkKdTree::ParallelDivideSize)
+  {
+    // The two halves are stored in disjoint parts of c1 and ids, so they are
+    // divided concurrently. Below parallelLevel, regions are divided serially.
+    vtkSMPTaskGroup tasks;
+    tasks.Spawn(
+      [&]() { this->DivideRegion(kd->GetLeft(), c1, leftIds, level + 1, parallelLevel); });
+    this->DivideRegion(kd->GetRight(), c1 + nleft * 3, rightIds, level + 1, parallelLevel);
+    tasks.Wait();
+    return 0;
+  }
+
+  this->DivideRegion(kd->GetLeft(), c1, leftIds, level + 1, parallelLevel);
 
-  this->DivideRegion(kd->GetRight(), c1 + nleft * 3, rightIds, level + 1);
+  this->DivideRegion(kd->GetRight(), c1 + nleft * 3, rightIds, level + 1, parallelLevel);
 
   return 0;
 }
@@ -1848,16 +1888,23 @@ void vtkKdTree::BuildLocatorFromPoints(vtkPoints** ptArrays, int numPtArrays)
     else
     {
       // Hopefully point arrays are usually floats.  This conversion will
-      // really slow things down.
+      // really slow things down, so it is threaded.
 
-      for (vtkIdType ii = 0; ii < npoints; ii++)
-      {
-        double* pt = ptArrays[i]->GetPoint(ii);
-
-        points[ptId++] = static_cast<float>(pt[0]);
-        points[ptId++] = static_cast<float>(pt[1]);
-        points[ptId++] = static_cast<float>(pt[2]);
-      }
+      vtkPoints* ptArray = ptArrays[i];
+      float* ptr = points + ptId;
+      vtkSMPTools::For(0, npoints,
+        [ptArray, ptr](vtkIdType begin, vtkIdType end)
+        {
+          double pt[3];
+          for (vtkIdType ii = begin; ii < end; ii++)
+          {
+            ptArray->GetPoint(ii, pt);
+            ptr[3 * ii] = static_cast<float>(pt[0]);
+            ptr[3 * ii + 1] = static_cast<float>(pt[1]);
+            ptr[3 * ii + 2] = static_cast<float>(pt[2]);
+          }
+        });
+      ptId += nvals;
     }
   }
 
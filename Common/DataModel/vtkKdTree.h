@@ -768,6 +768,11 @@ protected:
 
   int DivideRegion(vtkKdNode* kd, float* c1, int* ids, int nlevels);
 
+  // Regions of levels lower than parallelLevel and with more than ParallelDivideSize
+  // points have their two halves divided concurrently.
+  int DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level, int parallelLevel);
+  static constexpr int ParallelDivideSize = 10000;
+
   void DoMedianFind(vtkKdNode* kd, float* c1, int* ids, int d1, int d2, int d3);
 
   void SelfRegister(vtkKdNode* kd);
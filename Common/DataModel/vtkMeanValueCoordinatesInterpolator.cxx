@@ -534,8 +534,9 @@ void vtkMeanValueCoordinatesInterpolator::ComputeInterpolationWeights(
 
   // We can use a fast path if:
   // 1) The mesh only consists of triangles, and
-  // 2) `cells` is using vtkIdType for storage.
-  bool canFastPath =
+  // 2) `cells` is using vtkIdType for storage, and not a compact storage,
+  //    which the 32/64-bit accessors would convert.
+  bool canFastPath = !cells->IsStorageCompact() &&
 #ifdef VTK_USE_64BIT_IDS
     cells->IsStorage64Bit();
 #else  // VTK_USE_64BIT_IDS
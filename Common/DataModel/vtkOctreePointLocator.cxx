@@ -14,7 +14,10 @@
 #include "vtkOctreePointLocatorNode.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTaskGroup.h"
+#include "vtkSMPTools.h"
 
+#include <algorithm>
 #include <list>
 #include <map>
 #include <queue>
@@ -225,27 +228,25 @@ int vtkOctreePointLocator::DivideTest(int size, int level)
 }
 
 //------------------------------------------------------------------------------
-void vtkOctreePointLocator::DivideRegion(vtkOctreePointLocatorNode* node, int* ordering, int level)
+int vtkOctreePointLocator::DivideRegion(vtkOctreePointLocatorNode* node, int* ordering,
+  int level, const double* coordinates, int parallelLevel)
 {
   if (!this->DivideTest(node->GetNumberOfPoints(), level))
   {
-    return;
-  }
-  if (level >= this->Level)
-  {
-    this->Level = level + 1;
+    return 0;
   }
 
   node->CreateChildNodes();
   int numberOfPoints = node->GetNumberOfPoints();
-  vtkDataSet* ds = this->GetDataSet();
 
   std::vector<int> points[7];
   int i;
   int subOctantNumberOfPoints[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
   for (i = 0; i < numberOfPoints; i++)
   {
-    int index = node->GetSubOctantIndex(ds->GetPoint(ordering[i]), 0);
+    double point[3];
+    std::copy_n(coordinates + 3 * static_cast<vtkIdType>(ordering[i]), 3, point);
+    int index = node->GetSubOctantIndex(point, 0);
     if (index)
     {
       points[index - 1].push_back(ordering[i]);
@@ -266,13 +267,43 @@ void vtkOctreePointLocator::DivideRegion(vtkOctreePointLocatorNode* node, int* o
       memcpy(ordering + counter, points[i].data(), subOctantNumberOfPoints[i + 1] * sizeOfInt);
     }
   }
+  int* childOrdering[8];
   counter = 0;
   for (i = 0; i < 8; i++)
   {
     node->GetChild(i)->SetNumberOfPoints(subOctantNumberOfPoints[i]);
-    this->DivideRegion(node->GetChild(i), ordering + counter, level + 1);
+    childOrdering[i] = ordering + counter;
     counter += subOctantNumberOfPoints[i];
   }
+
+  int depth[8];
+  if (level < parallelLevel && numberOfPoints > vtkOctreePointLocator::ParallelDivideSize)
+  {
+    // The points of the octants are stored in disjoint parts of ordering, so the
+    // octants are divided concurrently. Below parallelLevel, they are divided serially.
+    vtkSMPTaskGroup tasks;
+    for (i = 1; i < 8; i++)
+    {
+      tasks.Spawn(
+        [&, i]()
+        {
+          depth[i] = this->DivideRegion(
+            node->GetChild(i), childOrdering[i], level + 1, coordinates, parallelLevel);
+        });
+    }
+    depth[0] = this->DivideRegion(
+      node->GetChild(0), childOrdering[0], level + 1, coordinates, parallelLevel);
+    tasks.Wait();
+  }
+  else
+  {
+    for (i = 0; i < 8; i++)
+    {
+      depth[i] = this->DivideRegion(
+        node->GetChild(i), childOrdering[i], level + 1, coordinates, parallelLevel);
+    }
+  }
+  return std::max(level + 1, *std::max_element(depth, depth + 8));
 }
 
 //------------------------------------------------------------------------------
@@ -395,23 +426,41 @@ void vtkOctreePointLocator::BuildLocatorInternal()
     return;
   }
 
-  for (i = 0; i < numPoints; i++)
-  {
-    this->LocatorIds[i] = i;
-  }
-  this->DivideRegion(node, this->LocatorIds, 0);
-  // TODO: may want to directly check if there exists a point array that
-  // is of type float and directly copy that instead of dealing with
-  // all of the casts
+  // Gather the point coordinates once, so that the octants can be divided
+  // concurrently: vtkDataSet::GetPoint(vtkIdType) is not thread safe.
   vtkDataSet* ds = this->GetDataSet();
-  for (i = 0; i < numPoints; i++)
-  {
-    double* pt = ds->GetPoint(this->LocatorIds[i]);
+  std::vector<double> coordinates(3 * static_cast<size_t>(numPoints));
+  ds->GetPoint(0, coordinates.data());
+  vtkSMPTools::For(0, numPoints,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType ptId = begin; ptId < end; ptId++)
+      {
+        ds->GetPoint(ptId, coordinates.data() + 3 * ptId);
+        this->LocatorIds[ptId] = static_cast<int>(ptId);
+      }
+    });
 
-    this->LocatorPoints[i * 3] = static_cast<float>(pt[0]);
-    this->LocatorPoints[i * 3 + 1] = static_cast<float>(pt[1]);
-    this->LocatorPoints[i * 3 + 2] = static_cast<float>(pt[2]);
+  // Divide concurrently enough levels to give a few octants to each thread.
+  int parallelLevel = 0;
+  for (int nOctants = 1; nOctants < 4 * vtkSMPTools::GetEstimatedNumberOfThreads(); nOctants <<= 3)
+  {
+    parallelLevel++;
   }
+  int depth = this->DivideRegion(node, this->LocatorIds, 0, coordinates.data(), parallelLevel);
+  this->Level = std::max(this->Level, depth);
+
+  vtkSMPTools::For(0, numPoints,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType ptId = begin; ptId < end; ptId++)
+      {
+        const double* pt = coordinates.data() + 3 * static_cast<vtkIdType>(this->LocatorIds[ptId]);
+        this->LocatorPoints[ptId * 3] = static_cast<float>(pt[0]);
+        this->LocatorPoints[ptId * 3 + 1] = static_cast<float>(pt[1]);
+        this->LocatorPoints[ptId * 3 + 2] = static_cast<float>(pt[2]);
+      }
+    });
 
   int nextLeafNodeId = 0;
   int nextMinId = 0;
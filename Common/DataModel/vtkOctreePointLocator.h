@@ -219,7 +219,15 @@ protected:
   // Recursive helper for public FindPointsInArea
   void AddAllPointsInRegion(vtkOctreePointLocatorNode* node, vtkIdTypeArray* ids);
 
-  void DivideRegion(vtkOctreePointLocatorNode* node, int* ordering, int level);
+  /**
+   * Divide node, whose points are ordering[i] with coordinates
+   * coordinates[3 * ordering[i]], and return the depth of the subtree. Octants of
+   * levels lower than parallelLevel and with more than ParallelDivideSize points
+   * are divided concurrently.
+   */
+  int DivideRegion(vtkOctreePointLocatorNode* node, int* ordering, int level,
+    const double* coordinates, int parallelLevel);
+  static constexpr int ParallelDivideSize = 10000;
 
   int DivideTest(int size, int level);
 
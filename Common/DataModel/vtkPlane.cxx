@@ -248,6 +248,21 @@ double vtkPlane::EvaluateFunction(double x[3])
     this->InternalNormal[2] * (x[2] - this->InternalOrigin[2]));
 }
 
+//------------------------------------------------------------------------------
+// Evaluate plane equation for a batch of points.
+void vtkPlane::EvaluateFunctionBatch(
+  vtkIdType n, const double* x, const double* y, const double* z, double* values)
+{
+  const double n0 = this->InternalNormal[0], n1 = this->InternalNormal[1],
+               n2 = this->InternalNormal[2];
+  const double o0 = this->InternalOrigin[0], o1 = this->InternalOrigin[1],
+               o2 = this->InternalOrigin[2];
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    values[i] = n0 * (x[i] - o0) + n1 * (y[i] - o1) + n2 * (z[i] - o2);
+  }
+}
+
 //------------------------------------------------------------------------------
 // Evaluate function gradient at point x[3].
 void vtkPlane::EvaluateGradient(double vtkNotUsed(x)[3], double n[3])
@@ -39,6 +39,8 @@ public:
   using vtkImplicitFunction::EvaluateFunction;
   void EvaluateFunction(vtkDataArray* input, vtkDataArray* output) override;
   double EvaluateFunction(double x[3]) override;
+  void EvaluateFunctionBatch(
+    vtkIdType n, const double* x, const double* y, const double* z, double* values) override;
   ///@}
 
   /**
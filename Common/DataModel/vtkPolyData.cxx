@@ -8,6 +8,7 @@
 #include "vtkCellLinks.h"
 #include "vtkGarbageCollector.h"
 #include "vtkGenericCell.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkNew.h"
@@ -20,6 +21,7 @@
 #include "vtkStaticCellLinks.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 // vtkPolyDataInternals.h methods:
@@ -259,6 +261,8 @@ namespace
 { // anonymous
 struct ComputeCellBoundsVisitor
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   // vtkCellArray::Visit entry point:
   template <typename CellStateT>
   void operator()(CellStateT& state, vtkPoints* points, vtkIdType cellId, double bounds[6]) const
@@ -746,6 +750,8 @@ namespace
 
 struct BuildCellsImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   // Typer functor must take a vtkIdType cell size and convert it into a
   // VTKCellType. The functor must ensure that the input size and returned cell
   // type are valid for the target cell array or throw a std::runtime_error.
@@ -910,6 +916,41 @@ void vtkPolyData::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkPolyData::GetCellRange(vtkIdType beginCellId, vtkIdType endCellId,
+  vtkUnsignedCharArray* types, vtkIdTypeArray* offsets, vtkIdTypeArray* connectivity)
+{
+  if (this->Cells == nullptr)
+  {
+    this->BuildCells();
+  }
+
+  const vtkIdType numCells = endCellId - beginCellId;
+  types->SetNumberOfTuples(numCells);
+  offsets->SetNumberOfTuples(numCells + 1);
+  offsets->SetValue(0, 0);
+  connectivity->Reset();
+
+  vtkNew<vtkIdList> ptIds;
+  vtkIdType npts;
+  const vtkIdType* pts;
+  for (vtkIdType i = 0; i < numCells; ++i)
+  {
+    const TaggedCellId tag = this->Cells->GetTag(beginCellId + i);
+    const vtkIdType offset = connectivity->GetNumberOfValues();
+    if (tag.IsDeleted())
+    {
+      types->SetValue(i, VTK_EMPTY_CELL);
+      offsets->SetValue(i + 1, offset);
+      continue;
+    }
+    types->SetValue(i, tag.GetCellType());
+    this->GetCellArrayInternal(tag)->GetCellAtId(tag.GetCellId(), npts, pts, ptIds);
+    std::copy(pts, pts + npts, connectivity->WritePointer(offset, npts));
+    offsets->SetValue(i + 1, offset + npts);
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 {
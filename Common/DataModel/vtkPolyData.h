@@ -109,6 +109,13 @@ public:
    */
   void GetCellPoints(vtkIdType cellId, vtkIdList* ptIds) override;
 
+  /**
+   * Get the types and the points of a range of cells, copied from the cell
+   * arrays of the polydata. See vtkDataSet::GetCellRange().
+   */
+  void GetCellRange(vtkIdType beginCellId, vtkIdType endCellId, vtkUnsignedCharArray* types,
+    vtkIdTypeArray* offsets, vtkIdTypeArray* connectivity) override;
+
   /**
    * Efficient method to obtain cells using a particular point. Make sure that
    * routine BuildLinks() has been called.
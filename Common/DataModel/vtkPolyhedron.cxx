@@ -18,11 +18,13 @@
 #include "vtkPointLocator.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkPolyhedronTopology.h"
 #include "vtkQuad.h"
 #include "vtkTetra.h"
 #include "vtkTriangle.h"
 #include "vtkVector.h"
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <map>
@@ -272,6 +274,39 @@ void vtkPolyhedron::Initialize()
   this->LocatorConstructed = 0;
 }
 
+//------------------------------------------------------------------------------
+void vtkPolyhedron::SetCanonicalTopology(vtkPolyhedronTopology* topology, vtkIdType cellId)
+{
+  vtkIdType numFaces;
+  const vtkIdType* faceOffsets;
+  const vtkIdType* faceConn;
+  topology->GetCellFaces(cellId, numFaces, faceOffsets, faceConn);
+  if (numFaces == 0)
+  {
+    return;
+  }
+
+  // The faces are already in canonical space: just copy them.
+  this->Faces->Reset();
+  this->Faces->AllocateExact(numFaces, faceOffsets[numFaces] - faceOffsets[0]);
+  for (vtkIdType fid = 0; fid < numFaces; ++fid)
+  {
+    this->Faces->InsertNextCell(faceOffsets[fid + 1] - faceOffsets[fid], faceConn + faceOffsets[fid]);
+  }
+  this->FacesGenerated = 1;
+
+  // Same for the edges; the edge table is not needed once they are known.
+  vtkIdType numEdges;
+  const vtkIdType* edges;
+  const vtkIdType* edgeFaces;
+  topology->GetCellEdges(cellId, numEdges, edges, edgeFaces);
+  this->Edges->SetNumberOfTuples(numEdges);
+  this->EdgeFaces->SetNumberOfTuples(numEdges);
+  std::copy(edges, edges + 2 * numEdges, this->Edges->GetPointer(0));
+  std::copy(edgeFaces, edgeFaces + 2 * numEdges, this->EdgeFaces->GetPointer(0));
+  this->EdgesGenerated = 1;
+}
+
 //------------------------------------------------------------------------------
 int vtkPolyhedron::GetNumberOfEdges()
 {
@@ -784,9 +819,11 @@ bool vtkPolyhedron::IsConvex()
   this->ComputeBounds();
 
   // loop over all edges in the polyhedron
-  this->EdgeTable->InitTraversal();
-  while ((edgeId = this->EdgeTable->GetNextEdge(w[0], w[1])) >= 0)
+  vtkIdType numEdges = this->Edges->GetNumberOfTuples();
+  for (edgeId = 0; edgeId < numEdges; ++edgeId)
   {
+    this->Edges->GetTypedTuple(edgeId, w);
+
     // get the edge points
     this->Points->GetPoint(w[0], x[0]);
     this->Points->GetPoint(w[1], x[1]);
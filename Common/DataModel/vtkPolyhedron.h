@@ -138,6 +138,7 @@ class vtkPolyData;
 class vtkCellLocator;
 class vtkGenericCell;
 class vtkPointLocator;
+class vtkPolyhedronTopology;
 class vtkMinimalStandardRandomSequence;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkPolyhedron : public vtkCell3D
@@ -221,6 +222,16 @@ public:
    */
   void Initialize() override;
 
+  /**
+   * Copy the canonical faces and edges of the polyhedron from a precomputed
+   * vtkPolyhedronTopology instead of generating them from the global faces
+   * when they are first needed. This method must be called after Initialize(),
+   * with the topology of the grid the cell with id cellId was loaded from.
+   * vtkUnstructuredGrid::GetCell() does it when the grid has an up to date
+   * topology (see vtkUnstructuredGrid::BuildPolyhedronTopology()).
+   */
+  void SetCanonicalTopology(vtkPolyhedronTopology* topology, vtkIdType cellId);
+
   ///@{
   /**
    * A polyhedron is represented internally by a set of polygonal faces.
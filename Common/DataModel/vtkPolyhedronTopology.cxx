@@ -0,0 +1,312 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPolyhedronTopology.h"
+
+#include "vtkCellArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkPolyhedronTopology);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Compute the canonical faces and edges of one cell the same way
+// vtkPolyhedron::GenerateFaces() and vtkPolyhedron::GenerateEdges() do,
+// reusing the buffers from one cell to the next.
+struct CellTopology
+{
+  // Use of an edge by a face, in the order the faces are traversed.
+  struct EdgeUse
+  {
+    vtkIdType Low;
+    vtkIdType High;
+    vtkIdType Sequence;
+    vtkIdType Face;
+    vtkIdType Points[2];
+  };
+
+  // Created on first use so that the thread local copies do not share them.
+  vtkSmartPointer<vtkIdList> PointIds;
+  vtkSmartPointer<vtkIdList> FaceIds;
+  vtkSmartPointer<vtkIdList> FacePointIds;
+
+  std::vector<std::pair<vtkIdType, vtkIdType>> PointMap;
+  std::vector<EdgeUse> Uses;
+  std::vector<EdgeUse> UniqueEdges;
+
+  std::vector<vtkIdType> FaceSizes;
+  std::vector<vtkIdType> FaceConnectivity;
+  std::vector<vtkIdType> Edges;
+  std::vector<vtkIdType> EdgeFaces;
+
+  // Same as vtkPolyhedron::PointIdMap: the last index of a point id, 0 if the
+  // point is not in the cell.
+  vtkIdType GetCanonicalId(vtkIdType pointId) const
+  {
+    auto it = std::upper_bound(this->PointMap.begin(), this->PointMap.end(), pointId,
+      [](vtkIdType id, const std::pair<vtkIdType, vtkIdType>& entry) { return id < entry.first; });
+    if (it == this->PointMap.begin() || (--it)->first != pointId)
+    {
+      return 0;
+    }
+    return it->second;
+  }
+
+  void Compute(vtkIdType cellId, vtkCellArray* connectivity, vtkCellArray* faces,
+    vtkCellArray* faceLocations)
+  {
+    this->FaceSizes.clear();
+    this->FaceConnectivity.clear();
+    this->Edges.clear();
+    this->EdgeFaces.clear();
+    if (cellId >= faceLocations->GetNumberOfCells() || faceLocations->GetCellSize(cellId) == 0)
+    {
+      return;
+    }
+    if (!this->PointIds)
+    {
+      this->PointIds = vtkSmartPointer<vtkIdList>::New();
+      this->FaceIds = vtkSmartPointer<vtkIdList>::New();
+      this->FacePointIds = vtkSmartPointer<vtkIdList>::New();
+    }
+
+    vtkIdType npts;
+    const vtkIdType* pts;
+    connectivity->GetCellAtId(cellId, npts, pts, this->PointIds);
+    this->PointMap.resize(npts);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      this->PointMap[i] = std::make_pair(pts[i], i);
+    }
+    std::sort(this->PointMap.begin(), this->PointMap.end());
+
+    vtkIdType nfaces;
+    const vtkIdType* faceIds;
+    faceLocations->GetCellAtId(cellId, nfaces, faceIds, this->FaceIds);
+    this->Uses.clear();
+    for (vtkIdType fid = 0; fid < nfaces; ++fid)
+    {
+      vtkIdType nfacePts;
+      const vtkIdType* facePts;
+      faces->GetCellAtId(faceIds[fid], nfacePts, facePts, this->FacePointIds);
+      this->FaceSizes.push_back(nfacePts);
+      const std::size_t faceBegin = this->FaceConnectivity.size();
+      for (vtkIdType i = 0; i < nfacePts; ++i)
+      {
+        this->FaceConnectivity.push_back(this->GetCanonicalId(facePts[i]));
+      }
+      for (vtkIdType i = 0; i < nfacePts; ++i)
+      {
+        EdgeUse use;
+        use.Points[0] = this->FaceConnectivity[faceBegin + i];
+        use.Points[1] = this->FaceConnectivity[faceBegin + (i + 1 != nfacePts ? i + 1 : 0)];
+        use.Low = std::min(use.Points[0], use.Points[1]);
+        use.High = std::max(use.Points[0], use.Points[1]);
+        use.Sequence = static_cast<vtkIdType>(this->Uses.size());
+        use.Face = fid;
+        this->Uses.push_back(use);
+      }
+    }
+
+    // Group the uses of each edge. Like vtkEdgeTable, edges are unoriented; the
+    // first use defines the edge and its first face, and the last other use its
+    // second face.
+    std::sort(this->Uses.begin(), this->Uses.end(),
+      [](const EdgeUse& a, const EdgeUse& b)
+      {
+        return a.Low < b.Low || (a.Low == b.Low && (a.High < b.High ||
+                                                     (a.High == b.High && a.Sequence < b.Sequence)));
+      });
+    this->UniqueEdges.clear();
+    for (std::size_t i = 0; i < this->Uses.size();)
+    {
+      std::size_t last = i;
+      while (last + 1 < this->Uses.size() && this->Uses[last + 1].Low == this->Uses[i].Low &&
+        this->Uses[last + 1].High == this->Uses[i].High)
+      {
+        ++last;
+      }
+      EdgeUse edge = this->Uses[i];
+      // The High member now holds the second face.
+      edge.High = last != i ? this->Uses[last].Face : -1;
+      this->UniqueEdges.push_back(edge);
+      i = last + 1;
+    }
+    std::sort(this->UniqueEdges.begin(), this->UniqueEdges.end(),
+      [](const EdgeUse& a, const EdgeUse& b) { return a.Sequence < b.Sequence; });
+    for (const EdgeUse& edge : this->UniqueEdges)
+    {
+      this->Edges.push_back(edge.Points[0]);
+      this->Edges.push_back(edge.Points[1]);
+      this->EdgeFaces.push_back(edge.Face);
+      this->EdgeFaces.push_back(edge.High);
+    }
+  }
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+vtkPolyhedronTopology::vtkPolyhedronTopology()
+{
+  this->Edges->SetNumberOfComponents(2);
+  this->EdgeFaces->SetNumberOfComponents(2);
+}
+
+//------------------------------------------------------------------------------
+vtkPolyhedronTopology::~vtkPolyhedronTopology() = default;
+
+//------------------------------------------------------------------------------
+// The cells are processed twice: a first pass counts the faces, face points
+// and edges of each cell, and once the offsets are known a second pass writes
+// them. Both passes run in parallel.
+void vtkPolyhedronTopology::Build(
+  vtkCellArray* connectivity, vtkCellArray* faces, vtkCellArray* faceLocations)
+{
+  this->Connectivity = connectivity;
+  this->Faces = faces;
+  this->FaceLocations = faceLocations;
+
+  const vtkIdType numCells = connectivity ? connectivity->GetNumberOfCells() : 0;
+  this->CellFaceOffsets->SetNumberOfValues(numCells + 1);
+  this->CellEdgeOffsets->SetNumberOfValues(numCells + 1);
+  vtkIdType* cellFaceOffsets = this->CellFaceOffsets->GetPointer(0);
+  vtkIdType* cellEdgeOffsets = this->CellEdgeOffsets->GetPointer(0);
+  std::vector<vtkIdType> cellConnOffsets(numCells + 1);
+  cellFaceOffsets[0] = cellEdgeOffsets[0] = cellConnOffsets[0] = 0;
+
+  if (numCells == 0 || !faces || !faceLocations)
+  {
+    std::fill_n(cellFaceOffsets, numCells + 1, 0);
+    std::fill_n(cellEdgeOffsets, numCells + 1, 0);
+    this->FaceOffsets->SetNumberOfValues(1);
+    this->FaceOffsets->SetValue(0, 0);
+    this->FaceConnectivity->SetNumberOfValues(0);
+    this->Edges->SetNumberOfTuples(0);
+    this->EdgeFaces->SetNumberOfTuples(0);
+    this->BuildTime.Modified();
+    return;
+  }
+
+  vtkSMPThreadLocal<CellTopology> localTopology;
+  vtkSMPTools::For(0, numCells,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      CellTopology& topology = localTopology.Local();
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        topology.Compute(cellId, connectivity, faces, faceLocations);
+        cellFaceOffsets[cellId + 1] = static_cast<vtkIdType>(topology.FaceSizes.size());
+        cellConnOffsets[cellId + 1] = static_cast<vtkIdType>(topology.FaceConnectivity.size());
+        cellEdgeOffsets[cellId + 1] = static_cast<vtkIdType>(topology.Edges.size() / 2);
+      }
+    });
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    cellFaceOffsets[cellId + 1] += cellFaceOffsets[cellId];
+    cellConnOffsets[cellId + 1] += cellConnOffsets[cellId];
+    cellEdgeOffsets[cellId + 1] += cellEdgeOffsets[cellId];
+  }
+
+  this->FaceOffsets->SetNumberOfValues(cellFaceOffsets[numCells] + 1);
+  this->FaceConnectivity->SetNumberOfValues(cellConnOffsets[numCells]);
+  this->Edges->SetNumberOfTuples(cellEdgeOffsets[numCells]);
+  this->EdgeFaces->SetNumberOfTuples(cellEdgeOffsets[numCells]);
+  vtkIdType* faceOffsets = this->FaceOffsets->GetPointer(0);
+  vtkIdType* faceConn = this->FaceConnectivity->GetPointer(0);
+  vtkIdType* edges = this->Edges->GetPointer(0);
+  vtkIdType* edgeFaces = this->EdgeFaces->GetPointer(0);
+  faceOffsets[cellFaceOffsets[numCells]] = cellConnOffsets[numCells];
+
+  vtkSMPTools::For(0, numCells,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      CellTopology& topology = localTopology.Local();
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        if (cellFaceOffsets[cellId] == cellFaceOffsets[cellId + 1])
+        {
+          continue;
+        }
+        topology.Compute(cellId, connectivity, faces, faceLocations);
+        vtkIdType offset = cellConnOffsets[cellId];
+        vtkIdType* cellFaces = faceOffsets + cellFaceOffsets[cellId];
+        for (std::size_t fid = 0; fid < topology.FaceSizes.size(); ++fid)
+        {
+          cellFaces[fid] = offset;
+          offset += topology.FaceSizes[fid];
+        }
+        std::copy(topology.FaceConnectivity.begin(), topology.FaceConnectivity.end(),
+          faceConn + cellConnOffsets[cellId]);
+        std::copy(topology.Edges.begin(), topology.Edges.end(), edges + 2 * cellEdgeOffsets[cellId]);
+        std::copy(topology.EdgeFaces.begin(), topology.EdgeFaces.end(),
+          edgeFaces + 2 * cellEdgeOffsets[cellId]);
+      }
+    });
+
+  this->BuildTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+bool vtkPolyhedronTopology::IsValid(
+  vtkCellArray* connectivity, vtkCellArray* faces, vtkCellArray* faceLocations)
+{
+  return connectivity && connectivity == this->Connectivity && faces == this->Faces &&
+    faceLocations == this->FaceLocations &&
+    this->GetNumberOfCells() == connectivity->GetNumberOfCells() &&
+    connectivity->GetMTime() <= this->BuildTime && (!faces || faces->GetMTime() <= this->BuildTime) &&
+    (!faceLocations || faceLocations->GetMTime() <= this->BuildTime);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkPolyhedronTopology::GetNumberOfCells()
+{
+  return this->CellFaceOffsets->GetNumberOfValues() - 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkPolyhedronTopology::GetCellFaces(vtkIdType cellId, vtkIdType& numFaces,
+  const vtkIdType*& faceOffsets, const vtkIdType*& faceConnectivity)
+{
+  const vtkIdType* cellFaceOffsets = this->CellFaceOffsets->GetPointer(0);
+  numFaces = cellFaceOffsets[cellId + 1] - cellFaceOffsets[cellId];
+  faceOffsets = this->FaceOffsets->GetPointer(cellFaceOffsets[cellId]);
+  faceConnectivity = this->FaceConnectivity->GetPointer(0);
+}
+
+//------------------------------------------------------------------------------
+void vtkPolyhedronTopology::GetCellEdges(
+  vtkIdType cellId, vtkIdType& numEdges, const vtkIdType*& edges, const vtkIdType*& edgeFaces)
+{
+  const vtkIdType* cellEdgeOffsets = this->CellEdgeOffsets->GetPointer(0);
+  numEdges = cellEdgeOffsets[cellId + 1] - cellEdgeOffsets[cellId];
+  edges = this->Edges->GetPointer(2 * cellEdgeOffsets[cellId]);
+  edgeFaces = this->EdgeFaces->GetPointer(2 * cellEdgeOffsets[cellId]);
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkPolyhedronTopology::GetActualMemorySize()
+{
+  return this->CellFaceOffsets->GetActualMemorySize() + this->FaceOffsets->GetActualMemorySize() +
+    this->FaceConnectivity->GetActualMemorySize() + this->CellEdgeOffsets->GetActualMemorySize() +
+    this->Edges->GetActualMemorySize() + this->EdgeFaces->GetActualMemorySize();
+}
+
+//------------------------------------------------------------------------------
+void vtkPolyhedronTopology::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Number Of Cells: " << this->GetNumberOfCells() << "\n";
+  os << indent << "Number Of Faces: " << this->FaceOffsets->GetNumberOfValues() - 1 << "\n";
+  os << indent << "Number Of Edges: " << this->Edges->GetNumberOfTuples() << "\n";
+}
+VTK_ABI_NAMESPACE_END
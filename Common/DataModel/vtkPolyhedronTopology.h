@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPolyhedronTopology
+ * @brief   canonical faces and edges of all the polyhedra of an unstructured grid
+ *
+ * vtkPolyhedron works with canonical point ids, i.e. the index of the points
+ * in the cell. Each time a polyhedron is loaded with
+ * vtkUnstructuredGrid::GetCell(), it maps the global point ids of its faces to
+ * canonical ids and inserts its edges in a vtkEdgeTable. On meshes made of
+ * polyhedra this dominates the cost of contouring or clipping.
+ *
+ * vtkPolyhedronTopology does this work once for all the polyhedra of a grid,
+ * in parallel, and stores the result in flat offset arrays: the canonical
+ * faces of each cell, and its edges with the two faces they bound, in the
+ * order vtkPolyhedron generates them. vtkPolyhedron::SetCanonicalTopology()
+ * then copies a cell from these arrays instead of generating it.
+ *
+ * The topology is built with vtkUnstructuredGrid::BuildPolyhedronTopology()
+ * and shared by the shallow copies of the grid. It is not modified once
+ * built, so cells can be loaded from several threads.
+ *
+ * @sa
+ * vtkPolyhedron vtkUnstructuredGrid
+ */
+
+#ifndef vtkPolyhedronTopology_h
+#define vtkPolyhedronTopology_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkNew.h"                   // For vtkNew
+#include "vtkObject.h"
+#include "vtkSmartPointer.h" // For vtkSmartPointer
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkCellArray;
+class vtkIdTypeArray;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkPolyhedronTopology : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, type information, and printing.
+   */
+  static vtkPolyhedronTopology* New();
+  vtkTypeMacro(vtkPolyhedronTopology, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  /**
+   * Build the topology of the polyhedra described by the given cell arrays,
+   * laid out as in vtkUnstructuredGrid: connectivity holds the points of each
+   * cell, faceLocations the ids of the faces of each cell (no face for the
+   * cells that are not polyhedra), and faces the points of each face.
+   */
+  void Build(vtkCellArray* connectivity, vtkCellArray* faces, vtkCellArray* faceLocations);
+
+  /**
+   * Return true if the topology was built from these arrays and they have not
+   * been modified since.
+   */
+  bool IsValid(vtkCellArray* connectivity, vtkCellArray* faces, vtkCellArray* faceLocations);
+
+  /**
+   * Return the number of cells the topology was built for.
+   */
+  vtkIdType GetNumberOfCells();
+
+  /**
+   * Get the canonical faces of a cell. Face i is made of the points
+   * faceConnectivity[faceOffsets[i]] to faceConnectivity[faceOffsets[i + 1] - 1].
+   * numFaces is 0 for the cells that are not polyhedra.
+   */
+  void GetCellFaces(vtkIdType cellId, vtkIdType& numFaces, const vtkIdType*& faceOffsets,
+    const vtkIdType*& faceConnectivity);
+
+  /**
+   * Get the canonical edges of a cell as numEdges pairs of point ids, and the
+   * cell faces on each side of them (-1 when the edge bounds only one face).
+   */
+  void GetCellEdges(
+    vtkIdType cellId, vtkIdType& numEdges, const vtkIdType*& edges, const vtkIdType*& edgeFaces);
+
+  /**
+   * Return the memory used by the topology in kibibytes.
+   */
+  unsigned long GetActualMemorySize();
+
+protected:
+  vtkPolyhedronTopology();
+  ~vtkPolyhedronTopology() override;
+
+  // Offsets of the faces of each cell in FaceOffsets, and offsets of each face
+  // in FaceConnectivity.
+  vtkNew<vtkIdTypeArray> CellFaceOffsets;
+  vtkNew<vtkIdTypeArray> FaceOffsets;
+  vtkNew<vtkIdTypeArray> FaceConnectivity;
+
+  // Offsets of the edges of each cell, edge point pairs and edge face pairs.
+  vtkNew<vtkIdTypeArray> CellEdgeOffsets;
+  vtkNew<vtkIdTypeArray> Edges;
+  vtkNew<vtkIdTypeArray> EdgeFaces;
+
+  // The arrays the topology was built from.
+  vtkSmartPointer<vtkCellArray> Connectivity;
+  vtkSmartPointer<vtkCellArray> Faces;
+  vtkSmartPointer<vtkCellArray> FaceLocations;
+  vtkTimeStamp BuildTime;
+
+private:
+  vtkPolyhedronTopology(const vtkPolyhedronTopology&) = delete;
+  void operator=(const vtkPolyhedronTopology&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -440,6 +440,15 @@ void vtkRectilinearGrid::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
   this->StructuredCells->GetCellAtId(cellId, ptIds);
 }
 
+//------------------------------------------------------------------------------
+void vtkRectilinearGrid::GetCellRange(vtkIdType beginCellId, vtkIdType endCellId,
+  vtkUnsignedCharArray* types, vtkIdTypeArray* offsets, vtkIdTypeArray* connectivity)
+{
+  vtkStructuredData::GetCellRange(this->StructuredCells, this->StructuredCellTypes, beginCellId,
+    endCellId, this->Dimensions, this->DataDescription, this->GetCellGhostArray(),
+    this->GetPointGhostArray(), types, offsets, connectivity);
+}
+
 //------------------------------------------------------------------------------
 void vtkRectilinearGrid::ComputeBounds()
 {
@@ -30,6 +30,20 @@ double vtkSphere::EvaluateFunction(double x[3])
     this->Radius * this->Radius);
 }
 
+//------------------------------------------------------------------------------
+// Evaluate sphere equation for a batch of points.
+void vtkSphere::EvaluateFunctionBatch(
+  vtkIdType n, const double* x, const double* y, const double* z, double* values)
+{
+  const double c0 = this->Center[0], c1 = this->Center[1], c2 = this->Center[2];
+  const double r2 = this->Radius * this->Radius;
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    const double d0 = x[i] - c0, d1 = y[i] - c1, d2 = z[i] - c2;
+    values[i] = (d0 * d0 + d1 * d1 + d2 * d2) - r2;
+  }
+}
+
 //------------------------------------------------------------------------------
 // Evaluate sphere gradient.
 void vtkSphere::EvaluateGradient(double x[3], double n[3])
@@ -9,10 +9,13 @@
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
 #include "vtkExplicitStructuredGrid.h"
+#include "vtkIdList.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <atomic>
 #include <type_traits>
 #include <vector>
@@ -81,6 +84,94 @@ void vtkStaticCellLinksTemplate<TIds>::Initialize()
   }
 }
 
+VTK_ABI_NAMESPACE_END
+
+namespace vtkSCLT_detail
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+//----------------------------------------------------------------------------
+// Prefix sum of the number of uses of each point: offsets[ptId] is set to the
+// sum of the counts of the points before ptId, and the total is returned.
+// Large point sets are split into blocks that are summed in parallel, then
+// shifted by the sum of the blocks before them.
+template <typename TIds>
+vtkIdType ComputeOffsets(const std::atomic<TIds>* counts, TIds* offsets, vtkIdType numPts)
+{
+  constexpr vtkIdType blockSize = 65536;
+  const vtkIdType numBlocks = (numPts + blockSize - 1) / blockSize;
+  std::vector<vtkIdType> blockOffsets(numBlocks + 1, 0);
+
+  // memory_order_relaxed is safe here, since we're not using the atomics for synchronization.
+  vtkSMPTools::For(0, numBlocks,
+    [&](vtkIdType block, vtkIdType endBlock)
+    {
+      for (; block < endBlock; ++block)
+      {
+        const vtkIdType endPtId = std::min(numPts, (block + 1) * blockSize);
+        vtkIdType sum = 0;
+        for (vtkIdType ptId = block * blockSize; ptId < endPtId; ++ptId)
+        {
+          sum += counts[ptId].load(std::memory_order_relaxed);
+        }
+        blockOffsets[block + 1] = sum;
+      }
+    });
+  for (vtkIdType block = 0; block < numBlocks; ++block)
+  {
+    blockOffsets[block + 1] += blockOffsets[block];
+  }
+  vtkSMPTools::For(0, numBlocks,
+    [&](vtkIdType block, vtkIdType endBlock)
+    {
+      for (; block < endBlock; ++block)
+      {
+        const vtkIdType endPtId = std::min(numPts, (block + 1) * blockSize);
+        vtkIdType offset = blockOffsets[block];
+        for (vtkIdType ptId = block * blockSize; ptId < endPtId; ++ptId)
+        {
+          offsets[ptId] = static_cast<TIds>(offset);
+          offset += counts[ptId].load(std::memory_order_relaxed);
+        }
+      }
+    });
+  return blockOffsets[numBlocks];
+}
+
+//----------------------------------------------------------------------------
+// Sort the cell links of each point (if needed) to ensure deterministic order.
+template <typename TIds>
+struct SortLinks
+{
+  const TIds* Offsets;
+  TIds* Links;
+
+  SortLinks(const TIds* offsets, TIds* links)
+    : Offsets(offsets)
+    , Links(links)
+  {
+  }
+
+  void operator()(vtkIdType beginPointId, vtkIdType endPointId)
+  {
+    for (vtkIdType pointId = beginPointId; pointId < endPointId; ++pointId)
+    {
+      // check if the links are sorted, because that's the most common case
+      const bool isSorted = std::is_sorted(
+        this->Links + this->Offsets[pointId], this->Links + this->Offsets[pointId + 1]);
+      // if the links are not sorted, we need to sort them
+      if (!isSorted)
+      {
+        std::sort(this->Links + this->Offsets[pointId], this->Links + this->Offsets[pointId + 1]);
+      }
+    }
+  }
+};
+
+VTK_ABI_NAMESPACE_END
+} // end namespace vtkSCLT_detail
+
+VTK_ABI_NAMESPACE_BEGIN
 //----------------------------------------------------------------------------
 // Build the link list array for any dataset type. Specialized methods are
 // used for dataset types that use vtkCellArrays to represent cells.
@@ -110,32 +201,36 @@ void vtkStaticCellLinksTemplate<TIds>::BuildLinks(vtkDataSet* ds)
   this->NumCells = ds->GetNumberOfCells();
   this->NumPts = ds->GetNumberOfPoints();
 
-  // Traverse data to determine number of uses of each point. Also count the
-  // number of links to allocate.
-  std::vector<TIds> counts(static_cast<size_t>(this->NumPts));
-
+  // GetCellPoints() is thread safe once it has been called from a single
+  // thread.
   vtkNew<vtkIdList> cellPts;
-  this->LinksSize = 0;
-  for (vtkIdType cellId = 0; cellId < this->NumCells; cellId++)
+  if (this->NumCells > 0)
   {
-    ds->GetCellPoints(cellId, cellPts);
-    vtkIdType npts = cellPts->GetNumberOfIds();
-    for (vtkIdType j = 0; j < npts; j++)
-    {
-      counts[cellPts->GetId(j)]++;
-      this->LinksSize++;
-    }
+    ds->GetCellPoints(0, cellPts);
   }
 
+  // Traverse data to determine number of uses of each point. Also count the
+  // number of links to allocate.
+  std::atomic<TIds>* counts = new std::atomic<TIds>[this->NumPts]();
+  vtkSMPThreadLocalObject<vtkIdList> tlCellPts;
+  vtkSMPTools::For(0, this->NumCells,
+    [&](vtkIdType cellId, vtkIdType endCellId)
+    {
+      vtkIdList* ids = tlCellPts.Local();
+      for (; cellId < endCellId; ++cellId)
+      {
+        ds->GetCellPoints(cellId, ids);
+        for (vtkIdType j = 0; j < ids->GetNumberOfIds(); ++j)
+        {
+          counts[ids->GetId(j)].fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    });
+
   // Perform prefix sum to determine offsets
   this->OffsetsSharedPtr.reset(new TIds[this->NumPts + 1], std::default_delete<TIds[]>());
   this->Offsets = this->OffsetsSharedPtr.get();
-  this->Offsets[0] = 0;
-  for (vtkIdType ptId = 1; ptId < this->NumPts; ++ptId)
-  {
-    const TIds& nCells = counts[ptId - 1];
-    this->Offsets[ptId] = this->Offsets[ptId - 1] + nCells;
-  }
+  this->LinksSize = vtkSCLT_detail::ComputeOffsets(counts, this->Offsets, this->NumPts);
   this->Offsets[this->NumPts] = this->LinksSize;
 
   // Allocate links array, Extra one allocated to simplify later pointer manipulation
@@ -147,18 +242,28 @@ void vtkStaticCellLinksTemplate<TIds>::BuildLinks(vtkDataSet* ds)
   // the cells are to be inserted. Each time a cell is inserted, the offset
   // is decremented. In the end, the offset array is also constructed as it
   // points to the beginning of each cell run.
-  for (vtkIdType cellId = 0; cellId < this->NumCells; ++cellId)
-  {
-    ds->GetCellPoints(cellId, cellPts);
-    vtkIdType npts = cellPts->GetNumberOfIds();
-    for (vtkIdType j = 0; j < npts; ++j)
+  vtkSMPTools::For(0, this->NumCells,
+    [&](vtkIdType cellId, vtkIdType endCellId)
     {
-      vtkIdType ptId = cellPts->GetId(j);
-      const TIds offset = this->Offsets[ptId + 1] - counts[ptId]--;
-      this->Links[offset] = cellId;
-    }
-  }
-  this->Offsets[this->NumPts] = this->LinksSize;
+      vtkIdList* ids = tlCellPts.Local();
+      for (; cellId < endCellId; ++cellId)
+      {
+        ds->GetCellPoints(cellId, ids);
+        for (vtkIdType j = 0; j < ids->GetNumberOfIds(); ++j)
+        {
+          const vtkIdType ptId = ids->GetId(j);
+          const TIds offset =
+            this->Offsets[ptId + 1] - counts[ptId].fetch_sub(1, std::memory_order_relaxed);
+          this->Links[offset] = static_cast<TIds>(cellId);
+        }
+      }
+    });
+  delete[] counts;
+
+  // The threads insert the cells in any order: sort the links of each point
+  // so that they do not depend on the scheduling.
+  vtkSCLT_detail::SortLinks<TIds> sortLinks(this->Offsets, this->Links);
+  vtkSMPTools::For(0, this->NumPts, sortLinks);
 }
 VTK_ABI_NAMESPACE_END
 
@@ -168,6 +273,8 @@ VTK_ABI_NAMESPACE_BEGIN
 
 struct CountPoints
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT, typename TIds>
   void operator()(
     CellStateT& state, std::atomic<TIds>* counts, vtkIdType beginCellId, vtkIdType endCellId)
@@ -188,24 +295,24 @@ struct CountPoints
 
 struct BuildLinks
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT, typename TIds>
   void operator()(CellStateT& state, const TIds* offsets, std::atomic<TIds>* counts, TIds* links,
     vtkIdType beginCellId, vtkIdType endCellId, const TIds idOffset = 0)
   {
-    using ValueType = typename CellStateT::ValueType;
-
     const auto cellConnectivity = vtk::DataArrayValueRange<1>(state.GetConnectivity());
-    const auto cellOffsets = vtk::DataArrayValueRange<1>(state.GetOffsets());
     // Now build the links. The summation from the prefix sum indicates where
     // the cells are to be inserted. Each time a cell is inserted, the offset
     // is decremented. In the end, the offset array is also constructed as it
     // points to the beginning of each cell run.
-    ValueType ptIdOffset;
+    vtkIdType ptIdOffset, endOffset;
     size_t ptId;
     TIds offset;
     for (vtkIdType cellId = beginCellId; cellId < endCellId; ++cellId)
     {
-      for (ptIdOffset = cellOffsets[cellId]; ptIdOffset < cellOffsets[cellId + 1]; ++ptIdOffset)
+      endOffset = state.GetEndOffset(cellId);
+      for (ptIdOffset = state.GetBeginOffset(cellId); ptIdOffset < endOffset; ++ptIdOffset)
       {
         ptId = static_cast<size_t>(cellConnectivity[ptIdOffset]);
         // memory_order_relaxed is safe here, since we're not using the atomics for synchronization.
@@ -269,34 +376,6 @@ struct InsertLinks
   }
 };
 
-template <typename TIds>
-struct SortLinks
-{
-  const TIds* Offsets;
-  TIds* Links;
-
-  SortLinks(const TIds* offsets, TIds* links)
-    : Offsets(offsets)
-    , Links(links)
-  {
-  }
-
-  void operator()(vtkIdType beginPointId, vtkIdType endPointId)
-  {
-    for (vtkIdType pointId = beginPointId; pointId < endPointId; ++pointId)
-    {
-      // check if the links are sorted, because that's the most common case
-      const bool isSorted = std::is_sorted(
-        this->Links + this->Offsets[pointId], this->Links + this->Offsets[pointId + 1]);
-      // if the links are not sorted, we need to sort them
-      if (!isSorted)
-      {
-        std::sort(this->Links + this->Offsets[pointId], this->Links + this->Offsets[pointId + 1]);
-      }
-    }
-  }
-};
-
 } // anonymous
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -336,12 +415,7 @@ void vtkStaticCellLinksTemplate<TIds>::BuildLinksFromMultipleArrays(
   // Perform prefix sum to determine offsets
   this->OffsetsSharedPtr.reset(new TIds[numPts + 1], std::default_delete<TIds[]>());
   this->Offsets = this->OffsetsSharedPtr.get();
-  this->Offsets[0] = 0;
-  for (vtkIdType ptId = 1; ptId < numPts; ++ptId)
-  {
-    TIds nCells = counts[ptId - 1].load(std::memory_order_relaxed);
-    this->Offsets[ptId] = this->Offsets[ptId - 1] + nCells;
-  }
+  vtkSCLT_detail::ComputeOffsets(counts, this->Offsets, numPts);
   this->Offsets[numPts] = this->LinksSize;
 
   // Allocate links array, Extra one allocated to simplify later pointer manipulation
@@ -360,7 +434,7 @@ void vtkStaticCellLinksTemplate<TIds>::BuildLinksFromMultipleArrays(
   delete[] counts;
 
   // Sort the cell links of each point (if needed) to ensure deterministic order
-  SortLinks<TIds> sortLinks(this->Offsets, this->Links);
+  vtkSCLT_detail::SortLinks<TIds> sortLinks(this->Offsets, this->Links);
   vtkSMPTools::For(0, numPts, sortLinks);
 }
 
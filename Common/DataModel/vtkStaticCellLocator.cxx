@@ -15,9 +15,12 @@
 #include "vtkPlane.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
 #include "vtkSMPTools.h"
 
+#include <algorithm>
 #include <array>
+#include <limits>
 #include <queue>
 #include <vector>
 
@@ -53,6 +56,12 @@ vtkStandardNewMacro(vtkStaticCellLocator);
 // fragment count, a templated class of either int or vtkIdType is
 // created. Different types are used because of 1) significant reduction in
 // memory and 2) significant speed up in the parallel sort.
+//
+// When the data set deforms (IncrementalUpdate), the bin grid is kept: the
+// cell bounds are recomputed, the cells whose range of bins changed are
+// flagged, and a new sorted tuple array is assembled bin by bin from the
+// kept tuples of the unflagged cells and the (sorted) new tuples of the
+// flagged cells. This avoids sorting all the tuples again.
 
 //========================= CELL LOCATOR MACHINERY ====================================
 
@@ -77,6 +86,12 @@ struct vtkCellBinner
   double fX, fY, fZ, bX, bY, bZ;
   vtkIdType xD, yD, zD, xyD;
 
+  // Locator parameters used to build the bins, an incremental update is only
+  // possible if they did not change.
+  vtkTypeBool Automatic;
+  int NumberOfCellsPerNode;
+  vtkIdType MaxNumberOfBuckets;
+
   vtkCellBinner() = default;
 
   // Construction
@@ -117,6 +132,10 @@ struct vtkCellBinner
     this->yD = this->Divisions[1];
     this->zD = this->Divisions[2];
     this->xyD = this->Divisions[0] * this->Divisions[1];
+
+    this->Automatic = loc->GetAutomatic();
+    this->NumberOfCellsPerNode = loc->GetNumberOfCellsPerNode();
+    this->MaxNumberOfBuckets = loc->GetMaxNumberOfBuckets();
   }
 
   ~vtkCellBinner()
@@ -158,6 +177,15 @@ struct vtkCellBinner
 
   vtkIdType GetBinIndex(int ijk[3]) const { return ijk[0] + ijk[1] * xD + ijk[2] * xyD; }
 
+  // Given the bounds of a cell, determine the range of bins it overlaps.
+  void GetBinRange(const double bds[6], int ijkMin[3], int ijkMax[3]) const
+  {
+    const double xmin[3] = { bds[0], bds[2], bds[4] };
+    const double xmax[3] = { bds[1], bds[3], bds[5] };
+    this->GetBinIndices(xmin, ijkMin);
+    this->GetBinIndices(xmax, ijkMax);
+  }
+
   // These are helper functions
   vtkIdType CountBins(const int ijkMin[3], const int ijkMax[3])
   {
@@ -285,6 +313,11 @@ struct vtkCellProcessor
 
   // Convenience for computing
   virtual int IsEmpty(vtkIdType binId) = 0;
+
+  // Refit the bins to the cells of a modified data set with the same number
+  // of cells. Returns false if more than threshold of the cells changed bins,
+  // in which case the locator is left unchanged and must be rebuilt.
+  virtual bool Refit(vtkDataSet* ds, double threshold, vtkIdType& numRebinned) = 0;
 };
 
 namespace
@@ -365,6 +398,7 @@ struct CellProcessor : public vtkCellProcessor
   {
     return (this->GetNumberOfIds(static_cast<T>(binId)) > 0 ? 0 : 1);
   }
+  bool Refit(vtkDataSet* ds, double threshold, vtkIdType& numRebinned) override;
 
   // This functor is used to perform the final cell binning
   void Initialize() {}
@@ -478,6 +512,59 @@ struct MapOffsets
 
 }; // MapOffsets
 
+// This functor recomputes the bounds of the cells of a modified data set, and
+// flags the cells which now overlap a different range of bins.
+struct CellRefitter
+{
+  const vtkCellBinner* Binner;
+  vtkDataSet* DataSet;
+  const double* OldBounds;
+  double* NewBounds;
+  unsigned char* Moved;
+  vtkSMPThreadLocal<vtkIdType> LocalNumberOfMovedCells;
+  vtkIdType NumberOfMovedCells;
+
+  CellRefitter(const vtkCellBinner* binner, vtkDataSet* ds, const double* oldBounds,
+    double* newBounds, unsigned char* moved)
+    : Binner(binner)
+    , DataSet(ds)
+    , OldBounds(oldBounds)
+    , NewBounds(newBounds)
+    , Moved(moved)
+    , NumberOfMovedCells(0)
+  {
+  }
+
+  void Initialize() { this->LocalNumberOfMovedCells.Local() = 0; }
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    vtkIdType& numMoved = this->LocalNumberOfMovedCells.Local();
+    const double* oldBds = this->OldBounds + 6 * cellId;
+    double* bds = this->NewBounds + 6 * cellId;
+    int oldMin[3], oldMax[3], ijkMin[3], ijkMax[3];
+
+    for (; cellId < endCellId; ++cellId, oldBds += 6, bds += 6)
+    {
+      this->DataSet->GetCellBounds(cellId, bds);
+      this->Binner->GetBinRange(oldBds, oldMin, oldMax);
+      this->Binner->GetBinRange(bds, ijkMin, ijkMax);
+      const bool moved =
+        !std::equal(ijkMin, ijkMin + 3, oldMin) || !std::equal(ijkMax, ijkMax + 3, oldMax);
+      this->Moved[cellId] = moved ? 1 : 0;
+      numMoved += moved ? 1 : 0;
+    }
+  }
+
+  void Reduce()
+  {
+    for (vtkIdType numMoved : this->LocalNumberOfMovedCells)
+    {
+      this->NumberOfMovedCells += numMoved;
+    }
+  }
+}; // CellRefitter
+
 //------------------------------------------------------------------------------
 template <typename T>
 vtkIdType CellProcessor<T>::FindCell(
@@ -1313,6 +1400,156 @@ bool CellProcessor<T>::InsideCellBounds(const double x[3], vtkIdType cellId)
 {
   return CellProcessor::IsInBounds(this->CellBounds + 6 * cellId, x);
 }
+
+//------------------------------------------------------------------------------
+template <typename T>
+bool CellProcessor<T>::Refit(vtkDataSet* ds, double threshold, vtkIdType& numRebinned)
+{
+  const vtkIdType numCells = this->NumCells;
+  const vtkIdType numBins = this->NumBins;
+  vtkCellBinner* binner = this->Binner;
+
+  // Recompute the cell bounds in a new array, since the current one may be
+  // shared with shallow copies of the locator. The first call causes non
+  // thread safe initialization to occur.
+  auto cellBounds = std::make_shared<std::vector<double>>(numCells * 6);
+  ds->GetCellBounds(0, cellBounds->data());
+  std::vector<unsigned char> moved(numCells);
+  CellRefitter refitter(binner, ds, this->CellBounds, cellBounds->data(), moved.data());
+  vtkSMPTools::For(0, numCells, refitter);
+  numRebinned = refitter.NumberOfMovedCells;
+  if (numRebinned > threshold * numCells)
+  {
+    return false;
+  }
+
+  if (numRebinned > 0)
+  {
+    // Create the sorted (cellId,binId) tuples of the moved cells.
+    std::vector<vtkIdType> movedCells;
+    movedCells.reserve(numRebinned);
+    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    {
+      if (moved[cellId])
+      {
+        movedCells.push_back(cellId);
+      }
+    }
+    std::vector<vtkIdType> movedOffsets(numRebinned + 1);
+    movedOffsets[0] = 0;
+    int ijkMin[3], ijkMax[3];
+    for (vtkIdType i = 0; i < numRebinned; ++i)
+    {
+      binner->GetBinRange(cellBounds->data() + 6 * movedCells[i], ijkMin, ijkMax);
+      movedOffsets[i + 1] = movedOffsets[i] + binner->CountBins(ijkMin, ijkMax);
+    }
+    std::vector<CellFragments<T>> movedMap(movedOffsets[numRebinned]);
+    vtkSMPTools::For(0, numRebinned,
+      [&](vtkIdType i, vtkIdType end)
+      {
+        int bMin[3], bMax[3];
+        for (; i < end; ++i)
+        {
+          const vtkIdType cellId = movedCells[i];
+          CellFragments<T>* t = movedMap.data() + movedOffsets[i];
+          binner->GetBinRange(cellBounds->data() + 6 * cellId, bMin, bMax);
+          for (int k = bMin[2]; k <= bMax[2]; ++k)
+          {
+            for (int j = bMin[1]; j <= bMax[1]; ++j)
+            {
+              for (int ii = bMin[0]; ii <= bMax[0]; ++ii, ++t)
+              {
+                t->CellId = static_cast<T>(cellId);
+                t->BinId = static_cast<T>(ii + j * this->xD + k * this->xyD);
+              }
+            }
+          }
+        }
+      });
+    vtkSMPTools::Sort(movedMap.begin(), movedMap.end());
+
+    // Range of the moved tuples falling in a bin.
+    auto movedRange = [&movedMap](vtkIdType binId)
+    {
+      auto begin = std::lower_bound(movedMap.begin(), movedMap.end(), binId,
+        [](const CellFragments<T>& t, vtkIdType id) { return t.BinId < id; });
+      auto end = std::lower_bound(begin, movedMap.end(), binId + 1,
+        [](const CellFragments<T>& t, vtkIdType id) { return t.BinId < id; });
+      return std::make_pair(begin, end);
+    };
+
+    // Count the tuples of each bin: the ones of the cells which did not move
+    // are kept, the ones of the moved cells are replaced.
+    std::vector<vtkIdType> binCounts(numBins);
+    vtkSMPTools::For(0, numBins,
+      [&](vtkIdType binId, vtkIdType endBinId)
+      {
+        for (; binId < endBinId; ++binId)
+        {
+          const CellFragments<T>* ids = this->GetIds(binId);
+          const T numIds = this->GetNumberOfIds(binId);
+          vtkIdType count = 0;
+          for (T i = 0; i < numIds; ++i)
+          {
+            count += moved[ids[i].CellId] ? 0 : 1;
+          }
+          auto range = movedRange(binId);
+          binCounts[binId] = count + (range.second - range.first);
+        }
+      });
+
+    auto offsets = std::make_shared<std::vector<T>>(numBins + 1);
+    vtkIdType numFragments = 0;
+    for (vtkIdType binId = 0; binId < numBins; ++binId)
+    {
+      (*offsets)[binId] = static_cast<T>(numFragments);
+      numFragments += binCounts[binId];
+    }
+    if (numFragments >= std::numeric_limits<T>::max())
+    {
+      // The tuples do not fit in the current id type anymore.
+      return false;
+    }
+    (*offsets)[numBins] = static_cast<T>(numFragments);
+
+    // Assemble the new tuples bin by bin.
+    auto map = std::make_shared<std::vector<CellFragments<T>>>(numFragments + 1);
+    (*map)[numFragments].BinId = static_cast<T>(numBins);
+    vtkSMPTools::For(0, numBins,
+      [&](vtkIdType binId, vtkIdType endBinId)
+      {
+        for (; binId < endBinId; ++binId)
+        {
+          CellFragments<T>* t = map->data() + (*offsets)[binId];
+          const CellFragments<T>* ids = this->GetIds(binId);
+          const T numIds = this->GetNumberOfIds(binId);
+          t = std::copy_if(ids, ids + numIds, t,
+            [&moved](const CellFragments<T>& id) { return !moved[id.CellId]; });
+          auto range = movedRange(binId);
+          std::copy(range.first, range.second, t);
+        }
+      });
+
+    this->MapSharedPtr = map;
+    this->Map = map->data();
+    this->OffsetsShardPtr = offsets;
+    this->Offsets = offsets->data();
+    this->NumFragments = numFragments;
+    this->NumBatches =
+      static_cast<int>(std::ceil(static_cast<double>(numFragments) / this->BatchSize));
+    // Note that the per-cell Counts of the binner are only used while
+    // building, they are not updated.
+    binner->NumFragments = numFragments;
+  }
+
+  binner->DataSet = ds;
+  binner->CellBoundsSharedPtr = cellBounds;
+  binner->CellBounds = cellBounds->data();
+  this->DataSet = ds;
+  this->CellBounds = binner->CellBounds;
+  this->MaxCellSize = static_cast<size_t>(ds->GetMaxCellSize());
+  return true;
+}
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -1453,7 +1690,75 @@ void vtkStaticCellLocator::BuildLocator()
     vtkDebugMacro(<< "BuildLocator exited - UseExistingSearchStructure");
     return;
   }
+  // refit the existing bins if possible
+  if (this->IncrementalUpdate && this->UpdateLocatorInternal())
+  {
+    this->BuildTime.Modified();
+    return;
+  }
+  this->BuildLocatorInternal();
+}
+
+//------------------------------------------------------------------------------
+bool vtkStaticCellLocator::RefitLocator()
+{
+  if (this->UpdateLocatorInternal())
+  {
+    this->BuildTime.Modified();
+    return true;
+  }
   this->BuildLocatorInternal();
+  return false;
+}
+
+//------------------------------------------------------------------------------
+bool vtkStaticCellLocator::UpdateLocatorInternal()
+{
+  vtkIdType numCells;
+  if (!this->Binner || !this->Processor || !this->DataSet ||
+    (numCells = this->DataSet->GetNumberOfCells()) < 1 || numCells != this->Binner->NumCells)
+  {
+    return false;
+  }
+
+  // The bins must have been built with the current parameters.
+  if (this->Automatic != this->Binner->Automatic)
+  {
+    return false;
+  }
+  if (this->Automatic)
+  {
+    if (this->NumberOfCellsPerNode != this->Binner->NumberOfCellsPerNode ||
+      this->MaxNumberOfBuckets != this->Binner->MaxNumberOfBuckets)
+    {
+      return false;
+    }
+  }
+  else if (!std::equal(this->Divisions, this->Divisions + 3, this->Binner->Divisions))
+  {
+    return false;
+  }
+
+  // Cells outside of the bins would be missed by the queries.
+  const double* bounds = this->DataSet->GetBounds();
+  for (int i = 0; i < 3; ++i)
+  {
+    if (bounds[2 * i] < this->Bounds[2 * i] || bounds[2 * i + 1] > this->Bounds[2 * i + 1])
+    {
+      vtkDebugMacro(<< "Data set left the locator bounds, rebuilding");
+      return false;
+    }
+  }
+
+  vtkIdType numRebinned;
+  if (!this->Processor->Refit(this->DataSet, this->RebuildThreshold, numRebinned))
+  {
+    vtkDebugMacro(<< numRebinned << " cells changed bins, rebuilding");
+    return false;
+  }
+  vtkDebugMacro(<< "Updated static cell locator, " << numRebinned << " cells rebinned");
+  this->NumberOfRebinnedCells = numRebinned;
+  return true;
 }
 
 //------------------------------------------------------------------------------
@@ -1475,6 +1780,7 @@ void vtkStaticCellLocator::BuildLocatorInternal()
 
   // Prepare
   this->FreeSearchStructure();
+  this->NumberOfRebinnedCells = -1;
 
   // The bounding box can be slow
   int i, ndivs[3];
@@ -1718,6 +2024,8 @@ void vtkStaticCellLocator::ShallowCopy(vtkAbstractCellLocator* locator)
   std::copy_n(cellLocator->Divisions, 3, this->Divisions);
   std::copy_n(cellLocator->H, 3, this->H);
   this->SetMaxNumberOfBuckets(cellLocator->GetMaxNumberOfBuckets());
+  this->SetIncrementalUpdate(cellLocator->GetIncrementalUpdate());
+  this->SetRebuildThreshold(cellLocator->GetRebuildThreshold());
   this->LargeIds = cellLocator->LargeIds;
   // copy binner
   this->Binner = new vtkCellBinner();
@@ -1748,6 +2056,9 @@ void vtkStaticCellLocator::ShallowCopy(vtkAbstractCellLocator* locator)
   this->Binner->yD = cellLocator->Binner->yD;
   this->Binner->zD = cellLocator->Binner->zD;
   this->Binner->xyD = cellLocator->Binner->xyD;
+  this->Binner->Automatic = cellLocator->Binner->Automatic;
+  this->Binner->NumberOfCellsPerNode = cellLocator->Binner->NumberOfCellsPerNode;
+  this->Binner->MaxNumberOfBuckets = cellLocator->Binner->MaxNumberOfBuckets;
   // copy processor
   if (this->LargeIds)
   {
@@ -1798,6 +2109,19 @@ void vtkStaticCellLocator::ShallowCopy(vtkAbstractCellLocator* locator)
   this->BuildTime.Modified();
 }
 
+//------------------------------------------------------------------------------
+void vtkStaticCellLocator::CopyParameters(vtkAbstractCellLocator* from)
+{
+  this->Superclass::CopyParameters(from);
+  if (auto locator = vtkStaticCellLocator::SafeDownCast(from))
+  {
+    this->SetDivisions(locator->GetDivisions());
+    this->SetMaxNumberOfBuckets(locator->GetMaxNumberOfBuckets());
+    this->SetIncrementalUpdate(locator->GetIncrementalUpdate());
+    this->SetRebuildThreshold(locator->GetRebuildThreshold());
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkStaticCellLocator::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -1808,5 +2132,8 @@ void vtkStaticCellLocator::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Max Number Of Buckets: " << this->MaxNumberOfBuckets << "\n";
 
   os << indent << "Large IDs: " << this->LargeIds << "\n";
+  os << indent << "Incremental Update: " << this->IncrementalUpdate << "\n";
+  os << indent << "Rebuild Threshold: " << this->RebuildThreshold << "\n";
+  os << indent << "Number Of Rebinned Cells: " << this->NumberOfRebinnedCells << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -13,6 +13,13 @@
  * threaded (via vtkSMPTools), and supports one-time static construction
  * (i.e., incremental cell insertion is not supported).
  *
+ * For deforming meshes, where points move but the number of cells stays the
+ * same, IncrementalUpdate can be enabled: when the data set is modified, the
+ * cell bounds are recomputed and only the cells that moved to other bins are
+ * rebinned, keeping the bin grid of the previous build. A full rebuild is
+ * done instead if the cells leave the bounds of the grid, or if more than
+ * RebuildThreshold of the cells moved to other bins.
+ *
  * @warning
  * vtkStaticCellLocator utilizes the following parent class parameters:
  * - Automatic                   (default true)
@@ -99,6 +106,36 @@ public:
    */
   bool GetLargeIds() { return this->LargeIds; }
 
+  ///@{
+  /**
+   * Enable incremental update of the locator when the data set is modified.
+   * The bins are then refit to the new cell bounds instead of being rebuilt
+   * from scratch, as long as the number of cells and the locator parameters
+   * did not change, and the cells stay within the bounds of the locator.
+   * BuildLocator() then refits the locator, see RefitLocator(). Default is
+   * false.
+   */
+  vtkSetMacro(IncrementalUpdate, bool);
+  vtkGetMacro(IncrementalUpdate, bool);
+  vtkBooleanMacro(IncrementalUpdate, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Set the fraction of cells which may move to other bins during an
+   * incremental update. If more cells move, the locator is rebuilt from
+   * scratch, which is faster than rebinning most of the cells. Default is 0.25.
+   */
+  vtkSetClampMacro(RebuildThreshold, double, 0.0, 1.0);
+  vtkGetMacro(RebuildThreshold, double);
+  ///@}
+
+  /**
+   * Return the number of cells moved to other bins by the last incremental
+   * update, or -1 if the locator was last built from scratch.
+   */
+  vtkGetMacro(NumberOfRebinnedCells, vtkIdType);
+
   // Reuse any superclass signatures that we don't override.
   using vtkAbstractCellLocator::FindCell;
   using vtkAbstractCellLocator::FindClosestPoint;
@@ -216,12 +253,33 @@ public:
    */
   void ShallowCopy(vtkAbstractCellLocator* locator) override;
 
+  /**
+   * Copy the parameters of another locator, see vtkAbstractCellLocator.
+   */
+  void CopyParameters(vtkAbstractCellLocator* from) override;
+
+  /**
+   * Refit the existing search structure to the cells of the modified data
+   * set, whether IncrementalUpdate is enabled or not. The locator is rebuilt
+   * from scratch instead when it cannot be refit, e.g. when there is no search
+   * structure, the number of cells or the locator parameters changed, the
+   * cells left the bounds of the locator, or more than RebuildThreshold of the
+   * cells moved to other bins. Returns true if the locator was refit.
+   */
+  bool RefitLocator();
+
 protected:
   vtkStaticCellLocator();
   ~vtkStaticCellLocator() override;
 
   void BuildLocatorInternal() override;
 
+  /**
+   * Refit the existing search structure to the modified data set. Returns
+   * false if the locator must be rebuilt from scratch instead.
+   */
+  bool UpdateLocatorInternal();
+
   double Bounds[6]; // Bounding box of the whole dataset
   int Divisions[3]; // Number of sub-divisions in x-y-z directions
   double H[3];      // Width of each bin in x-y-z directions
@@ -229,6 +287,10 @@ protected:
   vtkIdType MaxNumberOfBuckets; // Maximum number of buckets in locator
   bool LargeIds;                // indicate whether integer ids are small or large
 
+  bool IncrementalUpdate = false;       // refit the bins when the data set is modified
+  double RebuildThreshold = 0.25;       // fraction of rebinned cells triggering a rebuild
+  vtkIdType NumberOfRebinnedCells = -1; // cells rebinned by the last incremental update
+
   // Support PIMPLd implementation
   vtkCellBinner* Binner;       // Does the binning
   vtkCellProcessor* Processor; // Invokes methods (templated subclasses)
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkStaticFaceHashLinks.h"
+
+#include "vtkCellArray.h"
+#include "vtkObjectFactory.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkStaticFaceHashLinks);
+
+//------------------------------------------------------------------------------
+vtkStaticFaceHashLinks::vtkStaticFaceHashLinks()
+  : NumberOfPoints(0)
+  , NumberOfCells(0)
+{
+  this->Impl = new HashLinksType;
+}
+
+//------------------------------------------------------------------------------
+vtkStaticFaceHashLinks::~vtkStaticFaceHashLinks()
+{
+  delete this->Impl;
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticFaceHashLinks::BuildHashLinks(vtkUnstructuredGrid* input)
+{
+  this->Impl->Reset();
+  this->Connectivity = input->GetCells();
+  this->Types = input->GetCellTypesArray();
+  this->Faces = input->GetPolyhedronFaces();
+  this->FaceLocations = input->GetPolyhedronFaceLocations();
+  this->NumberOfPoints = input->GetNumberOfPoints();
+  this->NumberOfCells = input->GetNumberOfCells();
+  if (input->GetNumberOfCells() > 0)
+  {
+    this->Impl->BuildHashLinks(input);
+  }
+  this->BuildTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+bool vtkStaticFaceHashLinks::IsValid(vtkUnstructuredGrid* input)
+{
+  // The number of cells is checked as well since inserting cells does not
+  // modify the cell arrays.
+  if (!input || !this->Connectivity || input->GetCells() != this->Connectivity ||
+    input->GetCellTypesArray() != this->Types || input->GetPolyhedronFaces() != this->Faces ||
+    input->GetPolyhedronFaceLocations() != this->FaceLocations ||
+    input->GetNumberOfPoints() != this->NumberOfPoints ||
+    input->GetNumberOfCells() != this->NumberOfCells)
+  {
+    return false;
+  }
+  return this->Connectivity->GetMTime() <= this->BuildTime &&
+    (!this->Types || this->Types->GetMTime() <= this->BuildTime) &&
+    (!this->Faces || this->Faces->GetMTime() <= this->BuildTime) &&
+    (!this->FaceLocations || this->FaceLocations->GetMTime() <= this->BuildTime);
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkStaticFaceHashLinks::GetActualMemorySize()
+{
+  const vtkIdType numHashes = this->Impl->GetNumberOfHashes();
+  const double size =
+    static_cast<double>(this->Impl->GetNumberOfFaces()) * (sizeof(vtkIdType) + sizeof(vtkTypeInt32)) +
+    static_cast<double>(numHashes > 0 ? numHashes + 1 : 0) * sizeof(vtkIdType);
+  return static_cast<unsigned long>(std::ceil(size / 1024.0)); // kibibytes
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticFaceHashLinks::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Number Of Faces: " << this->Impl->GetNumberOfFaces() << "\n";
+  os << indent << "Number Of Hashes: " << this->Impl->GetNumberOfHashes() << "\n";
+}
+VTK_ABI_NAMESPACE_END
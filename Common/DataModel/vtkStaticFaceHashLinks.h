@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkStaticFaceHashLinks
+ * @brief   faces of an unstructured grid grouped by hash, shared by filters
+ *
+ * vtkStaticFaceHashLinks groups the faces of the cells of an unstructured
+ * grid by hash value: the smallest id of the points of the face for the
+ * faces of 3D cells, or the number of points of the grid for 0D, 1D and 2D
+ * cells. Faces with the same points share the same hash, which makes it
+ * cheap to find the faces shared by two cells, e.g. to extract the boundary
+ * of the grid.
+ *
+ * The links are usually built with vtkUnstructuredGrid::BuildFaceHashLinks(),
+ * which keeps them with the grid so that several filters processing the same
+ * grid (surface extraction with vtkGeometryFilter or vtkDataSetSurfaceFilter
+ * for instance) build them once. They are not modified once built, so they
+ * can be queried from several threads.
+ *
+ * @warning
+ * This is a wrappable version of vtkStaticFaceHashLinksTemplate, instantiated
+ * with vtkIdType cell ids and vtkTypeInt32 face ids so that it handles any
+ * grid, including polyhedra.
+ *
+ * @sa
+ * vtkStaticFaceHashLinksTemplate vtkUnstructuredGrid vtkGeometryFilter
+ */
+
+#ifndef vtkStaticFaceHashLinks_h
+#define vtkStaticFaceHashLinks_h
+
+#include "vtkCommonDataModelModule.h"       // For export macro
+#include "vtkObject.h"
+#include "vtkSmartPointer.h"                // For vtkSmartPointer
+#include "vtkStaticFaceHashLinksTemplate.h" // For implementation
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkCellArray;
+class vtkUnsignedCharArray;
+class vtkUnstructuredGrid;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkStaticFaceHashLinks : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, type information, and printing.
+   */
+  static vtkStaticFaceHashLinks* New();
+  vtkTypeMacro(vtkStaticFaceHashLinks, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  /**
+   * The templated class holding the links.
+   */
+  using HashLinksType = vtkStaticFaceHashLinksTemplate<vtkIdType, vtkTypeInt32>;
+
+  /**
+   * Build the hash links of the faces of the given grid.
+   */
+  void BuildHashLinks(vtkUnstructuredGrid* input);
+
+  /**
+   * Return true if the links were built from the cells of this grid and the
+   * cells have not been modified since.
+   */
+  bool IsValid(vtkUnstructuredGrid* input);
+
+  /**
+   * Get number of faces.
+   */
+  vtkIdType GetNumberOfFaces() { return this->Impl->GetNumberOfFaces(); }
+
+  /**
+   * Get the number of hashes.
+   */
+  vtkIdType GetNumberOfHashes() { return this->Impl->GetNumberOfHashes(); }
+
+  /**
+   * Get the number of faces in a particular hash.
+   */
+  vtkIdType GetNumberOfFacesInHash(vtkIdType hash)
+  {
+    return this->Impl->GetNumberOfFacesInHash(hash);
+  }
+
+  /**
+   * Get cell id of faces in a particular hash.
+   */
+  vtkIdType* GetCellIdOfFacesInHash(vtkIdType hash)
+  {
+    return this->Impl->GetCellIdOfFacesInHash(hash);
+  }
+
+  /**
+   * Get face id of faces in a particular hash.
+   */
+  VTK_WRAPEXCLUDE vtkTypeInt32* GetFaceIdOfFacesInHash(vtkIdType hash)
+  {
+    return this->Impl->GetFaceIdOfFacesInHash(hash);
+  }
+
+  /**
+   * Get the templated links, for the filters that are templated on them.
+   */
+  VTK_WRAPEXCLUDE const HashLinksType& GetHashLinks() { return *this->Impl; }
+
+  /**
+   * Return the memory used by the links in kibibytes.
+   */
+  unsigned long GetActualMemorySize();
+
+protected:
+  vtkStaticFaceHashLinks();
+  ~vtkStaticFaceHashLinks() override;
+
+  HashLinksType* Impl;
+
+  // The cells the links were built from.
+  vtkSmartPointer<vtkCellArray> Connectivity;
+  vtkSmartPointer<vtkUnsignedCharArray> Types;
+  vtkSmartPointer<vtkCellArray> Faces;
+  vtkSmartPointer<vtkCellArray> FaceLocations;
+  vtkIdType NumberOfPoints;
+  vtkIdType NumberOfCells;
+  vtkTimeStamp BuildTime;
+
+private:
+  vtkStaticFaceHashLinks(const vtkStaticFaceHashLinks&) = delete;
+  void operator=(const vtkStaticFaceHashLinks&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -132,13 +132,14 @@ struct vtkStaticFaceHashLinksTemplate<TInputIdType, TFaceIdType>::CreateFacesInf
 
   struct FaceInformationOperator
   {
+    static constexpr bool SupportsCompactStorage = true;
+
     template <typename CellStateT>
     void operator()(
       CellStateT& state, CreateFacesInformation* This, vtkIdType beginBatchId, vtkIdType endBatchId)
     {
       using ValueType = typename CellStateT::ValueType;
       const ValueType* connectivityPtr = state.GetConnectivity()->GetPointer(0);
-      const ValueType* offsetsPtr = state.GetOffsets()->GetPointer(0);
       const unsigned char* cellTypes = This->Input->GetCellTypesArray()->GetPointer(0);
 
       auto cell = This->TLCell.Local();
@@ -158,7 +159,7 @@ struct vtkStaticFaceHashLinksTemplate<TInputIdType, TFaceIdType>::CreateFacesInf
         {
           const unsigned char& cellType = cellTypes[cellId];
           // get cell points by just accessing the connectivity/offsets array
-          const ValueType* pts = connectivityPtr + offsetsPtr[cellId];
+          const ValueType* pts = connectivityPtr + state.GetBeginOffset(cellId);
 
           // the hash value of a face from a 3d cell is the minimum point id
           // the hash value of a face from a 0-1-2d cell is this->NumberOfPoints
@@ -6,6 +6,7 @@
 #include "vtkConstantArray.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
 #include "vtkStructuredCellArray.h"
@@ -628,6 +629,62 @@ bool vtkStructuredData::IsCellVisible(vtkIdType cellId, VTK_FUTURE_CONST int dim
 
   return true;
 }
+//------------------------------------------------------------------------------
+void vtkStructuredData::GetCellRange(vtkStructuredCellArray* cells,
+  vtkConstantArray<int>* cellTypes, vtkIdType beginCellId, vtkIdType endCellId,
+  VTK_FUTURE_CONST int dimensions[3], int dataDescription, vtkUnsignedCharArray* cellGhostArray,
+  vtkUnsignedCharArray* pointGhostArray, vtkUnsignedCharArray* types, vtkIdTypeArray* offsets,
+  vtkIdTypeArray* connectivity)
+{
+  const vtkIdType numCells = endCellId - beginCellId;
+  types->SetNumberOfTuples(numCells);
+  offsets->SetNumberOfTuples(numCells + 1);
+  offsets->SetValue(0, 0);
+  if (numCells <= 0)
+  {
+    connectivity->Reset();
+    return;
+  }
+
+  // All the cells have the same type and size, the hidden cells excepted.
+  const unsigned char cellType = static_cast<unsigned char>(cellTypes->GetValue(beginCellId));
+  connectivity->SetNumberOfTuples(numCells * cells->GetCellSize(beginCellId));
+  unsigned char* typesPtr = types->GetPointer(0);
+  vtkIdType* offsetsPtr = offsets->GetPointer(0);
+  vtkIdType* connPtr = connectivity->GetPointer(0);
+  const bool checkVisibility = cellGhostArray || pointGhostArray;
+  vtkIdType offset = 0;
+  for (vtkIdType i = 0; i < numCells; ++i)
+  {
+    const vtkIdType cellId = beginCellId + i;
+    if (checkVisibility &&
+      !vtkStructuredData::IsCellVisible(
+        cellId, dimensions, dataDescription, cellGhostArray, pointGhostArray))
+    {
+      typesPtr[i] = VTK_EMPTY_CELL;
+    }
+    else
+    {
+      typesPtr[i] = cellType;
+      vtkIdType npts;
+      cells->GetCellAtId(cellId, npts, connPtr + offset);
+      offset += npts;
+    }
+    offsetsPtr[i + 1] = offset;
+  }
+  if (offset < connectivity->GetNumberOfValues())
+  {
+    // Shrinking keeps the memory, unless the array becomes empty.
+    if (offset > 0)
+    {
+      connectivity->SetNumberOfTuples(offset);
+    }
+    else
+    {
+      connectivity->Reset();
+    }
+  }
+}
 
 //------------------------------------------------------------------------------
 void vtkStructuredData::GetCellNeighbors(
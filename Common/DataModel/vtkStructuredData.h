@@ -24,6 +24,7 @@
 VTK_ABI_NAMESPACE_BEGIN
 class vtkDataArray;
 class vtkIdList;
+class vtkIdTypeArray;
 class vtkPoints;
 class vtkStructuredCellArray;
 class vtkUnsignedCharArray;
@@ -122,6 +123,18 @@ public:
     int dataDescription, vtkUnsignedCharArray* cellGhostArray,
     vtkUnsignedCharArray* pointGhostArray = nullptr);
 
+  /**
+   * Get the types and the points of the cells beginCellId <= cellId <
+   * endCellId of a structured dataset with the given implicit cells and cell
+   * types, as described in vtkDataSet::GetCellRange(). The visibility of the
+   * cells is only checked if a ghost array is given.
+   */
+  static void GetCellRange(vtkStructuredCellArray* cells, vtkConstantArray<int>* cellTypes,
+    vtkIdType beginCellId, vtkIdType endCellId, VTK_FUTURE_CONST int dimensions[3],
+    int dataDescription, vtkUnsignedCharArray* cellGhostArray,
+    vtkUnsignedCharArray* pointGhostArray, vtkUnsignedCharArray* types, vtkIdTypeArray* offsets,
+    vtkIdTypeArray* connectivity);
+
   /**
    * Returns the cell dimensions, i.e., the number of cells along the i,j,k
    * for the grid with the given grid extent. Note, the grid extent is the
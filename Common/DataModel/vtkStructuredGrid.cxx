@@ -164,6 +164,15 @@ void vtkStructuredGrid::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
   this->StructuredCells->GetCellAtId(cellId, ptIds);
 }
 
+//------------------------------------------------------------------------------
+void vtkStructuredGrid::GetCellRange(vtkIdType beginCellId, vtkIdType endCellId,
+  vtkUnsignedCharArray* types, vtkIdTypeArray* offsets, vtkIdTypeArray* connectivity)
+{
+  vtkStructuredData::GetCellRange(this->StructuredCells, this->StructuredCellTypes, beginCellId,
+    endCellId, this->Dimensions, this->DataDescription, this->GetCellGhostArray(),
+    this->GetPointGhostArray(), types, offsets, connectivity);
+}
+
 namespace
 {
 class CellVisibility
@@ -16,13 +16,16 @@
 #include "vtkDoubleArray.h"
 #include "vtkGarbageCollector.h"
 #include "vtkGenericCell.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyhedron.h"
+#include "vtkPolyhedronTopology.h"
 #include "vtkStaticCellLinks.h"
+#include "vtkStaticFaceHashLinks.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGridCellIterator.h"
 
@@ -299,6 +302,8 @@ void vtkUnstructuredGrid::CopyStructure(vtkDataSet* ds)
   this->DistinctCellTypesUpdateMTime = 0;
   this->Faces = ug->Faces;
   this->FaceLocations = ug->FaceLocations;
+  this->PolyhedronTopology = ug->PolyhedronTopology;
+  this->FaceHashLinks = ug->FaceHashLinks;
 }
 
 //------------------------------------------------------------------------------
@@ -311,6 +316,8 @@ void vtkUnstructuredGrid::Cleanup()
   this->DistinctCellTypesUpdateMTime = 0;
   this->Faces = nullptr;
   this->FaceLocations = nullptr;
+  this->PolyhedronTopology = nullptr;
+  this->FaceHashLinks = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -368,6 +375,14 @@ void vtkUnstructuredGrid::GetCell(vtkIdType cellId, vtkGenericCell* cell)
   {
     cell->Initialize();
   }
+  if (cellType == VTK_POLYHEDRON)
+  {
+    if (vtkPolyhedronTopology* topology = this->GetPolyhedronTopology())
+    {
+      static_cast<vtkPolyhedron*>(cell->GetRepresentativeCell())
+        ->SetCanonicalTopology(topology, cellId);
+    }
+  }
   this->SetCellOrderAndRationalWeights(cellId, cell);
 }
 
@@ -377,6 +392,8 @@ namespace
 { // anonymous
 struct ComputeCellBoundsVisitor
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   // vtkCellArray::Visit entry point:
   template <typename CellStateT>
   void operator()(CellStateT& state, vtkPoints* points, vtkIdType cellId, double bounds[6]) const
@@ -1059,6 +1076,8 @@ void vtkUnstructuredGrid::SetCells(vtkUnsignedCharArray* cellTypes, vtkCellArray
   this->DistinctCellTypesUpdateMTime = 0;
   this->Faces = nullptr;
   this->FaceLocations = nullptr;
+  this->PolyhedronTopology = nullptr;
+  this->FaceHashLinks = nullptr;
   if (faceLocations != nullptr && faces != nullptr)
   {
     vtkIdType prepareSize = faceLocations->GetSize();
@@ -1110,6 +1129,8 @@ void vtkUnstructuredGrid::SetPolyhedralCells(vtkUnsignedCharArray* cellTypes, vt
   this->DistinctCellTypesUpdateMTime = 0;
   this->Faces = faces;
   this->FaceLocations = faceLocations;
+  this->PolyhedronTopology = nullptr;
+  this->FaceHashLinks = nullptr;
   this->LegacyFaces = nullptr;
   this->LegacyFaceLocations = nullptr;
 }
@@ -1144,6 +1165,65 @@ void vtkUnstructuredGrid::BuildLinks()
   this->Links->BuildLinks();
 }
 
+//------------------------------------------------------------------------------
+void vtkUnstructuredGrid::BuildPolyhedronTopology()
+{
+  if (!this->Connectivity || !this->Faces || !this->FaceLocations)
+  {
+    this->PolyhedronTopology = nullptr;
+    return;
+  }
+  if (this->GetPolyhedronTopology())
+  {
+    return;
+  }
+  // A new object is built rather than updating the current one in place,
+  // since it may be shared with shallow copies of this grid.
+  vtkNew<vtkPolyhedronTopology> topology;
+  topology->Build(this->Connectivity, this->Faces, this->FaceLocations);
+  this->PolyhedronTopology = topology;
+}
+
+//------------------------------------------------------------------------------
+vtkPolyhedronTopology* vtkUnstructuredGrid::GetPolyhedronTopology()
+{
+  if (this->PolyhedronTopology &&
+    this->PolyhedronTopology->IsValid(this->Connectivity, this->Faces, this->FaceLocations))
+  {
+    return this->PolyhedronTopology;
+  }
+  return nullptr;
+}
+
+//------------------------------------------------------------------------------
+void vtkUnstructuredGrid::BuildFaceHashLinks()
+{
+  if (!this->Connectivity || !this->Types)
+  {
+    this->FaceHashLinks = nullptr;
+    return;
+  }
+  if (this->GetFaceHashLinks())
+  {
+    return;
+  }
+  // A new object is built rather than updating the current one in place,
+  // since it may be shared with shallow copies of this grid.
+  vtkNew<vtkStaticFaceHashLinks> links;
+  links->BuildHashLinks(this);
+  this->FaceHashLinks = links;
+}
+
+//------------------------------------------------------------------------------
+vtkStaticFaceHashLinks* vtkUnstructuredGrid::GetFaceHashLinks()
+{
+  if (this->FaceHashLinks && this->FaceHashLinks->IsValid(this))
+  {
+    return this->FaceHashLinks;
+  }
+  return nullptr;
+}
+
 //------------------------------------------------------------------------------
 void vtkUnstructuredGrid::GetPointCells(vtkIdType ptId, vtkIdType& ncells, vtkIdType*& cells)
 {
@@ -1169,6 +1249,70 @@ void vtkUnstructuredGrid::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
   this->Connectivity->GetCellAtId(cellId, ptIds);
 }
 
+//------------------------------------------------------------------------------
+// Support GetCellRange()
+namespace
+{ // anonymous
+struct CopyCellRangeVisitor
+{
+  // Only uses the generic accessors of the states.
+  static constexpr bool SupportsCompactStorage = true;
+
+  // vtkCellArray::Visit entry point:
+  template <typename CellStateT>
+  void operator()(CellStateT& state, vtkIdType beginCellId, vtkIdType endCellId,
+    vtkIdTypeArray* offsets, vtkIdTypeArray* connectivity) const
+  {
+    const vtkIdType numCells = endCellId - beginCellId;
+    const vtkIdType beginOffset = state.GetBeginOffset(beginCellId);
+    const vtkIdType numIds = state.GetBeginOffset(endCellId) - beginOffset;
+
+    offsets->SetNumberOfTuples(numCells + 1);
+    vtkIdType* offsetsPtr = offsets->GetPointer(0);
+    for (vtkIdType i = 0; i <= numCells; ++i)
+    {
+      offsetsPtr[i] = state.GetBeginOffset(beginCellId + i) - beginOffset;
+    }
+
+    if (numIds > 0)
+    {
+      const auto cellPoints = state.GetConnectivity()->GetPointer(beginOffset);
+      connectivity->SetNumberOfTuples(numIds);
+      std::copy(cellPoints, cellPoints + numIds, connectivity->GetPointer(0));
+    }
+    else
+    {
+      connectivity->Reset();
+    }
+  }
+};
+} // anonymous
+
+//------------------------------------------------------------------------------
+// Copy the range of cells from the cell arrays, without any virtual call per
+// cell.
+void vtkUnstructuredGrid::GetCellRange(vtkIdType beginCellId, vtkIdType endCellId,
+  vtkUnsignedCharArray* types, vtkIdTypeArray* offsets, vtkIdTypeArray* connectivity)
+{
+  if (!this->Connectivity || !this->Types)
+  {
+    // No cells: the range can only be empty.
+    types->Reset();
+    offsets->SetNumberOfTuples(1);
+    offsets->SetValue(0, 0);
+    connectivity->Reset();
+    return;
+  }
+  const vtkIdType numCells = endCellId - beginCellId;
+  types->SetNumberOfTuples(numCells);
+  if (numCells > 0)
+  {
+    std::copy_n(this->Types->GetPointer(beginCellId), numCells, types->GetPointer(0));
+  }
+  this->Connectivity->Visit(
+    CopyCellRangeVisitor{}, beginCellId, endCellId, offsets, connectivity);
+}
+
 //------------------------------------------------------------------------------
 void vtkUnstructuredGrid::GetCellTypes(vtkCellTypes* types)
 {
@@ -1503,6 +1647,16 @@ unsigned long vtkUnstructuredGrid::GetActualMemorySize()
     size += this->Links->GetActualMemorySize();
   }
 
+  if (this->PolyhedronTopology)
+  {
+    size += this->PolyhedronTopology->GetActualMemorySize();
+  }
+
+  if (this->FaceHashLinks)
+  {
+    size += this->FaceHashLinks->GetActualMemorySize();
+  }
+
   if (this->Types)
   {
     size += this->Types->GetActualMemorySize();
@@ -1541,6 +1695,8 @@ void vtkUnstructuredGrid::ShallowCopy(vtkDataObject* dataObject)
     this->DistinctCellTypesUpdateMTime = 0;
     this->Faces = grid->Faces;
     this->FaceLocations = grid->FaceLocations;
+    this->PolyhedronTopology = grid->PolyhedronTopology;
+    this->FaceHashLinks = grid->FaceHashLinks;
 
     if (grid->Links)
     {
@@ -1708,6 +1864,8 @@ namespace
 template <class TLinks>
 struct IsCellBoundaryImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   // vtkCellArray::Visit entry point:
   template <typename CellStateT>
   bool operator()(CellStateT& state, TLinks* links, vtkIdType cellId, vtkIdType nPts,
@@ -1736,18 +1894,16 @@ struct IsCellBoundaryImpl
     // Now for each cell, see if it contains all the face points
     // in the facePts list. If so, then this is not a boundary face.
     const ValueType* connectivityPtr = state.GetConnectivity()->GetPointer(0);
-    const ValueType* offsetsPtr = state.GetOffsets()->GetPointer(0);
     bool match;
-    vtkIdType j;
-    ValueType k;
+    vtkIdType j, k;
     for (vtkIdType i = 0; i < minNumCells; ++i)
     {
       const auto& minCellId = minCells[i];
       if (minCellId != cellId) // don't include current cell
       {
         // get cell points
-        const ValueType nCellPts = offsetsPtr[minCellId + 1] - offsetsPtr[minCellId];
-        const ValueType* cellPts = connectivityPtr + offsetsPtr[minCellId];
+        const vtkIdType nCellPts = state.GetCellSize(minCellId);
+        const ValueType* cellPts = connectivityPtr + state.GetBeginOffset(minCellId);
         match = true;
         for (j = 0; j < nPts && match; ++j) // for all pts in input boundary entity
         {
@@ -1781,6 +1937,8 @@ struct IsCellBoundaryImpl
 template <class TLinks>
 struct GetCellNeighborsImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   // vtkCellArray::Visit entry point:
   template <typename CellStateT>
   void operator()(CellStateT& state, TLinks* links, vtkIdType cellId, vtkIdType nPts,
@@ -1807,18 +1965,16 @@ struct GetCellNeighborsImpl
     // Now for each cell, see if it contains all the face points
     // in the facePts list. If so, then this is not a boundary face.
     const ValueType* connectivityPtr = state.GetConnectivity()->GetPointer(0);
-    const ValueType* offsetsPtr = state.GetOffsets()->GetPointer(0);
     bool match;
-    vtkIdType j;
-    ValueType k;
+    vtkIdType j, k;
     for (vtkIdType i = 0; i < minNumCells; ++i)
     {
       const auto& minCellId = minCells[i];
       if (minCellId != cellId) // don't include current cell
       {
         // get cell points
-        const ValueType nCellPts = offsetsPtr[minCellId + 1] - offsetsPtr[minCellId];
-        const ValueType* cellPts = connectivityPtr + offsetsPtr[minCellId];
+        const vtkIdType nCellPts = state.GetCellSize(minCellId);
+        const ValueType* cellPts = connectivityPtr + state.GetBeginOffset(minCellId);
         match = true;
         for (j = 0; j < nPts && match; ++j) // for all pts in input boundary entity
         {
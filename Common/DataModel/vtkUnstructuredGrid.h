@@ -29,6 +29,8 @@ VTK_ABI_NAMESPACE_BEGIN
 class vtkCellArray;
 class vtkIdList;
 class vtkIdTypeArray;
+class vtkPolyhedronTopology;
+class vtkStaticFaceHashLinks;
 class vtkUnsignedCharArray;
 class vtkIdTypeArray;
 
@@ -185,6 +187,15 @@ public:
     this->Connectivity->GetCellAtId(cellId, npts, pts, ptIds);
   }
 
+  /**
+   * Get the types and the points of a range of cells, copied from the cell
+   * arrays of the grid. See vtkDataSet::GetCellRange().
+   *
+   * THIS METHOD IS THREAD SAFE
+   */
+  void GetCellRange(vtkIdType beginCellId, vtkIdType endCellId, vtkUnsignedCharArray* types,
+    vtkIdTypeArray* offsets, vtkIdTypeArray* connectivity) override;
+
   ///@{
   /**
    * Special (efficient) operation to return the list of cells using the
@@ -420,6 +431,42 @@ public:
   vtkCellArray* GetPolyhedronFaceLocations();
   ///@}
 
+  /**
+   * Build the canonical faces and edges of all the polyhedra of the grid, in
+   * parallel, so that GetCell() copies them into the vtkPolyhedron instead of
+   * generating them for each cell. This speeds up the filters processing many
+   * polyhedra, such as contouring or clipping. The topology is rebuilt only if
+   * the cells were modified since the last call, and is discarded when the
+   * cells are replaced. It does nothing if the grid has no polyhedron.
+   * Like BuildLinks(), call it again after editing the cells in place.
+   * @sa vtkPolyhedronTopology
+   */
+  void BuildPolyhedronTopology();
+
+  /**
+   * Return the topology built by BuildPolyhedronTopology() if it is up to
+   * date with the cells of the grid, nullptr otherwise.
+   */
+  vtkPolyhedronTopology* GetPolyhedronTopology();
+
+  /**
+   * Build the links grouping the faces of the cells by hash, in parallel, and
+   * keep them with the grid so that the filters extracting its boundary
+   * (vtkGeometryFilter, vtkDataSetSurfaceFilter) use them instead of building
+   * their own. This is useful when several such filters process the same
+   * grid. The links are rebuilt only if the cells were modified since the
+   * last call, are shared with the shallow copies of the grid, and are
+   * discarded when the cells are replaced.
+   * @sa vtkStaticFaceHashLinks
+   */
+  void BuildFaceHashLinks();
+
+  /**
+   * Return the links built by BuildFaceHashLinks() if they are up to date with
+   * the cells of the grid, nullptr otherwise.
+   */
+  vtkStaticFaceHashLinks* GetFaceHashLinks();
+
   /**
    * Special function used by vtkUnstructuredGridReader.
    * By default vtkUnstructuredGrid does not contain face information, which is
@@ -565,6 +612,12 @@ protected:
   vtkSmartPointer<vtkCellArray> Faces;
   vtkSmartPointer<vtkCellArray> FaceLocations;
 
+  // Canonical faces and edges of the polyhedra, see BuildPolyhedronTopology().
+  vtkSmartPointer<vtkPolyhedronTopology> PolyhedronTopology;
+
+  // Faces of the cells grouped by hash, see BuildFaceHashLinks().
+  vtkSmartPointer<vtkStaticFaceHashLinks> FaceHashLinks;
+
   // Legacy support -- stores the old-style cell array locations.
   vtkSmartPointer<vtkIdTypeArray> CellLocations;
 
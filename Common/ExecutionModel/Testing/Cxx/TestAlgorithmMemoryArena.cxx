@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that the outputs of an algorithm executed with UseMemoryArena are moved
+// out of the arena of the execution, so that its blocks are freed.
+
+#include "vtkArenaMemoryResource.h"
+#include "vtkDataArray.h"
+#include "vtkElevationFilter.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+
+#include <cstdlib>
+#include <iostream>
+
+int TestAlgorithmMemoryArena(int, char*[])
+{
+  vtkSmartPointer<vtkPolyData> output;
+  vtkSmartPointer<vtkArenaMemoryResource> arenas[2];
+  {
+    vtkNew<vtkSphereSource> sphere;
+    sphere->UseMemoryArenaOn();
+    vtkNew<vtkElevationFilter> elevation;
+    elevation->UseMemoryArenaOn();
+    elevation->SetInputConnection(sphere->GetOutputPort());
+    elevation->SetLowPoint(0.0, 0.0, -0.5);
+    elevation->SetHighPoint(0.0, 0.0, 0.5);
+    elevation->Update();
+
+    vtkAlgorithm* algorithms[2] = { sphere, elevation };
+    for (int i = 0; i < 2; ++i)
+    {
+      arenas[i] =
+        vtkArenaMemoryResource::SafeDownCast(algorithms[i]->GetExecutionMemoryResource());
+      if (!arenas[i] || arenas[i]->GetNumberOfAllocations() == 0 ||
+        arenas[i]->GetBytesInUse() != 0 || arenas[i]->GetArenaSize() != 0)
+      {
+        std::cerr << "Error: the arena of " << algorithms[i]->GetClassName()
+                  << " is still used by its output" << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+    output = elevation->GetPolyDataOutput();
+  }
+
+  // The output outlives the pipeline and its values are intact.
+  vtkDataArray* elevations = output->GetPointData()->GetArray("Elevation");
+  double range[2];
+  elevations->GetRange(range);
+  double bounds[6];
+  output->GetBounds(bounds);
+  if (output->GetNumberOfPoints() != 50 || output->GetNumberOfPolys() != 96 || range[0] != 0.0 ||
+    range[1] != 1.0 || bounds[5] != 0.5)
+  {
+    std::cerr << "Error: wrong output" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Arrays of the output that grow no longer use the arena.
+  output->GetPoints()->InsertNextPoint(0.0, 0.0, 2.0);
+  elevations->InsertNextTuple1(2.0);
+  if (arenas[0]->GetBytesInUse() != 0 || arenas[1]->GetBytesInUse() != 0)
+  {
+    std::cerr << "Error: the output still allocates from the arena" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
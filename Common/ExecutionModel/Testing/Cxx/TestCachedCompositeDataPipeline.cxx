@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that vtkCachedCompositeDataPipeline restores the outputs of previous
+// executions with the same parameters and inputs, and only those: by the
+// modification time of the algorithm, or by the state set by the application.
+
+#include "vtkCachedCompositeDataPipeline.h"
+#include "vtkDataArray.h"
+#include "vtkElevationFilter.h"
+#include "vtkInformation.h"
+#include "vtkInformationStringKey.h"
+#include "vtkNew.h"
+#include "vtkPipelineProfiler.h"
+#include "vtkPipelineResultCache.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// The profiler counts the executions, while the cache counts the hits of all
+// the executives sharing it.
+bool CheckExecutions(vtkPipelineProfiler* profiler, vtkAlgorithm* algorithm, vtkIdType executions,
+  vtkPipelineResultCache* cache, vtkIdType hits, const char* step)
+{
+  if (profiler->GetNumberOfRequests(algorithm) != executions || cache->GetNumberOfHits() != hits)
+  {
+    std::cerr << "Error: " << step << ": " << profiler->GetNumberOfRequests(algorithm)
+              << " executions and " << cache->GetNumberOfHits() << " cache hits instead of "
+              << executions << " and " << hits << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Set the parameter of the filter with the state describing it.
+void SetLowPoint(vtkElevationFilter* elevation, double z, const char* state)
+{
+  elevation->SetLowPoint(0.0, 0.0, z);
+  elevation->GetInformation()->Set(vtkCachedCompositeDataPipeline::ALGORITHM_STATE(), state);
+}
+}
+
+int TestCachedCompositeDataPipeline(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(32);
+  sphere->SetPhiResolution(32);
+  vtkNew<vtkElevationFilter> elevation;
+  vtkNew<vtkCachedCompositeDataPipeline> executive;
+  elevation->SetExecutive(executive);
+  elevation->SetInputConnection(sphere->GetOutputPort());
+  vtkSmartPointer<vtkPipelineResultCache> cache = executive->GetResultCache();
+
+  vtkNew<vtkPipelineProfiler> profiler;
+  profiler->Start();
+
+  // Without state, the outputs are keyed by the modification time of the algorithm.
+  elevation->SetLowPoint(0.0, 0.0, -0.5);
+  elevation->Update();
+  const double rangeA = elevation->GetOutput()->GetPointData()->GetScalars()->GetRange()[1];
+
+  // The source executes again, but produces the same data: its content is hashed.
+  sphere->Modified();
+  elevation->Update();
+  if (!CheckExecutions(profiler, elevation, 1, cache, 1, "same input content"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Any modification is a new state, even one that PrintSelf() does not show.
+  elevation->SetLowPoint(0.0, 0.0, -0.5 + 1e-9);
+  elevation->Update();
+  elevation->SetLowPoint(0.0, 0.0, -0.5);
+  elevation->Update();
+  if (!CheckExecutions(profiler, elevation, 3, cache, 1, "modified algorithm") ||
+    cache->GetNumberOfEntries() != 3)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // With a state, the outputs of a previous state are restored.
+  SetLowPoint(elevation, 0.0, "low 0");
+  elevation->Update();
+  SetLowPoint(elevation, -0.5, "low -0.5");
+  elevation->Update();
+  if (!CheckExecutions(profiler, elevation, 5, cache, 1, "distinct states"))
+  {
+    return EXIT_FAILURE;
+  }
+  SetLowPoint(elevation, 0.0, "low 0");
+  elevation->Update();
+  SetLowPoint(elevation, -0.5, "low -0.5");
+  elevation->Update();
+  if (!CheckExecutions(profiler, elevation, 5, cache, 3, "restored states"))
+  {
+    return EXIT_FAILURE;
+  }
+  vtkDataSet* output = elevation->GetOutput();
+  if (output->GetNumberOfPoints() != sphere->GetOutput()->GetNumberOfPoints() ||
+    !output->GetPointData()->GetScalars() ||
+    output->GetPointData()->GetScalars()->GetRange()[1] != rangeA ||
+    !output->GetInformation()->Has(vtkCachedCompositeDataPipeline::CACHE_KEY()))
+  {
+    std::cerr << "Error: wrong restored output" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A different input is a miss.
+  sphere->SetThetaResolution(16);
+  elevation->Update();
+  if (!CheckExecutions(profiler, elevation, 6, cache, 3, "different input") ||
+    cache->GetNumberOfEntries() != 6)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // A downstream cached executive uses the key of its input instead of hashing it.
+  vtkNew<vtkElevationFilter> downstream;
+  vtkNew<vtkCachedCompositeDataPipeline> downstreamExecutive;
+  downstreamExecutive->SetResultCache(cache);
+  downstreamExecutive->HashInputContentsOff();
+  downstream->SetExecutive(downstreamExecutive);
+  downstream->SetInputConnection(elevation->GetOutputPort());
+  downstream->Update();
+  SetLowPoint(elevation, 0.0, "low 0");
+  downstream->Update();
+  SetLowPoint(elevation, -0.5, "low -0.5");
+  downstream->Update();
+  if (!CheckExecutions(profiler, elevation, 7, cache, 5, "upstream executive") ||
+    !CheckExecutions(profiler, downstream, 2, cache, 5, "downstream executive") ||
+    cache->GetNumberOfEntries() != 9)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Entries that do not fit are discarded, the least recently used first.
+  const unsigned long entrySize = output->GetActualMemorySize();
+  cache->SetMemoryLimit(2 * entrySize + entrySize / 2);
+  if (cache->GetNumberOfEntries() != 2 || cache->GetMemorySize() > cache->GetMemoryLimit())
+  {
+    std::cerr << "Error: " << cache->GetNumberOfEntries() << " entries left of "
+              << cache->GetMemorySize() << " KiB" << std::endl;
+    return EXIT_FAILURE;
+  }
+  SetLowPoint(elevation, 0.0, "low 0");
+  elevation->Update();
+  if (!CheckExecutions(profiler, elevation, 8, cache, 5, "evicted entry"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The entries of an executive are removed with it.
+  downstream->Update();
+  downstreamExecutive->SetResultCache(nullptr);
+  if (cache->GetNumberOfEntries() != 1)
+  {
+    std::cerr << "Error: entries of the downstream executive not removed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Without cache, the executive behaves as vtkCompositeDataPipeline.
+  executive->SetResultCache(nullptr);
+  SetLowPoint(elevation, -0.5, "low -0.5");
+  elevation->Update();
+  SetLowPoint(elevation, 0.0, "low 0");
+  elevation->Update();
+  if (!CheckExecutions(profiler, elevation, 10, cache, 5, "no cache") ||
+    output->GetInformation()->Has(vtkCachedCompositeDataPipeline::CACHE_KEY()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  profiler->Stop();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that vtkConcurrentBranchPipeline updates the branches of its algorithm
+// concurrently, executing a shared producer once and the algorithms that do
+// not declare CAN_EXECUTE_CONCURRENTLY one at a time, also when the
+// algorithms run vtkSMPTools loops.
+
+#include "vtkAppendPolyData.h"
+#include "vtkConcurrentBranchPipeline.h"
+#include "vtkInformation.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPipelineProfiler.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSMPTools.h"
+#include "vtkSphereSource.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+std::atomic<int> Running(0);
+std::atomic<int> MaximumRunning(0);
+std::atomic<int> RunningNonConcurrent(0);
+std::atomic<int> MaximumRunningNonConcurrent(0);
+
+void UpdateMaximum(std::atomic<int>& maximum, int value)
+{
+  int current = maximum;
+  while (value > current && !maximum.compare_exchange_weak(current, value))
+  {
+  }
+}
+}
+
+// Pass the input through, slowly enough for the branches to overlap, with a
+// vtkSMPTools loop whose waiting threads may run other tasks.
+class vtkSlowPassFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkSlowPassFilter* New();
+  vtkTypeMacro(vtkSlowPassFilter, vtkPolyDataAlgorithm);
+
+  int NumberOfExecutions = 0;
+
+protected:
+  vtkSlowPassFilter() = default;
+  ~vtkSlowPassFilter() override = default;
+
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    const bool concurrent = this->GetInformation()->Get(CAN_EXECUTE_CONCURRENTLY()) != 0;
+    UpdateMaximum(MaximumRunning, ++Running);
+    if (!concurrent)
+    {
+      UpdateMaximum(MaximumRunningNonConcurrent, ++RunningNonConcurrent);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(25));
+    vtkSMPTools::For(0, 16, 1,
+      [](vtkIdType, vtkIdType) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+    if (!concurrent)
+    {
+      --RunningNonConcurrent;
+    }
+    --Running;
+
+    vtkPolyData::GetData(outputVector)->ShallowCopy(vtkPolyData::GetData(inputVector[0]));
+    ++this->NumberOfExecutions;
+    return 1;
+  }
+
+private:
+  vtkSlowPassFilter(const vtkSlowPassFilter&) = delete;
+  void operator=(const vtkSlowPassFilter&) = delete;
+};
+
+vtkStandardNewMacro(vtkSlowPassFilter);
+
+int TestConcurrentBranchPipeline(int, char*[])
+{
+  const int numberOfBranches = 4;
+  vtkNew<vtkSphereSource> sphere;
+  vtkNew<vtkAppendPolyData> append;
+  vtkNew<vtkConcurrentBranchPipeline> executive;
+  append->SetExecutive(executive);
+  vtkNew<vtkSlowPassFilter> filters[numberOfBranches];
+  for (auto& filter : filters)
+  {
+    filter->SetInputConnection(sphere->GetOutputPort());
+    append->AddInputConnection(filter->GetOutputPort());
+  }
+
+  vtkNew<vtkPipelineProfiler> profiler;
+  profiler->Start();
+
+  // Without declaration, the filters execute one at a time.
+  append->Update();
+  if (MaximumRunning != 1 || profiler->GetNumberOfRequests(sphere) != 1 ||
+    append->GetOutput()->GetNumberOfPoints() !=
+      numberOfBranches * sphere->GetOutput()->GetNumberOfPoints())
+  {
+    std::cerr << "Error: wrong update of non concurrent branches, " << MaximumRunning
+              << " filters running together" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Up to date branches do not execute.
+  append->Modified();
+  append->Update();
+  for (auto& filter : filters)
+  {
+    if (filter->NumberOfExecutions != 1)
+    {
+      std::cerr << "Error: filter executed " << filter->NumberOfExecutions << " times"
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Declared filters execute concurrently, the others still take turns.
+  for (int i = 0; i < numberOfBranches; ++i)
+  {
+    filters[i]->GetInformation()->Set(vtkAlgorithm::CAN_EXECUTE_CONCURRENTLY(), i % 2);
+  }
+  MaximumRunning = 0;
+  sphere->Modified();
+  append->Update();
+  if (MaximumRunningNonConcurrent != 1 || MaximumRunning < 2 ||
+    profiler->GetNumberOfRequests(sphere) != 2 || profiler->GetNumberOfRequests(append) != 3)
+  {
+    std::cerr << "Error: wrong update of concurrent branches, " << MaximumRunning
+              << " filters and " << MaximumRunningNonConcurrent
+              << " non concurrent filters running together" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (auto& filter : filters)
+  {
+    if (filter->NumberOfExecutions != 2)
+    {
+      std::cerr << "Error: filter executed " << filter->NumberOfExecutions << " times"
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  profiler->Stop();
+  return EXIT_SUCCESS;
+}
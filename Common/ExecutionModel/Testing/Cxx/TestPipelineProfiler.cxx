@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that vtkPipelineProfiler records the requests and cache hits of the
+// algorithms of a pipeline while it is active, and exports them.
+
+#include "vtkElevationFilter.h"
+#include "vtkNew.h"
+#include "vtkPipelineProfiler.h"
+#include "vtkSphereSource.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+int TestPipelineProfiler(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetObjectName("sphere \"source\"");
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(sphere->GetOutputPort());
+
+  vtkNew<vtkPipelineProfiler> profiler;
+  profiler->Start();
+  if (!profiler->IsActive() || vtkPipelineProfiler::GetActiveProfiler() != profiler.GetPointer())
+  {
+    std::cerr << "Error: profiler not active" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  elevation->Update();
+  if (profiler->GetNumberOfRequests(sphere) != 1 || profiler->GetNumberOfRequests(elevation) != 1 ||
+    profiler->GetNumberOfRequests(elevation, "RequestInformation") != 1 ||
+    profiler->GetNumberOfCacheHits(elevation) != 0)
+  {
+    std::cerr << "Error: wrong requests for the first update" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (profiler->GetOutputMemorySize(sphere) == 0 ||
+    profiler->GetOutputMemorySize(elevation) < profiler->GetOutputMemorySize(sphere) ||
+    profiler->GetWallTime(elevation) < 0.0 || profiler->GetCPUTime(elevation) < 0.0)
+  {
+    std::cerr << "Error: wrong measurements" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Nothing changed: the filter does not execute.
+  elevation->Update();
+  if (profiler->GetNumberOfRequests(elevation) != 1 ||
+    profiler->GetNumberOfCacheHits(elevation) != 1)
+  {
+    std::cerr << "Error: up to date filter not recorded as a cache hit" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Only the filter executes again.
+  elevation->SetLowPoint(0.0, 0.0, -0.5);
+  elevation->Update();
+  if (profiler->GetNumberOfRequests(sphere) != 1 || profiler->GetNumberOfRequests(elevation) != 2 ||
+    profiler->GetNumberOfCacheHits(sphere) != 1)
+  {
+    std::cerr << "Error: wrong requests for the update of the filter" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::ostringstream trace;
+  profiler->WriteChromeTrace(trace);
+  const std::string json = trace.str();
+  if (json.find("{\"traceEvents\":[") != 0 ||
+    json.find("\"cat\":\"RequestData\"") == std::string::npos ||
+    json.find("\"ph\":\"X\"") == std::string::npos ||
+    json.find("\"cat\":\"CacheHit\"") == std::string::npos ||
+    json.find("'sphere \\\"source\\\"'") == std::string::npos)
+  {
+    std::cerr << "Error: wrong Chrome trace:\n" << json << std::endl;
+    return EXIT_FAILURE;
+  }
+  profiler->PrintSummary(std::cout);
+
+  // Nothing is recorded once stopped.
+  profiler->Stop();
+  const vtkIdType numberOfEvents = profiler->GetNumberOfEvents();
+  sphere->Modified();
+  elevation->Update();
+  if (profiler->IsActive() || vtkPipelineProfiler::GetActiveProfiler() ||
+    profiler->GetNumberOfEvents() != numberOfEvents)
+  {
+    std::cerr << "Error: events recorded after stopping the profiler" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  profiler->Reset();
+  if (profiler->GetNumberOfEvents() != 0)
+  {
+    std::cerr << "Error: events not discarded" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
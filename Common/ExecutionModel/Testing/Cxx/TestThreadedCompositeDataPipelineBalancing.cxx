@@ -0,0 +1,261 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that vtkThreadedCompositeDataPipeline processes the blocks from the
+// most to the least expensive, using the block cost function when set, that
+// it batches the small blocks and enables nested parallelism for a block too
+// large to be balanced, and that the algorithms declaring
+// CAN_EXECUTE_BLOCKS_CONCURRENTLY get it by default when parallel block
+// execution is enabled.
+
+#include "vtkAlgorithm.h"
+#include "vtkDataSet.h"
+#include "vtkElevationFilter.h"
+#include "vtkInformation.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSMPTools.h"
+#include "vtkSphereSource.h"
+#include "vtkThreadedCompositeDataPipeline.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Pass the input through, recording the number of points of the blocks in
+// the order they are processed, and the SMP state while processing them.
+class vtkRecordBlocksFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkRecordBlocksFilter* New();
+  vtkTypeMacro(vtkRecordBlocksFilter, vtkPolyDataAlgorithm);
+
+  struct BlockState
+  {
+    std::thread::id Thread;
+    bool NestedParallelism;
+    int NumberOfThreads;
+  };
+
+  std::vector<vtkIdType> Blocks;
+  std::map<vtkIdType, BlockState> States;
+
+protected:
+  vtkRecordBlocksFilter()
+  {
+    this->GetInformation()->Set(vtkAlgorithm::CAN_EXECUTE_BLOCKS_CONCURRENTLY(), 1);
+  }
+  ~vtkRecordBlocksFilter() override = default;
+
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+    vtkPolyData::GetData(outputVector)->ShallowCopy(input);
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Blocks.push_back(input->GetNumberOfPoints());
+    this->States[input->GetNumberOfPoints()] = { std::this_thread::get_id(),
+      vtkSMPTools::GetNestedParallelism(), vtkSMPTools::GetEstimatedNumberOfThreads() };
+    return 1;
+  }
+
+private:
+  vtkRecordBlocksFilter(const vtkRecordBlocksFilter&) = delete;
+  void operator=(const vtkRecordBlocksFilter&) = delete;
+
+  std::mutex Mutex;
+};
+vtkStandardNewMacro(vtkRecordBlocksFilter);
+
+namespace
+{
+bool CheckOutput(vtkMultiBlockDataSet* input, vtkDataObject* output, const char* arrayName)
+{
+  vtkMultiBlockDataSet* blocks = vtkMultiBlockDataSet::SafeDownCast(output);
+  if (!blocks || blocks->GetNumberOfBlocks() != input->GetNumberOfBlocks())
+  {
+    return false;
+  }
+  for (unsigned int i = 0; i < input->GetNumberOfBlocks(); ++i)
+  {
+    vtkDataSet* inBlock = vtkDataSet::SafeDownCast(input->GetBlock(i));
+    vtkDataSet* outBlock = vtkDataSet::SafeDownCast(blocks->GetBlock(i));
+    if (!outBlock || outBlock->GetNumberOfPoints() != inBlock->GetNumberOfPoints() ||
+      (arrayName && !outBlock->GetPointData()->GetArray(arrayName)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestThreadedCompositeDataPipelineBalancing(int, char*[])
+{
+  // Small blocks, with a large one in the middle.
+  const unsigned int numberOfBlocks = 12;
+  const unsigned int largeBlock = 5;
+  vtkNew<vtkMultiBlockDataSet> input;
+  input->SetNumberOfBlocks(numberOfBlocks);
+  for (unsigned int i = 0; i < numberOfBlocks; ++i)
+  {
+    vtkNew<vtkSphereSource> sphere;
+    sphere->SetThetaResolution(i == largeBlock ? 128 : 4 + i);
+    sphere->SetPhiResolution(i == largeBlock ? 128 : 4);
+    sphere->Update();
+    input->SetBlock(i, sphere->GetOutput());
+  }
+  const vtkIdType largeSize =
+    vtkDataSet::SafeDownCast(input->GetBlock(largeBlock))->GetNumberOfPoints();
+
+  // The order is only deterministic with the sequential backend.
+  const std::string backend = vtkSMPTools::GetBackend();
+  vtkSMPTools::SetBackend("Sequential");
+
+  vtkNew<vtkThreadedCompositeDataPipeline> executive;
+  vtkNew<vtkRecordBlocksFilter> filter;
+  filter->SetExecutive(executive);
+  filter->SetInputDataObject(input);
+  filter->Update();
+  if (filter->Blocks.size() != numberOfBlocks || filter->Blocks[0] != largeSize ||
+    !CheckOutput(input, filter->GetOutputDataObject(0), nullptr))
+  {
+    std::cerr << "Error: the largest block is not processed first" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (size_t i = 1; i < filter->Blocks.size(); ++i)
+  {
+    if (filter->Blocks[i] > filter->Blocks[i - 1])
+    {
+      std::cerr << "Error: the blocks are not processed by decreasing cost" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // A cost function reversing the order.
+  int numberOfCalls = 0;
+  executive->SetBlockCostFunction(
+    [&numberOfCalls](vtkDataObject* block)
+    {
+      ++numberOfCalls;
+      return 1.0 / static_cast<double>(vtkDataSet::SafeDownCast(block)->GetNumberOfPoints());
+    });
+  filter->Blocks.clear();
+  filter->Modified();
+  filter->Update();
+  if (numberOfCalls != static_cast<int>(numberOfBlocks) ||
+    filter->Blocks.size() != numberOfBlocks || filter->Blocks.back() != largeSize ||
+    !CheckOutput(input, filter->GetOutputDataObject(0), nullptr))
+  {
+    std::cerr << "Error: the block cost function is not used" << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkSMPTools::SetBackend(backend.c_str());
+
+  // With several threads, the large block enables nested parallelism without
+  // changing the number of threads, and the configuration is restored after.
+  bool nestedChecked = true;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 4 },
+    [&]()
+    {
+      if (vtkSMPTools::GetEstimatedNumberOfThreads() != 4)
+      {
+        return;
+      }
+      executive->SetBlockCostFunction(nullptr);
+      filter->States.clear();
+      filter->Modified();
+      filter->Update();
+      const auto& large = filter->States[largeSize];
+      nestedChecked = large.NestedParallelism && large.NumberOfThreads == 4 &&
+        !vtkSMPTools::GetNestedParallelism() && vtkSMPTools::GetEstimatedNumberOfThreads() == 4 &&
+        CheckOutput(input, filter->GetOutputDataObject(0), nullptr);
+    });
+  if (!nestedChecked)
+  {
+    std::cerr << "Error: wrong nested parallelism for the large block" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Blocks of equal cost are processed in batches of a quarter of the average
+  // work of a thread, here 4 blocks, in their order, without nested parallelism.
+  const unsigned int numberOfEqualBlocks = 64;
+  vtkNew<vtkMultiBlockDataSet> equalInput;
+  equalInput->SetNumberOfBlocks(numberOfEqualBlocks);
+  for (unsigned int i = 0; i < numberOfEqualBlocks; ++i)
+  {
+    vtkNew<vtkSphereSource> sphere;
+    sphere->SetThetaResolution(4 + i);
+    sphere->SetPhiResolution(4);
+    sphere->Update();
+    equalInput->SetBlock(i, sphere->GetOutput());
+  }
+  bool batchesChecked = true;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 4 },
+    [&]()
+    {
+      if (vtkSMPTools::GetEstimatedNumberOfThreads() != 4)
+      {
+        return;
+      }
+      executive->SetBlockCostFunction([](vtkDataObject*) { return 1.0; });
+      filter->States.clear();
+      filter->SetInputDataObject(equalInput);
+      filter->Update();
+      if (filter->States.size() != numberOfEqualBlocks ||
+        !CheckOutput(equalInput, filter->GetOutputDataObject(0), nullptr))
+      {
+        batchesChecked = false;
+        return;
+      }
+      for (unsigned int i = 0; i < numberOfEqualBlocks; ++i)
+      {
+        const vtkIdType size =
+          vtkDataSet::SafeDownCast(equalInput->GetBlock(i))->GetNumberOfPoints();
+        const vtkIdType batchSize =
+          vtkDataSet::SafeDownCast(equalInput->GetBlock(i - i % 4))->GetNumberOfPoints();
+        if (filter->States[size].NestedParallelism ||
+          filter->States[size].Thread != filter->States[batchSize].Thread)
+        {
+          batchesChecked = false;
+        }
+      }
+    });
+  executive->SetBlockCostFunction(nullptr);
+  if (!batchesChecked)
+  {
+    std::cerr << "Error: the blocks of equal cost are not processed in batches" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Only the algorithms declaring it get a threaded executive by default.
+  vtkAlgorithm::SetDefaultParallelBlockExecution(true);
+  vtkNew<vtkElevationFilter> elevation;
+  vtkNew<vtkSphereSource> sphere;
+  const bool threaded = vtkThreadedCompositeDataPipeline::SafeDownCast(elevation->GetExecutive()) &&
+    !vtkThreadedCompositeDataPipeline::SafeDownCast(sphere->GetExecutive());
+  vtkAlgorithm::SetDefaultParallelBlockExecution(false);
+  if (!threaded)
+  {
+    std::cerr << "Error: wrong default executives" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  elevation->SetInputDataObject(input);
+  elevation->Update();
+  if (!CheckOutput(input, elevation->GetOutputDataObject(0), "Elevation"))
+  {
+    std::cerr << "Error: wrong output of the threaded elevation filter" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -25,12 +25,14 @@
 #include "vtkInformationStringVectorKey.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkMemoryResource.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkProgressObserver.h"
 #include "vtkSmartPointer.h"
 #include "vtkTable.h"
+#include "vtkThreadedCompositeDataPipeline.h"
 #include "vtkTrivialProducer.h"
 
 #include <set>
@@ -52,9 +54,12 @@ vtkInformationKeyMacro(vtkAlgorithm, INPUT_CONNECTION, Integer);
 vtkInformationKeyMacro(vtkAlgorithm, INPUT_ARRAYS_TO_PROCESS, InformationVector);
 vtkInformationKeyMacro(vtkAlgorithm, CAN_PRODUCE_SUB_EXTENT, Integer);
 vtkInformationKeyMacro(vtkAlgorithm, CAN_HANDLE_PIECE_REQUEST, Integer);
+vtkInformationKeyMacro(vtkAlgorithm, CAN_EXECUTE_CONCURRENTLY, Integer);
+vtkInformationKeyMacro(vtkAlgorithm, CAN_EXECUTE_BLOCKS_CONCURRENTLY, Integer);
 vtkInformationKeyMacro(vtkAlgorithm, ABORTED, Integer);
 
 vtkExecutive* vtkAlgorithm::DefaultExecutivePrototype = nullptr;
+bool vtkAlgorithm::DefaultParallelBlockExecution = false;
 vtkTimeStamp vtkAlgorithm::LastAbortTime;
 
 //------------------------------------------------------------------------------
@@ -85,6 +90,8 @@ vtkAlgorithm::vtkAlgorithm()
   this->ProgressText = nullptr;
   this->Executive = nullptr;
   this->ProgressObserver = nullptr;
+  this->UseMemoryArena = false;
+  this->ExecutionMemoryResource = nullptr;
   this->InputPortInformation = vtkInformationVector::New();
   this->OutputPortInformation = vtkInformationVector::New();
   this->AlgorithmInternal = new vtkAlgorithmInternals;
@@ -111,6 +118,7 @@ vtkAlgorithm::~vtkAlgorithm()
     this->ProgressObserver->UnRegister(this);
     this->ProgressObserver = nullptr;
   }
+  this->SetExecutionMemoryResource(nullptr);
   this->InputPortInformation->Delete();
   this->OutputPortInformation->Delete();
   delete this->AlgorithmInternal;
@@ -118,6 +126,25 @@ vtkAlgorithm::~vtkAlgorithm()
   this->ProgressText = nullptr;
 }
 
+//------------------------------------------------------------------------------
+void vtkAlgorithm::SetExecutionMemoryResource(vtkMemoryResource* resource)
+{
+  // Like SetProgressObserver, this does not modify the algorithm since it is
+  // set by executives during execution.
+  if (resource != this->ExecutionMemoryResource)
+  {
+    if (this->ExecutionMemoryResource)
+    {
+      this->ExecutionMemoryResource->UnRegister(this);
+    }
+    this->ExecutionMemoryResource = resource;
+    if (resource)
+    {
+      resource->Register(this);
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkAlgorithm::SetProgressObserver(vtkProgressObserver* po)
 {
@@ -740,6 +767,7 @@ void vtkAlgorithm::PrintSelf(ostream& os, vtkIndent indent)
   }
 
   os << indent << "ErrorCode: " << vtkErrorCode::GetStringFromErrorCode(this->ErrorCode) << endl;
+  os << indent << "UseMemoryArena: " << this->UseMemoryArena << "\n";
 
   if (this->Information)
   {
@@ -1044,9 +1072,26 @@ vtkExecutive* vtkAlgorithm::CreateDefaultExecutive()
   {
     return vtkAlgorithm::DefaultExecutivePrototype->NewInstance();
   }
+  if (vtkAlgorithm::DefaultParallelBlockExecution && this->Information &&
+    this->Information->Get(vtkAlgorithm::CAN_EXECUTE_BLOCKS_CONCURRENTLY()))
+  {
+    return vtkThreadedCompositeDataPipeline::New();
+  }
   return vtkCompositeDataPipeline::New();
 }
 
+//------------------------------------------------------------------------------
+void vtkAlgorithm::SetDefaultParallelBlockExecution(bool enable)
+{
+  vtkAlgorithm::DefaultParallelBlockExecution = enable;
+}
+
+//------------------------------------------------------------------------------
+bool vtkAlgorithm::GetDefaultParallelBlockExecution()
+{
+  return vtkAlgorithm::DefaultParallelBlockExecution;
+}
+
 //------------------------------------------------------------------------------
 void vtkAlgorithm::ReportReferences(vtkGarbageCollector* collector)
 {
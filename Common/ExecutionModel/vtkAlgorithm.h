@@ -38,6 +38,7 @@ class vtkInformationIntegerKey;
 class vtkInformationStringKey;
 class vtkInformationStringVectorKey;
 class vtkInformationVector;
+class vtkMemoryResource;
 class vtkProgressObserver;
 
 class VTKCOMMONEXECUTIONMODEL_EXPORT VTK_MARSHALMANUAL vtkAlgorithm : public vtkObject
@@ -338,6 +339,27 @@ public:
    */
   static vtkInformationIntegerKey* CAN_HANDLE_PIECE_REQUEST();
 
+  /**
+   * Key set in the information of an algorithm, see GetInformation(), to
+   * declare that it can execute concurrently with other algorithms, i.e. that
+   * its requests only modify the algorithm itself and its outputs. Executives
+   * updating upstream branches concurrently, such as
+   * vtkConcurrentBranchPipeline, execute the other algorithms one at a time.
+   * In such branches, the events of all the algorithms are invoked from the
+   * threads of the branches.
+   * \ingroup InformationKeys
+   */
+  static vtkInformationIntegerKey* CAN_EXECUTE_CONCURRENTLY();
+
+  /**
+   * Key set in the information of an algorithm, see GetInformation(), to
+   * declare that it can process the blocks of a composite dataset in parallel,
+   * i.e. that its requests are re-entrant as required by
+   * vtkThreadedCompositeDataPipeline. See SetDefaultParallelBlockExecution().
+   * \ingroup InformationKeys
+   */
+  static vtkInformationIntegerKey* CAN_EXECUTE_BLOCKS_CONCURRENTLY();
+
   /**
    *
    * \ingroup InformationKeys
@@ -731,6 +753,20 @@ public:
    */
   static void SetDefaultExecutivePrototype(vtkExecutive* proto);
 
+  ///@{
+  /**
+   * When on, and no DefaultExecutivePrototype is set, CreateDefaultExecutive()
+   * creates a vtkThreadedCompositeDataPipeline for the algorithms declaring
+   * CAN_EXECUTE_BLOCKS_CONCURRENTLY(), so that they process the blocks of
+   * composite datasets in parallel. This only affects the executives created
+   * afterwards. By default this is off. The key is declared by
+   * vtkElevationFilter, vtkCellCenters, vtkShrinkFilter and vtkShrinkPolyData;
+   * other algorithms keep their usual executive.
+   */
+  static void SetDefaultParallelBlockExecution(bool enable);
+  static bool GetDefaultParallelBlockExecution();
+  ///@}
+
   ///@{
   /**
    * These functions return the update extent for output ports that
@@ -776,6 +812,34 @@ public:
   vtkGetObjectMacro(ProgressObserver, vtkProgressObserver);
   ///@}
 
+  ///@{
+  /**
+   * If on, the memory allocated while the algorithm generates its data is drawn
+   * from a vtkArenaMemoryResource created by the executive for each execution.
+   * This covers vtkIdList objects and data array buffers created by the
+   * algorithm, and thread-local objects created in the Initialize() method of
+   * vtkSMPTools functors. Short-lived temporaries are then cheap to allocate and
+   * do not fragment the heap. Once the data is generated, the arrays of the
+   * outputs are moved to memory allocated as usual, and the blocks of the arena
+   * are freed unless some of its memory is still in use, such as temporaries
+   * kept by the algorithm.
+   * Default is off.
+   */
+  vtkSetMacro(UseMemoryArena, bool);
+  vtkGetMacro(UseMemoryArena, bool);
+  vtkBooleanMacro(UseMemoryArena, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Memory resource used by the last execution of the algorithm, nullptr if
+   * UseMemoryArena was off. Its counters report the memory allocated by that
+   * execution. This is set by the executive and does not modify the algorithm.
+   */
+  void SetExecutionMemoryResource(vtkMemoryResource*);
+  vtkGetObjectMacro(ExecutionMemoryResource, vtkMemoryResource);
+  ///@}
+
   ///@{
   /**
    * Set to all output ports of this algorithm the information key
@@ -973,6 +1037,7 @@ protected:
   virtual void SetNumberOfInputConnections(int port, int n);
 
   static vtkExecutive* DefaultExecutivePrototype;
+  static bool DefaultParallelBlockExecution;
 
   /**
    * These methods are used by subclasses to implement methods to
@@ -990,6 +1055,8 @@ protected:
   }
 
   vtkProgressObserver* ProgressObserver;
+  bool UseMemoryArena;
+  vtkMemoryResource* ExecutionMemoryResource;
 
 private:
   vtkExecutive* Executive;
@@ -0,0 +1,489 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCachedCompositeDataPipeline.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkCellData.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkExplicitStructuredGrid.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationIdTypeKey.h"
+#include "vtkInformationIntegerVectorKey.h"
+#include "vtkInformationStringKey.h"
+#include "vtkInformationVector.h"
+#include "vtkMatrix3x3.h"
+#include "vtkObjectFactory.h"
+#include "vtkPipelineProfiler.h"
+#include "vtkPipelineResultCache.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkSmartPointer.h"
+#include "vtkStringArray.h"
+#include "vtkStructuredGrid.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <atomic>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkCachedCompositeDataPipeline);
+
+vtkInformationKeyMacro(vtkCachedCompositeDataPipeline, CACHE_KEY, String);
+vtkInformationKeyMacro(vtkCachedCompositeDataPipeline, CACHE_KEY_TIME, IdType);
+vtkInformationKeyMacro(vtkCachedCompositeDataPipeline, ALGORITHM_STATE, String);
+
+namespace
+{
+std::atomic<vtkTypeUInt64> NextSerialNumber(1);
+
+//------------------------------------------------------------------------------
+// A 128-bit hash made of two 64-bit lanes, processing 8 bytes at a time.
+class Hasher
+{
+public:
+  void AddWord(vtkTypeUInt64 word)
+  {
+    this->A = (this->A ^ word) * 0x100000001b3ULL;
+    this->A ^= this->A >> 29;
+    this->B = (this->B + word) * 0x9e3779b97f4a7c15ULL;
+    this->B ^= this->B >> 32;
+  }
+
+  void Add(const void* data, std::size_t size)
+  {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+      vtkTypeUInt64 word;
+      std::memcpy(&word, bytes + i, 8);
+      this->AddWord(word);
+    }
+    if (i < size)
+    {
+      vtkTypeUInt64 word = 0;
+      std::memcpy(&word, bytes + i, size - i);
+      this->AddWord(word);
+    }
+    this->AddWord(size);
+  }
+
+  void Add(const std::string& str) { this->Add(str.data(), str.size()); }
+  void Add(const char* str) { this->Add(str ? std::string(str) : std::string()); }
+
+  std::string GetKey() const
+  {
+    std::ostringstream key;
+    key << std::hex << std::setfill('0') << std::setw(16) << this->A << std::setw(16) << this->B;
+    return key.str();
+  }
+
+private:
+  vtkTypeUInt64 A = 0xcbf29ce484222325ULL;
+  vtkTypeUInt64 B = 0x84222325cbf29ce4ULL;
+};
+
+//------------------------------------------------------------------------------
+void HashIdentity(Hasher& hasher, vtkObject* object)
+{
+  hasher.AddWord(reinterpret_cast<std::uintptr_t>(object));
+  hasher.AddWord(object ? object->GetMTime() : 0);
+}
+
+//------------------------------------------------------------------------------
+void HashArray(Hasher& hasher, vtkAbstractArray* array)
+{
+  if (!array)
+  {
+    hasher.AddWord(0);
+    return;
+  }
+  hasher.Add(array->GetName());
+  hasher.AddWord(array->GetDataType());
+  hasher.AddWord(array->GetNumberOfComponents());
+  hasher.AddWord(array->GetNumberOfTuples());
+  const vtkIdType numValues = array->GetNumberOfValues();
+  vtkDataArray* dataArray = vtkDataArray::SafeDownCast(array);
+  if (numValues > 0 && array->HasStandardMemoryLayout() && array->GetDataType() != VTK_BIT &&
+    array->GetDataTypeSize() > 0)
+  {
+    hasher.Add(array->GetVoidPointer(0), numValues * array->GetDataTypeSize());
+  }
+  else if (dataArray)
+  {
+    std::vector<double> tuple(dataArray->GetNumberOfComponents());
+    for (vtkIdType tupleId = 0; tupleId < dataArray->GetNumberOfTuples(); ++tupleId)
+    {
+      dataArray->GetTuple(tupleId, tuple.data());
+      hasher.Add(tuple.data(), tuple.size() * sizeof(double));
+    }
+  }
+  else if (vtkStringArray* stringArray = vtkStringArray::SafeDownCast(array))
+  {
+    for (vtkIdType valueId = 0; valueId < numValues; ++valueId)
+    {
+      hasher.Add(stringArray->GetValue(valueId));
+    }
+  }
+  else
+  {
+    HashIdentity(hasher, array);
+  }
+}
+
+//------------------------------------------------------------------------------
+void HashFieldData(Hasher& hasher, vtkFieldData* fieldData)
+{
+  if (!fieldData)
+  {
+    hasher.AddWord(0);
+    return;
+  }
+  hasher.AddWord(fieldData->GetNumberOfArrays());
+  for (int i = 0; i < fieldData->GetNumberOfArrays(); ++i)
+  {
+    HashArray(hasher, fieldData->GetAbstractArray(i));
+  }
+  if (vtkDataSetAttributes* attributes = vtkDataSetAttributes::SafeDownCast(fieldData))
+  {
+    int indices[vtkDataSetAttributes::NUM_ATTRIBUTES];
+    attributes->GetAttributeIndices(indices);
+    hasher.Add(indices, sizeof(indices));
+  }
+}
+
+//------------------------------------------------------------------------------
+// The cells are visited one by one, so that the hash does not depend on the
+// storage of the cell array, and does not convert it.
+void HashCells(Hasher& hasher, vtkCellArray* cells)
+{
+  if (!cells)
+  {
+    hasher.AddWord(0);
+    return;
+  }
+  hasher.AddWord(cells->GetNumberOfCells());
+  auto iter = vtk::TakeSmartPointer(cells->NewIterator());
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+  {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    iter->GetCurrentCell(npts, pts);
+    hasher.Add(pts, npts * sizeof(vtkIdType));
+  }
+}
+
+//------------------------------------------------------------------------------
+// Hash the content of the data sets, and the identity of the other data
+// objects.
+void HashDataObject(Hasher& hasher, vtkDataObject* data)
+{
+  if (!data)
+  {
+    hasher.AddWord(0);
+    return;
+  }
+  hasher.Add(data->GetClassName());
+
+  if (vtkCompositeDataSet* composite = vtkCompositeDataSet::SafeDownCast(data))
+  {
+    auto iter = vtk::TakeSmartPointer(composite->NewIterator());
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      hasher.AddWord(iter->GetCurrentFlatIndex());
+      HashDataObject(hasher, iter->GetCurrentDataObject());
+    }
+    HashFieldData(hasher, composite->GetFieldData());
+    return;
+  }
+
+  vtkDataSet* dataSet = vtkDataSet::SafeDownCast(data);
+  if (!dataSet)
+  {
+    HashIdentity(hasher, data);
+    return;
+  }
+
+  if (vtkImageData* image = vtkImageData::SafeDownCast(dataSet))
+  {
+    hasher.Add(image->GetExtent(), 6 * sizeof(int));
+    hasher.Add(image->GetOrigin(), 3 * sizeof(double));
+    hasher.Add(image->GetSpacing(), 3 * sizeof(double));
+    hasher.Add(image->GetDirectionMatrix()->GetData(), 9 * sizeof(double));
+  }
+  else if (vtkRectilinearGrid* rectilinear = vtkRectilinearGrid::SafeDownCast(dataSet))
+  {
+    hasher.Add(rectilinear->GetExtent(), 6 * sizeof(int));
+    HashArray(hasher, rectilinear->GetXCoordinates());
+    HashArray(hasher, rectilinear->GetYCoordinates());
+    HashArray(hasher, rectilinear->GetZCoordinates());
+  }
+  else if (vtkPointSet* pointSet = vtkPointSet::SafeDownCast(dataSet))
+  {
+    HashArray(hasher, pointSet->GetPoints() ? pointSet->GetPoints()->GetData() : nullptr);
+    if (vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(pointSet))
+    {
+      HashArray(hasher, grid->GetCellTypesArray());
+      HashCells(hasher, grid->GetCells());
+      HashCells(hasher, grid->GetPolyhedronFaces());
+      HashCells(hasher, grid->GetPolyhedronFaceLocations());
+    }
+    else if (vtkPolyData* polyData = vtkPolyData::SafeDownCast(pointSet))
+    {
+      HashCells(hasher, polyData->GetVerts());
+      HashCells(hasher, polyData->GetLines());
+      HashCells(hasher, polyData->GetPolys());
+      HashCells(hasher, polyData->GetStrips());
+    }
+    else if (vtkStructuredGrid* structured = vtkStructuredGrid::SafeDownCast(pointSet))
+    {
+      hasher.Add(structured->GetExtent(), 6 * sizeof(int));
+    }
+    else if (vtkExplicitStructuredGrid* explicitGrid =
+               vtkExplicitStructuredGrid::SafeDownCast(pointSet))
+    {
+      hasher.Add(explicitGrid->GetExtent(), 6 * sizeof(int));
+      HashCells(hasher, explicitGrid->GetCells());
+    }
+    else if (pointSet->GetNumberOfCells() > 0)
+    {
+      // Unknown topology.
+      HashIdentity(hasher, pointSet);
+    }
+  }
+  else
+  {
+    HashIdentity(hasher, dataSet);
+  }
+
+  HashFieldData(hasher, dataSet->GetPointData());
+  HashFieldData(hasher, dataSet->GetCellData());
+  HashFieldData(hasher, dataSet->GetFieldData());
+}
+}
+
+//------------------------------------------------------------------------------
+vtkCachedCompositeDataPipeline::vtkCachedCompositeDataPipeline()
+  : ResultCache(vtkPipelineResultCache::New())
+  , HashInputContents(true)
+  , SerialNumber(NextSerialNumber++)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkCachedCompositeDataPipeline::~vtkCachedCompositeDataPipeline()
+{
+  this->SetResultCache(nullptr);
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::SetResultCache(vtkPipelineResultCache* cache)
+{
+  if (this->ResultCache == cache)
+  {
+    return;
+  }
+  if (this->ResultCache)
+  {
+    this->ResultCache->RemoveEntries(this);
+    this->ResultCache->UnRegister(this);
+  }
+  this->ResultCache = cache;
+  if (this->ResultCache)
+  {
+    this->ResultCache->Register(this);
+  }
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+std::string vtkCachedCompositeDataPipeline::ComputeAlgorithmState()
+{
+  vtkInformation* info = this->Algorithm->GetInformation();
+  const char* state = info->Has(ALGORITHM_STATE()) ? info->Get(ALGORITHM_STATE()) : nullptr;
+  return state ? state : std::string();
+}
+
+//------------------------------------------------------------------------------
+bool vtkCachedCompositeDataPipeline::ComputeCacheKey(
+  vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec, std::string& key)
+{
+  if (!this->Algorithm || this->GetNumberOfOutputPorts() == 0 || this->ContinueExecuting)
+  {
+    return false;
+  }
+
+  Hasher hasher;
+  hasher.AddWord(this->SerialNumber);
+
+  // Without a state describing all its parameters, any modification of the
+  // algorithm is a new state.
+  hasher.Add(this->Algorithm->GetClassName());
+  const std::string state = this->ComputeAlgorithmState();
+  hasher.AddWord(state.empty() ? 0 : 1);
+  if (state.empty())
+  {
+    hasher.AddWord(this->Algorithm->GetMTime());
+  }
+  else
+  {
+    hasher.Add(state);
+  }
+
+  for (int port = 0; port < outInfoVec->GetNumberOfInformationObjects(); ++port)
+  {
+    vtkInformation* outInfo = outInfoVec->GetInformationObject(port);
+    vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+    hasher.Add(output ? output->GetClassName() : nullptr);
+    hasher.AddWord(outInfo->Get(UPDATE_PIECE_NUMBER()));
+    hasher.AddWord(outInfo->Get(UPDATE_NUMBER_OF_PIECES()));
+    hasher.AddWord(outInfo->Get(UPDATE_NUMBER_OF_GHOST_LEVELS()));
+    if (outInfo->Has(UPDATE_EXTENT()))
+    {
+      hasher.Add(outInfo->Get(UPDATE_EXTENT()), 6 * sizeof(int));
+    }
+    if (outInfo->Has(UPDATE_TIME_STEP()))
+    {
+      const double time = outInfo->Get(UPDATE_TIME_STEP());
+      hasher.Add(&time, sizeof(time));
+    }
+    if (outInfo->Has(UPDATE_COMPOSITE_INDICES()))
+    {
+      hasher.Add(outInfo->Get(UPDATE_COMPOSITE_INDICES()),
+        outInfo->Length(UPDATE_COMPOSITE_INDICES()) * sizeof(int));
+    }
+  }
+
+  for (int port = 0; port < this->GetNumberOfInputPorts(); ++port)
+  {
+    const int numConnections = inInfoVec[port]->GetNumberOfInformationObjects();
+    hasher.AddWord(numConnections);
+    for (int connection = 0; connection < numConnections; ++connection)
+    {
+      vtkDataObject* input =
+        inInfoVec[port]->GetInformationObject(connection)->Get(vtkDataObject::DATA_OBJECT());
+      vtkInformation* inputInfo = input ? input->GetInformation() : nullptr;
+      if (inputInfo && inputInfo->Has(CACHE_KEY()) &&
+        static_cast<vtkMTimeType>(inputInfo->Get(CACHE_KEY_TIME())) == input->GetMTime())
+      {
+        hasher.Add(inputInfo->Get(CACHE_KEY()));
+      }
+      else if (this->HashInputContents)
+      {
+        HashDataObject(hasher, input);
+      }
+      else
+      {
+        HashIdentity(hasher, input);
+      }
+    }
+  }
+
+  key = hasher.GetKey();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+int vtkCachedCompositeDataPipeline::ExecuteData(
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  std::string key;
+  if (!this->ResultCache || !this->ComputeCacheKey(inInfoVec, outInfoVec, key))
+  {
+    key.clear();
+  }
+
+  const int numOutputs = outInfoVec->GetNumberOfInformationObjects();
+  std::vector<vtkSmartPointer<vtkDataObject>> cached;
+  bool hit = !key.empty() && this->ResultCache->Find(key, cached) &&
+    static_cast<int>(cached.size()) == numOutputs;
+  for (int i = 0; hit && i < numOutputs; ++i)
+  {
+    vtkDataObject* output = outInfoVec->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT());
+    hit = output && cached[i] && !strcmp(output->GetClassName(), cached[i]->GetClassName());
+  }
+
+  int result = 1;
+  if (hit)
+  {
+    // Restore the outputs instead of executing the algorithm.
+    this->ExecuteDataStart(request, inInfoVec, outInfoVec);
+    for (int i = 0; i < numOutputs; ++i)
+    {
+      vtkInformation* outInfo = outInfoVec->GetInformationObject(i);
+      outInfo->Get(vtkDataObject::DATA_OBJECT())->ShallowCopy(cached[i]);
+    }
+    this->ExecuteDataEnd(request, inInfoVec, outInfoVec);
+    vtkPipelineProfiler::RecordCacheHit(this);
+  }
+  else
+  {
+    result = this->Superclass::ExecuteData(request, inInfoVec, outInfoVec);
+
+    // Cache the outputs, unless the algorithm failed or did not generate them all.
+    std::vector<vtkSmartPointer<vtkDataObject>> outputs;
+    for (int i = 0; !key.empty() && i < numOutputs; ++i)
+    {
+      vtkInformation* outInfo = outInfoVec->GetInformationObject(i);
+      vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+      if (!output || outInfo->Get(DATA_NOT_GENERATED()) || outInfo->Get(vtkAlgorithm::ABORTED()))
+      {
+        key.clear();
+        break;
+      }
+      auto copy = vtk::TakeSmartPointer(output->NewInstance());
+      copy->ShallowCopy(output);
+      outputs.push_back(copy);
+    }
+    if (!result || this->ContinueExecuting)
+    {
+      key.clear();
+    }
+    if (!key.empty())
+    {
+      this->ResultCache->Insert(key, this, outputs);
+    }
+  }
+
+  // Tag the outputs with their key for the downstream executives.
+  for (int i = 0; i < numOutputs; ++i)
+  {
+    vtkDataObject* output = outInfoVec->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT());
+    if (!output)
+    {
+      continue;
+    }
+    vtkInformation* dataInfo = output->GetInformation();
+    if (key.empty())
+    {
+      dataInfo->Remove(CACHE_KEY());
+      dataInfo->Remove(CACHE_KEY_TIME());
+    }
+    else
+    {
+      dataInfo->Set(CACHE_KEY(), (key + '/' + std::to_string(i)).c_str());
+      dataInfo->Set(CACHE_KEY_TIME(), static_cast<vtkIdType>(output->GetMTime()));
+    }
+  }
+
+  return result;
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Result Cache: " << this->ResultCache << "\n";
+  os << indent << "Hash Input Contents: " << (this->HashInputContents ? "On\n" : "Off\n");
+}
+VTK_ABI_NAMESPACE_END
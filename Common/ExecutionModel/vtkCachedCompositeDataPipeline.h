@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkCachedCompositeDataPipeline
+ * @brief   executive reusing the outputs of previous executions
+ *
+ * vtkCachedCompositeDataPipeline is a vtkCompositeDataPipeline that memoizes
+ * the outputs of its algorithm. Before executing the algorithm, it computes
+ * a key from everything the outputs depend on, and restores the outputs of a
+ * previous execution with the same key from its vtkPipelineResultCache. So,
+ * scrubbing back and forth through time steps executes the algorithm once
+ * per time step, and with an algorithm state (see below), toggling an
+ * isovalue between a few values executes it once per value.
+ * Unlike vtkCachedStreamingDemandDrivenPipeline, it works with any algorithm
+ * and data type. Set it as the executive of the expensive algorithms:
+ *
+ * @code{.cpp}
+ * vtkNew<vtkCachedCompositeDataPipeline> executive;
+ * contour->SetExecutive(executive);
+ * @endcode
+ *
+ * The key combines:
+ * - The state of the algorithm. By default this is its modification time, so
+ *   any modification of the algorithm executes it again, and only changes of
+ *   the request or of the inputs may restore previous outputs. To restore the
+ *   outputs of previous parameters, the application opts in by setting
+ *   ALGORITHM_STATE() on the information of the algorithm to a text that
+ *   describes all the parameters the outputs depend on, with their full
+ *   precision, and updating it whenever they change. Subclasses may instead
+ *   override ComputeAlgorithmState().
+ * - The request: update piece, number of pieces and ghost levels, extent,
+ *   time step and composite indices.
+ * - Each input: the key of the outputs of the upstream algorithm when it also
+ *   uses this executive and its output was not modified since, or otherwise
+ *   a hash of the content of the input (points, cells, attributes...) when
+ *   HashInputContents is on, or the identity and modification time of the
+ *   input data object when it is off.
+ *
+ * For instance, to restore the contours of the previous isovalues:
+ *
+ * @code{.cpp}
+ * std::ostringstream state;
+ * state << std::setprecision(17) << "isovalue " << isovalue;
+ * contour->SetValue(0, isovalue);
+ * contour->GetInformation()->Set(
+ *   vtkCachedCompositeDataPipeline::ALGORITHM_STATE(), state.str().c_str());
+ * @endcode
+ *
+ * The outputs are cached as shallow copies, so the algorithm must create new
+ * arrays at each execution, as all VTK algorithms do. The cache assumes that
+ * the outputs only depend on the state of the algorithm and on its inputs: a
+ * reader whose file changes on disk must be modified to get a new state.
+ *
+ * The outputs carry their key in CACHE_KEY(), so that downstream algorithms
+ * using this executive do not hash them.
+ *
+ * @sa
+ * vtkPipelineResultCache vtkPipelineResultDiskCache vtkPipelineProfiler
+ */
+
+#ifndef vtkCachedCompositeDataPipeline_h
+#define vtkCachedCompositeDataPipeline_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkCompositeDataPipeline.h"
+
+#include <string> // For algorithm state
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkInformationIdTypeKey;
+class vtkInformationStringKey;
+class vtkPipelineResultCache;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkCachedCompositeDataPipeline
+  : public vtkCompositeDataPipeline
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, obtaining type information, and
+   * printing the state of the object.
+   */
+  static vtkCachedCompositeDataPipeline* New();
+  vtkTypeMacro(vtkCachedCompositeDataPipeline, vtkCompositeDataPipeline);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the cache holding the outputs. A cache may be shared by several
+   * executives, to bound the memory they use together. By default each
+   * executive has its own cache.
+   */
+  void SetResultCache(vtkPipelineResultCache* cache);
+  vtkGetObjectMacro(ResultCache, vtkPipelineResultCache);
+  ///@}
+
+  ///@{
+  /**
+   * Indicate whether the content of the inputs that do not carry a cache key
+   * is hashed. Otherwise these inputs are identified by their address and
+   * modification time, which is cheaper but misses when an upstream algorithm
+   * produces the same data again. By default this is on.
+   */
+  vtkSetMacro(HashInputContents, bool);
+  vtkGetMacro(HashInputContents, bool);
+  vtkBooleanMacro(HashInputContents, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Keys set on the information of the output data objects: the cache key of
+   * the output, and the modification time of the output when it was set, to
+   * detect outputs modified afterwards.
+   */
+  static vtkInformationStringKey* CACHE_KEY();
+  static vtkInformationIdTypeKey* CACHE_KEY_TIME();
+  ///@}
+
+  /**
+   * Key set on the information of the algorithm, see
+   * vtkAlgorithm::GetInformation(), to a text describing all its parameters.
+   * When set, it replaces the modification time of the algorithm in the
+   * cache key, see the class documentation.
+   */
+  static vtkInformationStringKey* ALGORITHM_STATE();
+
+protected:
+  vtkCachedCompositeDataPipeline();
+  ~vtkCachedCompositeDataPipeline() override;
+
+  int ExecuteData(vtkInformation* request, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec) override;
+
+  /**
+   * Return a text describing all the parameters of the algorithm, or an empty
+   * text to key the outputs by the modification time of the algorithm. By
+   * default this is the ALGORITHM_STATE() of the algorithm.
+   */
+  virtual std::string ComputeAlgorithmState();
+
+  /**
+   * Compute the cache key of the current request. Return false if the outputs
+   * cannot be cached.
+   */
+  bool ComputeCacheKey(
+    vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec, std::string& key);
+
+  vtkPipelineResultCache* ResultCache;
+  bool HashInputContents;
+
+  // Distinguishes the entries of this executive in a shared cache.
+  vtkTypeUInt64 SerialNumber;
+
+private:
+  vtkCachedCompositeDataPipeline(const vtkCachedCompositeDataPipeline&) = delete;
+  void operator=(const vtkCachedCompositeDataPipeline&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
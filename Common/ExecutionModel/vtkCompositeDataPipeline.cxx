@@ -718,7 +718,7 @@ int vtkCompositeDataPipeline::ForwardUpstream(vtkInformation* request)
       if (e)
       {
         request->Set(FROM_OUTPUT_PORT(), producerPort);
-        if (!e->ProcessRequest(request, e->GetInputInformation(), e->GetOutputInformation()))
+        if (!this->ForwardRequestToProducer(e, request))
         {
           result = 0;
         }
@@ -755,7 +755,7 @@ int vtkCompositeDataPipeline::ForwardUpstream(int i, int j, vtkInformation* requ
     vtkAlgorithmOutput* input = this->Algorithm->GetInputConnection(i, j);
     int port = request->Get(FROM_OUTPUT_PORT());
     request->Set(FROM_OUTPUT_PORT(), input->GetIndex());
-    if (!e->ProcessRequest(request, e->GetInputInformation(), e->GetOutputInformation()))
+    if (!this->ForwardRequestToProducer(e, request))
     {
       result = 0;
     }
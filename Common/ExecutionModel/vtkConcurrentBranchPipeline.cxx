@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkConcurrentBranchPipeline.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkInformation.h"
+#include "vtkInformationExecutivePortKey.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkConcurrentBranchPipeline);
+
+namespace
+{
+// The input connections produced by one executive, updated by one thread.
+struct Branch
+{
+  vtkExecutive* Producer;
+  std::vector<int> Ports;
+  vtkSmartPointer<vtkInformation> Request;
+  int Result;
+  std::exception_ptr Exception;
+};
+}
+
+//------------------------------------------------------------------------------
+vtkConcurrentBranchPipeline::vtkConcurrentBranchPipeline() = default;
+
+//------------------------------------------------------------------------------
+vtkConcurrentBranchPipeline::~vtkConcurrentBranchPipeline() = default;
+
+//------------------------------------------------------------------------------
+int vtkConcurrentBranchPipeline::ForwardUpstream(vtkInformation* request)
+{
+  if (this->SharedInputInformation || !request->Has(REQUEST_DATA()) ||
+    vtkExecutive::IsInConcurrentBranch())
+  {
+    return this->Superclass::ForwardUpstream(request);
+  }
+
+  // Group the input connections by producer.
+  std::vector<Branch> branches;
+  for (int i = 0; i < this->GetNumberOfInputPorts(); ++i)
+  {
+    vtkInformationVector* inVector = this->GetInputInformation()[i];
+    for (int j = 0; j < this->Algorithm->GetNumberOfInputConnections(i); ++j)
+    {
+      vtkExecutive* producer;
+      int producerPort;
+      vtkExecutive::PRODUCER()->Get(inVector->GetInformationObject(j), producer, producerPort);
+      if (!producer)
+      {
+        continue;
+      }
+      auto branch = std::find_if(branches.begin(), branches.end(),
+        [producer](const Branch& candidate) { return candidate.Producer == producer; });
+      if (branch == branches.end())
+      {
+        branches.push_back(Branch{ producer, {}, nullptr, 1, nullptr });
+        branch = branches.end() - 1;
+      }
+      branch->Ports.push_back(producerPort);
+    }
+  }
+  if (branches.size() < 2)
+  {
+    return this->Superclass::ForwardUpstream(request);
+  }
+
+  if (!this->Algorithm->ModifyRequest(request, BeforeForward))
+  {
+    return 0;
+  }
+
+  // Each branch modifies its own copy of the request.
+  for (Branch& branch : branches)
+  {
+    branch.Request = vtkSmartPointer<vtkInformation>::New();
+    branch.Request->Copy(request);
+  }
+
+  // Each branch is updated by its own thread, the first one by the calling
+  // thread. They are not tasks of the SMP backend: a thread waiting for the
+  // tasks of a vtkSMPTools loop may run other pending tasks, and would update
+  // another branch while its algorithm holds the locks of the branch.
+  auto updateBranch = [this](Branch& branch)
+  {
+    vtkExecutive::EnterConcurrentBranch();
+    try
+    {
+      for (int port : branch.Ports)
+      {
+        branch.Request->Set(FROM_OUTPUT_PORT(), port);
+        if (!this->ForwardRequestToProducer(branch.Producer, branch.Request))
+        {
+          branch.Result = 0;
+        }
+      }
+    }
+    catch (...)
+    {
+      branch.Exception = std::current_exception();
+    }
+    vtkExecutive::LeaveConcurrentBranch();
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(branches.size() - 1);
+  for (std::size_t i = 1; i < branches.size(); ++i)
+  {
+    threads.emplace_back(updateBranch, std::ref(branches[i]));
+  }
+  updateBranch(branches[0]);
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  int result = 1;
+  for (const Branch& branch : branches)
+  {
+    if (branch.Exception)
+    {
+      std::rethrow_exception(branch.Exception);
+    }
+    result = std::min(result, branch.Result);
+  }
+
+  if (!this->Algorithm->ModifyRequest(request, AfterForward))
+  {
+    return 0;
+  }
+
+  return result;
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentBranchPipeline::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
+VTK_ABI_NAMESPACE_END
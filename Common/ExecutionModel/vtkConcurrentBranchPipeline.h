@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkConcurrentBranchPipeline
+ * @brief   executive updating its inputs concurrently
+ *
+ * vtkConcurrentBranchPipeline is a vtkCompositeDataPipeline that updates the
+ * upstream branches of its algorithm concurrently, each on its own thread,
+ * instead of one after the other. A branch is the part of
+ * the pipeline producing one of the inputs. Set it as the executive of an
+ * algorithm consuming several independent branches, such as a
+ * vtkAppendPolyData combining a contour, a slice and glyphs:
+ *
+ * @code{.cpp}
+ * vtkNew<vtkConcurrentBranchPipeline> executive;
+ * append->SetExecutive(executive);
+ * contour->GetInformation()->Set(vtkAlgorithm::CAN_EXECUTE_CONCURRENTLY(), 1);
+ * @endcode
+ *
+ * Only the algorithms that declare that they can execute concurrently with
+ * CAN_EXECUTE_CONCURRENTLY() in their information actually do: the other
+ * algorithms of the branches execute one at a time. Such an algorithm must
+ * only modify itself and its outputs, and only call the thread-safe methods
+ * of its inputs, which may be shared with other branches. For instance, an
+ * algorithm calling vtkDataSet::GetCell() or vtkImageData::GetPoints() on its
+ * input cannot execute concurrently.
+ *
+ * The events of the algorithms of the branches, such as progress, start and
+ * end events, are invoked from the threads of the branches, concurrently
+ * with the other branches. Their observers must be thread safe; those
+ * updating a user interface must forward the events to its thread.
+ *
+ * A producer shared by several branches, such as a reader feeding all of
+ * them, executes once: the first branch reaching it updates it, while the
+ * other branches wait for it.
+ *
+ * Only the requests for data are forwarded concurrently. The branches of an
+ * algorithm which is itself in a concurrent branch are updated one after the
+ * other. The threads of the branches are not tasks of the SMP backend, since
+ * a thread waiting for the tasks of a vtkSMPTools loop may run other pending
+ * tasks, which would update a branch from the middle of another one. The
+ * vtkSMPTools loops of the algorithms still use the threads of the backend.
+ *
+ * @sa
+ * vtkThreadedCompositeDataPipeline
+ */
+
+#ifndef vtkConcurrentBranchPipeline_h
+#define vtkConcurrentBranchPipeline_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkCompositeDataPipeline.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkConcurrentBranchPipeline : public vtkCompositeDataPipeline
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, obtaining type information, and
+   * printing the state of the object.
+   */
+  static vtkConcurrentBranchPipeline* New();
+  vtkTypeMacro(vtkConcurrentBranchPipeline, vtkCompositeDataPipeline);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+protected:
+  vtkConcurrentBranchPipeline();
+  ~vtkConcurrentBranchPipeline() override;
+
+  using vtkCompositeDataPipeline::ForwardUpstream;
+  int ForwardUpstream(vtkInformation* request) override;
+
+private:
+  vtkConcurrentBranchPipeline(const vtkConcurrentBranchPipeline&) = delete;
+  void operator=(const vtkConcurrentBranchPipeline&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -2,14 +2,19 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkDemandDrivenPipeline.h"
 
+#include "vtkAOSDataArrayTemplate.h"
 #include "vtkAlgorithm.h"
 #include "vtkAlgorithmOutput.h"
+#include "vtkArenaMemoryResource.h"
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCommand.h"
+#include "vtkCompositeDataSet.h"
 #include "vtkDataArray.h"
 #include "vtkDataObject.h"
 #include "vtkDataObjectTypes.h"
 #include "vtkDataSet.h"
+#include "vtkFieldData.h"
 #include "vtkGarbageCollector.h"
 #include "vtkInformation.h"
 #include "vtkInformationExecutivePortKey.h"
@@ -21,8 +26,18 @@
 #include "vtkInformationVector.h"
 #include "vtkLogger.h"
 #include "vtkObjectFactory.h"
+#include "vtkPipelineProfiler.h"
 #include "vtkPointData.h"
-
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkSOADataArrayTemplate.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <mutex>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -35,6 +50,124 @@ vtkInformationKeyMacro(vtkDemandDrivenPipeline, REQUEST_DATA_NOT_GENERATED, Requ
 vtkInformationKeyMacro(vtkDemandDrivenPipeline, REQUEST_DATA_OBJECT, Request);
 vtkInformationKeyMacro(vtkDemandDrivenPipeline, REQUEST_INFORMATION, Request);
 
+//------------------------------------------------------------------------------
+// Held by the algorithms that cannot execute concurrently in concurrent branches.
+namespace
+{
+std::recursive_mutex& GetNonConcurrentExecutionMutex()
+{
+  static std::recursive_mutex mutex;
+  return mutex;
+}
+
+//------------------------------------------------------------------------------
+// Move the values of the arrays of an output allocated from the arena of the
+// execution to memory allocated as usual, so that the output does not keep the
+// arena alive.
+template <typename ValueType>
+void ReleaseTypedMemoryResource(vtkDataArray* array, ValueType*)
+{
+  if (auto* aos = vtkAOSDataArrayTemplate<ValueType>::FastDownCast(array))
+  {
+    aos->ReleaseMemoryResource();
+  }
+  else if (auto* soa = vtkSOADataArrayTemplate<ValueType>::FastDownCast(array))
+  {
+    soa->ReleaseMemoryResource();
+  }
+}
+
+void ReleaseMemoryResource(vtkAbstractArray* array)
+{
+  vtkDataArray* dataArray = vtkDataArray::SafeDownCast(array);
+  if (!dataArray)
+  {
+    return;
+  }
+  switch (dataArray->GetDataType())
+  {
+    vtkTemplateMacro(ReleaseTypedMemoryResource(dataArray, static_cast<VTK_TT*>(nullptr)));
+  }
+}
+
+struct ReleaseCellArrayMemoryResource
+{
+  static constexpr bool SupportsCompactStorage = true;
+
+  template <typename CellStateT>
+  void operator()(CellStateT& state)
+  {
+    ReleaseMemoryResource(state.GetConnectivity());
+    ReleaseMemoryResource(state.GetOffsets());
+  }
+};
+
+void ReleaseMemoryResource(vtkCellArray* cells)
+{
+  if (cells)
+  {
+    cells->Visit(ReleaseCellArrayMemoryResource{});
+  }
+}
+
+void ReleaseMemoryResource(vtkFieldData* fieldData)
+{
+  for (int i = 0; fieldData && i < fieldData->GetNumberOfArrays(); ++i)
+  {
+    ReleaseMemoryResource(fieldData->GetAbstractArray(i));
+  }
+}
+
+void ReleaseMemoryResource(vtkDataObject* dataObject)
+{
+  if (!dataObject)
+  {
+    return;
+  }
+  if (vtkCompositeDataSet::SafeDownCast(dataObject))
+  {
+    ReleaseMemoryResource(dataObject->GetFieldData());
+  }
+  for (vtkDataObject* leaf : vtkCompositeDataSet::GetDataSets<vtkDataObject>(dataObject))
+  {
+    for (int type = 0; type < vtkDataObject::NUMBER_OF_ATTRIBUTE_TYPES; ++type)
+    {
+      if (type != vtkDataObject::POINT_THEN_CELL)
+      {
+        ReleaseMemoryResource(leaf->GetAttributesAsFieldData(type));
+      }
+    }
+    if (auto* pointSet = vtkPointSet::SafeDownCast(leaf))
+    {
+      if (vtkPoints* points = pointSet->GetPoints())
+      {
+        ReleaseMemoryResource(points->GetData());
+      }
+    }
+    if (auto* polyData = vtkPolyData::SafeDownCast(leaf))
+    {
+      ReleaseMemoryResource(polyData->GetVerts());
+      ReleaseMemoryResource(polyData->GetLines());
+      ReleaseMemoryResource(polyData->GetPolys());
+      ReleaseMemoryResource(polyData->GetStrips());
+    }
+    else if (auto* grid = vtkUnstructuredGrid::SafeDownCast(leaf))
+    {
+      ReleaseMemoryResource(grid->GetCells());
+      ReleaseMemoryResource(grid->GetCellTypesArray());
+      ReleaseMemoryResource(grid->GetPolyhedronFaces());
+      ReleaseMemoryResource(grid->GetPolyhedronFaceLocations());
+    }
+    else if (auto* rectilinearGrid = vtkRectilinearGrid::SafeDownCast(leaf))
+    {
+      ReleaseMemoryResource(rectilinearGrid->GetXCoordinates());
+      ReleaseMemoryResource(rectilinearGrid->GetYCoordinates());
+      ReleaseMemoryResource(rectilinearGrid->GetZCoordinates());
+    }
+  }
+}
+}
+
 //------------------------------------------------------------------------------
 vtkDemandDrivenPipeline::vtkDemandDrivenPipeline()
 {
@@ -244,9 +377,18 @@ vtkTypeBool vtkDemandDrivenPipeline::ProcessRequest(
         return 0;
       }
 
-      // Request data from the algorithm.
-      vtkLogF(TRACE, "%s execute-data", vtkLogIdentifier(this->Algorithm));
-      result = this->ExecuteData(request, inInfoVec, outInfoVec);
+      // Request data from the algorithm. In a concurrent branch, algorithms
+      // that do not declare that they can execute concurrently take turns.
+      {
+        std::unique_lock<std::recursive_mutex> lock;
+        if (vtkExecutive::IsInConcurrentBranch() &&
+          !this->Algorithm->GetInformation()->Get(vtkAlgorithm::CAN_EXECUTE_CONCURRENTLY()))
+        {
+          lock = std::unique_lock<std::recursive_mutex>(GetNonConcurrentExecutionMutex());
+        }
+        vtkLogF(TRACE, "%s execute-data", vtkLogIdentifier(this->Algorithm));
+        result = this->ExecuteData(request, inInfoVec, outInfoVec);
+      }
 
       // Data are now up to date.
       this->DataTime.Modified();
@@ -262,6 +404,10 @@ vtkTypeBool vtkDemandDrivenPipeline::ProcessRequest(
       this->InformationTime.Modified();
       this->DataObjectTime.Modified();
     }
+    else
+    {
+      vtkPipelineProfiler::RecordCacheHit(this);
+    }
     return result;
   }
 
@@ -445,6 +591,18 @@ int vtkDemandDrivenPipeline::ExecuteData(
   vtkInformation* request, vtkInformationVector** inInfo, vtkInformationVector* outInfo)
 {
   this->ExecuteDataStart(request, inInfo, outInfo);
+
+  // Allocations of the algorithm are drawn from an arena if requested, otherwise
+  // from the resource of the caller if any.
+  vtkSmartPointer<vtkArenaMemoryResource> arena;
+  if (this->Algorithm->GetUseMemoryArena())
+  {
+    arena = vtkSmartPointer<vtkArenaMemoryResource>::New();
+  }
+  this->Algorithm->SetExecutionMemoryResource(arena);
+  vtkMemoryResource::vtkCurrentRAII currentResource(
+    arena ? arena.Get() : vtkMemoryResource::GetCurrent());
+
   // Invoke the request on the algorithm.
   //   vtkMTimeType mTimeBefore = this->Algorithm->GetMTime();
   int result = this->CallAlgorithm(request, vtkExecutive::RequestDownstream, inInfo, outInfo);
@@ -455,11 +613,36 @@ int vtkDemandDrivenPipeline::ExecuteData(
   //                     << "This may lead to unnecessary pipeline "
   //                     << "executions");
   //     }
+  if (arena)
+  {
+    // Only the temporaries of the execution live in the arena: move the arrays
+    // of the outputs out of it, then free its blocks. Objects of the outputs
+    // that still refer to the arena then allocate from the system.
+    for (int i = 0; i < outInfo->GetNumberOfInformationObjects(); ++i)
+    {
+      ReleaseMemoryResource(outInfo->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT()));
+    }
+    if (arena->Release())
+    {
+      arena->SetLargeAllocationThreshold(0);
+    }
+    else
+    {
+      vtkDebugMacro("Memory allocated by " << this->Algorithm->GetObjectDescription()
+                                           << " is still in use, its arena is kept.");
+    }
+  }
   this->ExecuteDataEnd(request, inInfo, outInfo);
 
   return result;
 }
 
+//------------------------------------------------------------------------------
+bool vtkDemandDrivenPipeline::SerializeInConcurrentBranch(vtkInformation* request)
+{
+  return request->Has(REQUEST_DATA()) != 0;
+}
+
 //------------------------------------------------------------------------------
 void vtkDemandDrivenPipeline::ExecuteDataStart(
   vtkInformation* request, vtkInformationVector** inInfo, vtkInformationVector* outputs)
@@ -195,6 +195,9 @@ protected:
   virtual int NeedToExecuteData(
     int outputPort, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec);
 
+  // Process the requests for data of concurrent branches one at a time.
+  bool SerializeInConcurrentBranch(vtkInformation* request) override;
+
   // Handle before/after operations for ExecuteData method.
   virtual void ExecuteDataStart(
     vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec);
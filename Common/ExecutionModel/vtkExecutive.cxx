@@ -14,8 +14,10 @@
 #include "vtkInformationKeyVectorKey.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
+#include "vtkPipelineProfiler.h"
 #include "vtkSmartPointer.h"
 
+#include <mutex>
 #include <sstream>
 #include <vector>
 
@@ -36,6 +38,8 @@ class vtkExecutiveInternals
 {
 public:
   std::vector<vtkInformationVector*> InputInformation;
+  // Serializes the requests for data of concurrent branches.
+  std::recursive_mutex RequestDataMutex;
   vtkExecutiveInternals();
   ~vtkExecutiveInternals();
   vtkInformationVector** GetInputInformation(int newNumberOfPorts);
@@ -596,7 +600,7 @@ int vtkExecutive::ForwardUpstream(vtkInformation* request)
       {
         int port = request->Get(FROM_OUTPUT_PORT());
         request->Set(FROM_OUTPUT_PORT(), producerPort);
-        if (!e->ProcessRequest(request, e->GetInputInformation(), e->GetOutputInformation()))
+        if (!this->ForwardRequestToProducer(e, request))
         {
           result = 0;
         }
@@ -613,6 +617,48 @@ int vtkExecutive::ForwardUpstream(vtkInformation* request)
   return result;
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+VTK_THREAD_LOCAL int ConcurrentBranchDepth = 0;
+}
+
+//------------------------------------------------------------------------------
+int vtkExecutive::ForwardRequestToProducer(vtkExecutive* producer, vtkInformation* request)
+{
+  std::unique_lock<std::recursive_mutex> lock;
+  if (vtkExecutive::IsInConcurrentBranch() && producer->SerializeInConcurrentBranch(request))
+  {
+    lock = std::unique_lock<std::recursive_mutex>(producer->ExecutiveInternal->RequestDataMutex);
+  }
+  return producer->ProcessRequest(
+    request, producer->GetInputInformation(), producer->GetOutputInformation());
+}
+
+//------------------------------------------------------------------------------
+bool vtkExecutive::SerializeInConcurrentBranch(vtkInformation* vtkNotUsed(request))
+{
+  return false;
+}
+
+//------------------------------------------------------------------------------
+bool vtkExecutive::IsInConcurrentBranch()
+{
+  return ConcurrentBranchDepth > 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutive::EnterConcurrentBranch()
+{
+  ++ConcurrentBranchDepth;
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutive::LeaveConcurrentBranch()
+{
+  --ConcurrentBranchDepth;
+}
+
 //------------------------------------------------------------------------------
 void vtkExecutive::CopyDefaultInformation(vtkInformation* request, int direction,
   vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
@@ -720,7 +766,11 @@ int vtkExecutive::CallAlgorithm(vtkInformation* request, int direction,
 
   // Invoke the request on the algorithm.
   this->InAlgorithm = 1;
-  int result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
+  int result;
+  {
+    vtkPipelineProfiler::RequestScope profile(this, request, outInfo);
+    result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
+  }
   this->InAlgorithm = 0;
 
   // If the algorithm failed report it now.
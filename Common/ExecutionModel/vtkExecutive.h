@@ -247,6 +247,33 @@ protected:
 
   virtual int ForwardDownstream(vtkInformation* request);
   virtual int ForwardUpstream(vtkInformation* request);
+
+  /**
+   * Forward a request to the executive producing an input. While upstream
+   * branches are updated concurrently, see vtkConcurrentBranchPipeline, a
+   * producer shared by several branches processes one request for data at a
+   * time.
+   */
+  int ForwardRequestToProducer(vtkExecutive* producer, vtkInformation* request);
+
+  /**
+   * Return whether this executive processes the given request for one
+   * concurrent branch at a time, see ForwardRequestToProducer(). The base
+   * executive serializes no request.
+   */
+  virtual bool SerializeInConcurrentBranch(vtkInformation* request);
+
+  ///@{
+  /**
+   * Indicate whether the calling thread is updating an upstream branch
+   * concurrently with other branches, see vtkConcurrentBranchPipeline. Calls
+   * to EnterConcurrentBranch() and LeaveConcurrentBranch() are paired.
+   */
+  static bool IsInConcurrentBranch();
+  static void EnterConcurrentBranch();
+  static void LeaveConcurrentBranch();
+  ///@}
+
   virtual void CopyDefaultInformation(vtkInformation* request, int direction,
     vtkInformationVector** inInfo, vtkInformationVector* outInfo);
 
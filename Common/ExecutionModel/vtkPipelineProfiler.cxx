@@ -0,0 +1,501 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPipelineProfiler.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkDataObject.h"
+#include "vtkExecutive.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <vtksys/FStream.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include "vtkWindows.h"
+#else
+#include <sys/resource.h>
+#endif
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkPipelineProfiler);
+
+namespace
+{
+// The active profiler, referenced while it is active. The flag avoids
+// locking the mutex for each request when no profiler is active.
+std::mutex ActiveProfilerMutex;
+vtkPipelineProfiler* ActiveProfiler = nullptr;
+std::atomic<bool> HasActiveProfiler(false);
+
+const char* const CacheHitName = "CacheHit";
+
+//------------------------------------------------------------------------------
+double GetWallClockTime()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+//------------------------------------------------------------------------------
+// The user and system CPU time used by all the threads of the process. Not
+// std::clock(), which returns the wall clock time on Windows.
+double GetProcessCPUTime()
+{
+#ifdef _WIN32
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+  {
+    return 0.0;
+  }
+  // In units of 100 nanoseconds.
+  auto toSeconds = [](const FILETIME& time)
+  {
+    ULARGE_INTEGER value;
+    value.LowPart = time.dwLowDateTime;
+    value.HighPart = time.dwHighDateTime;
+    return static_cast<double>(value.QuadPart) * 1e-7;
+  };
+  return toSeconds(kernelTime) + toSeconds(userTime);
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0.0;
+  }
+  auto toSeconds = [](const struct timeval& time)
+  { return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_usec) * 1e-6; };
+  return toSeconds(usage.ru_utime) + toSeconds(usage.ru_stime);
+#endif
+}
+
+//------------------------------------------------------------------------------
+const char* GetRequestName(vtkInformation* request)
+{
+  if (request->Has(vtkDemandDrivenPipeline::REQUEST_DATA()))
+  {
+    return "RequestData";
+  }
+  if (request->Has(vtkDemandDrivenPipeline::REQUEST_INFORMATION()))
+  {
+    return "RequestInformation";
+  }
+  if (request->Has(vtkStreamingDemandDrivenPipeline::REQUEST_UPDATE_EXTENT()))
+  {
+    return "RequestUpdateExtent";
+  }
+  if (request->Has(vtkDemandDrivenPipeline::REQUEST_DATA_OBJECT()))
+  {
+    return "RequestDataObject";
+  }
+  if (request->Has(vtkStreamingDemandDrivenPipeline::REQUEST_UPDATE_TIME()))
+  {
+    return "RequestUpdateTime";
+  }
+  if (request->Has(vtkStreamingDemandDrivenPipeline::REQUEST_TIME_DEPENDENT_INFORMATION()))
+  {
+    return "RequestTimeDependentInformation";
+  }
+  if (request->Has(vtkDemandDrivenPipeline::REQUEST_DATA_NOT_GENERATED()))
+  {
+    return "RequestDataNotGenerated";
+  }
+  return "ProcessRequest";
+}
+
+//------------------------------------------------------------------------------
+void WriteJSONString(ostream& os, const std::string& str)
+{
+  os << '"';
+  for (char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      os << '\\' << c;
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      char escaped[8];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+      os << escaped;
+    }
+    else
+    {
+      os << c;
+    }
+  }
+  os << '"';
+}
+}
+
+//------------------------------------------------------------------------------
+struct vtkPipelineProfiler::vtkInternals
+{
+  // A request processed by an algorithm, or a cache hit. Times are in
+  // seconds, relative to Origin.
+  struct Event
+  {
+    const void* Algorithm;
+    std::string Description;
+    const char* Request;
+    int Thread;
+    double Start;
+    double WallTime;
+    double CPUTime;
+    unsigned long long OutputMemorySize;
+    int NumberOfThreads;
+  };
+
+  std::mutex Mutex;
+  double Origin = GetWallClockTime();
+  std::vector<Event> Events;
+  std::map<std::thread::id, int> Threads;
+
+  // The profiler mutex must be locked.
+  int GetThread()
+  {
+    auto inserted =
+      this->Threads.emplace(std::this_thread::get_id(), static_cast<int>(this->Threads.size()));
+    return inserted.first->second;
+  }
+
+  void AddEvent(vtkAlgorithm* algorithm, const char* request, double wallStart, double wallTime,
+    double cpuTime, unsigned long long outputMemorySize, int numberOfThreads)
+  {
+    std::string description = algorithm->GetObjectDescription();
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Events.push_back(Event{ algorithm, std::move(description), request, this->GetThread(),
+      wallStart - this->Origin, wallTime, cpuTime, outputMemorySize, numberOfThreads });
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkPipelineProfiler::vtkPipelineProfiler()
+  : Internals(new vtkInternals)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkPipelineProfiler::~vtkPipelineProfiler() = default;
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::Start()
+{
+  vtkPipelineProfiler* previous = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(ActiveProfilerMutex);
+    if (ActiveProfiler == this)
+    {
+      return;
+    }
+    previous = ActiveProfiler;
+    this->Register(nullptr);
+    ActiveProfiler = this;
+    HasActiveProfiler = true;
+  }
+  if (previous)
+  {
+    previous->UnRegister(nullptr);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::Stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(ActiveProfilerMutex);
+    if (ActiveProfiler != this)
+    {
+      return;
+    }
+    ActiveProfiler = nullptr;
+    HasActiveProfiler = false;
+  }
+  // This may delete the profiler.
+  this->UnRegister(nullptr);
+}
+
+//------------------------------------------------------------------------------
+bool vtkPipelineProfiler::IsActive()
+{
+  std::lock_guard<std::mutex> lock(ActiveProfilerMutex);
+  return ActiveProfiler == this;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkPipelineProfiler> vtkPipelineProfiler::GetActiveProfiler()
+{
+  if (!HasActiveProfiler.load(std::memory_order_acquire))
+  {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(ActiveProfilerMutex);
+  return ActiveProfiler;
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::Reset()
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  this->Internals->Events.clear();
+  this->Internals->Threads.clear();
+  this->Internals->Origin = GetWallClockTime();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkPipelineProfiler::GetNumberOfEvents()
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  return static_cast<vtkIdType>(this->Internals->Events.size());
+}
+
+//------------------------------------------------------------------------------
+int vtkPipelineProfiler::GetNumberOfRequests(vtkAlgorithm* algorithm, const char* requestName)
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  return static_cast<int>(std::count_if(this->Internals->Events.begin(),
+    this->Internals->Events.end(), [algorithm, requestName](const vtkInternals::Event& event)
+    { return event.Algorithm == algorithm && !strcmp(event.Request, requestName); }));
+}
+
+//------------------------------------------------------------------------------
+double vtkPipelineProfiler::GetWallTime(vtkAlgorithm* algorithm, const char* requestName)
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  double time = 0.0;
+  for (const auto& event : this->Internals->Events)
+  {
+    if (event.Algorithm == algorithm && !strcmp(event.Request, requestName))
+    {
+      time += event.WallTime;
+    }
+  }
+  return time;
+}
+
+//------------------------------------------------------------------------------
+double vtkPipelineProfiler::GetCPUTime(vtkAlgorithm* algorithm, const char* requestName)
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  double time = 0.0;
+  for (const auto& event : this->Internals->Events)
+  {
+    if (event.Algorithm == algorithm && !strcmp(event.Request, requestName))
+    {
+      time += event.CPUTime;
+    }
+  }
+  return time;
+}
+
+//------------------------------------------------------------------------------
+unsigned long long vtkPipelineProfiler::GetOutputMemorySize(vtkAlgorithm* algorithm)
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  const auto& events = this->Internals->Events;
+  auto last = std::find_if(events.rbegin(), events.rend(),
+    [algorithm](const vtkInternals::Event& event)
+    { return event.Algorithm == algorithm && !strcmp(event.Request, "RequestData"); });
+  return last != events.rend() ? last->OutputMemorySize : 0;
+}
+
+//------------------------------------------------------------------------------
+int vtkPipelineProfiler::GetNumberOfCacheHits(vtkAlgorithm* algorithm)
+{
+  return this->GetNumberOfRequests(algorithm, CacheHitName);
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::WriteChromeTrace(ostream& os)
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  // Times are in microseconds.
+  os << "{\"traceEvents\":[";
+  const char* separator = "\n";
+  for (const auto& event : this->Internals->Events)
+  {
+    os << separator << "{\"name\":";
+    WriteJSONString(os, event.Description);
+    os << ",\"cat\":\"" << event.Request << "\",\"pid\":0,\"tid\":" << event.Thread
+       << ",\"ts\":" << std::fixed << std::setprecision(3) << event.Start * 1e6;
+    if (event.Request == CacheHitName)
+    {
+      os << ",\"ph\":\"i\",\"s\":\"t\"}";
+    }
+    else
+    {
+      os << ",\"ph\":\"X\",\"dur\":" << event.WallTime * 1e6
+         << ",\"args\":{\"cpu_time_us\":" << event.CPUTime * 1e6;
+      if (event.NumberOfThreads > 0)
+      {
+        const double utilization =
+          event.WallTime > 0.0 ? event.CPUTime / (event.WallTime * event.NumberOfThreads) : 0.0;
+        os << ",\"output_bytes\":" << event.OutputMemorySize
+           << ",\"threads\":" << event.NumberOfThreads << ",\"thread_utilization\":" << utilization;
+      }
+      os << "}}";
+    }
+    separator = ",\n";
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  os << std::defaultfloat;
+}
+
+//------------------------------------------------------------------------------
+bool vtkPipelineProfiler::WriteChromeTrace(const char* fileName)
+{
+  vtksys::ofstream file(fileName);
+  if (!file)
+  {
+    vtkErrorMacro("Cannot open " << (fileName ? fileName : "(null)") << " for writing.");
+    return false;
+  }
+  this->WriteChromeTrace(file);
+  return static_cast<bool>(file);
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::PrintSummary(ostream& os)
+{
+  struct Summary
+  {
+    std::string Description;
+    int NumberOfExecutions = 0;
+    double DataWallTime = 0.0;
+    double DataCPUTime = 0.0;
+    double OtherWallTime = 0.0;
+    unsigned long long OutputMemorySize = 0;
+    int NumberOfCacheHits = 0;
+  };
+  std::map<const void*, Summary> summaries;
+  {
+    std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+    for (const auto& event : this->Internals->Events)
+    {
+      Summary& summary = summaries[event.Algorithm];
+      summary.Description = event.Description;
+      if (event.Request == CacheHitName)
+      {
+        ++summary.NumberOfCacheHits;
+      }
+      else if (!strcmp(event.Request, "RequestData"))
+      {
+        ++summary.NumberOfExecutions;
+        summary.DataWallTime += event.WallTime;
+        summary.DataCPUTime += event.CPUTime;
+        summary.OutputMemorySize = event.OutputMemorySize;
+      }
+      else
+      {
+        summary.OtherWallTime += event.WallTime;
+      }
+    }
+  }
+  std::vector<Summary> sorted;
+  sorted.reserve(summaries.size());
+  for (auto& item : summaries)
+  {
+    sorted.push_back(std::move(item.second));
+  }
+  std::stable_sort(sorted.begin(), sorted.end(),
+    [](const Summary& a, const Summary& b) { return a.DataWallTime > b.DataWallTime; });
+
+  os << std::left << std::setw(48) << "Algorithm" << std::right << std::setw(11) << "Executions"
+     << std::setw(14) << "Data wall (s)" << std::setw(13) << "Data CPU (s)" << std::setw(15)
+     << "Other wall (s)" << std::setw(14) << "Output (MiB)" << std::setw(12) << "Cache hits"
+     << "\n";
+  for (const auto& summary : sorted)
+  {
+    os << std::left << std::setw(48) << summary.Description << std::right << std::setw(11)
+       << summary.NumberOfExecutions << std::fixed << std::setprecision(6) << std::setw(14)
+       << summary.DataWallTime << std::setw(13) << summary.DataCPUTime << std::setw(15)
+       << summary.OtherWallTime << std::setprecision(3) << std::setw(14)
+       << summary.OutputMemorySize / (1024.0 * 1024.0) << std::setw(12)
+       << summary.NumberOfCacheHits << "\n";
+  }
+  os << std::defaultfloat;
+}
+
+//------------------------------------------------------------------------------
+vtkPipelineProfiler::RequestScope::RequestScope(
+  vtkExecutive* executive, vtkInformation* request, vtkInformationVector* outInfo)
+  : Profiler(vtkPipelineProfiler::GetActiveProfiler())
+{
+  if (this->Profiler)
+  {
+    this->Executive = executive;
+    this->Request = request;
+    this->OutputInformation = outInfo;
+    this->WallStart = GetWallClockTime();
+    this->CPUStart = GetProcessCPUTime();
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkPipelineProfiler::RequestScope::~RequestScope()
+{
+  vtkAlgorithm* algorithm = this->Profiler ? this->Executive->GetAlgorithm() : nullptr;
+  if (!algorithm)
+  {
+    return;
+  }
+  const double wallTime = GetWallClockTime() - this->WallStart;
+  const double cpuTime = GetProcessCPUTime() - this->CPUStart;
+
+  // The size of the outputs and the thread utilization are only meaningful
+  // for the execution of the algorithm.
+  const char* requestName = GetRequestName(this->Request);
+  unsigned long long outputMemorySize = 0;
+  int numberOfThreads = 0;
+  if (this->Request->Has(vtkDemandDrivenPipeline::REQUEST_DATA()))
+  {
+    numberOfThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+    const int numberOfOutputs =
+      this->OutputInformation ? this->OutputInformation->GetNumberOfInformationObjects() : 0;
+    for (int i = 0; i < numberOfOutputs; ++i)
+    {
+      vtkDataObject* output =
+        this->OutputInformation->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT());
+      if (output)
+      {
+        outputMemorySize += 1024ULL * output->GetActualMemorySize();
+      }
+    }
+  }
+  this->Profiler->Internals->AddEvent(algorithm, requestName, this->WallStart, wallTime, cpuTime,
+    outputMemorySize, numberOfThreads);
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::RecordCacheHit(vtkExecutive* executive)
+{
+  vtkSmartPointer<vtkPipelineProfiler> profiler = vtkPipelineProfiler::GetActiveProfiler();
+  if (profiler && executive->GetAlgorithm())
+  {
+    profiler->Internals->AddEvent(
+      executive->GetAlgorithm(), CacheHitName, GetWallClockTime(), 0.0, 0.0, 0, 0);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Active: " << (this->IsActive() ? "On\n" : "Off\n");
+  os << indent << "Number Of Events: " << this->GetNumberOfEvents() << "\n";
+}
+VTK_ABI_NAMESPACE_END
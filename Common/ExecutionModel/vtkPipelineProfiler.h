@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPipelineProfiler
+ * @brief   record the execution of all the algorithms of the pipelines
+ *
+ * vtkPipelineProfiler records every request processed by an algorithm
+ * (RequestDataObject, RequestInformation, RequestUpdateExtent, RequestData...)
+ * in all the pipelines of the application, while it is started. Unlike
+ * vtkExecutionTimer, which observes a single filter, it needs no setup per
+ * filter: the executives report each call of vtkAlgorithm::ProcessRequest()
+ * to the active profiler. When no profiler is started, this costs an atomic
+ * load per request.
+ *
+ * For each request, the profiler records the algorithm, the thread, the wall
+ * clock time and the CPU time of the process. For RequestData it also
+ * records the memory size of the output data objects, and the thread
+ * utilization: the CPU time divided by the wall clock time times the number
+ * of vtkSMPTools threads. A filter whose vtkSMPTools loops keep all threads
+ * busy has a utilization close to 1, a serial filter close to one over the
+ * number of threads. The CPU time is the one of the whole process, since the
+ * vtkSMPTools threads of a request are not known: when requests overlap, for
+ * instance when branches of a pipeline execute concurrently, the CPU time
+ * used by all of them is charged to each one, so the CPU times and the
+ * utilization are only meaningful when nothing else runs concurrently.
+ *
+ * The profiler also records cache hits: a request for data reaching an
+ * executive whose outputs are up to date, so that the algorithm does not
+ * execute.
+ *
+ * The events can be exported in the Chrome trace event format, which can be
+ * loaded in chrome://tracing or https://ui.perfetto.dev, and summarized per
+ * algorithm with PrintSummary() to find the filters that take the most time.
+ *
+ * A single profiler is active at a time. The profiler is thread safe, so
+ * pipelines may execute on several threads while it records them.
+ *
+ * @code{.cpp}
+ * vtkNew<vtkPipelineProfiler> profiler;
+ * profiler->Start();
+ * writer->Write();
+ * profiler->Stop();
+ * profiler->WriteChromeTrace("pipeline.json");
+ * profiler->PrintSummary(cout);
+ * @endcode
+ *
+ * @sa
+ * vtkExecutionTimer vtkExecutive vtkSMPTools
+ */
+
+#ifndef vtkPipelineProfiler_h
+#define vtkPipelineProfiler_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkObject.h"
+#include "vtkSmartPointer.h" // For RequestScope
+
+#include <memory> // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkAlgorithm;
+class vtkExecutive;
+class vtkInformation;
+class vtkInformationVector;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkPipelineProfiler : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, obtaining type information, and
+   * printing the state of the object.
+   */
+  static vtkPipelineProfiler* New();
+  vtkTypeMacro(vtkPipelineProfiler, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Start recording the requests of all the pipelines, or stop. Starting a
+   * profiler stops the one previously active. The active profiler is
+   * referenced until it is stopped.
+   */
+  void Start();
+  void Stop();
+  bool IsActive();
+  ///@}
+
+  /**
+   * Return the active profiler, or nullptr if none is started.
+   */
+  static vtkSmartPointer<vtkPipelineProfiler> GetActiveProfiler();
+
+  /**
+   * Discard the recorded events. The times of the next events are relative
+   * to this call, or to the construction of the profiler.
+   */
+  void Reset();
+
+  /**
+   * Return the number of recorded events: requests and cache hits.
+   */
+  vtkIdType GetNumberOfEvents();
+
+  ///@{
+  /**
+   * Return statistics about an algorithm, for one type of request given by
+   * its name: "RequestData", "RequestInformation", "RequestUpdateExtent",
+   * "RequestDataObject", "RequestUpdateTime",
+   * "RequestTimeDependentInformation" or "RequestDataNotGenerated". The
+   * times are in seconds. GetOutputMemorySize() returns the size in bytes of
+   * the outputs of the last RequestData.
+   */
+  int GetNumberOfRequests(vtkAlgorithm* algorithm, const char* requestName = "RequestData");
+  double GetWallTime(vtkAlgorithm* algorithm, const char* requestName = "RequestData");
+  double GetCPUTime(vtkAlgorithm* algorithm, const char* requestName = "RequestData");
+  unsigned long long GetOutputMemorySize(vtkAlgorithm* algorithm);
+  int GetNumberOfCacheHits(vtkAlgorithm* algorithm);
+  ///@}
+
+  ///@{
+  /**
+   * Export the events in the Chrome trace event JSON format. Return false if
+   * the file cannot be written.
+   */
+  void WriteChromeTrace(ostream& os);
+  bool WriteChromeTrace(const char* fileName);
+  ///@}
+
+  /**
+   * Print a table of the algorithms with their number of executions, wall
+   * clock and CPU time in RequestData and in the other requests, output
+   * memory size and cache hits, sorted by decreasing RequestData time.
+   */
+  void PrintSummary(ostream& os);
+
+#ifndef __VTK_WRAP__
+  /**
+   * Record a call to vtkAlgorithm::ProcessRequest() by an executive with
+   * the active profiler, if any, from construction to destruction. This is
+   * used by the executives.
+   */
+  class VTKCOMMONEXECUTIONMODEL_EXPORT RequestScope
+  {
+  public:
+    RequestScope(vtkExecutive* executive, vtkInformation* request, vtkInformationVector* outInfo);
+    ~RequestScope();
+
+  private:
+    RequestScope(const RequestScope&) = delete;
+    void operator=(const RequestScope&) = delete;
+
+    vtkSmartPointer<vtkPipelineProfiler> Profiler;
+    vtkExecutive* Executive = nullptr;
+    vtkInformation* Request = nullptr;
+    vtkInformationVector* OutputInformation = nullptr;
+    double WallStart = 0.0;
+    double CPUStart = 0.0;
+  };
+#endif
+
+  /**
+   * Record with the active profiler, if any, that the outputs of the
+   * algorithm of the executive were up to date for a request for data.
+   * This is used by the executives.
+   */
+  static void RecordCacheHit(vtkExecutive* executive);
+
+protected:
+  vtkPipelineProfiler();
+  ~vtkPipelineProfiler() override;
+
+private:
+  vtkPipelineProfiler(const vtkPipelineProfiler&) = delete;
+  void operator=(const vtkPipelineProfiler&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
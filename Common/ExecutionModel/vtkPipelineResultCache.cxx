@@ -0,0 +1,312 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPipelineResultCache.h"
+
+#include "vtkDataObject.h"
+#include "vtkObjectFactory.h"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkPipelineResultCache);
+
+//------------------------------------------------------------------------------
+struct vtkPipelineResultCache::vtkInternals
+{
+  struct Entry
+  {
+    std::string Key;
+    vtkObject* Owner;
+    // Empty when the entry is spilled.
+    std::vector<vtkSmartPointer<vtkDataObject>> Outputs;
+    unsigned long MemorySize = 0;
+    unsigned long DiskSize = 0;
+  };
+  using EntryList = std::list<Entry>;
+
+  // Most recently used entries first.
+  EntryList Entries;
+  std::unordered_map<std::string, EntryList::iterator> Keys;
+  std::recursive_mutex Mutex;
+  unsigned long MemorySize = 0;
+  unsigned long DiskSize = 0;
+  vtkIdType NumberOfHits = 0;
+  vtkIdType NumberOfMisses = 0;
+};
+
+namespace
+{
+unsigned long GetOutputsMemorySize(const std::vector<vtkSmartPointer<vtkDataObject>>& outputs)
+{
+  unsigned long size = 0;
+  for (const auto& output : outputs)
+  {
+    size += output ? output->GetActualMemorySize() : 0;
+  }
+  return size;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkPipelineResultCache::vtkPipelineResultCache()
+  : MemoryLimit(1048576)
+  , DiskLimit(10485760)
+  , Internals(new vtkInternals)
+{
+}
+
+//------------------------------------------------------------------------------
+// Subclasses that spill entries call Clear() in their own destructor, since
+// their RemoveEntry() cannot be called from here.
+vtkPipelineResultCache::~vtkPipelineResultCache() = default;
+
+//------------------------------------------------------------------------------
+void vtkPipelineResultCache::SetMemoryLimit(unsigned long limit)
+{
+  if (this->MemoryLimit != limit)
+  {
+    this->MemoryLimit = limit;
+    this->Modified();
+    this->Insert(std::string(), nullptr, {});
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineResultCache::SetDiskLimit(unsigned long limit)
+{
+  if (this->DiskLimit != limit)
+  {
+    this->DiskLimit = limit;
+    this->Modified();
+    this->Insert(std::string(), nullptr, {});
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkPipelineResultCache::GetNumberOfEntries()
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Internals->Mutex);
+  return static_cast<int>(this->Internals->Entries.size());
+}
+
+//------------------------------------------------------------------------------
+int vtkPipelineResultCache::GetNumberOfSpilledEntries()
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Internals->Mutex);
+  int count = 0;
+  for (const auto& entry : this->Internals->Entries)
+  {
+    count += entry.DiskSize > 0 ? 1 : 0;
+  }
+  return count;
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkPipelineResultCache::GetMemorySize()
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Internals->Mutex);
+  return this->Internals->MemorySize;
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkPipelineResultCache::GetDiskSize()
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Internals->Mutex);
+  return this->Internals->DiskSize;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkPipelineResultCache::GetNumberOfHits()
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Internals->Mutex);
+  return this->Internals->NumberOfHits;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkPipelineResultCache::GetNumberOfMisses()
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Internals->Mutex);
+  return this->Internals->NumberOfMisses;
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineResultCache::Clear()
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Internals->Mutex);
+  for (const auto& entry : this->Internals->Entries)
+  {
+    if (entry.DiskSize > 0)
+    {
+      this->RemoveEntry(entry.Key);
+    }
+  }
+  this->Internals->Entries.clear();
+  this->Internals->Keys.clear();
+  this->Internals->MemorySize = 0;
+  this->Internals->DiskSize = 0;
+}
+
+//------------------------------------------------------------------------------
+bool vtkPipelineResultCache::Find(
+  const std::string& key, std::vector<vtkSmartPointer<vtkDataObject>>& outputs)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Internals->Mutex);
+  auto& internals = *this->Internals;
+  auto found = internals.Keys.find(key);
+  if (found == internals.Keys.end())
+  {
+    ++internals.NumberOfMisses;
+    return false;
+  }
+
+  auto entry = found->second;
+  if (entry->DiskSize > 0)
+  {
+    // Read the spilled entry back, and insert it again as a new entry.
+    const bool read = this->ReadEntry(key, outputs);
+    this->RemoveEntry(key);
+    internals.DiskSize -= entry->DiskSize;
+    vtkObject* owner = entry->Owner;
+    internals.Entries.erase(entry);
+    internals.Keys.erase(found);
+    if (!read)
+    {
+      ++internals.NumberOfMisses;
+      return false;
+    }
+    this->Insert(key, owner, outputs);
+    ++internals.NumberOfHits;
+    return true;
+  }
+
+  internals.Entries.splice(internals.Entries.begin(), internals.Entries, entry);
+  outputs = entry->Outputs;
+  ++internals.NumberOfHits;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineResultCache::Insert(const std::string& key, vtkObject* owner,
+  const std::vector<vtkSmartPointer<vtkDataObject>>& outputs)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Internals->Mutex);
+  auto& internals = *this->Internals;
+
+  // An empty key only enforces the limits.
+  if (!key.empty())
+  {
+    auto found = internals.Keys.find(key);
+    if (found != internals.Keys.end())
+    {
+      auto entry = found->second;
+      if (entry->DiskSize > 0)
+      {
+        this->RemoveEntry(key);
+      }
+      internals.MemorySize -= entry->MemorySize;
+      internals.DiskSize -= entry->DiskSize;
+      internals.Entries.erase(entry);
+      internals.Keys.erase(found);
+    }
+
+    const unsigned long size = GetOutputsMemorySize(outputs);
+    if (size > this->MemoryLimit)
+    {
+      return;
+    }
+    internals.Entries.push_front(vtkInternals::Entry{ key, owner, outputs, size, 0 });
+    internals.Keys[key] = internals.Entries.begin();
+    internals.MemorySize += size;
+  }
+
+  // Evict the least recently used entries in memory, spilling them if possible.
+  for (auto entry = internals.Entries.end();
+       internals.MemorySize > this->MemoryLimit && entry != internals.Entries.begin();)
+  {
+    --entry;
+    if (entry->Outputs.empty())
+    {
+      continue;
+    }
+    internals.MemorySize -= entry->MemorySize;
+    entry->MemorySize = 0;
+    entry->DiskSize = this->WriteEntry(entry->Key, entry->Outputs);
+    entry->Outputs.clear();
+    internals.DiskSize += entry->DiskSize;
+    if (entry->DiskSize == 0)
+    {
+      internals.Keys.erase(entry->Key);
+      entry = internals.Entries.erase(entry);
+    }
+  }
+
+  // Remove the least recently used spilled entries beyond the disk limit.
+  for (auto entry = internals.Entries.end();
+       internals.DiskSize > this->DiskLimit && entry != internals.Entries.begin();)
+  {
+    --entry;
+    if (entry->DiskSize > 0)
+    {
+      this->RemoveEntry(entry->Key);
+      internals.DiskSize -= entry->DiskSize;
+      internals.Keys.erase(entry->Key);
+      entry = internals.Entries.erase(entry);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineResultCache::RemoveEntries(vtkObject* owner)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Internals->Mutex);
+  auto& internals = *this->Internals;
+  for (auto entry = internals.Entries.begin(); entry != internals.Entries.end();)
+  {
+    if (entry->Owner != owner)
+    {
+      ++entry;
+      continue;
+    }
+    if (entry->DiskSize > 0)
+    {
+      this->RemoveEntry(entry->Key);
+    }
+    internals.MemorySize -= entry->MemorySize;
+    internals.DiskSize -= entry->DiskSize;
+    internals.Keys.erase(entry->Key);
+    entry = internals.Entries.erase(entry);
+  }
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkPipelineResultCache::WriteEntry(
+  const std::string&, const std::vector<vtkSmartPointer<vtkDataObject>>&)
+{
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+bool vtkPipelineResultCache::ReadEntry(
+  const std::string&, std::vector<vtkSmartPointer<vtkDataObject>>&)
+{
+  return false;
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineResultCache::RemoveEntry(const std::string&) {}
+
+//------------------------------------------------------------------------------
+void vtkPipelineResultCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Memory Limit: " << this->MemoryLimit << "\n";
+  os << indent << "Disk Limit: " << this->DiskLimit << "\n";
+  os << indent << "Number Of Entries: " << this->GetNumberOfEntries() << "\n";
+  os << indent << "Memory Size: " << this->GetMemorySize() << "\n";
+  os << indent << "Disk Size: " << this->GetDiskSize() << "\n";
+  os << indent << "Number Of Hits: " << this->GetNumberOfHits() << "\n";
+  os << indent << "Number Of Misses: " << this->GetNumberOfMisses() << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPipelineResultCache
+ * @brief   least recently used cache of algorithm outputs
+ *
+ * vtkPipelineResultCache keeps the outputs of algorithm executions under a
+ * key describing everything they depend on, so that an executive such as
+ * vtkCachedCompositeDataPipeline can restore them instead of executing the
+ * algorithm again. The entries are shallow copies of the outputs.
+ *
+ * The memory used by the entries, as reported by
+ * vtkDataObject::GetActualMemorySize(), is bounded by MemoryLimit. When an
+ * entry does not fit, the least recently used entries are evicted. Arrays
+ * shared by several entries, or with the live outputs of the pipeline, are
+ * counted for each of them, so the limit is conservative.
+ *
+ * Evicted entries are discarded, unless a subclass writes them to disk by
+ * overriding WriteEntry(), ReadEntry() and RemoveEntry(): they are then read
+ * back when needed, while the size of the spilled entries is below
+ * DiskLimit. See vtkPipelineResultDiskCache.
+ *
+ * A cache may be shared by several executives, so that they share the memory
+ * limit. It is thread safe.
+ *
+ * @sa
+ * vtkCachedCompositeDataPipeline vtkPipelineResultDiskCache
+ */
+
+#ifndef vtkPipelineResultCache_h
+#define vtkPipelineResultCache_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkObject.h"
+#include "vtkSmartPointer.h" // For entries
+
+#include <memory> // For std::unique_ptr
+#include <string> // For keys
+#include <vector> // For entries
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataObject;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkPipelineResultCache : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, obtaining type information, and
+   * printing the state of the object.
+   */
+  static vtkPipelineResultCache* New();
+  vtkTypeMacro(vtkPipelineResultCache, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the maximum size of the entries kept in memory, in kibibytes.
+   * By default this is 1048576 (1 GiB).
+   */
+  void SetMemoryLimit(unsigned long limit);
+  vtkGetMacro(MemoryLimit, unsigned long);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the maximum size of the entries written to disk, in kibibytes,
+   * for the subclasses that spill evicted entries to disk. By default this
+   * is 10485760 (10 GiB).
+   */
+  void SetDiskLimit(unsigned long limit);
+  vtkGetMacro(DiskLimit, unsigned long);
+  ///@}
+
+  /**
+   * Return the number of entries, in memory or spilled to disk.
+   */
+  int GetNumberOfEntries();
+
+  /**
+   * Return the number of entries spilled to disk.
+   */
+  int GetNumberOfSpilledEntries();
+
+  ///@{
+  /**
+   * Return the size of the entries in memory and on disk, in kibibytes.
+   */
+  unsigned long GetMemorySize();
+  unsigned long GetDiskSize();
+  ///@}
+
+  ///@{
+  /**
+   * Return the number of lookups that found an entry, or not.
+   */
+  vtkIdType GetNumberOfHits();
+  vtkIdType GetNumberOfMisses();
+  ///@}
+
+  /**
+   * Remove all the entries.
+   */
+  void Clear();
+
+#ifndef __VTK_WRAP__
+  /**
+   * Look for the entry of a key. On success, the entry becomes the most
+   * recently used one and its data objects are returned. Spilled entries are
+   * read back into memory.
+   */
+  bool Find(const std::string& key, std::vector<vtkSmartPointer<vtkDataObject>>& outputs);
+
+  /**
+   * Add an entry, replacing any entry with the same key, and evict the least
+   * recently used entries that no longer fit. The owner identifies the
+   * entries to remove with RemoveEntries(). The data objects are referenced
+   * as is, so they must not be modified afterwards.
+   */
+  void Insert(const std::string& key, vtkObject* owner,
+    const std::vector<vtkSmartPointer<vtkDataObject>>& outputs);
+#endif
+
+  /**
+   * Remove the entries inserted by an owner.
+   */
+  void RemoveEntries(vtkObject* owner);
+
+protected:
+  vtkPipelineResultCache();
+  ~vtkPipelineResultCache() override;
+
+#ifndef __VTK_WRAP__
+  ///@{
+  /**
+   * Spill an evicted entry to disk, read it back, or remove it from disk.
+   * WriteEntry() returns the size written in kibibytes, or 0 if the entry
+   * was not written, which is what this class does: it discards evicted
+   * entries.
+   */
+  virtual unsigned long WriteEntry(
+    const std::string& key, const std::vector<vtkSmartPointer<vtkDataObject>>& outputs);
+  virtual bool ReadEntry(
+    const std::string& key, std::vector<vtkSmartPointer<vtkDataObject>>& outputs);
+  virtual void RemoveEntry(const std::string& key);
+  ///@}
+#endif
+
+  unsigned long MemoryLimit;
+  unsigned long DiskLimit;
+
+private:
+  vtkPipelineResultCache(const vtkPipelineResultCache&) = delete;
+  void operator=(const vtkPipelineResultCache&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
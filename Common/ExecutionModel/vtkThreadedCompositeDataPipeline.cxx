@@ -16,11 +16,14 @@
 
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
+#include "vtkDataSet.h"
 #include "vtkDebugLeaks.h"
 #include "vtkImageData.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPipelineProfiler.h"
 #include "vtkSmartPointer.h"
+#include "vtkTable.h"
 #include "vtkTimerLog.h"
 
 #include "vtkSMPProgressObserver.h"
@@ -28,7 +31,9 @@
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 
+#include <algorithm>
 #include <cassert>
+#include <numeric>
 #include <vector>
 
 //------------------------------------------------------------------------------
@@ -103,7 +108,8 @@ class ProcessBlock
 public:
   ProcessBlock(vtkThreadedCompositeDataPipeline* exec, vtkInformationVector** inInfoVec,
     vtkInformationVector* outInfoVec, int compositePort, int connection, vtkInformation* request,
-    const std::vector<vtkDataObject*>& inObjs, std::vector<vtkDataObject*>& outObjs)
+    const std::vector<vtkDataObject*>& inObjs, std::vector<vtkDataObject*>& outObjs,
+    const std::vector<vtkIdType>& order, const std::vector<vtkIdType>& batchStarts)
     : Exec(exec)
     , InInfoVec(inInfoVec)
     , OutInfoVec(outInfoVec)
@@ -111,6 +117,8 @@ public:
     , Connection(connection)
     , Request(request)
     , InObjs(inObjs)
+    , Order(order)
+    , BatchStarts(batchStarts)
   {
     int numInputPorts = this->Exec->GetNumberOfInputPorts();
     this->OutObjs = outObjs.data();
@@ -158,8 +166,10 @@ public:
 
     vtkInformation* inInfo = inInfoVec[this->CompositePort]->GetInformationObject(this->Connection);
 
-    for (vtkIdType i = begin; i < end; ++i)
+    // The range is a range of batches, each processing consecutive blocks of Order.
+    for (vtkIdType k = this->BatchStarts[begin]; k < this->BatchStarts[end]; ++k)
     {
+      const vtkIdType i = this->Order[k];
       std::vector<vtkDataObject*> outObjList = this->Exec->ExecuteSimpleAlgorithmForBlock(
         &inInfoVec[0], outInfoVec, inInfo, request, this->InObjs[i]);
       for (int j = 0; j < outInfoVec->GetNumberOfInformationObjects(); ++j)
@@ -181,6 +191,8 @@ protected:
   vtkInformation* Request;
   const std::vector<vtkDataObject*>& InObjs;
   vtkDataObject** OutObjs;
+  const std::vector<vtkIdType>& Order;
+  const std::vector<vtkIdType>& BatchStarts;
 
   vtkSMPThreadLocal<vtkInformationVector**> InInfoVecs;
   vtkSMPThreadLocal<vtkInformationVector*> OutInfoVecs;
@@ -228,14 +240,65 @@ void vtkThreadedCompositeDataPipeline::ExecuteEach(vtkCompositeDataIterator* ite
   std::vector<vtkDataObject*> outObjs;
   outObjs.resize(indices.size() * outInfoVec->GetNumberOfInformationObjects(), nullptr);
 
+  // Process the blocks from the most to the least expensive, so that an
+  // expensive block does not start when the other threads are done.
+  const vtkIdType numBlocks = static_cast<vtkIdType>(inObjs.size());
+  std::vector<double> costs(numBlocks);
+  double totalCost = 0.0;
+  double maxCost = 0.0;
+  for (vtkIdType i = 0; i < numBlocks; ++i)
+  {
+    costs[i] = std::max(0.0, this->EstimateBlockCost(inObjs[i]));
+    totalCost += costs[i];
+    maxCost = std::max(maxCost, costs[i]);
+  }
+  std::vector<vtkIdType> order(numBlocks);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+    [&costs](vtkIdType left, vtkIdType right) { return costs[left] > costs[right]; });
+
+  // Gather the small blocks in batches, so that a task costs about a quarter
+  // of the average work of a thread.
+  const int numThreads = std::max(1, vtkSMPTools::GetEstimatedNumberOfThreads());
+  const double batchCost = totalCost / (4.0 * numThreads);
+  std::vector<vtkIdType> batchStarts;
+  double currentCost = 0.0;
+  for (vtkIdType k = 0; k < numBlocks; ++k)
+  {
+    if (k == 0 || currentCost >= batchCost)
+    {
+      batchStarts.push_back(k);
+      currentCost = 0.0;
+    }
+    currentCost += costs[order[k]];
+  }
+  batchStarts.push_back(numBlocks);
+  const vtkIdType numBatches = static_cast<vtkIdType>(batchStarts.size()) - 1;
+
   // create the parallel task processBlock
-  ProcessBlock processBlock(
-    this, inInfoVec, outInfoVec, compositePort, connection, request, inObjs, outObjs);
+  ProcessBlock processBlock(this, inInfoVec, outInfoVec, compositePort, connection, request,
+    inObjs, outObjs, order, batchStarts);
+
+  // A block costing more than the average work of a thread cannot be balanced:
+  // let the algorithm use the idle threads while processing it.
+  const bool nested = maxCost > totalCost / numThreads && !vtkSMPTools::GetNestedParallelism();
 
   vtkSmartPointer<vtkProgressObserver> origPo(this->Algorithm->GetProgressObserver());
   vtkNew<vtkSMPProgressObserver> po;
   this->Algorithm->SetProgressObserver(po);
-  vtkSMPTools::For(0, static_cast<vtkIdType>(inObjs.size()), processBlock);
+  auto processBatches = [&]() { vtkSMPTools::For(0, numBatches, 1, processBlock); };
+  if (nested)
+  {
+    // The scope restores the configuration even if a block throws. Unlike
+    // Config(bool), the number of threads and the backend are kept.
+    vtkSMPTools::LocalScope(vtkSMPTools::Config{ vtkSMPTools::GetEstimatedNumberOfThreads(),
+                              vtkSMPTools::GetBackend(), true },
+      processBatches);
+  }
+  else
+  {
+    processBatches();
+  }
   this->Algorithm->SetProgressObserver(origPo);
 
   int i = 0;
@@ -257,6 +320,32 @@ void vtkThreadedCompositeDataPipeline::ExecuteEach(vtkCompositeDataIterator* ite
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkThreadedCompositeDataPipeline::SetBlockCostFunction(
+  std::function<double(vtkDataObject*)> function)
+{
+  this->BlockCostFunction = std::move(function);
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+double vtkThreadedCompositeDataPipeline::EstimateBlockCost(vtkDataObject* block)
+{
+  if (this->BlockCostFunction)
+  {
+    return this->BlockCostFunction(block);
+  }
+  if (vtkDataSet* dataSet = vtkDataSet::SafeDownCast(block))
+  {
+    return static_cast<double>(dataSet->GetNumberOfPoints() + dataSet->GetNumberOfCells());
+  }
+  if (vtkTable* table = vtkTable::SafeDownCast(block))
+  {
+    return static_cast<double>(table->GetNumberOfRows());
+  }
+  return 1.0;
+}
+
 //------------------------------------------------------------------------------
 int vtkThreadedCompositeDataPipeline::CallAlgorithm(vtkInformation* request, int direction,
   vtkInformationVector** inInfo, vtkInformationVector* outInfo)
@@ -265,7 +354,11 @@ int vtkThreadedCompositeDataPipeline::CallAlgorithm(vtkInformation* request, int
   this->CopyDefaultInformation(request, direction, inInfo, outInfo);
 
   // Invoke the request on the algorithm.
-  int result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
+  int result;
+  {
+    vtkPipelineProfiler::RequestScope profile(this, request, outInfo);
+    result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
+  }
 
   // If the algorithm failed report it now.
   if (!result)
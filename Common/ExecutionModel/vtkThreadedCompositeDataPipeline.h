@@ -10,7 +10,19 @@
  * using vtkSMPTools::For. Note that this requires that the
  * algorithm implement all pipeline passes in a re-entrant way. It should
  * store/retrieve all state changes using input and output information
- * objects, which are unique to each thread.
+ * objects, which are unique to each thread. Such algorithms may declare it
+ * with vtkAlgorithm::CAN_EXECUTE_BLOCKS_CONCURRENTLY(), see
+ * vtkAlgorithm::SetDefaultParallelBlockExecution().
+ *
+ * The blocks are balanced between the threads by their estimated cost, see
+ * EstimateBlockCost(): they are processed from the most to the least
+ * expensive, and the small blocks are processed in batches of similar cost
+ * instead of one task per block. When a block is too expensive to be
+ * balanced with the others, nested parallelism is enabled while processing
+ * the blocks, so that the parallel loops of the algorithm use the threads
+ * that would otherwise be idle. This is done with vtkSMPTools::LocalScope(),
+ * which keeps the number of threads and restores the previous configuration
+ * afterwards, even if the algorithm throws.
  */
 
 #ifndef vtkThreadedCompositeDataPipeline_h
@@ -19,6 +31,8 @@
 #include "vtkCommonExecutionModelModule.h" // For export macro
 #include "vtkCompositeDataPipeline.h"
 
+#include <functional> // For std::function
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkInformationVector;
 class vtkInformation;
@@ -38,6 +52,15 @@ public:
   int CallAlgorithm(vtkInformation* request, int direction, vtkInformationVector** inInfo,
     vtkInformationVector* outInfo) override;
 
+#ifndef __VTK_WRAP__
+  /**
+   * Set a function estimating the cost of processing a block, to use instead
+   * of the default estimation of EstimateBlockCost(). The function is called
+   * once per block, from the thread updating the pipeline.
+   */
+  void SetBlockCostFunction(std::function<double(vtkDataObject*)> function);
+#endif
+
 protected:
   vtkThreadedCompositeDataPipeline();
   ~vtkThreadedCompositeDataPipeline() override;
@@ -45,6 +68,15 @@ protected:
     vtkInformationVector* outInfoVec, int compositePort, int connection, vtkInformation* request,
     std::vector<vtkSmartPointer<vtkCompositeDataSet>>& compositeOutput) override;
 
+  /**
+   * Return the estimated cost of processing a block, in arbitrary units. By
+   * default this is the block cost function if set, or the number of points
+   * and cells of data sets, the number of rows of tables, and 1 otherwise.
+   */
+  virtual double EstimateBlockCost(vtkDataObject* block);
+
+  std::function<double(vtkDataObject*)> BlockCostFunction;
+
 private:
   vtkThreadedCompositeDataPipeline(const vtkThreadedCompositeDataPipeline&) = delete;
   void operator=(const vtkThreadedCompositeDataPipeline&) = delete;
@@ -0,0 +1,311 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that vtkSpatialReorderFilter orders points along the Hilbert and Morton
+// curves, and that points, cells, polyhedron faces and attributes are permuted
+// consistently for unstructured grids and polydata.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSpatialReorderFilter.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int Resolution = 8;
+
+vtkIdType LatticeId(int i, int j, int k)
+{
+  return i + Resolution * (j + Resolution * k);
+}
+
+//------------------------------------------------------------------------------
+// A lattice of Resolution^3 points with unit spacing, plus a point at
+// (Resolution, Resolution, Resolution) so that each lattice position maps to
+// the start of a block of the curve. Points and cells are stored in a
+// scrambled order, with attributes identifying them.
+void BuildGrid(vtkUnstructuredGrid* grid)
+{
+  const vtkIdType numPts = Resolution * Resolution * Resolution + 1;
+  std::vector<vtkIdType> scrambled(numPts);
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numPts);
+  vtkNew<vtkDoubleArray> positions;
+  positions->SetName("Position");
+  positions->SetNumberOfComponents(3);
+  positions->SetNumberOfTuples(numPts);
+  for (vtkIdType id = 0; id < numPts; ++id)
+  {
+    // 37 is coprime with numPts, so this is a permutation.
+    const vtkIdType ptId = (id * 37) % numPts;
+    scrambled[id] = ptId;
+    double x[3] = { static_cast<double>(Resolution), static_cast<double>(Resolution),
+      static_cast<double>(Resolution) };
+    if (id < numPts - 1)
+    {
+      x[0] = id % Resolution;
+      x[1] = (id / Resolution) % Resolution;
+      x[2] = id / (Resolution * Resolution);
+    }
+    points->SetPoint(ptId, x);
+    positions->SetTuple(ptId, x);
+  }
+  grid->SetPoints(points);
+  grid->GetPointData()->AddArray(positions);
+
+  // Voxels, with a polyhedron every 5 cells.
+  vtkNew<vtkIdTypeArray> cellIds;
+  cellIds->SetName("CellId");
+  for (int c = 0; c < (Resolution - 1) * (Resolution - 1) * (Resolution - 1); ++c)
+  {
+    const int cell = (c * 11) % ((Resolution - 1) * (Resolution - 1) * (Resolution - 1));
+    const int i = cell % (Resolution - 1);
+    const int j = (cell / (Resolution - 1)) % (Resolution - 1);
+    const int k = cell / ((Resolution - 1) * (Resolution - 1));
+    vtkIdType pts[8];
+    for (int corner = 0; corner < 8; ++corner)
+    {
+      pts[corner] =
+        scrambled[LatticeId(i + (corner & 1), j + ((corner >> 1) & 1), k + ((corner >> 2) & 1))];
+    }
+    if (c % 5 == 0)
+    {
+      const vtkIdType faces[30] = { 4, pts[0], pts[2], pts[3], pts[1], 4, pts[4], pts[5], pts[7],
+        pts[6], 4, pts[0], pts[1], pts[5], pts[4], 4, pts[1], pts[3], pts[7], pts[5], 4, pts[3],
+        pts[2], pts[6], pts[7], 4, pts[2], pts[0], pts[4], pts[6] };
+      grid->InsertNextCell(VTK_POLYHEDRON, 8, pts, 6, faces);
+    }
+    else
+    {
+      grid->InsertNextCell(VTK_VOXEL, 8, pts);
+    }
+    cellIds->InsertNextValue(grid->GetNumberOfCells() - 1);
+  }
+  grid->GetCellData()->AddArray(cellIds);
+}
+
+//------------------------------------------------------------------------------
+// Check that the output points, cells and attributes are the input ones,
+// permuted as described by the original id arrays.
+bool CheckPermutation(const std::string& name, vtkDataSet* input, vtkDataSet* output)
+{
+  auto originalPointIds =
+    vtkIdTypeArray::SafeDownCast(output->GetPointData()->GetArray("vtkOriginalPointIds"));
+  auto originalCellIds =
+    vtkIdTypeArray::SafeDownCast(output->GetCellData()->GetArray("vtkOriginalCellIds"));
+  if (!originalPointIds || !originalCellIds ||
+    output->GetNumberOfPoints() != input->GetNumberOfPoints() ||
+    output->GetNumberOfCells() != input->GetNumberOfCells())
+  {
+    std::cerr << "Error: " << name << ": wrong output" << std::endl;
+    return false;
+  }
+
+  vtkDataArray* positions = output->GetPointData()->GetArray("Position");
+  for (vtkIdType ptId = 0; ptId < output->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3], y[3];
+    output->GetPoint(ptId, x);
+    input->GetPoint(originalPointIds->GetValue(ptId), y);
+    if (vtkMath::Distance2BetweenPoints(x, y) != 0.0 ||
+      (positions && vtkMath::Distance2BetweenPoints(x, positions->GetTuple3(ptId)) != 0.0))
+    {
+      std::cerr << "Error: " << name << ": point " << ptId << " not permuted" << std::endl;
+      return false;
+    }
+  }
+
+  vtkDataArray* cellIds = output->GetCellData()->GetArray("CellId");
+  vtkUnstructuredGrid* inGrid = vtkUnstructuredGrid::SafeDownCast(input);
+  vtkUnstructuredGrid* outGrid = vtkUnstructuredGrid::SafeDownCast(output);
+  vtkNew<vtkIdList> inPts;
+  vtkNew<vtkIdList> outPts;
+  for (vtkIdType cellId = 0; cellId < output->GetNumberOfCells(); ++cellId)
+  {
+    const vtkIdType inCellId = originalCellIds->GetValue(cellId);
+    if (output->GetCellType(cellId) != input->GetCellType(inCellId) ||
+      (cellIds && cellIds->GetTuple1(cellId) != inCellId))
+    {
+      std::cerr << "Error: " << name << ": cell " << cellId << " not permuted" << std::endl;
+      return false;
+    }
+    if (inGrid && input->GetCellType(inCellId) == VTK_POLYHEDRON)
+    {
+      inGrid->GetFaceStream(inCellId, inPts);
+      outGrid->GetFaceStream(cellId, outPts);
+    }
+    else
+    {
+      input->GetCellPoints(inCellId, inPts);
+      output->GetCellPoints(cellId, outPts);
+    }
+    bool same = inPts->GetNumberOfIds() == outPts->GetNumberOfIds();
+    for (vtkIdType i = 0; same && i < inPts->GetNumberOfIds(); ++i)
+    {
+      // The face stream holds the number of faces, then the number of points
+      // of each face, here always 4.
+      const bool isCount =
+        output->GetCellType(cellId) == VTK_POLYHEDRON && (i == 0 || (i - 1) % 5 == 0);
+      same = isCount ? inPts->GetId(i) == outPts->GetId(i)
+                     : inPts->GetId(i) == originalPointIds->GetValue(outPts->GetId(i));
+    }
+    if (!same)
+    {
+      std::cerr << "Error: " << name << ": points of cell " << cellId << " not renumbered"
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Check that the lattice points are ordered along the Hilbert curve: each
+// lattice point is a neighbor of the next one.
+bool CheckHilbertOrder(vtkDataSet* output)
+{
+  const double far[3] = { Resolution, Resolution, Resolution };
+  double previous[3];
+  bool hasPrevious = false;
+  for (vtkIdType ptId = 0; ptId < output->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3];
+    output->GetPoint(ptId, x);
+    if (vtkMath::Distance2BetweenPoints(x, far) == 0.0)
+    {
+      hasPrevious = false;
+      continue;
+    }
+    if (hasPrevious && vtkMath::Distance2BetweenPoints(x, previous) != 1.0)
+    {
+      std::cerr << "Error: points " << ptId - 1 << " and " << ptId
+                << " are not neighbors along the Hilbert curve" << std::endl;
+      return false;
+    }
+    std::copy(x, x + 3, previous);
+    hasPrevious = true;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Check that the first points along the Morton curve fill the first block.
+bool CheckMortonOrder(vtkDataSet* output)
+{
+  for (vtkIdType ptId = 0; ptId < 8; ++ptId)
+  {
+    double x[3];
+    output->GetPoint(ptId, x);
+    if (x[0] > 1.0 || x[1] > 1.0 || x[2] > 1.0)
+    {
+      std::cerr << "Error: point " << ptId << " is not in the first Morton block" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestSpatialReorderFilter(int, char*[])
+{
+  vtkNew<vtkUnstructuredGrid> grid;
+  BuildGrid(grid);
+
+  vtkNew<vtkSpatialReorderFilter> reorder;
+  reorder->SetInputData(grid);
+  reorder->GenerateOriginalIdsOn();
+  reorder->Update();
+  vtkUnstructuredGrid* output = reorder->GetUnstructuredGridOutput();
+  if (!output || !CheckPermutation("Hilbert grid", grid, output) || !CheckHilbertOrder(output))
+  {
+    return EXIT_FAILURE;
+  }
+
+  reorder->SetCurveToMorton();
+  reorder->Update();
+  output = reorder->GetUnstructuredGridOutput();
+  if (!CheckPermutation("Morton grid", grid, output) || !CheckMortonOrder(output))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Cells only.
+  reorder->ReorderPointsOff();
+  reorder->Update();
+  output = reorder->GetUnstructuredGridOutput();
+  if (!CheckPermutation("grid with cells reordered", grid, output) ||
+    output->GetPoints()->GetData() != grid->GetPoints()->GetData())
+  {
+    return EXIT_FAILURE;
+  }
+  reorder->ReorderPointsOn();
+
+  // Polydata: the cells are reordered within each cell array.
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(grid->GetPoints());
+  polyData->GetPointData()->ShallowCopy(grid->GetPointData());
+  polyData->AllocateEstimate(2 * Resolution * Resolution, 4);
+  vtkNew<vtkIdTypeArray> cellIds;
+  cellIds->SetName("CellId");
+  for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells(); cellId += 3)
+  {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    grid->GetCellPoints(cellId, npts, pts);
+    polyData->InsertNextCell(VTK_QUAD, 4, pts);
+    cellIds->InsertNextValue(cellIds->GetNumberOfValues());
+    polyData->InsertNextCell(VTK_VERTEX, 1, pts);
+    cellIds->InsertNextValue(cellIds->GetNumberOfValues());
+  }
+  polyData->GetCellData()->AddArray(cellIds);
+
+  reorder->SetInputData(polyData);
+  reorder->SetCurveToHilbert();
+  reorder->Update();
+  vtkPolyData* polyOutput = reorder->GetPolyDataOutput();
+  if (!polyOutput || !CheckPermutation("polydata", polyData, polyOutput))
+  {
+    return EXIT_FAILURE;
+  }
+  if (polyOutput->GetNumberOfVerts() != polyData->GetNumberOfVerts() ||
+    polyOutput->GetCellType(0) != VTK_VERTEX)
+  {
+    std::cerr << "Error: polydata cells not grouped by type" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // In place.
+  vtkNew<vtkPolyData> inPlace;
+  inPlace->DeepCopy(polyData);
+  reorder->GenerateOriginalIdsOff();
+  if (!reorder->ReorderInPlace(inPlace) ||
+    inPlace->GetNumberOfCells() != polyData->GetNumberOfCells())
+  {
+    std::cerr << "Error: in place reordering failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType ptId = 0; ptId < inPlace->GetNumberOfPoints(); ++ptId)
+  {
+    if (vtkMath::Distance2BetweenPoints(inPlace->GetPoint(ptId), polyOutput->GetPoint(ptId)) != 0.0)
+    {
+      std::cerr << "Error: in place reordering differs from the filter output" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that vtkStaticCleanUnstructuredGrid merges the points of a grid whose
+// cells use a compact storage, without converting the cells of its input.
+
+#include "vtkCellArray.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkStaticCleanUnstructuredGrid.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <iostream>
+
+//------------------------------------------------------------------------------
+int TestStaticCleanUnstructuredGrid(int, char*[])
+{
+  // Two hexahedra with duplicated points on their shared face, and an unused point.
+  vtkNew<vtkPoints> points;
+  for (int hex = 0; hex < 2; ++hex)
+  {
+    for (int z = 0; z < 2; ++z)
+    {
+      points->InsertNextPoint(hex, 0, z);
+      points->InsertNextPoint(hex + 1, 0, z);
+      points->InsertNextPoint(hex + 1, 1, z);
+      points->InsertNextPoint(hex, 1, z);
+    }
+  }
+  points->InsertNextPoint(5, 5, 5);
+  vtkNew<vtkUnstructuredGrid> grid;
+  grid->SetPoints(points);
+  grid->Allocate(2);
+  const vtkIdType hex0[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+  const vtkIdType hex1[8] = { 8, 9, 10, 11, 12, 13, 14, 15 };
+  grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex0);
+  grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex1);
+  if (!grid->GetCells()->ConvertToCompactStorage() ||
+    grid->GetCells()->GetStorageType() != vtkCellArray::FixedSizeInt8)
+  {
+    std::cerr << "Error: cells not converted to a compact storage" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkStaticCleanUnstructuredGrid> clean;
+  clean->SetInputData(grid);
+  clean->RemoveUnusedPointsOn();
+  clean->Update();
+  vtkUnstructuredGrid* output = clean->GetOutput();
+
+  if (!grid->GetCells()->IsStorageCompact())
+  {
+    std::cerr << "Error: the cells of the input were converted" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (output->GetNumberOfPoints() != 12 || output->GetNumberOfCells() != 2)
+  {
+    std::cerr << "Error: " << output->GetNumberOfPoints() << " points and "
+              << output->GetNumberOfCells() << " cells instead of 12 and 2" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The cells keep their geometry and share the points of their common face.
+  vtkNew<vtkIdList> inIds;
+  vtkNew<vtkIdList> outIds;
+  for (vtkIdType cellId = 0; cellId < 2; ++cellId)
+  {
+    grid->GetCellPoints(cellId, inIds);
+    output->GetCellPoints(cellId, outIds);
+    for (vtkIdType i = 0; i < 8; ++i)
+    {
+      double inPoint[3], outPoint[3];
+      grid->GetPoint(inIds->GetId(i), inPoint);
+      output->GetPoint(outIds->GetId(i), outPoint);
+      if (inPoint[0] != outPoint[0] || inPoint[1] != outPoint[1] || inPoint[2] != outPoint[2])
+      {
+        std::cerr << "Error: wrong point " << i << " of cell " << cellId << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+  output->GetCellPoints(0, inIds);
+  output->GetCellPoints(1, outIds);
+  if (outIds->GetId(0) != inIds->GetId(1) || outIds->GetId(3) != inIds->GetId(2))
+  {
+    std::cerr << "Error: the shared points were not merged" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
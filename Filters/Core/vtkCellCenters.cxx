@@ -23,22 +23,57 @@
 #include "vtkSMPTools.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <atomic>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkCellCenters);
 
+//------------------------------------------------------------------------------
+vtkCellCenters::vtkCellCenters()
+{
+  // The per-thread state of RequestData lives in its functors.
+  this->GetInformation()->Set(vtkAlgorithm::CAN_EXECUTE_BLOCKS_CONCURRENTLY(), 1);
+}
+
 namespace
 {
 
+// Number of cells fetched at once with vtkDataSet::GetCellRange().
+constexpr vtkIdType CellRangeSize = 1024;
+
 class CellCenterFunctor
 {
   vtkSMPThreadLocalObject<vtkGenericCell> TLCell;
   vtkSMPThreadLocal<std::vector<double>> TLWeigths;
+  vtkSMPThreadLocalObject<vtkUnsignedCharArray> TLCellTypes;
+  vtkSMPThreadLocalObject<vtkIdTypeArray> TLCellOffsets;
+  vtkSMPThreadLocalObject<vtkIdTypeArray> TLCellPoints;
   vtkDataSet* DataSet;
   vtkDoubleArray* CellCenters;
   vtkIdType MaxCellSize;
 
+  // The parametric center of these linear cells is the mean of their points,
+  // so that their center is computed without instantiating them.
+  static bool IsCenterMeanOfPoints(int cellType)
+  {
+    switch (cellType)
+    {
+      case VTK_VERTEX:
+      case VTK_LINE:
+      case VTK_TRIANGLE:
+      case VTK_QUAD:
+      case VTK_PIXEL:
+      case VTK_TETRA:
+      case VTK_VOXEL:
+      case VTK_HEXAHEDRON:
+      case VTK_WEDGE:
+        return true;
+      default:
+        return false;
+    }
+  }
+
 public:
   CellCenterFunctor(vtkDataSet* ds, vtkDoubleArray* cellCenters)
     : DataSet(ds)
@@ -62,23 +97,48 @@ public:
     auto& weights = this->TLWeigths.Local();
     weights.resize(this->MaxCellSize);
     auto cell = this->TLCell.Local();
-    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    auto cellTypes = this->TLCellTypes.Local();
+    auto cellOffsets = this->TLCellOffsets.Local();
+    auto cellPoints = this->TLCellPoints.Local();
+    for (vtkIdType beginCellId = begin; beginCellId < end; beginCellId += CellRangeSize)
     {
-      this->DataSet->GetCell(cellId, cell);
-      double x[3] = { 0.0 };
-      if (cell->GetCellType() != VTK_EMPTY_CELL)
-      {
-        double pcoords[3];
-        int subId = cell->GetParametricCenter(pcoords);
-        cell->EvaluateLocation(subId, pcoords, x, weights.data());
-      }
-      else
+      const vtkIdType endCellId = std::min(beginCellId + CellRangeSize, end);
+      this->DataSet->GetCellRange(beginCellId, endCellId, cellTypes, cellOffsets, cellPoints);
+      for (vtkIdType cellId = beginCellId; cellId < endCellId; ++cellId)
       {
-        x[0] = 0.0;
-        x[1] = 0.0;
-        x[2] = 0.0;
+        const vtkIdType i = cellId - beginCellId;
+        const int cellType = cellTypes->GetValue(i);
+        double x[3] = { 0.0, 0.0, 0.0 };
+        if (cellType == VTK_EMPTY_CELL)
+        {
+          // empty cells are centered at the origin, and removed afterwards
+        }
+        else if (IsCenterMeanOfPoints(cellType))
+        {
+          const vtkIdType beginOffset = cellOffsets->GetValue(i);
+          const vtkIdType endOffset = cellOffsets->GetValue(i + 1);
+          double p[3];
+          for (vtkIdType j = beginOffset; j < endOffset; ++j)
+          {
+            this->DataSet->GetPoint(cellPoints->GetValue(j), p);
+            x[0] += p[0];
+            x[1] += p[1];
+            x[2] += p[2];
+          }
+          const double numPts = static_cast<double>(endOffset - beginOffset);
+          x[0] /= numPts;
+          x[1] /= numPts;
+          x[2] /= numPts;
+        }
+        else
+        {
+          this->DataSet->GetCell(cellId, cell);
+          double pcoords[3];
+          int subId = cell->GetParametricCenter(pcoords);
+          cell->EvaluateLocation(subId, pcoords, x, weights.data());
+        }
+        this->CellCenters->SetTypedTuple(cellId, x);
       }
-      this->CellCenters->SetTypedTuple(cellId, x);
     }
   }
 };
@@ -160,11 +220,16 @@ void vtkCellCenters::ComputeCellCenters(vtkDataSet* dataset, vtkDoubleArray* cen
 
   // Call this once one the main thread before calling on multiple threads.
   // According to the documentation for vtkDataSet::GetCell(vtkIdType, vtkGenericCell*),
-  // this is required to make this call subsequently thread safe
+  // this is required to make this call subsequently thread safe. The same
+  // holds for GetCellRange().
   if (dataset->GetNumberOfCells() > 0)
   {
     vtkNew<vtkGenericCell> cell;
     dataset->GetCell(0, cell);
+    vtkNew<vtkUnsignedCharArray> cellTypes;
+    vtkNew<vtkIdTypeArray> cellOffsets;
+    vtkNew<vtkIdTypeArray> cellPoints;
+    dataset->GetCellRange(0, 1, cellTypes, cellOffsets, cellPoints);
   }
 
   // Now split the work among threads.
@@ -86,7 +86,7 @@ public:
   static void ComputeCellCenters(vtkDataSet* dataset, vtkDoubleArray* centers);
 
 protected:
-  vtkCellCenters() = default;
+  vtkCellCenters();
   ~vtkCellCenters() override = default;
 
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
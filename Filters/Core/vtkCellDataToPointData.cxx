@@ -10,6 +10,7 @@
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkNew.h"
@@ -21,6 +22,7 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUniformGrid.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtkUnsignedIntArray.h"
 #include "vtkUnstructuredGrid.h"
 
@@ -35,6 +37,9 @@ vtkObjectFactoryNewMacro(vtkCellDataToPointData);
 
 namespace
 {
+// Number of cells fetched at once with vtkDataSet::GetCellRange() by the
+// general path.
+constexpr vtkIdType CellRangeSize = 1024;
 
 //------------------------------------------------------------------------------
 // Optimized code for vtkUnstructuredGrid/vtkPolyData. It's waaaay faster than the more
@@ -131,9 +136,9 @@ void FastUnstructuredDataSCLT(
 // Helper template function that implements the major part of the algorithm
 // which will be expanded by the vtkTemplateMacro. The template function is
 // provided so that coverage test can cover this function. This approach is
-// slow: it's non-threaded; uses a slower vtkDataSet API; and most
-// unfortunately, accommodates the ContributingCellOption which is not a
-// common workflow.
+// slow: it's non-threaded; uses the generic vtkDataSet API, fetching the cells
+// by ranges to limit the virtual calls; and most unfortunately, accommodates
+// the ContributingCellOption which is not a common workflow.
 struct Spread
 {
   template <typename SrcArrayT, typename DstArrayT>
@@ -154,26 +159,29 @@ struct Spread
     // accumulate
     if (contributingCellOption != vtkCellDataToPointData::Patch)
     {
-      vtkNew<vtkIdList> pointIds;
-      checkAbortInterval = std::min(ncells / 10 + 1, (vtkIdType)1000);
-      for (vtkIdType cid = 0; cid < ncells; ++cid)
+      vtkNew<vtkUnsignedCharArray> cellTypes;
+      vtkNew<vtkIdTypeArray> cellOffsets;
+      vtkNew<vtkIdTypeArray> cellPoints;
+      for (vtkIdType beginCellId = 0; beginCellId < ncells; beginCellId += CellRangeSize)
       {
-        if (cid % checkAbortInterval == 0 && filter->CheckAbort())
+        if (filter->CheckAbort())
         {
           break;
         }
-        int dimension = vtkCellTypes::GetDimension(src->GetCellType(cid));
-        if (dimension >= highestCellDimension)
+        const vtkIdType endCellId = std::min(beginCellId + CellRangeSize, ncells);
+        src->GetCellRange(beginCellId, endCellId, cellTypes, cellOffsets, cellPoints);
+        for (vtkIdType i = 0; i < endCellId - beginCellId; ++i)
         {
-          const auto srcTuple = srcTuples[cid];
-          src->GetCellPoints(cid, pointIds);
-          for (vtkIdType i = 0, I = pointIds->GetNumberOfIds(); i < I; ++i)
+          if (vtkCellTypes::GetDimension(cellTypes->GetValue(i)) >= highestCellDimension)
           {
-            const vtkIdType ptId = pointIds->GetId(i);
-            auto dstTuple = dstTuples[ptId];
-            // accumulate cell data to point data <==> point_data += cell_data
-            std::transform(srcTuple.cbegin(), srcTuple.cend(), dstTuple.cbegin(), dstTuple.begin(),
-              std::plus<T>());
+            const auto srcTuple = srcTuples[beginCellId + i];
+            for (vtkIdType j = cellOffsets->GetValue(i); j < cellOffsets->GetValue(i + 1); ++j)
+            {
+              auto dstTuple = dstTuples[cellPoints->GetValue(j)];
+              // accumulate cell data to point data <==> point_data += cell_data
+              std::transform(srcTuple.cbegin(), srcTuple.cend(), dstTuple.cbegin(),
+                dstTuple.begin(), std::plus<T>());
+            }
           }
         }
       }
@@ -664,16 +672,22 @@ int vtkCellDataToPointData::RequestDataForUnstructuredData(
         }
       }
     }
-    vtkNew<vtkIdList> pids;
-    for (vtkIdType cid = 0; cid < numberOfCells; ++cid)
+    vtkNew<vtkUnsignedCharArray> cellTypes;
+    vtkNew<vtkIdTypeArray> cellOffsets;
+    vtkNew<vtkIdTypeArray> cellPoints;
+    for (vtkIdType beginCellId = 0; beginCellId < numberOfCells; beginCellId += CellRangeSize)
     {
-      if (input->GetCell(cid)->GetCellDimension() >= highestCellDimension)
+      const vtkIdType endCellId = std::min(beginCellId + CellRangeSize, numberOfCells);
+      input->GetCellRange(beginCellId, endCellId, cellTypes, cellOffsets, cellPoints);
+      for (vtkIdType i = 0; i < endCellId - beginCellId; ++i)
       {
-        input->GetCellPoints(cid, pids);
-        for (vtkIdType i = 0, I = pids->GetNumberOfIds(); i < I; ++i)
+        if (vtkCellTypes::GetDimension(cellTypes->GetValue(i)) >= highestCellDimension)
         {
-          vtkIdType const pid = pids->GetId(i);
-          num->SetValue(pid, num->GetValue(pid) + 1);
+          for (vtkIdType j = cellOffsets->GetValue(i); j < cellOffsets->GetValue(i + 1); ++j)
+          {
+            vtkIdType const pid = cellPoints->GetValue(j);
+            num->SetValue(pid, num->GetValue(pid) + 1);
+          }
         }
       }
     }
@@ -26,6 +26,7 @@
 #include "vtkSimpleScalarTree.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkUnstructuredGrid.h"
 #include "vtkUnstructuredGridBase.h"
 
 #include <algorithm>
@@ -143,6 +144,14 @@ void vtkContourGridExecute(vtkContourGrid* self, vtkDataSet* input, vtkPolyData*
 
   numCells = input->GetNumberOfCells();
 
+  // Polyhedra are loaded from the grid with precomputed canonical faces and
+  // edges, which the cell iterator does not use.
+  vtkUnstructuredGrid* ugrid = vtkUnstructuredGrid::SafeDownCast(input);
+  if (ugrid)
+  {
+    ugrid->BuildPolyhedronTopology();
+  }
+
   //
   // Create objects to hold output of contour operation. First estimate
   // allocation size.
@@ -282,8 +291,15 @@ void vtkContourGridExecute(vtkContourGrid* self, vtkDataSet* input, vtkPolyData*
 
         if (needCell)
         {
-          cellIter->GetCell(cell);
           vtkIdType cellId = cellIter->GetCellId();
+          if (ugrid && cellType == VTK_POLYHEDRON)
+          {
+            ugrid->GetCell(cellId, cell);
+          }
+          else
+          {
+            cellIter->GetCell(cell);
+          }
           input->SetCellOrderAndRationalWeights(cellId, cell);
           for (i = 0; i < numContours; i++)
           {
@@ -126,6 +126,9 @@ vtkElevationFilter::vtkElevationFilter()
 
   this->ScalarRange[0] = 0.0;
   this->ScalarRange[1] = 1.0;
+
+  // RequestData only reads the parameters, so blocks may be processed in parallel.
+  this->GetInformation()->Set(vtkAlgorithm::CAN_EXECUTE_BLOCKS_CONCURRENTLY(), 1);
 }
 
 //------------------------------------------------------------------------------
@@ -63,6 +63,8 @@ namespace
 {
 struct BuildCellTypesImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   // Given a polyData cell array and a size to type functor, it creates the cell types
   template <typename CellStateT, typename SizeToTypeFunctor>
   void operator()(
@@ -88,12 +90,12 @@ struct BuildCellTypesImpl
 
 struct BuildConnectivityImpl
 {
+  static constexpr bool SupportsCompactStorage = true;
+
   template <typename CellStateT>
   void operator()(CellStateT& state, vtkIdTypeArray* outOffSets, vtkIdTypeArray* outConnectivity,
     vtkIdType offset, vtkIdType connectivityOffset)
   {
-    using IdType = typename CellStateT::ValueType;
-    const auto inOffsets = state.GetOffsets();
     const auto inConnectivity = state.GetConnectivity();
     const vtkIdType connectivitySize = inConnectivity->GetNumberOfValues();
     const vtkIdType numCells = state.GetNumberOfCells();
@@ -110,10 +112,11 @@ struct BuildConnectivityImpl
     vtkSMPTools::For(0, numCells,
       [&](vtkIdType begin, vtkIdType end)
       {
-        auto inOffPtr = inOffsets->GetPointer(0);
         auto outOffPtr = outOffSets->GetPointer(offset);
-        std::transform(inOffPtr + begin, inOffPtr + end, outOffPtr + begin,
-          [&connectivityOffset](IdType val) -> vtkIdType { return val + connectivityOffset; });
+        for (vtkIdType cellId = begin; cellId < end; ++cellId)
+        {
+          outOffPtr[cellId] = state.GetBeginOffset(cellId) + connectivityOffset;
+        }
       });
   }
 };
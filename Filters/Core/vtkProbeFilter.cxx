@@ -722,6 +722,7 @@ void vtkProbeFilter::ProbeEmptyPoints(
       if (!sameLocatorType)
       {
         auto cellLocator = vtk::TakeSmartPointer(this->CellLocatorPrototype->NewInstance());
+        cellLocator->CopyParameters(this->CellLocatorPrototype);
         ps->SetCellLocator(cellLocator);
         cellLocator->SetDataSet(ps);
         cellLocator->BuildLocator();
@@ -221,7 +221,10 @@ public:
    * the prototype to perform the FindCell() operation). If a prototype, and
    * a vtkFindCellStrategy are not defined, the vtkDataSet::FindCell() is
    * used. If a vtkFindCellStrategy is not defined, then the prototype is
-   * used.
+   * used. The instance copies the parameters of the prototype and is
+   * attached to the source, so that later executions reuse it; e.g., a
+   * vtkStaticCellLocator prototype with IncrementalUpdate enabled is refit,
+   * rather than rebuilt, when the source mesh deforms between time steps.
    */
   virtual void SetCellLocatorPrototype(vtkAbstractCellLocator*);
   vtkGetObjectMacro(CellLocatorPrototype, vtkAbstractCellLocator);
@@ -0,0 +1,555 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSpatialReorderFilter.h"
+
+#include "vtkArrayListTemplate.h" // For processing attribute data
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkSpatialReorderFilter);
+
+namespace
+{ // anonymous
+
+// Number of bits of the quantized coordinates along each axis, so that the
+// curve index of a position fits in 63 bits.
+constexpr int NumberOfBits = 21;
+constexpr vtkTypeUInt32 MaxCoordinate = (1u << NumberOfBits) - 1;
+
+//------------------------------------------------------------------------------
+// Insert two zero bits between each of the lower 21 bits of x.
+vtkTypeUInt64 SpreadBits(vtkTypeUInt64 x)
+{
+  x &= 0x1fffff;
+  x = (x | (x << 32)) & 0x1f00000000ffffULL;
+  x = (x | (x << 16)) & 0x1f0000ff0000ffULL;
+  x = (x | (x << 8)) & 0x100f00f00f00f00fULL;
+  x = (x | (x << 4)) & 0x10c30c30c30c30c3ULL;
+  x = (x | (x << 2)) & 0x1249249249249249ULL;
+  return x;
+}
+
+//------------------------------------------------------------------------------
+// Morton index: the interleaved bits of the quantized coordinates.
+vtkTypeUInt64 MortonIndex(const vtkTypeUInt32 q[3])
+{
+  return SpreadBits(q[0]) | (SpreadBits(q[1]) << 1) | (SpreadBits(q[2]) << 2);
+}
+
+//------------------------------------------------------------------------------
+// Hilbert index, following J. Skilling, "Programming the Hilbert curve", AIP
+// Conference Proceedings 707 (2004): the quantized coordinates are
+// transformed into the "transposed" Hilbert index, whose bits are then
+// interleaved, the first coordinate holding the most significant bits.
+vtkTypeUInt64 HilbertIndex(const vtkTypeUInt32 q[3])
+{
+  vtkTypeUInt32 x[3] = { q[0], q[1], q[2] };
+  constexpr vtkTypeUInt32 highestBit = 1u << (NumberOfBits - 1);
+
+  // Inverse undo
+  for (vtkTypeUInt32 bit = highestBit; bit > 1; bit >>= 1)
+  {
+    const vtkTypeUInt32 lowerBits = bit - 1;
+    for (int i = 0; i < 3; ++i)
+    {
+      if (x[i] & bit)
+      {
+        x[0] ^= lowerBits; // invert
+      }
+      else
+      {
+        const vtkTypeUInt32 t = (x[0] ^ x[i]) & lowerBits; // exchange
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  x[1] ^= x[0];
+  x[2] ^= x[1];
+  vtkTypeUInt32 t = 0;
+  for (vtkTypeUInt32 bit = highestBit; bit > 1; bit >>= 1)
+  {
+    if (x[2] & bit)
+    {
+      t ^= bit - 1;
+    }
+  }
+  x[0] ^= t;
+  x[1] ^= t;
+  x[2] ^= t;
+
+  return (SpreadBits(x[0]) << 2) | (SpreadBits(x[1]) << 1) | SpreadBits(x[2]);
+}
+
+//------------------------------------------------------------------------------
+// Compute the curve index of positions within the given bounds.
+struct CurveIndexer
+{
+  double Origin[3];
+  double Scale[3];
+  int Curve;
+
+  CurveIndexer(const double bounds[6], int curve)
+    : Curve(curve)
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      const double length = bounds[2 * i + 1] - bounds[2 * i];
+      this->Origin[i] = bounds[2 * i];
+      this->Scale[i] = length > 0.0 ? (MaxCoordinate + 1.0) / length : 0.0;
+    }
+  }
+
+  vtkTypeUInt64 operator()(const double x[3]) const
+  {
+    vtkTypeUInt32 q[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      const double coordinate = (x[i] - this->Origin[i]) * this->Scale[i];
+      q[i] = coordinate <= 0.0 ? 0
+        : coordinate >= MaxCoordinate ? MaxCoordinate
+                                      : static_cast<vtkTypeUInt32>(coordinate);
+    }
+    return this->Curve == vtkSpatialReorderFilter::MORTON_CURVE ? MortonIndex(q)
+                                                                 : HilbertIndex(q);
+  }
+};
+
+//------------------------------------------------------------------------------
+// Sort the ids 0 <= id < num by the curve index of their position, given by
+// position(id, x), which returns false for ids without position (sorted
+// first). Ties are broken by id. Return the sorted ids, i.e. the input id of
+// each output id.
+template <typename TPosition>
+std::vector<vtkIdType> SortAlongCurve(
+  vtkIdType num, const CurveIndexer& indexer, const TPosition& position)
+{
+  std::vector<std::pair<vtkTypeUInt64, vtkIdType>> keys(num);
+  vtkSMPTools::For(0, num,
+    [&](vtkIdType id, vtkIdType endId)
+    {
+      double x[3];
+      for (; id < endId; ++id)
+      {
+        keys[id].first = position(id, x) ? indexer(x) : 0;
+        keys[id].second = id;
+      }
+    }); // end lambda
+  vtkSMPTools::Sort(keys.begin(), keys.end());
+
+  std::vector<vtkIdType> order(num);
+  vtkSMPTools::For(0, num,
+    [&](vtkIdType id, vtkIdType endId)
+    {
+      for (; id < endId; ++id)
+      {
+        order[id] = keys[id].second;
+      }
+    }); // end lambda
+  return order;
+}
+
+//------------------------------------------------------------------------------
+// Sort the cells of a cell array by the curve index of their centroid.
+std::vector<vtkIdType> SortCellsAlongCurve(
+  vtkCellArray* cells, vtkPoints* points, const CurveIndexer& indexer)
+{
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+  return SortAlongCurve(cells->GetNumberOfCells(), indexer,
+    [&](vtkIdType cellId, double x[3])
+    {
+      vtkIdType npts;
+      const vtkIdType* pts;
+      cells->GetCellAtId(cellId, npts, pts, tlPtIds.Local());
+      if (npts == 0)
+      {
+        return false;
+      }
+      x[0] = x[1] = x[2] = 0.0;
+      double p[3];
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        points->GetPoint(pts[i], p);
+        x[0] += p[0];
+        x[1] += p[1];
+        x[2] += p[2];
+      }
+      x[0] /= npts;
+      x[1] /= npts;
+      x[2] /= npts;
+      return true;
+    }); // end lambda
+}
+
+//------------------------------------------------------------------------------
+// Build a new cell array where cell i is the cell cellOrder[i] of the input
+// (cell i if cellOrder is null) and the point ids are renumbered through
+// pointMap (unchanged if pointMap is null). The storage of the input is kept
+// when possible.
+vtkSmartPointer<vtkCellArray> PermuteCells(
+  vtkCellArray* cells, const vtkIdType* cellOrder, const vtkIdType* pointMap)
+{
+  const vtkIdType numCells = cells->GetNumberOfCells();
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(numCells + 1);
+  vtkIdType* offsetsPtr = offsets->GetPointer(0);
+  offsetsPtr[0] = 0;
+  vtkSMPTools::For(0, numCells,
+    [&](vtkIdType cellId, vtkIdType endCellId)
+    {
+      for (; cellId < endCellId; ++cellId)
+      {
+        offsetsPtr[cellId + 1] = cells->GetCellSize(cellOrder ? cellOrder[cellId] : cellId);
+      }
+    }); // end lambda
+  std::partial_sum(offsetsPtr, offsetsPtr + numCells + 1, offsetsPtr);
+
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(offsetsPtr[numCells]);
+  vtkIdType* connPtr = connectivity->GetPointer(0);
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+  vtkSMPTools::For(0, numCells,
+    [&](vtkIdType cellId, vtkIdType endCellId)
+    {
+      vtkIdList* ptIds = tlPtIds.Local();
+      vtkIdType npts;
+      const vtkIdType* pts;
+      for (; cellId < endCellId; ++cellId)
+      {
+        cells->GetCellAtId(cellOrder ? cellOrder[cellId] : cellId, npts, pts, ptIds);
+        vtkIdType* outPts = connPtr + offsetsPtr[cellId];
+        if (pointMap)
+        {
+          std::transform(
+            pts, pts + npts, outPts, [pointMap](vtkIdType ptId) { return pointMap[ptId]; });
+        }
+        else
+        {
+          std::copy(pts, pts + npts, outPts);
+        }
+      }
+    }); // end lambda
+
+  auto newCells = vtkSmartPointer<vtkCellArray>::New();
+  newCells->SetData(offsets, connectivity);
+  const int storageType = cells->GetStorageType();
+  if (newCells->GetStorageType() != storageType && newCells->CanConvertToStorage(storageType))
+  {
+    newCells->ConvertToStorage(storageType);
+  }
+  return newCells;
+}
+
+//------------------------------------------------------------------------------
+// Copy the attributes so that output tuple i is the input tuple order[i], in
+// parallel. The points of the dataset are permuted along with the point data
+// when given.
+void PermuteAttributes(vtkDataSetAttributes* inAttr, vtkDataSetAttributes* outAttr,
+  const std::vector<vtkIdType>& order, vtkPoints* inPts = nullptr, vtkPoints* outPts = nullptr)
+{
+  const vtkIdType num = static_cast<vtkIdType>(order.size());
+  outAttr->CopyAllocate(inAttr, num);
+  ArrayList arrays;
+  arrays.AddArrays(num, inAttr, outAttr, 0.0, /*promote=*/false);
+  if (inPts)
+  {
+    vtkDataArray* inData = inPts->GetData();
+    vtkStdString name = inData->GetName() ? inData->GetName() : "";
+    outPts->SetData(
+      vtkArrayDownCast<vtkDataArray>(arrays.AddArrayPair(num, inData, name, 0.0, false)));
+  }
+  vtkSMPTools::For(0, num,
+    [&](vtkIdType id, vtkIdType endId)
+    {
+      for (; id < endId; ++id)
+      {
+        arrays.Copy(order[id], id);
+      }
+    }); // end lambda
+}
+
+//------------------------------------------------------------------------------
+// The inverse of a permutation.
+std::vector<vtkIdType> InvertPermutation(const std::vector<vtkIdType>& order)
+{
+  std::vector<vtkIdType> inverse(order.size());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(order.size()),
+    [&](vtkIdType id, vtkIdType endId)
+    {
+      for (; id < endId; ++id)
+      {
+        inverse[order[id]] = id;
+      }
+    }); // end lambda
+  return inverse;
+}
+
+//------------------------------------------------------------------------------
+// An array holding the input id of each output id.
+vtkSmartPointer<vtkIdTypeArray> MakeOriginalIds(
+  const char* name, vtkIdType num, const std::vector<vtkIdType>& order)
+{
+  auto ids = vtkSmartPointer<vtkIdTypeArray>::New();
+  ids->SetName(name);
+  ids->SetNumberOfValues(num);
+  if (order.empty())
+  {
+    std::iota(ids->GetPointer(0), ids->GetPointer(0) + num, 0);
+  }
+  else
+  {
+    std::copy(order.begin(), order.end(), ids->GetPointer(0));
+  }
+  return ids;
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+vtkSpatialReorderFilter::vtkSpatialReorderFilter()
+{
+  this->Curve = HILBERT_CURVE;
+  this->ReorderPoints = true;
+  this->ReorderCells = true;
+  this->GenerateOriginalIds = false;
+}
+
+//------------------------------------------------------------------------------
+int vtkSpatialReorderFilter::FillInputPortInformation(int, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkUnstructuredGrid");
+  info->Append(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkPolyData");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkSpatialReorderFilter::RequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkPointSet* input = vtkPointSet::GetData(inputVector[0]);
+  vtkPointSet* output = vtkPointSet::GetData(outputVector);
+  return this->Reorder(input, output) ? 1 : 0;
+}
+
+//------------------------------------------------------------------------------
+bool vtkSpatialReorderFilter::ReorderInPlace(vtkPointSet* dataset)
+{
+  if (!dataset)
+  {
+    return false;
+  }
+  vtkSmartPointer<vtkPointSet> reordered = vtk::TakeSmartPointer(dataset->NewInstance());
+  if (!this->Reorder(dataset, reordered))
+  {
+    return false;
+  }
+  dataset->ShallowCopy(reordered);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkSpatialReorderFilter::Reorder(vtkPointSet* input, vtkPointSet* output)
+{
+  vtkUnstructuredGrid* inGrid = vtkUnstructuredGrid::SafeDownCast(input);
+  vtkPolyData* inPoly = vtkPolyData::SafeDownCast(input);
+  if (!inGrid && !inPoly)
+  {
+    vtkErrorMacro(<< "Unsupported input type " << (input ? input->GetClassName() : "(none)"));
+    return false;
+  }
+
+  vtkPoints* inPts = input->GetPoints();
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  const vtkIdType numCells = input->GetNumberOfCells();
+  if (!inPts || numPts < 1)
+  {
+    vtkDebugMacro(<< "No data to reorder!");
+    output->ShallowCopy(input);
+    return true;
+  }
+
+  double bounds[6];
+  input->GetBounds(bounds);
+  const CurveIndexer indexer(bounds, this->Curve);
+
+  // Order the points: pointOrder gives the input id of each output point, and
+  // pointMap the output id of each input point. Both are empty if the points
+  // are not reordered.
+  std::vector<vtkIdType> pointOrder, pointMap;
+  if (this->ReorderPoints)
+  {
+    pointOrder = SortAlongCurve(numPts, indexer,
+      [inPts](vtkIdType ptId, double x[3])
+      {
+        inPts->GetPoint(ptId, x);
+        return true;
+      }); // end lambda
+    pointMap = InvertPermutation(pointOrder);
+  }
+  this->UpdateProgress(0.3);
+  if (this->CheckAbort())
+  {
+    return true;
+  }
+
+  // Order the cells within each cell array, and the cell data accordingly.
+  // The cells of a vtkPolyData are numbered by cell array.
+  std::vector<vtkCellArray*> inCellArrays;
+  if (inGrid)
+  {
+    if (inGrid->GetCells())
+    {
+      inCellArrays.push_back(inGrid->GetCells());
+    }
+  }
+  else
+  {
+    inCellArrays = { inPoly->GetVerts(), inPoly->GetLines(), inPoly->GetPolys(),
+      inPoly->GetStrips() };
+  }
+  std::vector<std::vector<vtkIdType>> cellArrayOrders(inCellArrays.size());
+  std::vector<vtkIdType> cellOrder;
+  if (this->ReorderCells && numCells > 0)
+  {
+    cellOrder.reserve(numCells);
+    vtkIdType cellOffset = 0;
+    for (std::size_t i = 0; i < inCellArrays.size(); ++i)
+    {
+      cellArrayOrders[i] = SortCellsAlongCurve(inCellArrays[i], inPts, indexer);
+      for (vtkIdType cellId : cellArrayOrders[i])
+      {
+        cellOrder.push_back(cellOffset + cellId);
+      }
+      cellOffset += inCellArrays[i]->GetNumberOfCells();
+    }
+  }
+  this->UpdateProgress(0.6);
+  if (this->CheckAbort())
+  {
+    return true;
+  }
+
+  // Points and attributes.
+  vtkNew<vtkPoints> newPts;
+  if (pointOrder.empty())
+  {
+    newPts->ShallowCopy(inPts);
+    output->GetPointData()->PassData(input->GetPointData());
+  }
+  else
+  {
+    PermuteAttributes(input->GetPointData(), output->GetPointData(), pointOrder, inPts, newPts);
+  }
+  output->SetPoints(newPts);
+  if (cellOrder.empty())
+  {
+    output->GetCellData()->PassData(input->GetCellData());
+  }
+  else
+  {
+    PermuteAttributes(input->GetCellData(), output->GetCellData(), cellOrder);
+  }
+  output->GetFieldData()->PassData(input->GetFieldData());
+  if (this->GenerateOriginalIds)
+  {
+    output->GetPointData()->AddArray(MakeOriginalIds("vtkOriginalPointIds", numPts, pointOrder));
+    output->GetCellData()->AddArray(MakeOriginalIds("vtkOriginalCellIds", numCells, cellOrder));
+  }
+
+  // Topology.
+  const vtkIdType* pmap = pointMap.empty() ? nullptr : pointMap.data();
+  std::vector<vtkSmartPointer<vtkCellArray>> newCellArrays(inCellArrays.size());
+  for (std::size_t i = 0; i < inCellArrays.size(); ++i)
+  {
+    const vtkIdType* order = cellArrayOrders[i].empty() ? nullptr : cellArrayOrders[i].data();
+    newCellArrays[i] = (order || pmap) ? PermuteCells(inCellArrays[i], order, pmap)
+                                       : vtkSmartPointer<vtkCellArray>(inCellArrays[i]);
+  }
+
+  if (inGrid)
+  {
+    vtkUnstructuredGrid* outGrid = vtkUnstructuredGrid::SafeDownCast(output);
+    if (newCellArrays.empty())
+    {
+      return true;
+    }
+    vtkSmartPointer<vtkUnsignedCharArray> types = inGrid->GetCellTypesArray();
+    if (!cellOrder.empty())
+    {
+      types = vtkSmartPointer<vtkUnsignedCharArray>::New();
+      types->SetNumberOfValues(numCells);
+      const unsigned char* inTypes = inGrid->GetCellTypesArray()->GetPointer(0);
+      unsigned char* outTypes = types->GetPointer(0);
+      vtkSMPTools::For(0, numCells,
+        [&](vtkIdType cellId, vtkIdType endCellId)
+        {
+          for (; cellId < endCellId; ++cellId)
+          {
+            outTypes[cellId] = inTypes[cellOrder[cellId]];
+          }
+        }); // end lambda
+    }
+
+    // The faces of polyhedra are referenced by id from the face locations,
+    // which follow the cells, while the faces themselves are renumbered.
+    vtkCellArray* faces = inGrid->GetPolyhedronFaces();
+    vtkCellArray* faceLocations = inGrid->GetPolyhedronFaceLocations();
+    if (faces && faceLocations)
+    {
+      vtkSmartPointer<vtkCellArray> newFaces =
+        pmap ? PermuteCells(faces, nullptr, pmap) : vtkSmartPointer<vtkCellArray>(faces);
+      vtkSmartPointer<vtkCellArray> newFaceLocations = cellOrder.empty()
+        ? vtkSmartPointer<vtkCellArray>(faceLocations)
+        : PermuteCells(faceLocations, cellOrder.data(), nullptr);
+      outGrid->SetPolyhedralCells(types, newCellArrays[0], newFaceLocations, newFaces);
+    }
+    else
+    {
+      outGrid->SetCells(types, newCellArrays[0]);
+    }
+  }
+  else
+  {
+    vtkPolyData* outPoly = vtkPolyData::SafeDownCast(output);
+    outPoly->SetVerts(newCellArrays[0]);
+    outPoly->SetLines(newCellArrays[1]);
+    outPoly->SetPolys(newCellArrays[2]);
+    outPoly->SetStrips(newCellArrays[3]);
+  }
+  this->UpdateProgress(1.0);
+
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkSpatialReorderFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Curve: " << (this->Curve == MORTON_CURVE ? "Morton\n" : "Hilbert\n");
+  os << indent << "Reorder Points: " << (this->ReorderPoints ? "On\n" : "Off\n");
+  os << indent << "Reorder Cells: " << (this->ReorderCells ? "On\n" : "Off\n");
+  os << indent << "Generate Original Ids: " << (this->GenerateOriginalIds ? "On\n" : "Off\n");
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSpatialReorderFilter
+ * @brief   reorder points and cells along a space-filling curve
+ *
+ * vtkSpatialReorderFilter renumbers the points and the cells of a
+ * vtkUnstructuredGrid or a vtkPolyData so that they follow a space-filling
+ * curve: a Hilbert curve (the default) or a Morton (Z-order) curve. Points
+ * close in space then have close ids, and so do cells. Meshes whose points
+ * come in an arbitrary order, as produced by many mesh generators, are thus
+ * traversed with much better memory locality by the filters gathering point
+ * values through the cells (vtkCellDataToPointData, contouring, cutting,
+ * locators...). Reordering once after reading usually pays off as soon as a
+ * few filters process the mesh.
+ *
+ * The geometry and the topology are unchanged: the point and cell
+ * attributes are permuted along with the points and cells, and the cell
+ * connectivity (including the faces of polyhedra) is renumbered. The points
+ * are sorted by the curve index of their coordinates, quantized with 21 bits
+ * per axis over the bounds of the dataset, and the cells by the curve index
+ * of their centroid. The cells of a vtkPolyData are reordered within each of
+ * its vertex, line, polygon and strip arrays, since a vtkPolyData numbers
+ * its cells in this order. Points or cells with the same index keep their
+ * relative order, so the result does not depend on the number of threads.
+ *
+ * If GenerateOriginalIds is enabled, the output point data and cell data
+ * hold "vtkOriginalPointIds" and "vtkOriginalCellIds" arrays giving the input
+ * id of each output point and cell.
+ *
+ * ReorderInPlace() applies the same reordering to a dataset outside of a
+ * pipeline, e.g. right after reading it.
+ *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
+ * @sa
+ * vtkStaticCleanUnstructuredGrid vtkHierarchicalBinningFilter vtkStaticPointLocator
+ */
+
+#ifndef vtkSpatialReorderFilter_h
+#define vtkSpatialReorderFilter_h
+
+#include "vtkFiltersCoreModule.h" // For export macro
+#include "vtkPointSetAlgorithm.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkPointSet;
+
+class VTKFILTERSCORE_EXPORT vtkSpatialReorderFilter : public vtkPointSetAlgorithm
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, obtaining type information, and
+   * printing the state of the object.
+   */
+  static vtkSpatialReorderFilter* New();
+  vtkTypeMacro(vtkSpatialReorderFilter, vtkPointSetAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  /**
+   * The space-filling curves along which points and cells are ordered.
+   */
+  enum CurveTypes
+  {
+    HILBERT_CURVE = 0,
+    MORTON_CURVE = 1
+  };
+
+  ///@{
+  /**
+   * Specify the space-filling curve. The Hilbert curve, the default, only
+   * steps between neighboring positions and gives the best locality. The
+   * Morton curve is slightly cheaper to compute but jumps between blocks.
+   */
+  vtkSetClampMacro(Curve, int, HILBERT_CURVE, MORTON_CURVE);
+  vtkGetMacro(Curve, int);
+  void SetCurveToHilbert() { this->SetCurve(HILBERT_CURVE); }
+  void SetCurveToMorton() { this->SetCurve(MORTON_CURVE); }
+  ///@}
+
+  ///@{
+  /**
+   * Indicate whether the points are reordered. By default this is on.
+   */
+  vtkSetMacro(ReorderPoints, bool);
+  vtkBooleanMacro(ReorderPoints, bool);
+  vtkGetMacro(ReorderPoints, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Indicate whether the cells are reordered. By default this is on.
+   */
+  vtkSetMacro(ReorderCells, bool);
+  vtkBooleanMacro(ReorderCells, bool);
+  vtkGetMacro(ReorderCells, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Indicate whether the permutations are produced on output, as
+   * "vtkOriginalPointIds" and "vtkOriginalCellIds" arrays holding the input
+   * id of each output point and cell. By default this is off.
+   */
+  vtkSetMacro(GenerateOriginalIds, bool);
+  vtkBooleanMacro(GenerateOriginalIds, bool);
+  vtkGetMacro(GenerateOriginalIds, bool);
+  ///@}
+
+  /**
+   * Reorder the points and cells of the given vtkUnstructuredGrid or
+   * vtkPolyData with the settings of this filter, replacing its points,
+   * cells and attributes. Return false if the dataset type is not
+   * supported.
+   */
+  bool ReorderInPlace(vtkPointSet* dataset);
+
+protected:
+  vtkSpatialReorderFilter();
+  ~vtkSpatialReorderFilter() override = default;
+
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  /**
+   * Produce the reordered output from the input, which have the same type.
+   */
+  bool Reorder(vtkPointSet* input, vtkPointSet* output);
+
+  int Curve;
+  bool ReorderPoints;
+  bool ReorderCells;
+  bool GenerateOriginalIds;
+
+private:
+  vtkSpatialReorderFilter(const vtkSpatialReorderFilter&) = delete;
+  void operator=(const vtkSpatialReorderFilter&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -29,14 +29,22 @@ using PointUses = unsigned char;
 
 // Helper functions to mark points used by cells taking into account
 // the point merging information.
-template <typename UType>
-void MarkUses(vtkIdType numIds, UType* connArray, vtkIdType* mergeMap, PointUses* ptUses)
+// The input cells are only read, so compact storages are not converted.
+struct MarkUses
 {
-  for (auto i = 0; i < numIds; ++i)
+  static constexpr bool SupportsCompactStorage = true;
+
+  template <typename CellStateT>
+  void operator()(CellStateT& state, vtkIdType* mergeMap, PointUses* ptUses)
   {
-    ptUses[mergeMap[connArray->GetValue(i)]] = 1;
+    auto* connArray = state.GetConnectivity();
+    const vtkIdType numIds = connArray->GetNumberOfValues();
+    for (vtkIdType i = 0; i < numIds; ++i)
+    {
+      ptUses[mergeMap[connArray->GetValue(i)]] = 1;
+    }
   }
-}
+};
 
 //------------------------------------------------------------------------------
 // Fast, threaded method to copy new points and attribute data to the output.
@@ -533,17 +541,7 @@ int vtkStaticCleanUnstructuredGrid::RequestData(vtkInformation* vtkNotUsed(reque
 void vtkStaticCleanUnstructuredGrid::MarkPointUses(
   vtkCellArray* ca, vtkIdType* mergeMap, PointUses* ptUses)
 {
-  vtkIdType numConn = ca->GetNumberOfConnectivityIds();
-  if (ca->IsStorage64Bit())
-  {
-    vtkTypeInt64Array* conn = ca->GetConnectivityArray64();
-    MarkUses<vtkTypeInt64Array>(numConn, conn, mergeMap, ptUses);
-  }
-  else
-  {
-    vtkTypeInt32Array* conn = ca->GetConnectivityArray32();
-    MarkUses<vtkTypeInt32Array>(numConn, conn, mergeMap, ptUses);
-  }
+  ca->Visit(MarkUses{}, mergeMap, ptUses);
 }
 
 //------------------------------------------------------------------------------
@@ -61,6 +61,47 @@ vtkMTimeType vtkExtractGeometry::GetMTime()
 
 namespace
 {
+//------------------------------------------------------------------------------
+// Evaluate the implicit function by blocks of points: the coordinates of a block
+// are gathered into separate x, y and z arrays so that the function can evaluate
+// them with vtkImplicitFunction::FunctionValueBatch, and then the values of the
+// block are passed to the store functor. Abort is checked once per block.
+template <typename TPointsArray, typename TStore>
+void EvaluatePointsByBlocks(vtkExtractGeometry* self, TPointsArray* pointsArray,
+  vtkImplicitFunction* implicitFunction, vtkIdType beginPointId, vtkIdType endPointId,
+  TStore&& store)
+{
+  constexpr vtkIdType blockSize = 256;
+  const auto& points = vtk::DataArrayTupleRange<3>(pointsArray);
+  double point[3];
+  double x[blockSize], y[blockSize], z[blockSize], values[blockSize];
+  const bool isFirst = vtkSMPTools::GetSingleThread();
+  for (vtkIdType blockBegin = beginPointId; blockBegin < endPointId; blockBegin += blockSize)
+  {
+    if (isFirst)
+    {
+      self->CheckAbort();
+    }
+    if (self->GetAbortOutput())
+    {
+      break;
+    }
+    const vtkIdType size = std::min(blockSize, endPointId - blockBegin);
+    for (vtkIdType i = 0; i < size; ++i)
+    {
+      // GetTuple creates a copy of the tuple using GetTypedTuple if it's not a vktDataArray
+      // we do that since the input points can be implicit points, and GetTypedTuple is faster
+      // than accessing the component of the TupleReference using GetTypedComponent internally.
+      points.GetTuple(blockBegin + i, point);
+      x[i] = point[0];
+      y[i] = point[1];
+      z[i] = point[2];
+    }
+    implicitFunction->FunctionValueBatch(size, x, y, z, values);
+    store(blockBegin, size, values);
+  }
+}
+
 //------------------------------------------------------------------------------
 template <typename TPointsArray>
 struct EvaluatePointsInsidenessFunctor
@@ -84,33 +125,17 @@ struct EvaluatePointsInsidenessFunctor
 
   void operator()(vtkIdType beginPointId, vtkIdType endPointId)
   {
-    const auto& points = vtk::DataArrayTupleRange<3>(this->PointsArray);
     auto insideness = vtk::DataArrayValueRange<1>(this->InsidenessArray);
-
-    double point[3];
-    const bool isFirst = vtkSMPTools::GetSingleThread();
-    const auto checkAbortInterval = std::min((endPointId - beginPointId) / 10 + 1, (vtkIdType)1000);
-    for (vtkIdType pointId = beginPointId; pointId < endPointId; ++pointId)
-    {
-      if (pointId % checkAbortInterval == 0)
+    const double multiplier = this->Multiplier;
+    EvaluatePointsByBlocks(this->Self, this->PointsArray, this->ImplicitFunction, beginPointId,
+      endPointId,
+      [&](vtkIdType blockBegin, vtkIdType size, const double* values)
       {
-        if (isFirst)
-        {
-          this->Self->CheckAbort();
-        }
-        if (this->Self->GetAbortOutput())
+        for (vtkIdType i = 0; i < size; ++i)
         {
-          break;
+          insideness[blockBegin + i] = static_cast<unsigned char>(values[i] * multiplier < 0.0);
         }
-      }
-      // GetTuple creates a copy of the tuple using GetTypedTuple if it's not a vktDataArray
-      // we do that since the input points can be implicit points, and GetTypedTuple is faster
-      // than accessing the component of the TupleReference using GetTypedComponent internally.
-      points.GetTuple(pointId, point);
-
-      const auto scalar = this->ImplicitFunction->FunctionValue(point) * this->Multiplier;
-      insideness[pointId] = static_cast<unsigned char>(scalar < 0.0);
-    }
+      });
   }
 };
 
@@ -150,32 +175,17 @@ struct EvaluatePointsScalarsFunctor
 
   void operator()(vtkIdType beginPointId, vtkIdType endPointId)
   {
-    const auto& points = vtk::DataArrayTupleRange<3>(this->PointsArray);
     auto scalars = vtk::DataArrayValueRange<1>(this->ScalarsArray);
-
-    double point[3];
-    const bool isFirst = vtkSMPTools::GetSingleThread();
-    const auto checkAbortInterval = std::min((endPointId - beginPointId) / 10 + 1, (vtkIdType)1000);
-    for (vtkIdType pointId = beginPointId; pointId < endPointId; ++pointId)
-    {
-      if (pointId % checkAbortInterval == 0)
+    const double multiplier = this->Multiplier;
+    EvaluatePointsByBlocks(this->Self, this->PointsArray, this->ImplicitFunction, beginPointId,
+      endPointId,
+      [&](vtkIdType blockBegin, vtkIdType size, const double* values)
       {
-        if (isFirst)
+        for (vtkIdType i = 0; i < size; ++i)
         {
-          this->Self->CheckAbort();
-        }
-        if (this->Self->GetAbortOutput())
-        {
-          break;
+          scalars[blockBegin + i] = values[i] * multiplier;
         }
-      }
-      // GetTuple creates a copy of the tuple using GetTypedTuple if it's not a vktDataArray
-      // we do that since the input points can be implicit points, and GetTypedTuple is faster
-      // than accessing the component of the TupleReference using GetTypedComponent internally.
-      points.GetTuple(pointId, point);
-
-      scalars[pointId] = this->ImplicitFunction->FunctionValue(point) * this->Multiplier;
-    }
+      });
   }
 };
 
@@ -152,10 +152,13 @@ void vtkAbstractInterpolatedVelocityField::Initialize(vtkCompositeDataSet* compD
                  vtkCellLocatorStrategy::SafeDownCast(datasetInfo.Strategy))
       {
         auto providedCellLocatorStrategy = vtkCellLocatorStrategy::SafeDownCast(strategy);
-        // if locator is set, create a new instance of it and set it on the strategy
+        // if locator is set, create a new instance of it with the same parameters and set it on
+        // the strategy
         if (auto cellLocator = providedCellLocatorStrategy->GetCellLocator())
         {
-          cellLocatorStrategy->SetCellLocator(vtk::TakeSmartPointer(cellLocator->NewInstance()));
+          auto newCellLocator = vtk::TakeSmartPointer(cellLocator->NewInstance());
+          newCellLocator->CopyParameters(cellLocator);
+          cellLocatorStrategy->SetCellLocator(newCellLocator);
         }
       }
       datasetInfo.Strategy->Initialize(pointSet);
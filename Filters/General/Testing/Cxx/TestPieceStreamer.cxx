@@ -0,0 +1,262 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that vtkPieceStreamer streams its input by pieces, merges them with
+// the append, sum, histogram and bounds reducers, and increases the number of
+// pieces to meet its memory limit, unless the reducer alone exceeds it, and
+// that the execution following a failed reduction streams all the pieces again.
+
+#include "vtkAppendPieceReducer.h"
+#include "vtkBoundsPieceReducer.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCommand.h"
+#include "vtkDoubleArray.h"
+#include "vtkExecutive.h"
+#include "vtkFieldData.h"
+#include "vtkHistogramPieceReducer.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPieceStreamer.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkSumPieceReducer.h"
+#include "vtkTable.h"
+#include "vtkTestErrorObserver.h"
+#include "vtkUnstructuredGrid.h"
+#include "vtkUnstructuredGridAlgorithm.h"
+
+#include <cstdlib>
+#include <iostream>
+
+// Produce the vertices (i, 0, 0) of a range of ids in each piece, with the id
+// as point and cell data.
+class vtkVertexPieceSource : public vtkUnstructuredGridAlgorithm
+{
+public:
+  static vtkVertexPieceSource* New();
+  vtkTypeMacro(vtkVertexPieceSource, vtkUnstructuredGridAlgorithm);
+
+  vtkIdType NumberOfVertices = 1000;
+  int NumberOfExecutions = 0;
+  int NumberOfPieces = 0;
+
+protected:
+  vtkVertexPieceSource() { this->SetNumberOfInputPorts(0); }
+  ~vtkVertexPieceSource() override = default;
+
+  int RequestInformation(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    outputVector->GetInformationObject(0)->Set(CAN_HANDLE_PIECE_REQUEST(), 1);
+    return 1;
+  }
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    const int piece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+    this->NumberOfPieces =
+      outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES());
+    const vtkIdType begin = piece * this->NumberOfVertices / this->NumberOfPieces;
+    const vtkIdType end = (piece + 1) * this->NumberOfVertices / this->NumberOfPieces;
+
+    vtkNew<vtkPoints> points;
+    vtkNew<vtkCellArray> vertices;
+    vtkNew<vtkDoubleArray> pointValues;
+    pointValues->SetName("Value");
+    vtkNew<vtkDoubleArray> cellValues;
+    cellValues->SetName("Value");
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const vtkIdType pointId = points->InsertNextPoint(static_cast<double>(i), 0.0, 0.0);
+      vertices->InsertNextCell(1, &pointId);
+      pointValues->InsertNextValue(static_cast<double>(i));
+      cellValues->InsertNextValue(static_cast<double>(i));
+    }
+    vtkUnstructuredGrid* output = vtkUnstructuredGrid::GetData(outInfo);
+    output->SetPoints(points);
+    output->SetCells(VTK_VERTEX, vertices);
+    output->GetPointData()->AddArray(pointValues);
+    output->GetCellData()->AddArray(cellValues);
+    ++this->NumberOfExecutions;
+    return 1;
+  }
+
+private:
+  vtkVertexPieceSource(const vtkVertexPieceSource&) = delete;
+  void operator=(const vtkVertexPieceSource&) = delete;
+};
+vtkStandardNewMacro(vtkVertexPieceSource);
+
+// Sum the pieces, failing the reduction of a given piece.
+class vtkFailingPieceReducer : public vtkSumPieceReducer
+{
+public:
+  static vtkFailingPieceReducer* New();
+  vtkTypeMacro(vtkFailingPieceReducer, vtkSumPieceReducer);
+
+  int FailingPiece = -1;
+  int NumberOfReductions = 0;
+
+  int Reduce(vtkDataObject* piece) override
+  {
+    if (this->NumberOfReductions++ == this->FailingPiece)
+    {
+      return 0;
+    }
+    return this->Superclass::Reduce(piece);
+  }
+
+protected:
+  vtkFailingPieceReducer() = default;
+  ~vtkFailingPieceReducer() override = default;
+
+private:
+  vtkFailingPieceReducer(const vtkFailingPieceReducer&) = delete;
+  void operator=(const vtkFailingPieceReducer&) = delete;
+};
+vtkStandardNewMacro(vtkFailingPieceReducer);
+
+int TestPieceStreamer(int, char*[])
+{
+  vtkNew<vtkVertexPieceSource> source;
+  const vtkIdType n = source->NumberOfVertices;
+  vtkNew<vtkPieceStreamer> streamer;
+  streamer->SetInputConnection(source->GetOutputPort());
+  streamer->SetNumberOfStreamDivisions(4);
+
+  // Append
+  streamer->Update();
+  vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(streamer->GetOutputDataObject(0));
+  if (!grid || grid->GetNumberOfPoints() != n || grid->GetNumberOfCells() != n ||
+    source->NumberOfExecutions != 4 || source->NumberOfPieces != 4)
+  {
+    std::cerr << "Error: wrong appended pieces" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Sum
+  vtkNew<vtkSumPieceReducer> sum;
+  streamer->SetReducer(sum);
+  streamer->Update();
+  vtkTable* table = vtkTable::SafeDownCast(streamer->GetOutputDataObject(0));
+  if (!table || table->GetNumberOfRows() != 2 ||
+    table->GetValueByName(0, "Association").ToString() != "Points" ||
+    table->GetValueByName(1, "Association").ToString() != "Cells" ||
+    table->GetValueByName(0, "Count").ToLongLong() != n ||
+    table->GetValueByName(1, "Sum").ToDouble() != n * (n - 1) / 2.0 ||
+    vtkIdTypeArray::SafeDownCast(table->GetFieldData()->GetArray("NumberOfCells"))->GetValue(0) !=
+      n)
+  {
+    std::cerr << "Error: wrong sums" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Histogram
+  vtkNew<vtkHistogramPieceReducer> histogram;
+  histogram->SetArrayName("Value");
+  histogram->SetBinCount(10);
+  histogram->SetBinRange(0.0, static_cast<double>(n));
+  streamer->SetReducer(histogram);
+  streamer->Update();
+  table = vtkTable::SafeDownCast(streamer->GetOutputDataObject(0));
+  if (!table || table->GetNumberOfRows() != 10)
+  {
+    std::cerr << "Error: wrong histogram" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType bin = 0; bin < 10; ++bin)
+  {
+    if (table->GetValueByName(bin, "bin_values").ToLongLong() != n / 10 ||
+      table->GetValueByName(bin, "bin_extents").ToDouble() != (bin + 0.5) * n / 10)
+    {
+      std::cerr << "Error: wrong bin " << bin << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Bounds
+  vtkNew<vtkBoundsPieceReducer> bounds;
+  streamer->SetReducer(bounds);
+  streamer->Update();
+  table = vtkTable::SafeDownCast(streamer->GetOutputDataObject(0));
+  if (!table || table->GetValueByName(0, "Minimum").ToDouble() != 0.0 ||
+    table->GetValueByName(0, "Maximum").ToDouble() != n - 1.0 ||
+    table->GetValueByName(1, "Maximum").ToDouble() != 0.0)
+  {
+    std::cerr << "Error: wrong bounds" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Memory limit: the pieces are divided until they fit.
+  source->NumberOfVertices = 100000;
+  source->Modified();
+  streamer->SetNumberOfStreamDivisions(1);
+  streamer->Update();
+  const unsigned long wholeSize = streamer->GetPeakMemorySize();
+  streamer->SetMemoryLimit(wholeSize / 5);
+  streamer->Update();
+  table = vtkTable::SafeDownCast(streamer->GetOutputDataObject(0));
+  if (streamer->GetLastNumberOfStreamDivisions() < 8 ||
+    streamer->GetLastNumberOfStreamDivisions() != source->NumberOfPieces ||
+    streamer->GetNumberOfStreamDivisions() != 1 ||
+    streamer->GetPeakMemorySize() > streamer->GetMemoryLimit() ||
+    table->GetValueByName(0, "Maximum").ToDouble() != 100000 - 1.0)
+  {
+    std::cerr << "Error: memory limit not met, " << streamer->GetLastNumberOfStreamDivisions()
+              << " divisions, " << streamer->GetPeakMemorySize() << " KiB of " << wholeSize
+              << " KiB" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Memory limit with the append reducer: the appended pieces alone exceed the
+  // limit, so the divisions stop increasing once its growth is known.
+  vtkNew<vtkAppendPieceReducer> append;
+  streamer->SetReducer(append);
+  vtkNew<vtkTest::ErrorObserver> warnings;
+  streamer->AddObserver(vtkCommand::WarningEvent, warnings);
+  streamer->Update();
+  grid = vtkUnstructuredGrid::SafeDownCast(streamer->GetOutputDataObject(0));
+  if (!warnings->GetWarning() || streamer->GetLastNumberOfStreamDivisions() > 16 ||
+    !grid || grid->GetNumberOfPoints() != 100000)
+  {
+    std::cerr << "Error: wrong memory limit of the append reducer, "
+              << streamer->GetLastNumberOfStreamDivisions() << " divisions" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Failed reduction: the next execution starts again from the first piece.
+  vtkNew<vtkFailingPieceReducer> failing;
+  failing->FailingPiece = 2;
+  streamer->SetReducer(failing);
+  streamer->SetMemoryLimit(0);
+  streamer->SetNumberOfStreamDivisions(4);
+  vtkNew<vtkTest::ErrorObserver> errors;
+  streamer->GetExecutive()->AddObserver(vtkCommand::ErrorEvent, errors);
+  streamer->Update();
+  if (!errors->GetError() || failing->NumberOfReductions != 3)
+  {
+    std::cerr << "Error: the reduction did not fail" << std::endl;
+    return EXIT_FAILURE;
+  }
+  failing->FailingPiece = -1;
+  failing->NumberOfReductions = 0;
+  streamer->Modified();
+  streamer->Update();
+  table = vtkTable::SafeDownCast(streamer->GetOutputDataObject(0));
+  if (failing->NumberOfReductions != 4 || streamer->GetLastNumberOfStreamDivisions() != 4 ||
+    !table || table->GetValueByName(0, "Count").ToLongLong() != 100000 ||
+    table->GetValueByName(0, "Sum").ToDouble() != 100000.0 * (100000 - 1) / 2.0)
+  {
+    std::cerr << "Error: incomplete execution after a failure, "
+              << failing->NumberOfReductions << " reductions" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkAppendPieceReducer.h"
+
+#include "vtkAppendFilter.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataSet.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkAppendPieceReducer);
+
+//------------------------------------------------------------------------------
+vtkAppendPieceReducer::vtkAppendPieceReducer()
+  : MergePoints(0)
+  , Append(vtkAppendFilter::New())
+  , MemorySize(0)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkAppendPieceReducer::~vtkAppendPieceReducer()
+{
+  this->Append->Delete();
+}
+
+//------------------------------------------------------------------------------
+int vtkAppendPieceReducer::GetOutputDataObjectType()
+{
+  return VTK_UNSTRUCTURED_GRID;
+}
+
+//------------------------------------------------------------------------------
+void vtkAppendPieceReducer::Initialize()
+{
+  this->Append->RemoveAllInputConnections(0);
+  this->Append->GetOutput()->Initialize();
+  this->MemorySize = 0;
+}
+
+//------------------------------------------------------------------------------
+int vtkAppendPieceReducer::Reduce(vtkDataObject* piece)
+{
+  for (vtkDataSet* dataSet : vtkCompositeDataSet::GetDataSets<vtkDataSet>(piece))
+  {
+    if (dataSet->GetNumberOfPoints() == 0 && dataSet->GetNumberOfCells() == 0)
+    {
+      continue;
+    }
+    // The piece is overwritten by the next pass, keep a shallow copy.
+    vtkSmartPointer<vtkDataSet> copy = vtk::TakeSmartPointer(dataSet->NewInstance());
+    copy->ShallowCopy(dataSet);
+    this->Append->AddInputData(copy);
+    this->MemorySize += copy->GetActualMemorySize();
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkAppendPieceReducer::Finalize(vtkDataObject* output)
+{
+  vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(output);
+  if (!grid)
+  {
+    vtkErrorMacro("The output is not an unstructured grid.");
+    return 0;
+  }
+  if (this->Append->GetNumberOfInputConnections(0) == 0)
+  {
+    grid->Initialize();
+    return 1;
+  }
+  this->Append->SetMergePoints(this->MergePoints);
+  this->Append->Update();
+  grid->ShallowCopy(this->Append->GetOutput());
+  this->Initialize();
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkAppendPieceReducer::GetActualMemorySize()
+{
+  return this->MemorySize;
+}
+
+//------------------------------------------------------------------------------
+void vtkAppendPieceReducer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "MergePoints: " << this->MergePoints << endl;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkAppendPieceReducer
+ * @brief   reducer appending the pieces in an unstructured grid
+ *
+ * vtkAppendPieceReducer appends the datasets of the pieces streamed by
+ * vtkPieceStreamer with vtkAppendFilter. All the pieces are kept in memory, so
+ * it is meant for pieces reduced upstream, e.g. by a surface or contour
+ * filter. Points shared by several pieces are duplicated unless MergePoints
+ * is on.
+ *
+ * @sa
+ * vtkPieceStreamer vtkAppendFilter
+ */
+
+#ifndef vtkAppendPieceReducer_h
+#define vtkAppendPieceReducer_h
+
+#include "vtkFiltersGeneralModule.h" // For export macro
+#include "vtkPieceReducer.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkAppendFilter;
+
+class VTKFILTERSGENERAL_EXPORT vtkAppendPieceReducer : public vtkPieceReducer
+{
+public:
+  static vtkAppendPieceReducer* New();
+  vtkTypeMacro(vtkAppendPieceReducer, vtkPieceReducer);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/get whether the coincident points of the pieces are merged.
+   * By default this is off.
+   */
+  vtkSetMacro(MergePoints, vtkTypeBool);
+  vtkGetMacro(MergePoints, vtkTypeBool);
+  vtkBooleanMacro(MergePoints, vtkTypeBool);
+  ///@}
+
+  int GetOutputDataObjectType() override;
+  void Initialize() override;
+  int Reduce(vtkDataObject* piece) override;
+  int Finalize(vtkDataObject* output) override;
+  unsigned long GetActualMemorySize() override;
+
+protected:
+  vtkAppendPieceReducer();
+  ~vtkAppendPieceReducer() override;
+
+  vtkTypeBool MergePoints;
+
+private:
+  vtkAppendPieceReducer(const vtkAppendPieceReducer&) = delete;
+  void operator=(const vtkAppendPieceReducer&) = delete;
+
+  vtkAppendFilter* Append;
+  unsigned long MemorySize;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkBoundsPieceReducer.h"
+
+#include "vtkCompositeDataSet.h"
+#include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkTable.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkBoundsPieceReducer);
+
+//------------------------------------------------------------------------------
+vtkBoundsPieceReducer::vtkBoundsPieceReducer() = default;
+
+//------------------------------------------------------------------------------
+vtkBoundsPieceReducer::~vtkBoundsPieceReducer() = default;
+
+//------------------------------------------------------------------------------
+int vtkBoundsPieceReducer::GetOutputDataObjectType()
+{
+  return VTK_TABLE;
+}
+
+//------------------------------------------------------------------------------
+void vtkBoundsPieceReducer::Initialize()
+{
+  this->Bounds.Reset();
+}
+
+//------------------------------------------------------------------------------
+int vtkBoundsPieceReducer::Reduce(vtkDataObject* piece)
+{
+  for (vtkDataSet* dataSet : vtkCompositeDataSet::GetDataSets<vtkDataSet>(piece))
+  {
+    if (dataSet->GetNumberOfPoints() > 0)
+    {
+      this->Bounds.AddBounds(dataSet->GetBounds());
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkBoundsPieceReducer::Finalize(vtkDataObject* output)
+{
+  vtkTable* table = vtkTable::SafeDownCast(output);
+  if (!table)
+  {
+    vtkErrorMacro("The output is not a table.");
+    return 0;
+  }
+
+  double bounds[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+  if (this->Bounds.IsValid())
+  {
+    this->Bounds.GetBounds(bounds);
+  }
+  vtkNew<vtkDoubleArray> minimum;
+  minimum->SetName("Minimum");
+  minimum->SetNumberOfTuples(3);
+  vtkNew<vtkDoubleArray> maximum;
+  maximum->SetName("Maximum");
+  maximum->SetNumberOfTuples(3);
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    minimum->SetValue(axis, bounds[2 * axis]);
+    maximum->SetValue(axis, bounds[2 * axis + 1]);
+  }
+
+  table->Initialize();
+  table->AddColumn(minimum);
+  table->AddColumn(maximum);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkBoundsPieceReducer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
+VTK_ABI_NAMESPACE_END
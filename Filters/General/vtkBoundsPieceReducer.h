@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkBoundsPieceReducer
+ * @brief   reducer computing the bounds of the pieces
+ *
+ * vtkBoundsPieceReducer computes the bounding box of the pieces streamed by
+ * vtkPieceStreamer. The output is a table with one row per axis and the
+ * columns "Minimum" and "Maximum". Both are 0 when all the pieces are empty.
+ *
+ * @sa
+ * vtkPieceStreamer
+ */
+
+#ifndef vtkBoundsPieceReducer_h
+#define vtkBoundsPieceReducer_h
+
+#include "vtkBoundingBox.h" // For Bounds
+#include "vtkFiltersGeneralModule.h" // For export macro
+#include "vtkPieceReducer.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKFILTERSGENERAL_EXPORT vtkBoundsPieceReducer : public vtkPieceReducer
+{
+public:
+  static vtkBoundsPieceReducer* New();
+  vtkTypeMacro(vtkBoundsPieceReducer, vtkPieceReducer);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  int GetOutputDataObjectType() override;
+  void Initialize() override;
+  int Reduce(vtkDataObject* piece) override;
+  int Finalize(vtkDataObject* output) override;
+
+protected:
+  vtkBoundsPieceReducer();
+  ~vtkBoundsPieceReducer() override;
+
+private:
+  vtkBoundsPieceReducer(const vtkBoundsPieceReducer&) = delete;
+  void operator=(const vtkBoundsPieceReducer&) = delete;
+
+  vtkBoundingBox Bounds;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
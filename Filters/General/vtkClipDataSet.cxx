@@ -19,11 +19,15 @@
 #include "vtkNonLinearCell.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
 #include "vtkPolyhedron.h"
 #include "vtkSmartPointer.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkClipDataSet);
 vtkCxxSetObjectMacro(vtkClipDataSet, ClipFunction, vtkImplicitFunction);
@@ -286,11 +290,34 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
     {
       inPD->SetScalars(tmpScalars);
     }
-    double pt[3];
-    for (i = 0; i < numPts; i++)
+    vtkPointSet* inputPointSet = vtkPointSet::SafeDownCast(input);
+    if (inputPointSet && inputPointSet->GetPoints())
     {
-      input->GetPoint(i, pt);
-      tmpScalars->SetValue(i, this->ClipFunction->FunctionValue(pt));
+      // evaluate all the points at once, in parallel and by batches
+      this->ClipFunction->FunctionValue(inputPointSet->GetPoints()->GetData(), tmpScalars);
+    }
+    else
+    {
+      // evaluate the points by batches of coordinates
+      constexpr vtkIdType batchSize = 256;
+      double pt[3];
+      double x[batchSize], y[batchSize], z[batchSize], values[batchSize];
+      for (vtkIdType batchBegin = 0; batchBegin < numPts; batchBegin += batchSize)
+      {
+        const vtkIdType size = std::min(batchSize, numPts - batchBegin);
+        for (i = 0; i < size; i++)
+        {
+          input->GetPoint(batchBegin + i, pt);
+          x[i] = pt[0];
+          y[i] = pt[1];
+          z[i] = pt[2];
+        }
+        this->ClipFunction->FunctionValueBatch(size, x, y, z, values);
+        for (i = 0; i < size; i++)
+        {
+          tmpScalars->SetValue(batchBegin + i, values[i]);
+        }
+      }
     }
     clipScalars = tmpScalars;
   }
@@ -334,6 +361,12 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
     outCD[1]->CopyAllocate(inCD, estimatedSize, estimatedSize / 2);
   }
 
+  // Polyhedra are loaded with precomputed canonical faces and edges.
+  if (vtkUnstructuredGrid* inputGrid = vtkUnstructuredGrid::SafeDownCast(input))
+  {
+    inputGrid->BuildPolyhedronTopology();
+  }
+
   // Process all cells and clip each in turn
   //
   bool abort = false;
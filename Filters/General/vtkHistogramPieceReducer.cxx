@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkHistogramPieceReducer.h"
+
+#include "vtkArrayDispatch.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArrayRange.h"
+#include "vtkDataSet.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkTable.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkHistogramPieceReducer);
+
+namespace
+{
+struct HistogramWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, int component, vtkUnsignedCharArray* ghosts,
+    unsigned char duplicate, const double range[2], std::vector<vtkIdType>& bins)
+  {
+    const int binCount = static_cast<int>(bins.size());
+    const double width = (range[1] - range[0]) / binCount;
+    const auto tuples = vtk::DataArrayTupleRange(array);
+    vtkIdType tupleId = 0;
+    for (const auto tuple : tuples)
+    {
+      if (ghosts && (ghosts->GetValue(tupleId++) & duplicate))
+      {
+        continue;
+      }
+      const double value = static_cast<double>(tuple[component]);
+      // Also rejects NaN.
+      if (!(value >= range[0] && value <= range[1]))
+      {
+        continue;
+      }
+      const int bin = width > 0.0 ? static_cast<int>((value - range[0]) / width) : 0;
+      ++bins[std::min(bin, binCount - 1)];
+    }
+  }
+};
+}
+
+//------------------------------------------------------------------------------
+vtkHistogramPieceReducer::vtkHistogramPieceReducer()
+  : ArrayAssociation(vtkDataObject::FIELD_ASSOCIATION_POINTS)
+  , Component(0)
+  , BinCount(10)
+{
+  this->BinRange[0] = 0.0;
+  this->BinRange[1] = 1.0;
+}
+
+//------------------------------------------------------------------------------
+vtkHistogramPieceReducer::~vtkHistogramPieceReducer() = default;
+
+//------------------------------------------------------------------------------
+int vtkHistogramPieceReducer::GetOutputDataObjectType()
+{
+  return VTK_TABLE;
+}
+
+//------------------------------------------------------------------------------
+void vtkHistogramPieceReducer::Initialize()
+{
+  this->Bins.assign(this->BinCount, 0);
+}
+
+//------------------------------------------------------------------------------
+int vtkHistogramPieceReducer::Reduce(vtkDataObject* piece)
+{
+  if (this->Bins.size() != static_cast<size_t>(this->BinCount))
+  {
+    this->Initialize();
+  }
+  const bool points = this->ArrayAssociation == vtkDataObject::FIELD_ASSOCIATION_POINTS;
+  for (vtkDataSet* dataSet : vtkCompositeDataSet::GetDataSets<vtkDataSet>(piece))
+  {
+    vtkFieldData* attributes = dataSet->GetAttributesAsFieldData(this->ArrayAssociation);
+    vtkDataArray* array = attributes ? attributes->GetArray(this->ArrayName.c_str()) : nullptr;
+    if (!array || array->GetNumberOfTuples() == 0)
+    {
+      continue;
+    }
+    if (this->Component >= array->GetNumberOfComponents())
+    {
+      vtkErrorMacro("Array " << this->ArrayName << " has no component " << this->Component);
+      return 0;
+    }
+
+    vtkUnsignedCharArray* ghosts =
+      points ? dataSet->GetPointGhostArray() : dataSet->GetCellGhostArray();
+    const unsigned char duplicate = points
+      ? static_cast<unsigned char>(vtkDataSetAttributes::DUPLICATEPOINT)
+      : static_cast<unsigned char>(vtkDataSetAttributes::DUPLICATECELL);
+    HistogramWorker worker;
+    if (!vtkArrayDispatch::Dispatch::Execute(
+          array, worker, this->Component, ghosts, duplicate, this->BinRange, this->Bins))
+    {
+      worker(array, this->Component, ghosts, duplicate, this->BinRange, this->Bins);
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkHistogramPieceReducer::Finalize(vtkDataObject* output)
+{
+  vtkTable* table = vtkTable::SafeDownCast(output);
+  if (!table)
+  {
+    vtkErrorMacro("The output is not a table.");
+    return 0;
+  }
+  if (this->Bins.size() != static_cast<size_t>(this->BinCount))
+  {
+    this->Initialize();
+  }
+
+  vtkNew<vtkDoubleArray> binExtents;
+  binExtents->SetName("bin_extents");
+  binExtents->SetNumberOfTuples(this->BinCount);
+  vtkNew<vtkIdTypeArray> binValues;
+  binValues->SetName("bin_values");
+  binValues->SetNumberOfTuples(this->BinCount);
+  const double delta = (this->BinRange[1] - this->BinRange[0]) / this->BinCount;
+  for (int i = 0; i < this->BinCount; ++i)
+  {
+    binExtents->SetValue(i, this->BinRange[0] + (i + 0.5) * delta);
+    binValues->SetValue(i, this->Bins[i]);
+  }
+
+  table->Initialize();
+  table->AddColumn(binExtents);
+  table->AddColumn(binValues);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkHistogramPieceReducer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "ArrayName: " << this->ArrayName << endl;
+  os << indent << "ArrayAssociation: " << this->ArrayAssociation << endl;
+  os << indent << "Component: " << this->Component << endl;
+  os << indent << "BinCount: " << this->BinCount << endl;
+  os << indent << "BinRange: " << this->BinRange[0] << " " << this->BinRange[1] << endl;
+}
+VTK_ABI_NAMESPACE_END
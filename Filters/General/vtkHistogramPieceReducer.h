@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkHistogramPieceReducer
+ * @brief   reducer computing the histogram of an array of the pieces
+ *
+ * vtkHistogramPieceReducer counts the values of a component of a point or
+ * cell array of the pieces streamed by vtkPieceStreamer in BinCount bins
+ * evenly dividing BinRange. Since the range of the whole data is not known
+ * before streaming it, it must be set; the values outside of it, and the
+ * points and cells flagged as duplicated by the ghost arrays, are not
+ * counted. The output is a table with the columns "bin_extents", the centers
+ * of the bins, and "bin_values", the counts, as with vtkExtractHistogram.
+ *
+ * @sa
+ * vtkPieceStreamer vtkExtractHistogram
+ */
+
+#ifndef vtkHistogramPieceReducer_h
+#define vtkHistogramPieceReducer_h
+
+#include "vtkFiltersGeneralModule.h" // For export macro
+#include "vtkPieceReducer.h"
+
+#include <string> // For ArrayName
+#include <vector> // For Bins
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKFILTERSGENERAL_EXPORT vtkHistogramPieceReducer : public vtkPieceReducer
+{
+public:
+  static vtkHistogramPieceReducer* New();
+  vtkTypeMacro(vtkHistogramPieceReducer, vtkPieceReducer);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/get the name of the array to count.
+   */
+  vtkSetMacro(ArrayName, std::string);
+  vtkGetMacro(ArrayName, std::string);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the association of the array, vtkDataObject::FIELD_ASSOCIATION_POINTS
+   * or vtkDataObject::FIELD_ASSOCIATION_CELLS. By default this is the points.
+   */
+  vtkSetMacro(ArrayAssociation, int);
+  vtkGetMacro(ArrayAssociation, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the component of the array to count. By default this is 0.
+   */
+  vtkSetClampMacro(Component, int, 0, VTK_INT_MAX);
+  vtkGetMacro(Component, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the number of bins. By default this is 10.
+   */
+  vtkSetClampMacro(BinCount, int, 1, VTK_INT_MAX);
+  vtkGetMacro(BinCount, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the range of the bins. By default this is [0, 1].
+   */
+  vtkSetVector2Macro(BinRange, double);
+  vtkGetVector2Macro(BinRange, double);
+  ///@}
+
+  int GetOutputDataObjectType() override;
+  void Initialize() override;
+  int Reduce(vtkDataObject* piece) override;
+  int Finalize(vtkDataObject* output) override;
+
+protected:
+  vtkHistogramPieceReducer();
+  ~vtkHistogramPieceReducer() override;
+
+  std::string ArrayName;
+  int ArrayAssociation;
+  int Component;
+  int BinCount;
+  double BinRange[2];
+
+private:
+  vtkHistogramPieceReducer(const vtkHistogramPieceReducer&) = delete;
+  void operator=(const vtkHistogramPieceReducer&) = delete;
+
+  std::vector<vtkIdType> Bins;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,23 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPieceReducer.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+//------------------------------------------------------------------------------
+vtkPieceReducer::vtkPieceReducer() = default;
+
+//------------------------------------------------------------------------------
+vtkPieceReducer::~vtkPieceReducer() = default;
+
+//------------------------------------------------------------------------------
+unsigned long vtkPieceReducer::GetActualMemorySize()
+{
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkPieceReducer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPieceReducer
+ * @brief   abstract class merging the pieces streamed by vtkPieceStreamer
+ *
+ * vtkPieceReducer defines how vtkPieceStreamer merges the pieces of its input
+ * into its output. Initialize() is called before the first piece, Reduce()
+ * for each piece, and Finalize() after the last piece to produce the output.
+ * A reducer should keep as little of the pieces as possible, since the point
+ * of streaming is to never have the whole data in memory.
+ *
+ * @sa
+ * vtkPieceStreamer vtkAppendPieceReducer vtkSumPieceReducer
+ * vtkHistogramPieceReducer vtkBoundsPieceReducer
+ */
+
+#ifndef vtkPieceReducer_h
+#define vtkPieceReducer_h
+
+#include "vtkFiltersGeneralModule.h" // For export macro
+#include "vtkObject.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataObject;
+
+class VTKFILTERSGENERAL_EXPORT vtkPieceReducer : public vtkObject
+{
+public:
+  vtkTypeMacro(vtkPieceReducer, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Return the type of the output, e.g. VTK_UNSTRUCTURED_GRID or VTK_TABLE.
+   */
+  virtual int GetOutputDataObjectType() = 0;
+
+  /**
+   * Discard the pieces reduced so far. Called before the first piece.
+   */
+  virtual void Initialize() = 0;
+
+  /**
+   * Merge a piece. The piece is only valid during this call. Return 0 on
+   * error.
+   */
+  virtual int Reduce(vtkDataObject* piece) = 0;
+
+  /**
+   * Produce the output from the pieces reduced since Initialize(). Return 0
+   * on error.
+   */
+  virtual int Finalize(vtkDataObject* output) = 0;
+
+  /**
+   * Return the memory used by the pieces reduced so far, in kibibytes.
+   * The default implementation returns 0.
+   */
+  virtual unsigned long GetActualMemorySize();
+
+protected:
+  vtkPieceReducer();
+  ~vtkPieceReducer() override;
+
+private:
+  vtkPieceReducer(const vtkPieceReducer&) = delete;
+  void operator=(const vtkPieceReducer&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
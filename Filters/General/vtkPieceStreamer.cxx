@@ -0,0 +1,351 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPieceStreamer.h"
+
+#include "vtkAppendPieceReducer.h"
+#include "vtkDataObject.h"
+#include "vtkDataObjectTypes.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <algorithm>
+#include <set>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkPieceStreamer);
+vtkCxxSetObjectMacro(vtkPieceStreamer, Reducer, vtkPieceReducer);
+
+namespace
+{
+unsigned long ComputeUpstreamMemorySize(
+  vtkAlgorithm* algorithm, std::set<vtkAlgorithm*>& algorithms, std::set<vtkDataObject*>& objects)
+{
+  unsigned long size = 0;
+  for (int port = 0; port < algorithm->GetNumberOfInputPorts(); ++port)
+  {
+    for (int connection = 0; connection < algorithm->GetNumberOfInputConnections(port);
+         ++connection)
+    {
+      vtkAlgorithm* producer = algorithm->GetInputAlgorithm(port, connection);
+      if (!producer || !algorithms.insert(producer).second)
+      {
+        continue;
+      }
+      for (int output = 0; output < producer->GetNumberOfOutputPorts(); ++output)
+      {
+        vtkDataObject* data = producer->GetOutputDataObject(output);
+        if (data && objects.insert(data).second)
+        {
+          size += data->GetActualMemorySize();
+        }
+      }
+      size += ComputeUpstreamMemorySize(producer, algorithms, objects);
+    }
+  }
+  return size;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkPieceStreamer::vtkPieceStreamer()
+  : Reducer(vtkAppendPieceReducer::New())
+  , MemoryLimit(0)
+  , NumberOfStreamDivisions(2)
+  , MaximumNumberOfStreamDivisions(4096)
+  , PeakMemorySize(0)
+  , Streaming(false)
+  , Restart(false)
+  , WarnedMemoryLimit(false)
+  , SplitMemorySize(0)
+  , InitialReducerMemorySize(0)
+{
+  this->SetNumberOfInputPorts(1);
+  this->SetNumberOfOutputPorts(1);
+
+  this->NumberOfPasses = 2;
+}
+
+//------------------------------------------------------------------------------
+vtkPieceStreamer::~vtkPieceStreamer()
+{
+  this->SetReducer(nullptr);
+}
+
+//------------------------------------------------------------------------------
+void vtkPieceStreamer::SetNumberOfStreamDivisions(int num)
+{
+  if (num < 1 || this->NumberOfStreamDivisions == num)
+  {
+    return;
+  }
+
+  this->Modified();
+  this->NumberOfStreamDivisions = num;
+  if (!this->Streaming)
+  {
+    this->NumberOfPasses = num;
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkMTimeType vtkPieceStreamer::GetMTime()
+{
+  vtkMTimeType mTime = this->Superclass::GetMTime();
+  if (this->Reducer)
+  {
+    mTime = std::max(mTime, this->Reducer->GetMTime());
+  }
+  return mTime;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeBool vtkPieceStreamer::ProcessRequest(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  if (request->Has(vtkDemandDrivenPipeline::REQUEST_DATA_OBJECT()))
+  {
+    return this->RequestDataObject(request, inputVector, outputVector);
+  }
+
+  return this->Superclass::ProcessRequest(request, inputVector, outputVector);
+}
+
+//------------------------------------------------------------------------------
+int vtkPieceStreamer::RequestDataObject(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
+{
+  if (!this->Reducer)
+  {
+    vtkErrorMacro("No reducer set.");
+    return 0;
+  }
+
+  // The type of the output depends on the reducer.
+  const int type = this->Reducer->GetOutputDataObjectType();
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+  if (!output || output->GetDataObjectType() != type)
+  {
+    vtkSmartPointer<vtkDataObject> newOutput =
+      vtk::TakeSmartPointer(vtkDataObjectTypes::NewDataObject(type));
+    if (!newOutput)
+    {
+      vtkErrorMacro("Cannot create an output of type " << type << ".");
+      return 0;
+    }
+    outInfo->Set(vtkDataObject::DATA_OBJECT(), newOutput);
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkPieceStreamer::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  // get the info object
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+
+  // Each execution starts with the requested number of divisions, the memory
+  // limit may increase it while streaming.
+  if (!this->Streaming && this->CurrentIndex == 0)
+  {
+    this->NumberOfPasses = this->NumberOfStreamDivisions;
+  }
+
+  int outPiece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+  int outNumPieces = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES());
+
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER(),
+    outPiece * this->NumberOfPasses + this->CurrentIndex);
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES(),
+    outNumPieces * this->NumberOfPasses);
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkPieceStreamer::RequestData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  const int result = this->Superclass::RequestData(request, inputVector, outputVector);
+  if (!result)
+  {
+    // vtkStreamerBase returns before resetting the pass index when a pass or
+    // the reduction fails: start the next execution from scratch.
+    this->ResetExecution();
+    return 0;
+  }
+  if (this->Restart)
+  {
+    // Stream again from the first of the new pieces.
+    this->Restart = false;
+    this->CurrentIndex = 0;
+    request->Set(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING(), 1);
+  }
+  return result;
+}
+
+//------------------------------------------------------------------------------
+int vtkPieceStreamer::ExecutePass(
+  vtkInformationVector** inputVector, vtkInformationVector* vtkNotUsed(outputVector))
+{
+  if (!this->Reducer)
+  {
+    vtkErrorMacro("No reducer set.");
+    return 0;
+  }
+
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkDataObject* input = inInfo->Get(vtkDataObject::DATA_OBJECT());
+
+  if (this->CurrentIndex == 0)
+  {
+    if (!this->Streaming)
+    {
+      this->Streaming = true;
+      this->WarnedMemoryLimit = false;
+      this->SplitMemorySize = 0;
+      this->PeakMemorySize = 0;
+    }
+    this->Reducer->Initialize();
+    this->InitialReducerMemorySize = this->Reducer->GetActualMemorySize();
+  }
+
+  // Only the pieces shrink with more divisions: the reducer holds the result
+  // of the previous pieces, which may grow up to the whole output.
+  const unsigned long pieceSize = this->ComputeInputPipelineMemorySize();
+  const unsigned long reducerSize = this->Reducer->GetActualMemorySize();
+  const unsigned long size = pieceSize + reducerSize;
+  if (this->MemoryLimit > 0 && size > this->MemoryLimit)
+  {
+    // Project the size of the reducer at the last pass from its growth over
+    // the previous ones, whatever the number of divisions.
+    unsigned long finalReducerSize = reducerSize;
+    if (this->CurrentIndex > 0 && reducerSize > this->InitialReducerMemorySize)
+    {
+      const double growth =
+        static_cast<double>(reducerSize - this->InitialReducerMemorySize) / this->CurrentIndex;
+      finalReducerSize += static_cast<unsigned long>(
+        growth * (this->NumberOfPasses - this->CurrentIndex));
+    }
+    const bool reducerFits = finalReducerSize < this->MemoryLimit;
+
+    // Smaller pieces only help if the reducer leaves room for them, and if
+    // the last split made the pieces smaller, which is not the case when the
+    // input pipeline cannot handle pieces.
+    const bool smaller = this->SplitMemorySize == 0 || pieceSize < this->SplitMemorySize;
+    if (reducerFits && smaller &&
+      this->NumberOfPasses * 2 <= static_cast<unsigned int>(this->MaximumNumberOfStreamDivisions))
+    {
+      vtkDebugMacro("Pass " << this->CurrentIndex << " uses " << pieceSize << " KiB of "
+                            << this->MemoryLimit - reducerSize
+                            << " KiB left by the reducer, streaming again with "
+                            << this->NumberOfPasses * 2 << " divisions.");
+      this->NumberOfPasses *= 2;
+      this->SplitMemorySize = pieceSize;
+      this->PeakMemorySize = 0;
+      this->Restart = true;
+      return 1;
+    }
+    if (!this->WarnedMemoryLimit)
+    {
+      if (!reducerFits)
+      {
+        vtkWarningMacro("The reducer is expected to use "
+          << finalReducerSize << " KiB, more than the memory limit of " << this->MemoryLimit
+          << " KiB, which more divisions cannot meet.");
+      }
+      else
+      {
+        vtkWarningMacro("Pass " << this->CurrentIndex << " uses " << size
+                                << " KiB, more than the memory limit of " << this->MemoryLimit
+                                << " KiB.");
+      }
+      this->WarnedMemoryLimit = true;
+    }
+  }
+
+  this->PeakMemorySize = std::max(this->PeakMemorySize, size);
+  if (!this->Reducer->Reduce(input))
+  {
+    return 0;
+  }
+  this->UpdateProgress(static_cast<double>(this->CurrentIndex + 1) / this->NumberOfPasses);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkPieceStreamer::PostExecute(
+  vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
+{
+  if (this->Restart)
+  {
+    return 1;
+  }
+  this->Streaming = false;
+
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+  return this->Reducer->Finalize(output);
+}
+
+//------------------------------------------------------------------------------
+void vtkPieceStreamer::ResetExecution()
+{
+  this->Streaming = false;
+  this->Restart = false;
+  this->CurrentIndex = 0;
+  this->NumberOfPasses = this->NumberOfStreamDivisions;
+  this->SplitMemorySize = 0;
+  this->InitialReducerMemorySize = 0;
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkPieceStreamer::ComputeInputPipelineMemorySize()
+{
+  std::set<vtkAlgorithm*> algorithms;
+  std::set<vtkDataObject*> objects;
+  return ComputeUpstreamMemorySize(this, algorithms, objects);
+}
+
+//------------------------------------------------------------------------------
+int vtkPieceStreamer::FillOutputPortInformation(int vtkNotUsed(port), vtkInformation* info)
+{
+  info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkDataObject");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkPieceStreamer::FillInputPortInformation(int vtkNotUsed(port), vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkDataObject");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkPieceStreamer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "NumberOfStreamDivisions: " << this->NumberOfStreamDivisions << endl;
+  os << indent << "LastNumberOfStreamDivisions: " << this->NumberOfPasses << endl;
+  os << indent << "MemoryLimit: " << this->MemoryLimit << endl;
+  os << indent << "MaximumNumberOfStreamDivisions: " << this->MaximumNumberOfStreamDivisions
+     << endl;
+  os << indent << "PeakMemorySize: " << this->PeakMemorySize << endl;
+  os << indent << "Reducer: ";
+  if (this->Reducer)
+  {
+    os << endl;
+    this->Reducer->PrintSelf(os, indent.GetNextIndent());
+  }
+  else
+  {
+    os << "(none)" << endl;
+  }
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPieceStreamer
+ * @brief   streams any input pipeline by pieces and reduces the pieces
+ *
+ * vtkPieceStreamer executes its input pipeline once per piece, requesting
+ * piece CurrentIndex of NumberOfStreamDivisions through UPDATE_PIECE_NUMBER()
+ * and UPDATE_NUMBER_OF_PIECES(), and merges the pieces with a
+ * vtkPieceReducer: vtkAppendPieceReducer (the default), vtkSumPieceReducer,
+ * vtkHistogramPieceReducer, vtkBoundsPieceReducer or a custom one. Unlike
+ * vtkImageDataStreamer, it works with any data type, so that unstructured
+ * data larger than the memory can be reduced to a surface or statistics by
+ * readers that read pieces, such as the XML, HDF and IOSS readers:
+ *
+ * @code{.cpp}
+ * reader->SetFileName("huge.vtkhdf");
+ * contour->SetInputConnection(reader->GetOutputPort());
+ * vtkNew<vtkPieceStreamer> streamer;
+ * streamer->SetInputConnection(contour->GetOutputPort());
+ * streamer->SetNumberOfStreamDivisions(64);
+ * streamer->SetMemoryLimit(8 * 1024 * 1024); // 8 GiB
+ * streamer->Update();
+ * @endcode
+ *
+ * When MemoryLimit is set, the memory used by each pass is measured once the
+ * piece is executed: the size of the data objects of the input pipeline plus
+ * the memory used by the reducer. When the input pipeline uses more than the
+ * memory left by the reducer, the number of stream divisions is doubled, up
+ * to MaximumNumberOfStreamDivisions, and streaming starts over, since the
+ * pieces of different divisions do not nest in general. Smaller pieces do not
+ * help when the reducer itself is expected to exceed the limit, its size at
+ * the last pass being projected from its growth over the previous passes, as
+ * for the append reducer of a large output: a warning is emitted instead.
+ * Since the size of a piece is only known once it is read,
+ * NumberOfStreamDivisions should be large enough for the first piece to fit.
+ * The increased number of divisions only applies to the current execution,
+ * see GetLastNumberOfStreamDivisions().
+ *
+ * Algorithms of the input pipeline that cannot handle piece requests produce
+ * the whole data for the first piece and nothing for the others. Points
+ * shared by pieces are usually duplicated, see the reducers.
+ *
+ * @sa
+ * vtkPieceReducer vtkPolyDataStreamer vtkMemoryLimitImageDataStreamer
+ */
+
+#ifndef vtkPieceStreamer_h
+#define vtkPieceStreamer_h
+
+#include "vtkFiltersGeneralModule.h" // For export macro
+#include "vtkStreamerBase.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkPieceReducer;
+
+class VTKFILTERSGENERAL_EXPORT vtkPieceStreamer : public vtkStreamerBase
+{
+public:
+  static vtkPieceStreamer* New();
+  vtkTypeMacro(vtkPieceStreamer, vtkStreamerBase);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/get the reducer merging the pieces. By default this is a
+   * vtkAppendPieceReducer.
+   */
+  void SetReducer(vtkPieceReducer* reducer);
+  vtkGetObjectMacro(Reducer, vtkPieceReducer);
+  ///@}
+
+  ///@{
+  /**
+   * Set the number of pieces to divide the problem into. By default this is 2.
+   * Each execution starts with this number, even if the previous one
+   * increased it to meet the memory limit.
+   */
+  void SetNumberOfStreamDivisions(int num);
+  vtkGetMacro(NumberOfStreamDivisions, int);
+  ///@}
+
+  /**
+   * Return the number of stream divisions of the last execution, larger than
+   * NumberOfStreamDivisions when it was increased to meet the memory limit.
+   * Setting NumberOfStreamDivisions to it avoids streaming the first pieces
+   * again in the next executions.
+   */
+  int GetLastNumberOfStreamDivisions() { return static_cast<int>(this->NumberOfPasses); }
+
+  ///@{
+  /**
+   * Set/get the memory limit of a pass in kibibytes (1024 bytes), or 0 for no
+   * limit. By default this is 0.
+   */
+  vtkSetMacro(MemoryLimit, unsigned long);
+  vtkGetMacro(MemoryLimit, unsigned long);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the number of stream divisions beyond which they are not
+   * increased to meet the memory limit. By default this is 4096.
+   */
+  vtkSetClampMacro(MaximumNumberOfStreamDivisions, int, 1, VTK_INT_MAX);
+  vtkGetMacro(MaximumNumberOfStreamDivisions, int);
+  ///@}
+
+  /**
+   * Return the largest memory used by the passes of the last execution, in
+   * kibibytes, not counting the passes streamed again with more divisions.
+   */
+  vtkGetMacro(PeakMemorySize, unsigned long);
+
+  /**
+   * Include the modification time of the reducer.
+   */
+  vtkMTimeType GetMTime() override;
+
+  /**
+   * see vtkAlgorithm for details
+   */
+  vtkTypeBool ProcessRequest(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+protected:
+  vtkPieceStreamer();
+  ~vtkPieceStreamer() override;
+
+  int FillOutputPortInformation(int port, vtkInformation* info) override;
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  virtual int RequestDataObject(vtkInformation*, vtkInformationVector**, vtkInformationVector*);
+
+  int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override;
+
+  int ExecutePass(vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  int PostExecute(vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * Return the memory used by the data objects of the input pipeline, in
+   * kibibytes.
+   */
+  unsigned long ComputeInputPipelineMemorySize();
+
+  vtkPieceReducer* Reducer;
+  unsigned long MemoryLimit;
+  int NumberOfStreamDivisions;
+  int MaximumNumberOfStreamDivisions;
+  unsigned long PeakMemorySize;
+
+private:
+  vtkPieceStreamer(const vtkPieceStreamer&) = delete;
+  void operator=(const vtkPieceStreamer&) = delete;
+
+  // Forget the state of a failed execution.
+  void ResetExecution();
+
+  // State of the current execution.
+  bool Streaming;
+  bool Restart;
+  bool WarnedMemoryLimit;
+  unsigned long SplitMemorySize;
+  unsigned long InitialReducerMemorySize;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
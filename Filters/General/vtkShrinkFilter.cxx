@@ -19,6 +19,9 @@ vtkStandardNewMacro(vtkShrinkFilter);
 vtkShrinkFilter::vtkShrinkFilter()
 {
   this->ShrinkFactor = 0.5;
+
+  // The filter is not modified by RequestData.
+  this->GetInformation()->Set(vtkAlgorithm::CAN_EXECUTE_BLOCKS_CONCURRENTLY(), 1);
 }
 
 //------------------------------------------------------------------------------
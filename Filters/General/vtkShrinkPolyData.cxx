@@ -19,6 +19,9 @@ vtkShrinkPolyData::vtkShrinkPolyData(double sf)
 {
   sf = (sf < 0.0 ? 0.0 : (sf > 1.0 ? 1.0 : sf));
   this->ShrinkFactor = sf;
+
+  // Each block is shrunk independently, without modifying the filter.
+  this->GetInformation()->Set(vtkAlgorithm::CAN_EXECUTE_BLOCKS_CONCURRENTLY(), 1);
 }
 
 namespace
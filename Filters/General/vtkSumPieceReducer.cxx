@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSumPieceReducer.h"
+
+#include "vtkArrayDispatch.h"
+#include "vtkCellData.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArrayRange.h"
+#include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkIdTypeArray.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkSumPieceReducer);
+
+//------------------------------------------------------------------------------
+struct vtkSumPieceReducer::vtkInternals
+{
+  struct Sum
+  {
+    int Association;
+    std::string Name;
+    vtkIdType Count = 0;
+    std::vector<double> Components;
+  };
+
+  // In the order the arrays were found.
+  std::vector<Sum> Sums;
+  vtkIdType NumberOfPoints = 0;
+  vtkIdType NumberOfCells = 0;
+
+  Sum& GetSum(int association, const std::string& name, int numberOfComponents)
+  {
+    for (auto& sum : this->Sums)
+    {
+      if (sum.Association == association && sum.Name == name)
+      {
+        return sum;
+      }
+    }
+    this->Sums.push_back(Sum{ association, name, 0, std::vector<double>(numberOfComponents) });
+    return this->Sums.back();
+  }
+};
+
+namespace
+{
+struct SumWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, vtkUnsignedCharArray* ghosts, unsigned char duplicate,
+    vtkIdType& count, std::vector<double>& sums)
+  {
+    const auto tuples = vtk::DataArrayTupleRange(array);
+    const int numberOfComponents = std::min(tuples.GetTupleSize(), static_cast<int>(sums.size()));
+    vtkIdType tupleId = 0;
+    for (const auto tuple : tuples)
+    {
+      if (ghosts && (ghosts->GetValue(tupleId++) & duplicate))
+      {
+        continue;
+      }
+      ++count;
+      for (int c = 0; c < numberOfComponents; ++c)
+      {
+        sums[c] += static_cast<double>(tuple[c]);
+      }
+    }
+  }
+};
+
+vtkIdType CountNonDuplicates(vtkIdType size, vtkUnsignedCharArray* ghosts, unsigned char duplicate)
+{
+  if (!ghosts)
+  {
+    return size;
+  }
+  vtkIdType count = 0;
+  for (const auto ghost : vtk::DataArrayValueRange<1>(ghosts))
+  {
+    count += (ghost & duplicate) ? 0 : 1;
+  }
+  return count;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkSumPieceReducer::vtkSumPieceReducer()
+  : Internals(new vtkInternals)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkSumPieceReducer::~vtkSumPieceReducer() = default;
+
+//------------------------------------------------------------------------------
+int vtkSumPieceReducer::GetOutputDataObjectType()
+{
+  return VTK_TABLE;
+}
+
+//------------------------------------------------------------------------------
+void vtkSumPieceReducer::Initialize()
+{
+  *this->Internals = vtkInternals();
+}
+
+//------------------------------------------------------------------------------
+int vtkSumPieceReducer::Reduce(vtkDataObject* piece)
+{
+  auto& internals = *this->Internals;
+  for (vtkDataSet* dataSet : vtkCompositeDataSet::GetDataSets<vtkDataSet>(piece))
+  {
+    vtkUnsignedCharArray* pointGhosts = dataSet->GetPointGhostArray();
+    vtkUnsignedCharArray* cellGhosts = dataSet->GetCellGhostArray();
+    internals.NumberOfPoints += CountNonDuplicates(
+      dataSet->GetNumberOfPoints(), pointGhosts, vtkDataSetAttributes::DUPLICATEPOINT);
+    internals.NumberOfCells += CountNonDuplicates(
+      dataSet->GetNumberOfCells(), cellGhosts, vtkDataSetAttributes::DUPLICATECELL);
+
+    for (int association : { vtkDataObject::FIELD_ASSOCIATION_POINTS,
+           vtkDataObject::FIELD_ASSOCIATION_CELLS })
+    {
+      const bool points = association == vtkDataObject::FIELD_ASSOCIATION_POINTS;
+      vtkDataSetAttributes* attributes =
+        points ? static_cast<vtkDataSetAttributes*>(dataSet->GetPointData())
+               : static_cast<vtkDataSetAttributes*>(dataSet->GetCellData());
+      vtkUnsignedCharArray* ghosts = points ? pointGhosts : cellGhosts;
+      const unsigned char duplicate = points
+        ? static_cast<unsigned char>(vtkDataSetAttributes::DUPLICATEPOINT)
+        : static_cast<unsigned char>(vtkDataSetAttributes::DUPLICATECELL);
+      for (int i = 0; i < attributes->GetNumberOfArrays(); ++i)
+      {
+        vtkDataArray* array = attributes->GetArray(i);
+        if (!array || !array->GetName() || array == ghosts)
+        {
+          continue;
+        }
+        auto& sum =
+          internals.GetSum(association, array->GetName(), array->GetNumberOfComponents());
+        SumWorker worker;
+        if (!vtkArrayDispatch::Dispatch::Execute(
+              array, worker, ghosts, duplicate, sum.Count, sum.Components))
+        {
+          worker(array, ghosts, duplicate, sum.Count, sum.Components);
+        }
+      }
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkSumPieceReducer::Finalize(vtkDataObject* output)
+{
+  vtkTable* table = vtkTable::SafeDownCast(output);
+  if (!table)
+  {
+    vtkErrorMacro("The output is not a table.");
+    return 0;
+  }
+
+  vtkNew<vtkStringArray> associations;
+  associations->SetName("Association");
+  vtkNew<vtkStringArray> names;
+  names->SetName("Array");
+  vtkNew<vtkIntArray> components;
+  components->SetName("Component");
+  vtkNew<vtkIdTypeArray> counts;
+  counts->SetName("Count");
+  vtkNew<vtkDoubleArray> sums;
+  sums->SetName("Sum");
+  vtkNew<vtkDoubleArray> means;
+  means->SetName("Mean");
+  for (const auto& sum : this->Internals->Sums)
+  {
+    for (size_t c = 0; c < sum.Components.size(); ++c)
+    {
+      associations->InsertNextValue(
+        sum.Association == vtkDataObject::FIELD_ASSOCIATION_POINTS ? "Points" : "Cells");
+      names->InsertNextValue(sum.Name);
+      components->InsertNextValue(static_cast<int>(c));
+      counts->InsertNextValue(sum.Count);
+      sums->InsertNextValue(sum.Components[c]);
+      means->InsertNextValue(sum.Count > 0 ? sum.Components[c] / sum.Count : 0.0);
+    }
+  }
+
+  table->Initialize();
+  table->AddColumn(associations);
+  table->AddColumn(names);
+  table->AddColumn(components);
+  table->AddColumn(counts);
+  table->AddColumn(sums);
+  table->AddColumn(means);
+
+  vtkNew<vtkIdTypeArray> numberOfPoints;
+  numberOfPoints->SetName("NumberOfPoints");
+  numberOfPoints->InsertNextValue(this->Internals->NumberOfPoints);
+  table->GetFieldData()->AddArray(numberOfPoints);
+  vtkNew<vtkIdTypeArray> numberOfCells;
+  numberOfCells->SetName("NumberOfCells");
+  numberOfCells->InsertNextValue(this->Internals->NumberOfCells);
+  table->GetFieldData()->AddArray(numberOfCells);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkSumPieceReducer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSumPieceReducer
+ * @brief   reducer summing the point and cell arrays of the pieces
+ *
+ * vtkSumPieceReducer sums each component of the numeric point and cell
+ * arrays of the pieces streamed by vtkPieceStreamer. The output is a table
+ * with one row per array component and the columns "Association" ("Points"
+ * or "Cells"), "Array", "Component", "Count", "Sum" and "Mean". The field
+ * data of the table holds the total "NumberOfPoints" and "NumberOfCells".
+ *
+ * The points and cells flagged as duplicated by the ghost arrays are skipped.
+ * The points shared by pieces without ghost arrays, as with most unstructured
+ * readers, are counted once per piece.
+ *
+ * @sa
+ * vtkPieceStreamer
+ */
+
+#ifndef vtkSumPieceReducer_h
+#define vtkSumPieceReducer_h
+
+#include "vtkFiltersGeneralModule.h" // For export macro
+#include "vtkPieceReducer.h"
+
+#include <memory> // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKFILTERSGENERAL_EXPORT vtkSumPieceReducer : public vtkPieceReducer
+{
+public:
+  static vtkSumPieceReducer* New();
+  vtkTypeMacro(vtkSumPieceReducer, vtkPieceReducer);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  int GetOutputDataObjectType() override;
+  void Initialize() override;
+  int Reduce(vtkDataObject* piece) override;
+  int Finalize(vtkDataObject* output) override;
+
+protected:
+  vtkSumPieceReducer();
+  ~vtkSumPieceReducer() override;
+
+private:
+  vtkSumPieceReducer(const vtkSumPieceReducer&) = delete;
+  void operator=(const vtkSumPieceReducer&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that vtkGeometryFilter extracts the same boundary with the face hash
+// links kept with an unstructured grid as with the links it builds itself, that
+// it keeps the links with the grid only on demand, and that the links kept with
+// the grid are dropped when the cells change.
+
+#include "vtkCellArray.h"
+#include "vtkGeometryFilter.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkStaticFaceHashLinks.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+constexpr int Resolution = 5;
+
+//------------------------------------------------------------------------------
+// The boundary faces as sorted lists of point ids, in increasing order, so that
+// they do not depend on the order in which the filter visits them.
+std::vector<std::vector<vtkIdType>> ExtractFaces(vtkUnstructuredGrid* grid, bool keepLinks)
+{
+  vtkNew<vtkGeometryFilter> filter;
+  filter->SetInputData(grid);
+  filter->MergingOff();
+  if (keepLinks)
+  {
+    filter->KeepFaceHashLinksOn();
+  }
+  filter->Update();
+
+  std::vector<std::vector<vtkIdType>> faces;
+  vtkPolyData* output = filter->GetOutput();
+  vtkNew<vtkIdList> ptIds;
+  for (vtkIdType cellId = 0; cellId < output->GetNumberOfCells(); ++cellId)
+  {
+    output->GetCellPoints(cellId, ptIds);
+    std::vector<vtkIdType> face(ptIds->begin(), ptIds->end());
+    std::sort(face.begin(), face.end());
+    faces.push_back(face);
+  }
+  std::sort(faces.begin(), faces.end());
+  return faces;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestGeometryFilterFaceHashLinks(int, char*[])
+{
+  // A grid of voxels with a triangle.
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(Resolution, Resolution, Resolution);
+  vtkNew<vtkUnstructuredGrid> grid;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(image->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < image->GetNumberOfPoints(); ++ptId)
+  {
+    points->SetPoint(ptId, image->GetPoint(ptId));
+  }
+  grid->SetPoints(points);
+  grid->AllocateExact(image->GetNumberOfCells() + 1, 8);
+  vtkNew<vtkIdList> ptIds;
+  for (vtkIdType cellId = 0; cellId < image->GetNumberOfCells(); ++cellId)
+  {
+    image->GetCellPoints(cellId, ptIds);
+    grid->InsertNextCell(VTK_VOXEL, ptIds);
+  }
+  const vtkIdType triangle[3] = { 0, 1, Resolution };
+  grid->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+
+  // Private links, by default.
+  vtkNew<vtkGeometryFilter> defaultFilter;
+  if (defaultFilter->GetKeepFaceHashLinks())
+  {
+    std::cerr << "Error: face hash links kept by default" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const auto expected = ExtractFaces(grid, false);
+  const std::size_t numBoundaryFaces = 6 * (Resolution - 1) * (Resolution - 1) + 1;
+  if (expected.size() != numBoundaryFaces)
+  {
+    std::cerr << "Error: " << expected.size() << " boundary faces instead of " << numBoundaryFaces
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (grid->GetFaceHashLinks())
+  {
+    std::cerr << "Error: face hash links kept with the grid" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Links kept with the grid by the filter.
+  if (ExtractFaces(grid, true) != expected)
+  {
+    std::cerr << "Error: boundary differs with the face hash links of the grid" << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkStaticFaceHashLinks* links = grid->GetFaceHashLinks();
+  if (!links || links->GetNumberOfFaces() != 6 * image->GetNumberOfCells() + 1 ||
+    links->GetNumberOfHashes() != grid->GetNumberOfPoints() + 1)
+  {
+    std::cerr << "Error: face hash links not built" << std::endl;
+    return EXIT_FAILURE;
+  }
+  // Without KeepFaceHashLinks, the links of the grid are still used.
+  if (ExtractFaces(grid, false) != expected || grid->GetFaceHashLinks() != links)
+  {
+    std::cerr << "Error: face hash links of the grid not reused" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Building again keeps the same links, which are shared with shallow copies.
+  grid->BuildFaceHashLinks();
+  vtkNew<vtkUnstructuredGrid> copy;
+  copy->ShallowCopy(grid);
+  if (grid->GetFaceHashLinks() != links || copy->GetFaceHashLinks() != links)
+  {
+    std::cerr << "Error: face hash links not reused" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Replacing the cells drops them.
+  copy->SetCells(copy->GetCellTypesArray(), copy->GetCells());
+  if (copy->GetFaceHashLinks())
+  {
+    std::cerr << "Error: face hash links not dropped with the cells" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Inserting a cell invalidates the links.
+  grid->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+  if (grid->GetFaceHashLinks())
+  {
+    std::cerr << "Error: face hash links not invalidated by a new cell" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -26,6 +26,7 @@
 #include "vtkRectilinearGrid.h"
 #include "vtkSMPTools.h"
 #include "vtkStaticCellLinksTemplate.h"
+#include "vtkStaticFaceHashLinks.h"
 #include "vtkStaticFaceHashLinksTemplate.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredData.h"
@@ -78,6 +79,7 @@ vtkGeometryFilter::vtkGeometryFilter()
   this->OutputPointsPrecision = DEFAULT_PRECISION;
 
   this->FastMode = false;
+  this->KeepFaceHashLinks = false;
   this->RemoveGhostInterfaces = true;
 
   this->PieceInvariant = 0;
@@ -297,6 +299,7 @@ void vtkGeometryFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Merging: " << (this->Merging ? "On\n" : "Off\n");
 
   os << indent << "Fast Mode: " << (this->FastMode ? "On\n" : "Off\n");
+  os << indent << "Keep Face Hash Links: " << (this->KeepFaceHashLinks ? "On\n" : "Off\n");
   os << indent << "Remove Ghost Interfaces: " << (this->RemoveGhostInterfaces ? "On\n" : "Off\n")
      << "\n";
 
@@ -1326,24 +1329,24 @@ struct ExtractCellBoundaries
 
 // Extract unstructured grid boundary by visiting each cell and examining
 // cell features.
-template <typename TInputIdType, typename TFaceIdType>
+template <typename TInputIdType, typename TFaceHashLinks>
 struct ExtractUG : public ExtractCellBoundaries<TInputIdType>
 {
   // The unstructured grid to process
   vtkUnstructuredGrid* Grid;
-  using TFaceHashLinks = vtkStaticFaceHashLinksTemplate<TInputIdType, TFaceIdType>;
-  const TFaceHashLinks& FaceHashLinks;
+  std::shared_ptr<const TFaceHashLinks> FaceHashLinks;
   bool RemoveGhostInterfaces;
 
   vtkIdType NumberOfCells;
   const unsigned char MASKED_CELL;
 
-  ExtractUG(vtkGeometryFilter* self, vtkUnstructuredGrid* grid, TFaceHashLinks& faceHashLinks,
-    const char* cellVis, const unsigned char* cellGhost, const unsigned char* pointGhost,
+  ExtractUG(vtkGeometryFilter* self, vtkUnstructuredGrid* grid,
+    std::shared_ptr<const TFaceHashLinks> faceHashLinks, const char* cellVis,
+    const unsigned char* cellGhost, const unsigned char* pointGhost,
     vtkExcludedFaces<TInputIdType>* exc, ThreadOutputType<TInputIdType>* t)
     : ExtractCellBoundaries<TInputIdType>(self, cellVis, cellGhost, pointGhost, exc, t)
     , Grid(grid)
-    , FaceHashLinks(faceHashLinks)
+    , FaceHashLinks(std::move(faceHashLinks))
     , RemoveGhostInterfaces(self->GetRemoveGhostInterfaces())
     , NumberOfCells(grid->GetNumberOfCells())
     , MASKED_CELL(
@@ -1368,7 +1371,7 @@ struct ExtractUG : public ExtractCellBoundaries<TInputIdType>
     void operator()(CellStateT& state, ExtractUG* This, vtkIdType beginHash, vtkIdType endHash)
     {
       auto& localData = This->LocalData.Local();
-      auto& faceHashLinks = This->FaceHashLinks;
+      const auto& faceHashLinks = *This->FaceHashLinks;
       auto& faceList = localData.FaceList;
       auto& polys = localData.Polys;
 
@@ -3049,11 +3052,6 @@ int ExecuteUnstructuredGrid(vtkGeometryFilter* self, vtkDataSet* dataSetInput, v
   output->SetPolys(polys);
   output->SetStrips(strips);
 
-  // Build a face hash links to quickly determine the faces that have the same hash.
-  vtkStaticFaceHashLinksTemplate<TInputIdType, TFaceIdType> faceHashLinks;
-  faceHashLinks.BuildHashLinks(uGrid);
-  self->UpdateProgress(0.4);
-
   // Threaded visit of each cell to extract boundary features. Each thread gathers
   // output which is then composited into the final vtkPolyData.
   // Keep track of each thread's output, we'll need this later for compositing.
@@ -3061,14 +3059,44 @@ int ExecuteUnstructuredGrid(vtkGeometryFilter* self, vtkDataSet* dataSetInput, v
 
   // Perform the threaded boundary cell extraction. This performs some
   // initial reduction and allocation of the output. It also computes offsets
-  // and sizes for allocation and writing of data.
-  auto* extract = new ExtractUG<TInputIdType, TFaceIdType>(
-    self, uGrid, faceHashLinks, cellVis, cellGhosts, pointGhosts, exc, &threads);
-  vtkSMPTools::For(0, faceHashLinks.GetNumberOfHashes(), *extract);
+  // and sizes for allocation and writing of data. The faces are visited by
+  // hash, using the face hash links kept with the grid if they are up to date
+  // (see vtkUnstructuredGrid::BuildFaceHashLinks()). They are only built there
+  // when KeepFaceHashLinks is on, otherwise the input is left untouched.
+  ExtractCellBoundaries<TInputIdType>* extract;
+  if (self->GetKeepFaceHashLinks())
+  {
+    uGrid->BuildFaceHashLinks();
+  }
+  if (vtkStaticFaceHashLinks* sharedFaceHashLinks = uGrid->GetFaceHashLinks())
+  {
+    // The extraction keeps a reference to the links of the grid.
+    using TFaceHashLinks = vtkStaticFaceHashLinks::HashLinksType;
+    auto owner = std::make_shared<vtkSmartPointer<vtkStaticFaceHashLinks>>(sharedFaceHashLinks);
+    std::shared_ptr<const TFaceHashLinks> faceHashLinks(
+      owner, &sharedFaceHashLinks->GetHashLinks());
+    self->UpdateProgress(0.4);
+    auto* extractUG = new ExtractUG<TInputIdType, TFaceHashLinks>(
+      self, uGrid, faceHashLinks, cellVis, cellGhosts, pointGhosts, exc, &threads);
+    vtkSMPTools::For(0, faceHashLinks->GetNumberOfHashes(), *extractUG);
+    extract = extractUG;
+  }
+  else
+  {
+    // Build a face hash links to quickly determine the faces that have the same hash.
+    using TFaceHashLinks = vtkStaticFaceHashLinksTemplate<TInputIdType, TFaceIdType>;
+    auto faceHashLinks = std::make_shared<TFaceHashLinks>();
+    faceHashLinks->BuildHashLinks(uGrid);
+    self->UpdateProgress(0.4);
+    auto* extractUG = new ExtractUG<TInputIdType, TFaceHashLinks>(
+      self, uGrid, faceHashLinks, cellVis, cellGhosts, pointGhosts, exc, &threads);
+    vtkSMPTools::For(0, faceHashLinks->GetNumberOfHashes(), *extractUG);
+    extract = extractUG;
+    // free up the hash links
+    faceHashLinks->Reset();
+  }
   numCells = extract->NumCells;
   self->UpdateProgress(0.8);
-  // free up the hash links
-  faceHashLinks.Reset();
 
   // If merging points, then it's necessary to allocate the points array,
   // configure the point map, and generate the new points. Here we are using
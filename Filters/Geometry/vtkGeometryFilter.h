@@ -256,6 +256,23 @@ public:
   vtkBooleanMacro(FastMode, bool);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off keeping the face hash links built to extract the boundary of
+   * an unstructured grid with the input grid, see
+   * vtkUnstructuredGrid::BuildFaceHashLinks(). The links are then built once
+   * and reused by the next executions, and by the other filters extracting
+   * the boundary of the same grid, as long as its cells are unchanged. This
+   * modifies the input, so do not turn it on for filters sharing an input
+   * while they execute concurrently. Links already kept with the grid are
+   * used whatever this option. The default is off, so that grids processed
+   * once do not keep the extra memory.
+   */
+  vtkSetMacro(KeepFaceHashLinks, bool);
+  vtkGetMacro(KeepFaceHashLinks, bool);
+  vtkBooleanMacro(KeepFaceHashLinks, bool);
+  ///@}
+
   // The following are methods compatible with vtkDataSetSurfaceFilter.
 
   ///@{
@@ -430,6 +447,7 @@ protected:
   vtkIncrementalPointLocator* Locator;
 
   bool FastMode;
+  bool KeepFaceHashLinks;
 
   // These methods support compatibility with vtkDataSetSurfaceFilter
   int PieceInvariant;
@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that vtkPipelineResultDiskCache spills the entries evicted from memory
+// to disk, reads them back with their type and information, removes their
+// files, and discards the entries the legacy format cannot hold.
+
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPipelineResultDiskCache.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkTesting.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+vtkSmartPointer<vtkDataObject> MakeEntry(float value)
+{
+  const vtkIdType numberOfPoints = 10000;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numberOfPoints);
+  vtkNew<vtkFloatArray> values;
+  values->SetName("values");
+  values->SetNumberOfTuples(numberOfPoints);
+  for (vtkIdType i = 0; i < numberOfPoints; ++i)
+  {
+    points->SetPoint(i, i, value, 0.0);
+    values->SetValue(i, value * i);
+  }
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->GetPointData()->AddArray(values);
+  return polyData;
+}
+
+bool CheckEntry(const std::vector<vtkSmartPointer<vtkDataObject>>& outputs, float value)
+{
+  vtkPolyData* polyData = outputs.size() == 1 ? vtkPolyData::SafeDownCast(outputs[0]) : nullptr;
+  vtkDataArray* values = polyData ? polyData->GetPointData()->GetArray("values") : nullptr;
+  return values && polyData->GetNumberOfPoints() == 10000 &&
+    values->GetNumberOfTuples() == 10000 && values->GetComponent(10, 0) == value * 10 &&
+    polyData->GetPoint(10)[1] == value;
+}
+
+bool FileExists(const std::string& fileName)
+{
+  std::ifstream file(fileName);
+  return file.good();
+}
+}
+
+int TestPipelineResultDiskCache(int argc, char* argv[])
+{
+  vtkNew<vtkTesting> testing;
+  testing->AddArguments(argc, argv);
+  const std::string directory = testing->GetTempDirectory() + std::string("/ResultDiskCache");
+  const std::string firstFile = directory + "/first_0.vtk";
+
+  const vtkSmartPointer<vtkDataObject> first = MakeEntry(1.0f);
+  const unsigned long entrySize = first->GetActualMemorySize();
+  {
+    vtkNew<vtkPipelineResultDiskCache> cache;
+    cache->SetSpillDirectory(directory.c_str());
+    cache->SetMemoryLimit(entrySize + entrySize / 2);
+
+    cache->Insert("first", nullptr, { first });
+    cache->Insert("second", nullptr, { MakeEntry(2.0f) });
+    if (cache->GetNumberOfEntries() != 2 || cache->GetNumberOfSpilledEntries() != 1 ||
+      cache->GetDiskSize() == 0 || !FileExists(firstFile))
+    {
+      std::cerr << "Error: least recently used entry not spilled" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // Reading the first entry back spills the second one.
+    std::vector<vtkSmartPointer<vtkDataObject>> outputs;
+    if (!cache->Find("first", outputs) || !CheckEntry(outputs, 1.0f) ||
+      cache->GetNumberOfSpilledEntries() != 1 || FileExists(firstFile) ||
+      !FileExists(directory + "/second_0.vtk"))
+    {
+      std::cerr << "Error: spilled entry not read back" << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (!cache->Find("second", outputs) || !CheckEntry(outputs, 2.0f) ||
+      cache->GetNumberOfHits() != 2)
+    {
+      std::cerr << "Error: wrong second entry" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // Spilled entries beyond the disk limit are removed.
+    cache->SetDiskLimit(cache->GetDiskSize() - 1);
+    if (cache->GetNumberOfEntries() != 1 || cache->GetDiskSize() != 0 ||
+      FileExists(firstFile) || cache->Find("first", outputs))
+    {
+      std::cerr << "Error: spilled entry not removed" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    cache->SetDiskLimit(10 * entrySize);
+    cache->Insert("third", nullptr, { MakeEntry(3.0f) });
+    if (cache->GetNumberOfSpilledEntries() != 1)
+    {
+      std::cerr << "Error: entry not spilled" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The files are removed with the cache.
+  if (FileExists(directory + "/second_0.vtk"))
+  {
+    std::cerr << "Error: files left after the destruction of the cache" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Image data keep their class, extent and information. Composite data sets
+  // are discarded.
+  {
+    vtkNew<vtkPipelineResultDiskCache> cache;
+    cache->SetSpillDirectory(directory.c_str());
+    cache->SetMemoryLimit(entrySize + entrySize / 2);
+
+    vtkNew<vtkImageData> image;
+    image->SetExtent(2, 41, 0, 39, 5, 5);
+    image->AllocateScalars(VTK_FLOAT, 1);
+    image->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), 2.5);
+    vtkNew<vtkMultiBlockDataSet> multiBlock;
+    multiBlock->SetBlock(0, MakeEntry(4.0f));
+    cache->Insert("image", nullptr, { image });
+    cache->Insert("composite", nullptr, { multiBlock });
+    cache->Insert("fifth", nullptr, { MakeEntry(5.0f) });
+    if (cache->GetNumberOfEntries() != 2 || cache->GetNumberOfSpilledEntries() != 1 ||
+      FileExists(directory + "/composite_0.vtk"))
+    {
+      std::cerr << "Error: composite entry spilled" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    std::vector<vtkSmartPointer<vtkDataObject>> outputs;
+    vtkImageData* restored = cache->Find("image", outputs) && outputs.size() == 1
+      ? vtkImageData::SafeDownCast(outputs[0])
+      : nullptr;
+    if (!restored || strcmp(restored->GetClassName(), "vtkImageData") != 0 ||
+      restored->GetExtent()[0] != 2 || restored->GetExtent()[4] != 5 ||
+      restored->GetNumberOfPoints() != 1600 || !restored->GetPointData()->GetScalars() ||
+      restored->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP()) != 2.5)
+    {
+      std::cerr << "Error: wrong image read back" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,339 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPipelineResultDiskCache.h"
+
+#include "vtkAbstractArray.h"
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDataObject.h"
+#include "vtkDataSet.h"
+#include "vtkFieldData.h"
+#include "vtkGenericDataObjectReader.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationDoubleKey.h"
+#include "vtkInformationDoubleVectorKey.h"
+#include "vtkInformationIdTypeKey.h"
+#include "vtkInformationInformationVectorKey.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkInformationIntegerPointerKey.h"
+#include "vtkInformationIntegerVectorKey.h"
+#include "vtkInformationIterator.h"
+#include "vtkInformationStringKey.h"
+#include "vtkInformationStringVectorKey.h"
+#include "vtkInformationUnsignedLongKey.h"
+#include "vtkMath.h"
+#include "vtkMatrix3x3.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPolyDataWriter.h"
+#include "vtkRectilinearGridWriter.h"
+#include "vtkStringArray.h"
+#include "vtkStructuredGridWriter.h"
+#include "vtkStructuredPointsWriter.h"
+#include "vtkTable.h"
+#include "vtkTableWriter.h"
+#include "vtkUnstructuredGridWriter.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <map>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkPipelineResultDiskCache);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Whether the legacy writer writes a key of the information of an array. The
+// keys caching the ranges of the array need not be written.
+bool CanWriteArrayKey(vtkInformation* info, vtkInformationKey* key)
+{
+  if (key == vtkAbstractArray::PER_COMPONENT() || key == vtkAbstractArray::PER_FINITE_COMPONENT() ||
+    key == vtkDataArray::L2_NORM_RANGE() || key == vtkDataArray::L2_NORM_FINITE_RANGE())
+  {
+    return true;
+  }
+  if (vtkInformationDoubleKey* doubleKey = vtkInformationDoubleKey::SafeDownCast(key))
+  {
+    return vtkMath::IsFinite(info->Get(doubleKey));
+  }
+  if (vtkInformationDoubleVectorKey* vectorKey = vtkInformationDoubleVectorKey::SafeDownCast(key))
+  {
+    const double* values = info->Get(vectorKey);
+    return std::all_of(values, values + info->Length(vectorKey),
+      [](double value) { return vtkMath::IsFinite(value); });
+  }
+  return vtkInformationIdTypeKey::SafeDownCast(key) ||
+    vtkInformationIntegerKey::SafeDownCast(key) ||
+    vtkInformationIntegerVectorKey::SafeDownCast(key) ||
+    vtkInformationStringKey::SafeDownCast(key) ||
+    vtkInformationStringVectorKey::SafeDownCast(key) ||
+    vtkInformationUnsignedLongKey::SafeDownCast(key);
+}
+
+//------------------------------------------------------------------------------
+// Whether the legacy writer writes the arrays without loss: they must be
+// named data or string arrays, with information it can write.
+bool CanWriteFieldData(vtkFieldData* fieldData)
+{
+  if (!fieldData)
+  {
+    return true;
+  }
+  vtkNew<vtkInformationIterator> iter;
+  for (int i = 0; i < fieldData->GetNumberOfArrays(); ++i)
+  {
+    vtkAbstractArray* array = fieldData->GetAbstractArray(i);
+    if (!array->GetName() ||
+      (!vtkDataArray::SafeDownCast(array) && !vtkStringArray::SafeDownCast(array)))
+    {
+      return false;
+    }
+    if (!array->HasInformation())
+    {
+      continue;
+    }
+    vtkInformation* info = array->GetInformation();
+    iter->SetInformationWeak(info);
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      if (!CanWriteArrayKey(info, iter->GetCurrentKey()))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Return a writer for an output, or nullptr if the legacy format cannot hold
+// it without loss.
+vtkSmartPointer<vtkDataWriter> NewWriter(vtkDataObject* output)
+{
+  if (vtkDataSet* dataSet = vtkDataSet::SafeDownCast(output))
+  {
+    if (!CanWriteFieldData(dataSet->GetPointData()) ||
+      !CanWriteFieldData(dataSet->GetCellData()) || !CanWriteFieldData(dataSet->GetFieldData()))
+    {
+      return nullptr;
+    }
+  }
+  else if (vtkTable* table = vtkTable::SafeDownCast(output))
+  {
+    if (!CanWriteFieldData(table->GetRowData()) || !CanWriteFieldData(table->GetFieldData()))
+    {
+      return nullptr;
+    }
+  }
+  else
+  {
+    return nullptr;
+  }
+
+  switch (output->GetDataObjectType())
+  {
+    case VTK_POLY_DATA:
+      return vtkSmartPointer<vtkPolyDataWriter>::New();
+    case VTK_UNSTRUCTURED_GRID:
+      return vtkSmartPointer<vtkUnstructuredGridWriter>::New();
+    case VTK_STRUCTURED_GRID:
+    {
+      auto writer = vtkSmartPointer<vtkStructuredGridWriter>::New();
+      writer->WriteExtentOn();
+      return writer;
+    }
+    case VTK_RECTILINEAR_GRID:
+    {
+      auto writer = vtkSmartPointer<vtkRectilinearGridWriter>::New();
+      writer->WriteExtentOn();
+      return writer;
+    }
+    case VTK_IMAGE_DATA:
+    case VTK_STRUCTURED_POINTS:
+    {
+      // The legacy format has no direction.
+      if (!vtkImageData::SafeDownCast(output)->GetDirectionMatrix()->IsIdentity())
+      {
+        return nullptr;
+      }
+      auto writer = vtkSmartPointer<vtkStructuredPointsWriter>::New();
+      writer->WriteExtentOn();
+      return writer;
+    }
+    case VTK_TABLE:
+      return vtkSmartPointer<vtkTableWriter>::New();
+    default:
+      return nullptr;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Copy the information of a data object, but the extent, which points to the
+// extent of the data object.
+void CopyInformation(vtkInformation* from, vtkInformation* to)
+{
+  vtkNew<vtkInformationIterator> iter;
+  iter->SetInformationWeak(from);
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    vtkInformationKey* key = iter->GetCurrentKey();
+    if (key != vtkDataObject::DATA_EXTENT())
+    {
+      key->ShallowCopy(from, to);
+    }
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+struct vtkPipelineResultDiskCache::vtkSpillInternals
+{
+  // What the files do not hold: the type and the information of each output
+  // of the spilled entries.
+  struct SpilledOutput
+  {
+    vtkSmartPointer<vtkDataObject> Prototype;
+    vtkSmartPointer<vtkInformation> Information;
+  };
+  std::map<std::string, std::vector<SpilledOutput>> Entries;
+};
+
+//------------------------------------------------------------------------------
+vtkPipelineResultDiskCache::vtkPipelineResultDiskCache()
+  : SpillDirectory(nullptr)
+  , SpillInternals(new vtkSpillInternals)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkPipelineResultDiskCache::~vtkPipelineResultDiskCache()
+{
+  // Remove the files while RemoveEntry() is still the one of this class.
+  this->Clear();
+  this->SetSpillDirectory(nullptr);
+  delete this->SpillInternals;
+}
+
+//------------------------------------------------------------------------------
+std::string vtkPipelineResultDiskCache::GetEntryFileName(const std::string& key, int index)
+{
+  return std::string(this->SpillDirectory ? this->SpillDirectory : "") + "/" + key + "_" +
+    std::to_string(index) + ".vtk";
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkPipelineResultDiskCache::WriteEntry(
+  const std::string& key, const std::vector<vtkSmartPointer<vtkDataObject>>& outputs)
+{
+  if (!this->SpillDirectory || outputs.empty())
+  {
+    return 0;
+  }
+
+  std::vector<vtkSpillInternals::SpilledOutput> spilled;
+  std::vector<vtkSmartPointer<vtkDataWriter>> writers;
+  for (const auto& output : outputs)
+  {
+    vtkSmartPointer<vtkDataWriter> writer = output ? NewWriter(output) : nullptr;
+    if (!writer)
+    {
+      vtkDebugMacro("Cannot spill cache entry " << key << " to legacy files without loss");
+      return 0;
+    }
+    writers.push_back(writer);
+    auto information = vtkSmartPointer<vtkInformation>::New();
+    CopyInformation(output->GetInformation(), information);
+    spilled.push_back({ vtk::TakeSmartPointer(output->NewInstance()), information });
+  }
+  if (!vtksys::SystemTools::MakeDirectory(this->SpillDirectory))
+  {
+    return 0;
+  }
+
+  unsigned long size = 0;
+  for (int i = 0; i < static_cast<int>(outputs.size()); ++i)
+  {
+    const std::string fileName = this->GetEntryFileName(key, i);
+    writers[i]->SetFileName(fileName.c_str());
+    writers[i]->SetFileTypeToBinary();
+    writers[i]->SetInputData(outputs[i]);
+    if (!writers[i]->Write())
+    {
+      vtkWarningMacro("Cannot spill cache entry to " << fileName);
+      this->RemoveEntry(key);
+      return 0;
+    }
+    size += vtksys::SystemTools::FileLength(fileName);
+  }
+  this->SpillInternals->Entries[key] = std::move(spilled);
+  // Never report an empty entry, which would mean it was not written.
+  return size / 1024 + 1;
+}
+
+//------------------------------------------------------------------------------
+bool vtkPipelineResultDiskCache::ReadEntry(
+  const std::string& key, std::vector<vtkSmartPointer<vtkDataObject>>& outputs)
+{
+  outputs.clear();
+  auto entry = this->SpillInternals->Entries.find(key);
+  if (entry == this->SpillInternals->Entries.end())
+  {
+    return false;
+  }
+
+  vtkNew<vtkGenericDataObjectReader> reader;
+  reader->ReadAllScalarsOn();
+  reader->ReadAllVectorsOn();
+  reader->ReadAllNormalsOn();
+  reader->ReadAllTensorsOn();
+  reader->ReadAllColorScalarsOn();
+  reader->ReadAllTCoordsOn();
+  reader->ReadAllFieldsOn();
+  for (int i = 0; i < static_cast<int>(entry->second.size()); ++i)
+  {
+    const std::string fileName = this->GetEntryFileName(key, i);
+    reader->SetFileName(fileName.c_str());
+    reader->Update();
+    vtkDataObject* output = reader->GetOutputDataObject(0);
+    const auto& spilled = entry->second[i];
+    if (!output || !output->IsA(spilled.Prototype->GetClassName()))
+    {
+      outputs.clear();
+      return false;
+    }
+    // The reader may produce a subclass: vtkStructuredPoints for image data.
+    auto copy = vtk::TakeSmartPointer(spilled.Prototype->NewInstance());
+    copy->ShallowCopy(output);
+    CopyInformation(spilled.Information, copy->GetInformation());
+    outputs.push_back(copy);
+  }
+  return !outputs.empty();
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineResultDiskCache::RemoveEntry(const std::string& key)
+{
+  for (int i = 0;; ++i)
+  {
+    const std::string fileName = this->GetEntryFileName(key, i);
+    if (!vtksys::SystemTools::FileExists(fileName, true))
+    {
+      break;
+    }
+    vtksys::SystemTools::RemoveFile(fileName);
+  }
+  this->SpillInternals->Entries.erase(key);
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineResultDiskCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Spill Directory: " << (this->SpillDirectory ? this->SpillDirectory : "(none)")
+     << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPipelineResultDiskCache
+ * @brief   cache of algorithm outputs spilling to disk
+ *
+ * vtkPipelineResultDiskCache is a vtkPipelineResultCache that writes the
+ * entries evicted from memory to legacy VTK files in SpillDirectory, instead
+ * of discarding them. They are read back when an executive looks for them,
+ * which is usually much faster than executing an expensive algorithm again.
+ * The spilled entries are bounded by DiskLimit, and their files are removed
+ * when they are evicted from disk or read back, and when the cache is
+ * destroyed.
+ *
+ * Entries are not spilled while SpillDirectory is not set. Each cache should
+ * use its own directory, since the file names only depend on the keys.
+ *
+ * Only the outputs that the legacy format holds without loss are spilled:
+ * poly data, unstructured, structured and rectilinear grids, image data with
+ * an identity direction matrix, and tables, whose arrays are named data or
+ * string arrays with information keys the legacy writer supports. Entries
+ * with other outputs, such as composite data sets, are discarded when they
+ * are evicted. The information of the spilled outputs, e.g. their time step,
+ * is kept in memory.
+ *
+ * @sa
+ * vtkCachedCompositeDataPipeline vtkDataWriter
+ */
+
+#ifndef vtkPipelineResultDiskCache_h
+#define vtkPipelineResultDiskCache_h
+
+#include "vtkIOLegacyModule.h" // For export macro
+#include "vtkPipelineResultCache.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKIOLEGACY_EXPORT vtkPipelineResultDiskCache : public vtkPipelineResultCache
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, obtaining type information, and
+   * printing the state of the object.
+   */
+  static vtkPipelineResultDiskCache* New();
+  vtkTypeMacro(vtkPipelineResultDiskCache, vtkPipelineResultCache);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the directory where the evicted entries are written. It is
+   * created if needed. By default this is not set, and the evicted entries
+   * are discarded.
+   */
+  vtkSetFilePathMacro(SpillDirectory);
+  vtkGetFilePathMacro(SpillDirectory);
+  ///@}
+
+protected:
+  vtkPipelineResultDiskCache();
+  ~vtkPipelineResultDiskCache() override;
+
+#ifndef __VTK_WRAP__
+  unsigned long WriteEntry(
+    const std::string& key, const std::vector<vtkSmartPointer<vtkDataObject>>& outputs) override;
+  bool ReadEntry(
+    const std::string& key, std::vector<vtkSmartPointer<vtkDataObject>>& outputs) override;
+  void RemoveEntry(const std::string& key) override;
+#endif
+
+  /**
+   * Return the name of the file of an output of an entry.
+   */
+  std::string GetEntryFileName(const std::string& key, int index);
+
+  char* SpillDirectory;
+
+private:
+  struct vtkSpillInternals;
+  vtkSpillInternals* SpillInternals;
+
+  vtkPipelineResultDiskCache(const vtkPipelineResultDiskCache&) = delete;
+  void operator=(const vtkPipelineResultDiskCache&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif